@@ -13,6 +13,19 @@
 #include "common/common_types.h"
 #include "common/logging/log.h"
 
+#if _MSC_VER
+#include <intrin.h>
+#if _M_AMD64
+#define __x86_64__ 1
+#endif
+#else
+#if __x86_64__
+#include <emmintrin.h>
+#elif __aarch64__
+#include <arm_neon.h>
+#endif
+#endif
+
 namespace AudioCore {
 
 constexpr std::array<s16, 512> curve_lut0{
@@ -210,8 +223,54 @@ void Resample(s32* output, const s32* input, s32 pitch, s32& fraction, std::size
     }();
 
     std::size_t index{};
+    std::size_t i = 0;
+
+#if __x86_64__
+    // Evaluate the four-tap filter for four output samples at once. The input positions have
+    // to be walked scalarly since every output reads from a data-dependent window, but the
+    // samples only span the PCM16 range so they pack losslessly into the 16-bit multiplies
+    for (; i + 4 <= sample_count; i += 4) {
+        std::array<std::size_t, 4> indices;
+        std::array<std::size_t, 4> phases;
+        for (std::size_t j = 0; j < 4; j++) {
+            phases[j] = (static_cast<std::size_t>(fraction) >> 8) * 4;
+            indices[j] = index;
+            fraction += pitch;
+            index += (fraction >> 15);
+            fraction &= 0x7fff;
+        }
+        const __m128i s01 =
+            _mm_packs_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + indices[0])),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + indices[1])));
+        const __m128i s23 =
+            _mm_packs_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + indices[2])),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + indices[3])));
+        const __m128i l01 = _mm_unpacklo_epi64(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut.data() + phases[0])),
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut.data() + phases[1])));
+        const __m128i l23 = _mm_unpacklo_epi64(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut.data() + phases[2])),
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut.data() + phases[3])));
+        // Each madd yields the two partial tap sums of two output samples
+        const __m128i m01 = _mm_shuffle_epi32(_mm_madd_epi16(s01, l01), _MM_SHUFFLE(3, 1, 2, 0));
+        const __m128i m23 = _mm_shuffle_epi32(_mm_madd_epi16(s23, l23), _MM_SHUFFLE(3, 1, 2, 0));
+        const __m128i sums = _mm_add_epi32(_mm_unpacklo_epi64(m01, m23),
+                                           _mm_unpackhi_epi64(m01, m23));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_srai_epi32(sums, 15));
+    }
+#elif __aarch64__
+    for (; i < sample_count; i++) {
+        const std::size_t lut_index{(static_cast<std::size_t>(fraction) >> 8) * 4};
+        const int16x4_t coeffs = vld1_s16(lut.data() + lut_index);
+        const int16x4_t samples = vqmovn_s32(vld1q_s32(input + index));
+        output[i] = vaddvq_s32(vmull_s16(samples, coeffs)) >> 15;
+        fraction += pitch;
+        index += (fraction >> 15);
+        fraction &= 0x7fff;
+    }
+#endif
 
-    for (std::size_t i = 0; i < sample_count; i++) {
+    for (; i < sample_count; i++) {
         const std::size_t lut_index{(static_cast<std::size_t>(fraction) >> 8) * 4};
         const auto l0 = lut[lut_index + 0];
         const auto l1 = lut[lut_index + 1];
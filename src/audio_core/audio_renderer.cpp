@@ -11,6 +11,7 @@
 #include "audio_core/info_updater.h"
 #include "audio_core/voice_context.h"
 #include "common/logging/log.h"
+#include "common/thread.h"
 #include "core/memory.h"
 #include "core/settings.h"
 
@@ -92,9 +93,18 @@ AudioRenderer::AudioRenderer(Core::Timing::CoreTiming& core_timing, Core::Memory
     QueueMixedBuffer(1);
     QueueMixedBuffer(2);
     QueueMixedBuffer(3);
+
+    render_thread = std::thread(&AudioRenderer::RenderLoop, this);
 }
 
-AudioRenderer::~AudioRenderer() = default;
+AudioRenderer::~AudioRenderer() {
+    {
+        std::lock_guard lock{render_mutex};
+        render_stop = true;
+    }
+    render_cv.notify_one();
+    render_thread.join();
+}
 
 u32 AudioRenderer::GetSampleRate() const {
     return worker_params.sample_rate;
@@ -112,8 +122,15 @@ Stream::State AudioRenderer::GetStreamState() const {
     return stream->GetState();
 }
 
+std::size_t AudioRenderer::GetAndResetUnderrunCount() {
+    return stream->GetAndResetUnderrunCount();
+}
+
 ResultCode AudioRenderer::UpdateAudioRenderer(const std::vector<u8>& input_params,
                                               std::vector<u8>& output_params) {
+    // Keep the worker from mixing while the parameter block is applied; the lock is dropped
+    // before the released buffers are handed back to it
+    std::unique_lock lock{render_mutex};
 
     InfoUpdater info_updater{input_params, output_params, behavior_info};
 
@@ -195,6 +212,7 @@ ResultCode AudioRenderer::UpdateAudioRenderer(const std::vector<u8>& input_param
         return AudioCommon::Audren::ERR_INVALID_PARAMETERS;
     }
 
+    lock.unlock();
     ReleaseAndQueueBuffers();
 
     return RESULT_SUCCESS;
@@ -315,9 +333,28 @@ void AudioRenderer::QueueMixedBuffer(Buffer::Tag tag) {
 }
 
 void AudioRenderer::ReleaseAndQueueBuffers() {
-    const auto released_buffers{audio_out->GetTagsAndReleaseBuffers(stream)};
-    for (const auto& tag : released_buffers) {
-        QueueMixedBuffer(tag);
+    {
+        std::lock_guard lock{render_mutex};
+        render_requested = true;
+    }
+    render_cv.notify_one();
+}
+
+void AudioRenderer::RenderLoop() {
+    Common::SetCurrentThreadName("yuzu:AudioRenderer");
+
+    std::unique_lock lock{render_mutex};
+    while (true) {
+        render_cv.wait(lock, [this] { return render_requested || render_stop; });
+        if (render_stop) {
+            break;
+        }
+        render_requested = false;
+
+        const auto released_buffers{audio_out->GetTagsAndReleaseBuffers(stream)};
+        for (const auto& tag : released_buffers) {
+            QueueMixedBuffer(tag);
+        }
     }
 }
 
@@ -5,7 +5,10 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "audio_core/behavior_info.h"
@@ -51,8 +54,11 @@ public:
     [[nodiscard]] u32 GetSampleCount() const;
     [[nodiscard]] u32 GetMixBufferCount() const;
     [[nodiscard]] Stream::State GetStreamState() const;
+    std::size_t GetAndResetUnderrunCount();
 
 private:
+    void RenderLoop();
+
     BehaviorInfo behavior_info{};
 
     AudioCommon::AudioRendererParameter worker_params;
@@ -68,6 +74,13 @@ private:
     Core::Memory::Memory& memory;
     CommandGenerator command_generator;
     std::size_t elapsed_frame_count{};
+    /// Guards all renderer state shared between the service-facing update path and the worker
+    /// thread that mixes released buffers
+    std::mutex render_mutex;
+    std::condition_variable render_cv;
+    bool render_requested{false};
+    bool render_stop{false};
+    std::thread render_thread;
 };
 
 } // namespace AudioCore
@@ -9,24 +9,101 @@
 #include "audio_core/voice_context.h"
 #include "core/memory.h"
 
+#if _MSC_VER
+#include <intrin.h>
+#if _M_AMD64
+#define __x86_64__ 1
+#endif
+#else
+#if __x86_64__
+#include <emmintrin.h>
+#elif __aarch64__
+#include <arm_neon.h>
+#endif
+#endif
+
 namespace AudioCore {
 namespace {
 constexpr std::size_t MIX_BUFFER_SIZE = 0x3f00;
 constexpr std::size_t SCALED_MIX_BUFFER_SIZE = MIX_BUFFER_SIZE << 15ULL;
 
-template <std::size_t N>
+#if __x86_64__
+// Multiplies the signed 32-bit values in the even lanes of a and b into 64-bit products
+__m128i MultiplyS32(__m128i a, __m128i b) {
+    const __m128i product = _mm_mul_epu32(a, b);
+    const __m128i correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                                             _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi64(product, _mm_slli_epi64(correction, 32));
+}
+#endif
+
 void ApplyMix(s32* output, const s32* input, s32 gain, s32 sample_count) {
-    for (std::size_t i = 0; i < static_cast<std::size_t>(sample_count); i += N) {
-        for (std::size_t j = 0; j < N; j++) {
-            output[i + j] +=
-                static_cast<s32>((static_cast<s64>(input[i + j]) * gain + 0x4000) >> 15);
-        }
+    s32 i = 0;
+#if __x86_64__
+    const __m128i gain_vec = _mm_set1_epi32(gain);
+    const __m128i round = _mm_set1_epi64x(0x4000);
+    const __m128i low_mask = _mm_set1_epi64x(0xffffffff);
+    for (; i + 4 <= sample_count; i += 4) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i out = _mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i));
+        const __m128i even =
+            _mm_srli_epi64(_mm_add_epi64(MultiplyS32(in, gain_vec), round), 15);
+        const __m128i odd = _mm_srli_epi64(
+            _mm_add_epi64(MultiplyS32(_mm_srli_epi64(in, 32), gain_vec), round), 15);
+        const __m128i mixed = _mm_or_si128(_mm_and_si128(even, low_mask), _mm_slli_epi64(odd, 32));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_add_epi32(out, mixed));
+    }
+#elif __aarch64__
+    const int32x2_t gain_vec = vdup_n_s32(gain);
+    for (; i + 4 <= sample_count; i += 4) {
+        const int32x4_t in = vld1q_s32(input + i);
+        const int64x2_t lo = vmull_s32(vget_low_s32(in), gain_vec);
+        const int64x2_t hi = vmull_s32(vget_high_s32(in), gain_vec);
+        const int32x4_t mixed = vcombine_s32(vrshrn_n_s64(lo, 15), vrshrn_n_s64(hi, 15));
+        vst1q_s32(output + i, vaddq_s32(vld1q_s32(output + i), mixed));
+    }
+#endif
+    for (; i < sample_count; i++) {
+        output[i] += static_cast<s32>((static_cast<s64>(input[i]) * gain + 0x4000) >> 15);
     }
 }
 
 s32 ApplyMixRamp(s32* output, const s32* input, float gain, float delta, s32 sample_count) {
     s32 x = 0;
-    for (s32 i = 0; i < sample_count; i++) {
+    s32 i = 0;
+#if __x86_64__
+    __m128 gain_vec = _mm_setr_ps(gain, gain + delta, gain + delta * 2.0f, gain + delta * 3.0f);
+    const __m128 step = _mm_set1_ps(delta * 4.0f);
+    __m128i mixed = _mm_setzero_si128();
+    for (; i + 4 <= sample_count; i += 4) {
+        const __m128 in =
+            _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+        const __m128i out = _mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i));
+        mixed = _mm_cvttps_epi32(_mm_mul_ps(in, gain_vec));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_add_epi32(out, mixed));
+        gain_vec = _mm_add_ps(gain_vec, step);
+    }
+    if (i > 0) {
+        x = _mm_cvtsi128_si32(_mm_shuffle_epi32(mixed, _MM_SHUFFLE(3, 3, 3, 3)));
+        gain += delta * static_cast<float>(i);
+    }
+#elif __aarch64__
+    const float32x4_t ramp = {0.0f, 1.0f, 2.0f, 3.0f};
+    float32x4_t gain_vec = vaddq_f32(vdupq_n_f32(gain), vmulq_n_f32(ramp, delta));
+    const float32x4_t step = vdupq_n_f32(delta * 4.0f);
+    int32x4_t mixed = vdupq_n_s32(0);
+    for (; i + 4 <= sample_count; i += 4) {
+        const float32x4_t in = vcvtq_f32_s32(vld1q_s32(input + i));
+        mixed = vcvtq_s32_f32(vmulq_f32(in, gain_vec));
+        vst1q_s32(output + i, vaddq_s32(vld1q_s32(output + i), mixed));
+        gain_vec = vaddq_f32(gain_vec, step);
+    }
+    if (i > 0) {
+        x = vgetq_lane_s32(mixed, 3);
+        gain += delta * static_cast<float>(i);
+    }
+#endif
+    for (; i < sample_count; i++) {
         x = static_cast<s32>(static_cast<float>(input[i]) * gain);
         output[i] += x;
         gain += delta;
@@ -35,16 +112,44 @@ s32 ApplyMixRamp(s32* output, const s32* input, float gain, float delta, s32 sam
 }
 
 void ApplyGain(s32* output, const s32* input, s32 gain, s32 delta, s32 sample_count) {
-    for (s32 i = 0; i < sample_count; i++) {
+    s32 i = 0;
+#if __x86_64__
+    __m128i gain_vec = _mm_setr_epi32(gain, gain + delta, gain + delta * 2, gain + delta * 3);
+    const __m128i step = _mm_set1_epi32(delta * 4);
+    const __m128i round = _mm_set1_epi64x(0x4000);
+    const __m128i low_mask = _mm_set1_epi64x(0xffffffff);
+    for (; i + 4 <= sample_count; i += 4) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i even =
+            _mm_srli_epi64(_mm_add_epi64(MultiplyS32(in, gain_vec), round), 15);
+        const __m128i odd = _mm_srli_epi64(
+            _mm_add_epi64(MultiplyS32(_mm_srli_epi64(in, 32), _mm_srli_epi64(gain_vec, 32)), round),
+            15);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                         _mm_or_si128(_mm_and_si128(even, low_mask), _mm_slli_epi64(odd, 32)));
+        gain_vec = _mm_add_epi32(gain_vec, step);
+    }
+    gain += delta * i;
+#elif __aarch64__
+    int32x4_t gain_vec = {gain, gain + delta, gain + delta * 2, gain + delta * 3};
+    const int32x4_t step = vdupq_n_s32(delta * 4);
+    for (; i + 4 <= sample_count; i += 4) {
+        const int32x4_t in = vld1q_s32(input + i);
+        const int64x2_t lo = vmull_s32(vget_low_s32(in), vget_low_s32(gain_vec));
+        const int64x2_t hi = vmull_s32(vget_high_s32(in), vget_high_s32(gain_vec));
+        vst1q_s32(output + i, vcombine_s32(vrshrn_n_s64(lo, 15), vrshrn_n_s64(hi, 15)));
+        gain_vec = vaddq_s32(gain_vec, step);
+    }
+    gain += delta * i;
+#endif
+    for (; i < sample_count; i++) {
         output[i] = static_cast<s32>((static_cast<s64>(input[i]) * gain + 0x4000) >> 15);
         gain += delta;
     }
 }
 
 void ApplyGainWithoutDelta(s32* output, const s32* input, s32 gain, s32 sample_count) {
-    for (s32 i = 0; i < sample_count; i++) {
-        output[i] = static_cast<s32>((static_cast<s64>(input[i]) * gain + 0x4000) >> 15);
-    }
+    ApplyGain(output, input, gain, 0, sample_count);
 }
 
 s32 ApplyMixDepop(s32* output, s32 first_sample, s32 delta, s32 sample_count) {
@@ -90,8 +195,9 @@ void CommandGenerator::GenerateVoiceCommands() {
     if (dumping_frame) {
         LOG_DEBUG(Audio, "(DSP_TRACE) GenerateVoiceCommands");
     }
-    // Grab all our voices
-    const auto voice_count = voice_context.GetVoiceCount();
+    // Only the voices that were audible at sort time sit at the front of the sorted list; the
+    // silent remainder never generates commands
+    const auto voice_count = voice_context.GetActiveVoiceCount();
     for (std::size_t i = 0; i < voice_count; i++) {
         auto& voice_info = voice_context.GetSortedInfo(i);
         // Update voices and check if we should queue them
@@ -387,7 +493,7 @@ void CommandGenerator::GenerateI3dl2ReverbEffectCommand(s32 mix_buffer_offset, E
         if (params.input[i] != params.output[i]) {
             const auto* input = GetMixBuffer(mix_buffer_offset + params.input[i]);
             auto* output = GetMixBuffer(mix_buffer_offset + params.output[i]);
-            ApplyMix<1>(output, input, 32768, worker_params.sample_count);
+            ApplyMix(output, input, 32768, worker_params.sample_count);
         }*/
         auto* output = GetMixBuffer(mix_buffer_offset + params.output[i]);
         std::memset(output, 0, worker_params.sample_count * sizeof(s32));
@@ -406,7 +512,7 @@ void CommandGenerator::GenerateBiquadFilterEffectCommand(s32 mix_buffer_offset,
         if (params.input[i] != params.output[i]) {
             const auto* input = GetMixBuffer(mix_buffer_offset + params.input[i]);
             auto* output = GetMixBuffer(mix_buffer_offset + params.output[i]);
-            ApplyMix<1>(output, input, 32768, worker_params.sample_count);
+            ApplyMix(output, input, 32768, worker_params.sample_count);
         }
     }
 }
@@ -643,14 +749,7 @@ void CommandGenerator::GenerateMixCommand(std::size_t output_offset, std::size_t
     const auto* input = GetMixBuffer(input_offset);
 
     const s32 gain = static_cast<s32>(volume * 32768.0f);
-    // Mix with loop unrolling
-    if (worker_params.sample_count % 4 == 0) {
-        ApplyMix<4>(output, input, gain, worker_params.sample_count);
-    } else if (worker_params.sample_count % 2 == 0) {
-        ApplyMix<2>(output, input, gain, worker_params.sample_count);
-    } else {
-        ApplyMix<1>(output, input, gain, worker_params.sample_count);
-    }
+    ApplyMix(output, input, gain, worker_params.sample_count);
 }
 
 void CommandGenerator::GenerateFinalMixCommand() {
@@ -702,18 +801,20 @@ s32 CommandGenerator::DecodePcm16(ServerVoiceInfo& voice_info, VoiceState& dsp_s
     const auto samples_processed = std::min(sample_count, samples_remaining);
 
     if (in_params.channel_count == 1) {
-        std::vector<s16> buffer(samples_processed);
-        memory.ReadBlock(buffer_pos, buffer.data(), buffer.size() * sizeof(s16));
-        for (std::size_t i = 0; i < buffer.size(); i++) {
-            sample_buffer[mix_offset + i] = buffer[i];
+        pcm16_read_buffer.resize(static_cast<std::size_t>(samples_processed));
+        memory.ReadBlock(buffer_pos, pcm16_read_buffer.data(),
+                         pcm16_read_buffer.size() * sizeof(s16));
+        for (std::size_t i = 0; i < pcm16_read_buffer.size(); i++) {
+            sample_buffer[mix_offset + i] = pcm16_read_buffer[i];
         }
     } else {
         const auto channel_count = in_params.channel_count;
-        std::vector<s16> buffer(samples_processed * channel_count);
-        memory.ReadBlock(buffer_pos, buffer.data(), buffer.size() * sizeof(s16));
+        pcm16_read_buffer.resize(static_cast<std::size_t>(samples_processed * channel_count));
+        memory.ReadBlock(buffer_pos, pcm16_read_buffer.data(),
+                         pcm16_read_buffer.size() * sizeof(s16));
 
         for (std::size_t i = 0; i < static_cast<std::size_t>(samples_processed); i++) {
-            sample_buffer[mix_offset + i] = buffer[i * channel_count + channel];
+            sample_buffer[mix_offset + i] = pcm16_read_buffer[i * channel_count + channel];
         }
     }
 
@@ -745,7 +846,7 @@ s32 CommandGenerator::DecodeAdpcm(ServerVoiceInfo& voice_info, VoiceState& dsp_s
 
     auto frame_header = dsp_state.context.header;
     s32 idx = (frame_header >> 4) & 0xf;
-    s32 scale = frame_header & 0xf;
+    s32 scale = 1 << (frame_header & 0xf);
     s16 yn1 = dsp_state.context.yn1;
     s16 yn2 = dsp_state.context.yn2;
 
@@ -766,7 +867,7 @@ s32 CommandGenerator::DecodeAdpcm(ServerVoiceInfo& voice_info, VoiceState& dsp_s
                              samples_remaining_in_frame + (samples_remaining_in_frame != 0 ? 2 : 0);
 
     const auto decode_sample = [&](const int nibble) -> s16 {
-        const int xn = nibble * (1 << scale);
+        const int xn = nibble * scale;
         // We first transform everything into 11 bit fixed point, perform the second order
         // digital filter, then transform back.
         // 0x400 == 0.5 in 11 bit fixed point.
@@ -781,19 +882,19 @@ s32 CommandGenerator::DecodeAdpcm(ServerVoiceInfo& voice_info, VoiceState& dsp_s
     };
 
     std::size_t buffer_offset{};
-    std::vector<u8> buffer(
+    adpcm_read_buffer.resize(
         std::max((samples_processed / FRAME_LEN) * SAMPLES_PER_FRAME, FRAME_LEN));
-    memory.ReadBlock(wave_buffer.buffer_address + (position_in_frame / 2), buffer.data(),
-                     buffer.size());
+    memory.ReadBlock(wave_buffer.buffer_address + (position_in_frame / 2),
+                     adpcm_read_buffer.data(), adpcm_read_buffer.size());
     std::size_t cur_mix_offset = mix_offset;
 
     auto remaining_samples = samples_processed;
     while (remaining_samples > 0) {
         if (position_in_frame % NIBBLES_PER_SAMPLE == 0) {
             // Read header
-            frame_header = buffer[buffer_offset++];
+            frame_header = adpcm_read_buffer[buffer_offset++];
             idx = (frame_header >> 4) & 0xf;
-            scale = frame_header & 0xf;
+            scale = 1 << (frame_header & 0xf);
             coef1 = coeffs[idx * 2];
             coef2 = coeffs[idx * 2 + 1];
             position_in_frame += 2;
@@ -802,8 +903,8 @@ s32 CommandGenerator::DecodeAdpcm(ServerVoiceInfo& voice_info, VoiceState& dsp_s
             if (remaining_samples >= static_cast<int>(SAMPLES_PER_FRAME)) {
                 for (std::size_t i = 0; i < SAMPLES_PER_FRAME / 2; i++) {
                     // Sample 1
-                    const s32 s0 = SIGNED_NIBBLES[buffer[buffer_offset] >> 4];
-                    const s32 s1 = SIGNED_NIBBLES[buffer[buffer_offset++] & 0xf];
+                    const s32 s0 = SIGNED_NIBBLES[adpcm_read_buffer[buffer_offset] >> 4];
+                    const s32 s1 = SIGNED_NIBBLES[adpcm_read_buffer[buffer_offset++] & 0xf];
                     const s16 sample_1 = decode_sample(s0);
                     const s16 sample_2 = decode_sample(s1);
                     sample_buffer[cur_mix_offset++] = sample_1;
@@ -815,7 +916,7 @@ s32 CommandGenerator::DecodeAdpcm(ServerVoiceInfo& voice_info, VoiceState& dsp_s
             }
         }
         // Decode mid frame
-        s32 current_nibble = buffer[buffer_offset];
+        s32 current_nibble = adpcm_read_buffer[buffer_offset];
         if (position_in_frame++ & 0x1) {
             current_nibble &= 0xf;
             buffer_offset++;
@@ -97,6 +97,10 @@ private:
     std::vector<s32> mix_buffer{};
     std::vector<s32> sample_buffer{};
     std::vector<s32> depop_buffer{};
+    // Scratch buffers for guest memory reads in the decoders, kept as members so the per-voice
+    // decode calls reuse their capacity instead of allocating every audio frame
+    std::vector<s16> pcm16_read_buffer{};
+    std::vector<u8> adpcm_read_buffer{};
     bool dumping_frame{false};
 };
 } // namespace AudioCore
@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include "audio_core/cubeb_sink.h"
 #include "audio_core/stream.h"
 #include "audio_core/time_stretch.h"
@@ -18,6 +20,34 @@
 #endif
 
 namespace AudioCore {
+namespace {
+
+/// Downmixes interleaved 5.1 PCM16 samples to stereo
+std::vector<s16> DownmixToStereo(const std::vector<s16>& samples) {
+    std::vector<s16> buf;
+    buf.reserve(samples.size() / 3);
+    for (std::size_t i = 0; i < samples.size(); i += 6) {
+        // Downmixing implementation taken from the ATSC standard
+        const s16 left{samples[i + 0]};
+        const s16 right{samples[i + 1]};
+        const s16 center{samples[i + 2]};
+        const s16 surround_left{samples[i + 4]};
+        const s16 surround_right{samples[i + 5]};
+        // Not used in the ATSC reference implementation
+        [[maybe_unused]] const s16 low_frequency_effects{samples[i + 3]};
+
+        constexpr s32 clev{707}; // center mixing level coefficient
+        constexpr s32 slev{707}; // surround mixing level coefficient
+
+        buf.push_back(
+            static_cast<s16>(left + (clev * center / 1000) + (slev * surround_left / 1000)));
+        buf.push_back(
+            static_cast<s16>(right + (clev * center / 1000) + (slev * surround_right / 1000)));
+    }
+    return buf;
+}
+
+} // Anonymous namespace
 
 class CubebSinkStream final : public SinkStream {
 public:
@@ -78,28 +108,7 @@ public:
         if (source_num_channels > num_channels) {
             // Downsample 6 channels to 2
             ASSERT_MSG(source_num_channels == 6, "Channel count must be 6");
-
-            std::vector<s16> buf;
-            buf.reserve(samples.size() * num_channels / source_num_channels);
-            for (std::size_t i = 0; i < samples.size(); i += source_num_channels) {
-                // Downmixing implementation taken from the ATSC standard
-                const s16 left{samples[i + 0]};
-                const s16 right{samples[i + 1]};
-                const s16 center{samples[i + 2]};
-                const s16 surround_left{samples[i + 4]};
-                const s16 surround_right{samples[i + 5]};
-                // Not used in the ATSC reference implementation
-                [[maybe_unused]] const s16 low_frequency_effects{samples[i + 3]};
-
-                constexpr s32 clev{707}; // center mixing level coefficient
-                constexpr s32 slev{707}; // surround mixing level coefficient
-
-                buf.push_back(static_cast<s16>(left + (clev * center / 1000) +
-                                               (slev * surround_left / 1000)));
-                buf.push_back(static_cast<s16>(right + (clev * center / 1000) +
-                                               (slev * surround_right / 1000)));
-            }
-            queue.Push(buf);
+            queue.Push(DownmixToStereo(samples));
             return;
         }
 
@@ -117,6 +126,10 @@ public:
         should_flush = true;
     }
 
+    std::size_t GetAndResetUnderrunCount() override {
+        return underrun_count.exchange(0);
+    }
+
     u32 GetNumChannels() const {
         return num_channels;
     }
@@ -131,6 +144,7 @@ private:
     Common::RingBuffer<s16, 0x10000> queue;
     std::array<s16, 2> last_frame{};
     std::atomic<bool> should_flush{};
+    std::atomic<std::size_t> underrun_count{};
     TimeStretcher time_stretch;
 
     static long DataCallback(cubeb_stream* stream, void* user_data, const void* input_buffer,
@@ -138,7 +152,195 @@ private:
     static void StateCallback(cubeb_stream* stream, void* user_data, cubeb_state state);
 };
 
-CubebSink::CubebSink(std::string_view target_device_name) {
+class CubebSessionStream;
+
+/// One OS stream shared by every session of the sink. Sessions enqueue into their own rings and
+/// the single device callback mixes them together with per-session gain.
+class CubebMixedDevice {
+public:
+    explicit CubebMixedDevice(cubeb* ctx_, cubeb_devid output_device_)
+        : ctx{ctx_}, output_device{output_device_} {}
+
+    ~CubebMixedDevice() {
+        if (!stream_backend) {
+            return;
+        }
+        if (cubeb_stream_stop(stream_backend) != CUBEB_OK) {
+            LOG_CRITICAL(Audio_Sink, "Error stopping cubeb stream");
+        }
+        cubeb_stream_destroy(stream_backend);
+    }
+
+    /// Creates a session mixing into the shared stream, opening the device stream on first use.
+    /// Returns nullptr when the session cannot share the stream and needs a dedicated one.
+    SinkStreamPtr CreateSession(u32 sample_rate, const std::string& name);
+
+    void Unregister(CubebSessionStream* session) {
+        std::lock_guard lock{session_mutex};
+        std::erase(sessions, session);
+    }
+
+private:
+    static long DataCallback(cubeb_stream* stream, void* user_data, const void* input_buffer,
+                             void* output_buffer, long num_frames);
+    static void StateCallback(cubeb_stream*, void*, cubeb_state) {}
+
+    bool Open(u32 sample_rate_, const std::string& name);
+
+    cubeb* ctx{};
+    cubeb_devid output_device{};
+    cubeb_stream* stream_backend{};
+    u32 sample_rate{};
+
+    std::mutex session_mutex;
+    std::vector<CubebSessionStream*> sessions;
+    std::vector<s32> mix_buffer;
+};
+
+/// A session on the shared device stream. Always stereo; surround input is downmixed on enqueue.
+class CubebSessionStream final : public SinkStream {
+public:
+    explicit CubebSessionStream(CubebMixedDevice& device_) : device{device_} {}
+
+    ~CubebSessionStream() override {
+        device.Unregister(this);
+    }
+
+    void EnqueueSamples(u32 source_num_channels, const std::vector<s16>& samples) override {
+        if (source_num_channels > 2) {
+            ASSERT_MSG(source_num_channels == 6, "Channel count must be 6");
+            queue.Push(DownmixToStereo(samples));
+            return;
+        }
+        if (source_num_channels == 1) {
+            std::vector<s16> buf;
+            buf.reserve(samples.size() * 2);
+            for (const s16 sample : samples) {
+                buf.push_back(sample);
+                buf.push_back(sample);
+            }
+            queue.Push(buf);
+            return;
+        }
+        queue.Push(samples);
+    }
+
+    std::size_t SamplesInQueue(u32 channel_count) const override {
+        return queue.Size() / channel_count;
+    }
+
+    void Flush() override {}
+
+    std::size_t GetAndResetUnderrunCount() override {
+        return underrun_count.exchange(0);
+    }
+
+    void SetGain(float new_gain) override {
+        gain = new_gain;
+    }
+
+    /// Accumulates this session into the stereo mix, padding with the last frame on underrun.
+    /// Called from the device callback.
+    void Render(s32* mix, std::size_t num_frames) {
+        staging.resize(num_frames * 2);
+        const std::size_t samples_written = queue.Pop(staging.data(), staging.size());
+        if (samples_written > 0 && samples_written < staging.size()) {
+            underrun_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (samples_written >= 2) {
+            last_frame[0] = staging[samples_written - 2];
+            last_frame[1] = staging[samples_written - 1];
+        }
+        for (std::size_t i = samples_written; i < staging.size(); i += 2) {
+            staging[i + 0] = last_frame[0];
+            staging[i + 1] = last_frame[1];
+        }
+        // Fixed point so the hot loop stays integer only
+        const s32 fixed_gain = static_cast<s32>(gain.load(std::memory_order_relaxed) * 1024.0f);
+        for (std::size_t i = 0; i < staging.size(); ++i) {
+            mix[i] += staging[i] * fixed_gain >> 10;
+        }
+    }
+
+private:
+    CubebMixedDevice& device;
+
+    Common::RingBuffer<s16, 0x10000> queue;
+    std::array<s16, 2> last_frame{};
+    std::atomic<std::size_t> underrun_count{};
+    std::atomic<float> gain{1.0f};
+    std::vector<s16> staging;
+};
+
+SinkStreamPtr CubebMixedDevice::CreateSession(u32 sample_rate_, const std::string& name) {
+    std::lock_guard lock{session_mutex};
+    if (!stream_backend) {
+        if (!Open(sample_rate_, name)) {
+            return nullptr;
+        }
+    } else if (sample_rate_ != sample_rate) {
+        // Mixing would need resampling; let the caller fall back to a dedicated stream
+        return nullptr;
+    }
+    auto session = std::make_unique<CubebSessionStream>(*this);
+    sessions.push_back(session.get());
+    return session;
+}
+
+bool CubebMixedDevice::Open(u32 sample_rate_, const std::string& name) {
+    cubeb_stream_params params{};
+    params.rate = sample_rate_;
+    params.channels = 2;
+    params.format = CUBEB_SAMPLE_S16NE;
+    params.prefs = CUBEB_STREAM_PREF_PERSIST;
+    params.layout = CUBEB_LAYOUT_STEREO;
+
+    u32 minimum_latency{};
+    if (cubeb_get_min_latency(ctx, &params, &minimum_latency) != CUBEB_OK) {
+        LOG_CRITICAL(Audio_Sink, "Error getting minimum latency");
+    }
+
+    if (cubeb_stream_init(ctx, &stream_backend, name.c_str(), nullptr, nullptr, output_device,
+                          &params, std::max(512u, minimum_latency),
+                          &CubebMixedDevice::DataCallback, &CubebMixedDevice::StateCallback,
+                          this) != CUBEB_OK) {
+        LOG_CRITICAL(Audio_Sink, "Error initializing shared cubeb stream");
+        stream_backend = nullptr;
+        return false;
+    }
+    if (cubeb_stream_start(stream_backend) != CUBEB_OK) {
+        LOG_CRITICAL(Audio_Sink, "Error starting shared cubeb stream");
+        cubeb_stream_destroy(stream_backend);
+        stream_backend = nullptr;
+        return false;
+    }
+    sample_rate = sample_rate_;
+    return true;
+}
+
+long CubebMixedDevice::DataCallback([[maybe_unused]] cubeb_stream* stream, void* user_data,
+                                    [[maybe_unused]] const void* input_buffer, void* output_buffer,
+                                    long num_frames) {
+    auto* impl = static_cast<CubebMixedDevice*>(user_data);
+    auto* out = static_cast<s16*>(output_buffer);
+    if (!impl) {
+        return {};
+    }
+    const std::size_t num_samples = static_cast<std::size_t>(num_frames) * 2;
+    impl->mix_buffer.assign(num_samples, 0);
+    {
+        std::lock_guard lock{impl->session_mutex};
+        for (CubebSessionStream* session : impl->sessions) {
+            session->Render(impl->mix_buffer.data(), static_cast<std::size_t>(num_frames));
+        }
+    }
+    for (std::size_t i = 0; i < num_samples; ++i) {
+        out[i] = static_cast<s16>(std::clamp<s32>(impl->mix_buffer[i], -32768, 32767));
+    }
+    return num_frames;
+}
+
+CubebSink::CubebSink(std::string_view target_device_name, bool use_shared_stream) {
     // Cubeb requires COM to be initialized on the thread calling cubeb_init on Windows
 #ifdef _WIN32
     com_init_result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
@@ -166,6 +368,10 @@ CubebSink::CubebSink(std::string_view target_device_name) {
             cubeb_device_collection_destroy(ctx, &collection);
         }
     }
+
+    if (use_shared_stream) {
+        shared_device = std::make_unique<CubebMixedDevice>(ctx, output_device);
+    }
 }
 
 CubebSink::~CubebSink() {
@@ -176,6 +382,7 @@ CubebSink::~CubebSink() {
     for (auto& sink_stream : sink_streams) {
         sink_stream.reset();
     }
+    shared_device.reset();
 
     cubeb_destroy(ctx);
 
@@ -188,6 +395,13 @@ CubebSink::~CubebSink() {
 
 SinkStream& CubebSink::AcquireSinkStream(u32 sample_rate, u32 num_channels,
                                          const std::string& name) {
+    if (shared_device) {
+        if (auto session = shared_device->CreateSession(sample_rate, name)) {
+            sink_streams.push_back(std::move(session));
+            return *sink_streams.back();
+        }
+        LOG_WARNING(Audio_Sink, "Session cannot share the device stream, using a dedicated one");
+    }
     sink_streams.push_back(
         std::make_unique<CubebSinkStream>(ctx, sample_rate, num_channels, output_device, name));
     return *sink_streams.back();
@@ -225,6 +439,12 @@ long CubebSinkStream::DataCallback([[maybe_unused]] cubeb_stream* stream, void*
     }*/
     samples_written = impl->queue.Pop(buffer, samples_to_write);
 
+    if (samples_written > 0 && samples_written < samples_to_write) {
+        // The queue ran dry mid-buffer. A completely empty queue usually just means the
+        // emulated game is not outputting audio right now, so it is not counted
+        impl->underrun_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
     if (samples_written >= num_channels) {
         std::memcpy(&impl->last_frame[0], buffer + (samples_written - num_channels) * sizeof(s16),
                     num_channels * sizeof(s16));
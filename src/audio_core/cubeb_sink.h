@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -13,9 +14,11 @@
 
 namespace AudioCore {
 
+class CubebMixedDevice;
+
 class CubebSink final : public Sink {
 public:
-    explicit CubebSink(std::string_view device_id);
+    explicit CubebSink(std::string_view device_id, bool use_shared_stream = false);
     ~CubebSink() override;
 
     SinkStream& AcquireSinkStream(u32 sample_rate, u32 num_channels,
@@ -24,6 +27,7 @@ public:
 private:
     cubeb* ctx{};
     cubeb_devid output_device{};
+    std::unique_ptr<CubebMixedDevice> shared_device;
     std::vector<SinkStreamPtr> sink_streams;
 
 #ifdef _WIN32
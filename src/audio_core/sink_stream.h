@@ -29,6 +29,16 @@ public:
     virtual std::size_t SamplesInQueue(u32 num_channels) const = 0;
 
     virtual void Flush() = 0;
+
+    /// Returns the number of times the sink ran out of queued samples since the last call,
+    /// resetting the count
+    virtual std::size_t GetAndResetUnderrunCount() {
+        return 0;
+    }
+
+    /// Sets the mixing gain applied to this stream on sinks that mix several streams into one
+    /// shared device stream. Has no effect on dedicated streams.
+    virtual void SetGain(float) {}
 };
 
 using SinkStreamPtr = std::unique_ptr<SinkStream>;
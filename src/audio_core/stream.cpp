@@ -67,6 +67,10 @@ Stream::State Stream::GetState() const {
     return state;
 }
 
+std::size_t Stream::GetAndResetUnderrunCount() {
+    return sink_stream.GetAndResetUnderrunCount();
+}
+
 std::chrono::nanoseconds Stream::GetBufferReleaseNS(const Buffer& buffer) const {
     const std::size_t num_samples{buffer.GetSamples().size() / GetNumChannels()};
     return std::chrono::nanoseconds((static_cast<u64>(num_samples) * 1000000000ULL) / sample_rate);
@@ -95,6 +95,9 @@ public:
     /// Get the state
     [[nodiscard]] State GetState() const;
 
+    /// Returns the number of sink underruns since the last call, resetting the count
+    std::size_t GetAndResetUnderrunCount();
+
 private:
     /// Plays the next queued buffer in the audio stream, starting playback if necessary
     void PlayNextBuffer(std::chrono::nanoseconds ns_late = {});
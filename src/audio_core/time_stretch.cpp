@@ -7,6 +7,7 @@
 #include <cstddef>
 #include "audio_core/time_stretch.h"
 #include "common/logging/log.h"
+#include "core/settings.h"
 
 namespace AudioCore {
 
@@ -15,6 +16,33 @@ TimeStretcher::TimeStretcher(u32 sample_rate, u32 channel_count) : m_sample_rate
     m_sound_touch.setSampleRate(sample_rate);
     m_sound_touch.setPitch(1.0);
     m_sound_touch.setTempo(1.0);
+
+    // Pin the analysis windows instead of leaving SoundTouch in automatic mode, where they are
+    // derived again after every tempo change. Process adjusts the tempo continuously, so the
+    // automatic mode redid the window setup once per audio callback.
+    switch (Settings::values.audio_stretching_quality) {
+    case Settings::AudioStretchingQuality::Fast:
+        m_sound_touch.setSetting(SETTING_USE_QUICKSEEK, 1);
+        m_sound_touch.setSetting(SETTING_USE_AA_FILTER, 0);
+        m_sound_touch.setSetting(SETTING_SEQUENCE_MS, 30);
+        m_sound_touch.setSetting(SETTING_SEEKWINDOW_MS, 15);
+        m_sound_touch.setSetting(SETTING_OVERLAP_MS, 8);
+        break;
+    case Settings::AudioStretchingQuality::Balanced:
+        m_sound_touch.setSetting(SETTING_USE_QUICKSEEK, 1);
+        m_sound_touch.setSetting(SETTING_USE_AA_FILTER, 1);
+        m_sound_touch.setSetting(SETTING_SEQUENCE_MS, 40);
+        m_sound_touch.setSetting(SETTING_SEEKWINDOW_MS, 15);
+        m_sound_touch.setSetting(SETTING_OVERLAP_MS, 8);
+        break;
+    case Settings::AudioStretchingQuality::High:
+        m_sound_touch.setSetting(SETTING_USE_QUICKSEEK, 0);
+        m_sound_touch.setSetting(SETTING_USE_AA_FILTER, 1);
+        m_sound_touch.setSetting(SETTING_SEQUENCE_MS, 40);
+        m_sound_touch.setSetting(SETTING_SEEKWINDOW_MS, 28);
+        m_sound_touch.setSetting(SETTING_OVERLAP_MS, 12);
+        break;
+    }
 }
 
 void TimeStretcher::Clear() {
@@ -56,7 +84,13 @@ std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
     // Place a lower limit of 5% speed. When a game boots up, there will be
     // many silence samples. These do not need to be timestretched.
     m_stretch_ratio = std::max(m_stretch_ratio, 0.05);
-    m_sound_touch.setTempo(m_stretch_ratio);
+
+    // Applying a tempo reinitializes the transposition stage, so skip it while the smoothed
+    // ratio is within 0.1% of the one already in effect
+    if (std::abs(m_stretch_ratio - m_applied_ratio) > m_applied_ratio * 0.001) {
+        m_sound_touch.setTempo(m_stretch_ratio);
+        m_applied_ratio = m_stretch_ratio;
+    }
 
     LOG_TRACE(Audio, "{:5}/{:5} ratio:{:0.6f} backlog:{:0.6f}", num_in, num_out, m_stretch_ratio,
               backlog_fullness);
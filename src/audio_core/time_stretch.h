@@ -29,6 +29,7 @@ private:
     u32 m_sample_rate;
     soundtouch::SoundTouch m_sound_touch;
     double m_stretch_ratio = 1.0;
+    double m_applied_ratio = 1.0;
 };
 
 } // namespace AudioCore
@@ -2,6 +2,8 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+
 #include "audio_core/behavior_info.h"
 #include "audio_core/voice_context.h"
 #include "core/memory.h"
@@ -504,12 +506,45 @@ s32 VoiceContext::DecodePcm16(s32* output_buffer, ServerWaveBuffer* wave_buffer,
     return samples_processed;
 }
 
+std::size_t VoiceContext::GetActiveVoiceCount() const {
+    return active_voice_count;
+}
+
 void VoiceContext::SortInfo() {
+    // Voices only change between renderer updates, so the previous ordering can be kept while
+    // the sort keys and the set of audible voices stay the same
+    bool dirty = sort_keys.size() != voice_count;
+    if (!dirty) {
+        for (std::size_t i = 0; i < voice_count; i++) {
+            const auto& in = voice_info[i].GetInParams();
+            const auto& key = sort_keys[i];
+            if (key.priority != in.priority || key.sorting_order != in.sorting_order ||
+                key.audible == voice_info[i].ShouldSkip()) {
+                dirty = true;
+                break;
+            }
+        }
+    }
+    if (!dirty) {
+        return;
+    }
+
+    sort_keys.resize(voice_count);
     for (std::size_t i = 0; i < voice_count; i++) {
+        const auto& in = voice_info[i].GetInParams();
         sorted_voice_info[i] = &voice_info[i];
+        sort_keys[i] = SortKey{in.priority, in.sorting_order, !voice_info[i].ShouldSkip()};
     }
 
-    std::sort(sorted_voice_info.begin(), sorted_voice_info.end(),
+    // Keep the audible voices at the front so command generation does not have to walk the
+    // silent ones every frame
+    const auto audible_end =
+        std::partition(sorted_voice_info.begin(), sorted_voice_info.end(),
+                       [](const ServerVoiceInfo* info) { return !info->ShouldSkip(); });
+    active_voice_count =
+        static_cast<std::size_t>(std::distance(sorted_voice_info.begin(), audible_end));
+
+    std::sort(sorted_voice_info.begin(), audible_end,
               [](const ServerVoiceInfo* lhs, const ServerVoiceInfo* rhs) {
                   const auto& lhs_in = lhs->GetInParams();
                   const auto& rhs_in = rhs->GetInParams();
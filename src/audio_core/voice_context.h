@@ -267,6 +267,9 @@ public:
     ~VoiceContext();
 
     std::size_t GetVoiceCount() const;
+    /// Number of voices that were audible when the context was last sorted; they occupy the
+    /// front of the sorted voice list
+    std::size_t GetActiveVoiceCount() const;
     ServerVoiceChannelResource& GetChannelResource(std::size_t i);
     const ServerVoiceChannelResource& GetChannelResource(std::size_t i) const;
     VoiceState& GetState(std::size_t i);
@@ -285,12 +288,20 @@ public:
     void UpdateStateByDspShared();
 
 private:
+    struct SortKey {
+        s32 priority{};
+        s32 sorting_order{};
+        bool audible{};
+    };
+
     std::size_t voice_count{};
+    std::size_t active_voice_count{};
     std::vector<ServerVoiceChannelResource> voice_channel_resources{};
     std::vector<VoiceState> voice_states{};
     std::vector<VoiceState> dsp_voice_states{};
     std::vector<ServerVoiceInfo> voice_info{};
     std::vector<ServerVoiceInfo*> sorted_voice_info{};
+    std::vector<SortKey> sort_keys{};
 };
 
 } // namespace AudioCore
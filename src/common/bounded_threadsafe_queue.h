@@ -0,0 +1,89 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * A fixed-capacity lock-free queue for multiple producers and a single consumer.
+ *
+ * Producers claim a slot with a fetch_add ticket and publish it through a per-slot sequence
+ * number, so pushing never allocates and never takes a mutex. Blocking happens only on the empty
+ * and full edges through C++20 atomic waits, which map to futexes and skip the wake syscall when
+ * nobody is waiting.
+ */
+template <typename T, size_t Capacity = 0x400>
+class BoundedMPSCQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    BoundedMPSCQueue() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMPSCQueue(const BoundedMPSCQueue&) = delete;
+    BoundedMPSCQueue& operator=(const BoundedMPSCQueue&) = delete;
+
+    template <typename Arg>
+    void Push(Arg&& value) {
+        const u64 ticket = enqueue_pos.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots[ticket % Capacity];
+        // Full edge: wait for the consumer to release this slot
+        u64 sequence = slot.sequence.load(std::memory_order_acquire);
+        while (sequence != ticket) {
+            slot.sequence.wait(sequence, std::memory_order_acquire);
+            sequence = slot.sequence.load(std::memory_order_acquire);
+        }
+        slot.data = std::forward<Arg>(value);
+        slot.sequence.store(ticket + 1, std::memory_order_release);
+        // The consumer and a producer a full lap ahead can both wait on this slot, so wake both
+        slot.sequence.notify_all();
+    }
+
+    T PopWait() {
+        Slot& slot = slots[dequeue_pos % Capacity];
+        // Empty edge: wait for a producer to publish this slot
+        u64 sequence = slot.sequence.load(std::memory_order_acquire);
+        while (sequence != dequeue_pos + 1) {
+            slot.sequence.wait(sequence, std::memory_order_acquire);
+            sequence = slot.sequence.load(std::memory_order_acquire);
+        }
+        T value = std::move(slot.data);
+        slot.data = T();
+        slot.sequence.store(dequeue_pos + Capacity, std::memory_order_release);
+        slot.sequence.notify_all();
+        ++dequeue_pos;
+        return value;
+    }
+
+    /// May only be called from the consumer thread
+    [[nodiscard]] bool Empty() const {
+        const Slot& slot = slots[dequeue_pos % Capacity];
+        return slot.sequence.load(std::memory_order_acquire) != dequeue_pos + 1;
+    }
+
+private:
+    struct Slot {
+        std::atomic<u64> sequence{};
+        T data{};
+    };
+
+    // The producer and consumer cursors live on their own cache lines so that pushes do not
+    // invalidate the consumer's line and vice versa
+    alignas(64) std::atomic<u64> enqueue_pos{};
+    alignas(64) u64 dequeue_pos{};
+    alignas(64) std::array<Slot, Capacity> slots{};
+};
+
+} // namespace Common
@@ -0,0 +1,133 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#ifdef _WIN32
+// clang-format off
+#include <windows.h>
+// clang-format on
+#elif defined(__linux__)
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#endif
+
+#include <algorithm>
+#include <thread>
+
+#include "common/cpu_topology.h"
+
+namespace Common {
+
+#ifdef __linux__
+
+// Reads a sysfs CPU list such as "0-15,20,22-23" into logical CPU indices
+static std::vector<u32> ReadCpuList(const std::string& path) {
+    std::vector<u32> cpus;
+    std::ifstream file{path};
+    if (!file) {
+        return cpus;
+    }
+    std::string list;
+    std::getline(file, list);
+    std::stringstream stream{list};
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        u32 first{};
+        u32 last{};
+        if (std::sscanf(range.c_str(), "%u-%u", &first, &last) == 2) {
+            for (u32 cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } else if (std::sscanf(range.c_str(), "%u", &first) == 1) {
+            cpus.push_back(first);
+        }
+    }
+    return cpus;
+}
+
+static u64 ReadCpuMaxFrequency(u32 cpu) {
+    std::ifstream file{"/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                       "/cpufreq/cpuinfo_max_freq"};
+    u64 frequency{};
+    file >> frequency;
+    return frequency;
+}
+
+#endif
+
+// Detects the logical CPUs backed by performance and efficiency cores
+static CpuTopology Detect() {
+    CpuTopology topology{};
+    topology.num_logical_cpus = std::max<u32>(std::thread::hardware_concurrency(), 1);
+
+#ifdef _WIN32
+    // The CPU set list carries an efficiency class per logical CPU; on hybrid parts the
+    // performance cores report the highest class
+    ULONG size = 0;
+    GetSystemCpuSetInformation(nullptr, 0, &size, GetCurrentProcess(), 0);
+    std::vector<u8> buffer(size);
+    auto* const info = reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.data());
+    if (size != 0 && GetSystemCpuSetInformation(info, size, &size, GetCurrentProcess(), 0)) {
+        BYTE max_class = 0;
+        for (ULONG offset = 0; offset < size;) {
+            const auto* const entry =
+                reinterpret_cast<const SYSTEM_CPU_SET_INFORMATION*>(buffer.data() + offset);
+            max_class = std::max(max_class, entry->CpuSet.EfficiencyClass);
+            offset += entry->Size;
+        }
+        for (ULONG offset = 0; offset < size;) {
+            const auto* const entry =
+                reinterpret_cast<const SYSTEM_CPU_SET_INFORMATION*>(buffer.data() + offset);
+            const u32 cpu = entry->CpuSet.LogicalProcessorIndex;
+            if (entry->CpuSet.EfficiencyClass == max_class) {
+                topology.performance_cpus.push_back(cpu);
+            } else {
+                topology.efficiency_cpus.push_back(cpu);
+            }
+            offset += entry->Size;
+        }
+    }
+#elif defined(__linux__)
+    // Intel hybrid parts expose the core types directly
+    topology.performance_cpus = ReadCpuList("/sys/devices/cpu_core/cpus");
+    topology.efficiency_cpus = ReadCpuList("/sys/devices/cpu_atom/cpus");
+    if (topology.performance_cpus.empty()) {
+        // Fall back to classifying by maximum frequency: on heterogeneous parts the performance
+        // cores clock highest, on homogeneous parts every CPU matches the maximum
+        std::vector<u64> frequencies(topology.num_logical_cpus);
+        for (u32 cpu = 0; cpu < topology.num_logical_cpus; ++cpu) {
+            frequencies[cpu] = ReadCpuMaxFrequency(cpu);
+        }
+        const u64 max_frequency = *std::max_element(frequencies.begin(), frequencies.end());
+        topology.efficiency_cpus.clear();
+        if (max_frequency != 0) {
+            for (u32 cpu = 0; cpu < topology.num_logical_cpus; ++cpu) {
+                if (frequencies[cpu] == max_frequency) {
+                    topology.performance_cpus.push_back(cpu);
+                } else {
+                    topology.efficiency_cpus.push_back(cpu);
+                }
+            }
+        }
+    }
+#endif
+
+    if (topology.performance_cpus.empty()) {
+        // Unknown or homogeneous topology: treat every CPU as a performance core
+        topology.efficiency_cpus.clear();
+        for (u32 cpu = 0; cpu < topology.num_logical_cpus; ++cpu) {
+            topology.performance_cpus.push_back(cpu);
+        }
+    }
+    topology.is_hybrid = !topology.efficiency_cpus.empty();
+    return topology;
+}
+
+const CpuTopology& GetCpuTopology() {
+    static const CpuTopology topology = Detect();
+    return topology;
+}
+
+} // namespace Common
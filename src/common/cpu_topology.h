@@ -0,0 +1,24 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Describes the host CPU core layout for thread placement decisions
+struct CpuTopology {
+    u32 num_logical_cpus = 0;
+    std::vector<u32> performance_cpus; ///< Logical CPU indices of performance cores
+    std::vector<u32> efficiency_cpus;  ///< Logical CPU indices of efficiency cores
+    bool is_hybrid = false; ///< True when the host mixes performance and efficiency cores
+};
+
+/// Gets the topology of the host CPU. Detection runs once and the result is cached.
+[[nodiscard]] const CpuTopology& GetCpuTopology();
+
+} // namespace Common
@@ -24,7 +24,7 @@ struct Fiber::FiberImpl {
     std::function<void(void*)> rewind_point;
     void* rewind_parameter{};
     void* start_parameter{};
-    std::shared_ptr<Fiber> previous_fiber;
+    Fiber* previous_fiber{};
     bool is_thread_fiber{};
     bool released{};
 
@@ -47,7 +47,7 @@ void Fiber::Start(boost::context::detail::transfer_t& transfer) {
     ASSERT(impl->previous_fiber != nullptr);
     impl->previous_fiber->impl->context = transfer.fctx;
     impl->previous_fiber->impl->guard.unlock();
-    impl->previous_fiber.reset();
+    impl->previous_fiber = nullptr;
     impl->entry_point(impl->start_parameter);
     UNREACHABLE();
 }
@@ -116,16 +116,16 @@ void Fiber::Rewind() {
     boost::context::detail::jump_fcontext(impl->rewind_context, this);
 }
 
-void Fiber::YieldTo(std::shared_ptr<Fiber> from, std::shared_ptr<Fiber> to) {
+void Fiber::YieldTo(Fiber* from, Fiber* to) {
     ASSERT_MSG(from != nullptr, "Yielding fiber is null!");
     ASSERT_MSG(to != nullptr, "Next fiber is null!");
     to->impl->guard.lock();
     to->impl->previous_fiber = from;
-    auto transfer = boost::context::detail::jump_fcontext(to->impl->context, to.get());
+    auto transfer = boost::context::detail::jump_fcontext(to->impl->context, to);
     ASSERT(from->impl->previous_fiber != nullptr);
     from->impl->previous_fiber->impl->context = transfer.fctx;
     from->impl->previous_fiber->impl->guard.unlock();
-    from->impl->previous_fiber.reset();
+    from->impl->previous_fiber = nullptr;
 }
 
 std::shared_ptr<Fiber> Fiber::ThreadToFiber() {
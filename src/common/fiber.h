@@ -40,8 +40,10 @@ public:
     Fiber& operator=(Fiber&&) = default;
 
     /// Yields control from Fiber 'from' to Fiber 'to'
-    /// Fiber 'from' must be the currently running fiber.
-    static void YieldTo(std::shared_ptr<Fiber> from, std::shared_ptr<Fiber> to);
+    /// Fiber 'from' must be the currently running fiber. The caller owns both fibers and must
+    /// keep them alive across the switch; identity is by raw pointer so the hot path performs
+    /// no reference counting.
+    static void YieldTo(Fiber* from, Fiber* to);
     [[nodiscard]] static std::shared_ptr<Fiber> ThreadToFiber();
 
     void SetRewindPoint(std::function<void(void*)>&& rewind_func, void* rewind_param);
@@ -935,10 +935,12 @@ IOFile& IOFile::operator=(IOFile&& other) noexcept {
 
 void IOFile::Swap(IOFile& other) noexcept {
     std::swap(m_file, other.m_file);
+    std::swap(m_last_op, other.m_last_op);
 }
 
 bool IOFile::Open(const std::string& filename, const char openmode[], int flags) {
     Close();
+    m_last_op = LastOp::Repositioned;
     bool m_good;
 #ifdef _WIN32
     if (flags != 0) {
@@ -974,7 +976,18 @@ u64 IOFile::GetSize() const {
 }
 
 bool IOFile::Seek(s64 off, int origin) const {
-    return IsOpen() && 0 == fseeko(m_file, off, origin);
+    if (!IsOpen() || 0 != fseeko(m_file, off, origin)) {
+        return false;
+    }
+    m_last_op = LastOp::Repositioned;
+    return true;
+}
+
+bool IOFile::SeekIfRequired(u64 offset, bool for_write) const {
+    if (m_last_op == (for_write ? LastOp::Write : LastOp::Read) && Tell() == offset) {
+        return true;
+    }
+    return Seek(static_cast<s64>(offset), SEEK_SET);
 }
 
 u64 IOFile::Tell() const {
@@ -999,6 +1012,7 @@ std::size_t IOFile::ReadImpl(void* data, std::size_t length, std::size_t data_si
 
     DEBUG_ASSERT(data != nullptr);
 
+    m_last_op = LastOp::Read;
     return std::fread(data, data_size, length, m_file);
 }
 
@@ -1013,10 +1027,13 @@ std::size_t IOFile::WriteImpl(const void* data, std::size_t length, std::size_t
 
     DEBUG_ASSERT(data != nullptr);
 
+    m_last_op = LastOp::Write;
     return std::fwrite(data, data_size, length, m_file);
 }
 
 bool IOFile::Resize(u64 size) {
+    // Truncation happens below the stdio layer, so force the next transfer to reposition
+    m_last_op = LastOp::Repositioned;
     return IsOpen() && 0 ==
 #ifdef _WIN32
                            // ector: _chsize sucks, not 64-bit safe
@@ -278,6 +278,10 @@ public:
     }
 
     bool Seek(s64 off, int origin) const;
+    // Repositions to offset only when needed for the upcoming read or write. fseek flushes the
+    // stdio buffer even when the position does not change, so eliding it lets consecutive small
+    // transfers coalesce in the buffer instead of each becoming its own syscall.
+    bool SeekIfRequired(u64 offset, bool for_write) const;
     [[nodiscard]] u64 Tell() const;
     [[nodiscard]] u64 GetSize() const;
     bool Resize(u64 size);
@@ -289,10 +293,19 @@ public:
     }
 
 private:
+    // ISO C forbids switching between reading and writing on an update stream without an
+    // intervening reposition, so a seek may only be elided when the stream stays in one mode
+    enum class LastOp {
+        Repositioned,
+        Read,
+        Write,
+    };
+
     std::size_t ReadImpl(void* data, std::size_t length, std::size_t data_size) const;
     std::size_t WriteImpl(const void* data, std::size_t length, std::size_t data_size);
 
     std::FILE* m_file = nullptr;
+    mutable LastOp m_last_op = LastOp::Repositioned;
 };
 
 } // namespace Common::FS
@@ -4,10 +4,16 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <cstring>
+#include <type_traits>
 #include <utility>
 #include <boost/functional/hash.hpp>
 
+#include "common/cityhash.h"
+#include "common/common_types.h"
+
 namespace Common {
 
 struct PairHash {
@@ -19,4 +25,21 @@ struct PairHash {
     }
 };
 
+/// Hashes a trivially copyable value whose size is a compile-time multiple of eight bytes.
+/// The mixing function is CityHash's 128-to-64 fold, but with the length known at compile time
+/// the word loop unrolls and the whole hash inlines into the caller, avoiding the call and
+/// length dispatch that the generic CityHash64 pays on every small key.
+template <typename T>
+[[nodiscard]] u64 HashValue(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert(sizeof(T) % sizeof(u64) == 0, "T must be a multiple of eight bytes");
+    std::array<u64, sizeof(T) / sizeof(u64)> words;
+    std::memcpy(words.data(), &value, sizeof(T));
+    u64 hash = 0x9ae16a3b2f90404fULL + sizeof(T) * 2;
+    for (const u64 word : words) {
+        hash = Hash128to64({hash, word});
+    }
+    return hash;
+}
+
 } // namespace Common
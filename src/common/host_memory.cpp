@@ -0,0 +1,452 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#ifdef _WIN32
+
+#include <map>
+#include <optional>
+#include <windows.h>
+#include <boost/icl/interval_set.hpp>
+#include "common/dynamic_library.h"
+
+#elif defined(__linux__) // ^^^ Windows ^^^ vvv Linux vvv
+
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#endif // ^^^ Linux ^^^
+
+#include <mutex>
+
+#include "common/assert.h"
+#include "common/host_memory.h"
+#include "common/logging/log.h"
+
+namespace Common {
+
+constexpr size_t PageAlignment = 0x1000;
+
+#ifdef _WIN32
+
+// Manually imported for MinGW compatibility
+#ifndef MEM_RESERVE_PLACEHOLDER
+#define MEM_RESERVE_PLACEHOLDER 0x00040000
+#endif
+#ifndef MEM_REPLACE_PLACEHOLDER
+#define MEM_REPLACE_PLACEHOLDER 0x00004000
+#endif
+#ifndef MEM_COALESCE_PLACEHOLDERS
+#define MEM_COALESCE_PLACEHOLDERS 0x00000001
+#endif
+#ifndef MEM_PRESERVE_PLACEHOLDER
+#define MEM_PRESERVE_PLACEHOLDER 0x00000002
+#endif
+
+using PFN_CreateFileMapping2 = HANDLE(WINAPI*)(HANDLE File, SECURITY_ATTRIBUTES* SecurityAttributes,
+                                               ULONG DesiredAccess, ULONG PageProtection,
+                                               ULONG AllocationAttributes, ULONG64 MaximumSize,
+                                               PCWSTR Name, PVOID ExtendedParameters,
+                                               ULONG ParameterCount);
+
+using PFN_VirtualAlloc2 = PVOID(WINAPI*)(HANDLE Process, PVOID BaseAddress, SIZE_T Size,
+                                         ULONG AllocationType, ULONG PageProtection,
+                                         PVOID ExtendedParameters, ULONG ParameterCount);
+
+using PFN_MapViewOfFile3 = PVOID(WINAPI*)(HANDLE FileMapping, HANDLE Process, PVOID BaseAddress,
+                                          ULONG64 Offset, SIZE_T ViewSize, ULONG AllocationType,
+                                          ULONG PageProtection, PVOID ExtendedParameters,
+                                          ULONG ParameterCount);
+
+using PFN_UnmapViewOfFile2 = BOOL(WINAPI*)(HANDLE Process, PVOID BaseAddress, ULONG UnmapFlags);
+
+template <typename T>
+static void GetFuncAddress(Common::DynamicLibrary& dll, const char* name, T& pfn) {
+    if (!dll.GetSymbol(name, &pfn)) {
+        LOG_CRITICAL(HW_Memory, "Failed to load {}", name);
+        throw std::bad_alloc{};
+    }
+}
+
+class HostMemory::Impl {
+public:
+    explicit Impl(size_t backing_size_, size_t virtual_size_)
+        : backing_size{backing_size_}, virtual_size{virtual_size_}, process{GetCurrentProcess()},
+          kernelbase_dll("Kernelbase") {
+        if (!kernelbase_dll.IsOpen()) {
+            LOG_CRITICAL(HW_Memory, "Failed to load Kernelbase.dll");
+            throw std::bad_alloc{};
+        }
+        GetFuncAddress(kernelbase_dll, "CreateFileMapping2", pfn_CreateFileMapping2);
+        GetFuncAddress(kernelbase_dll, "VirtualAlloc2", pfn_VirtualAlloc2);
+        GetFuncAddress(kernelbase_dll, "MapViewOfFile3", pfn_MapViewOfFile3);
+        GetFuncAddress(kernelbase_dll, "UnmapViewOfFile2", pfn_UnmapViewOfFile2);
+
+        // Allocate a zero-initialized backing file
+        backing_handle =
+            pfn_CreateFileMapping2(INVALID_HANDLE_VALUE, nullptr, FILE_MAP_WRITE | FILE_MAP_READ,
+                                   PAGE_READWRITE, SEC_COMMIT, backing_size, nullptr, nullptr, 0);
+        if (!backing_handle) {
+            LOG_CRITICAL(HW_Memory, "Failed to allocate {} MiB of backing memory",
+                         backing_size >> 20);
+            throw std::bad_alloc{};
+        }
+        // Map a view of the whole backing file to read and write the memory from the CPU
+        backing_base = static_cast<u8*>(pfn_MapViewOfFile3(backing_handle, process, nullptr, 0,
+                                                           backing_size, 0, PAGE_READWRITE,
+                                                           nullptr, 0));
+        if (!backing_base) {
+            Release();
+            LOG_CRITICAL(HW_Memory, "Failed to map backing memory");
+            throw std::bad_alloc{};
+        }
+        // Reserve the virtual arena as one big placeholder to map guest memory into
+        virtual_base = static_cast<u8*>(pfn_VirtualAlloc2(process, nullptr, virtual_size,
+                                                          MEM_RESERVE | MEM_RESERVE_PLACEHOLDER,
+                                                          PAGE_NOACCESS, nullptr, 0));
+        if (!virtual_base) {
+            Release();
+            LOG_CRITICAL(HW_Memory, "Failed to reserve {} GiB of virtual memory",
+                         virtual_size >> 30);
+            throw std::bad_alloc{};
+        }
+        placeholders.insert({0, virtual_size});
+    }
+
+    ~Impl() {
+        std::scoped_lock lock{mutex};
+        while (!views.empty()) {
+            UnmapView(views.begin(), views.begin()->first, views.begin()->second.length);
+        }
+        Release();
+    }
+
+    void Map(size_t virtual_offset, size_t host_offset, size_t length) {
+        std::scoped_lock lock{mutex};
+        SplitPlaceholder(virtual_offset, length);
+        MapView(virtual_offset, host_offset, length);
+    }
+
+    void Unmap(size_t virtual_offset, size_t length) {
+        std::scoped_lock lock{mutex};
+        // Release every view intersecting the range, remapping any protruding head or tail
+        while (const auto it = FindIntersectingView(virtual_offset, length)) {
+            UnmapView(*it, virtual_offset, length);
+        }
+        CoalescePlaceholders(virtual_offset, length);
+    }
+
+    void Protect(size_t virtual_offset, size_t length, bool read, bool write) {
+        DWORD new_flags{};
+        if (read && write) {
+            new_flags = PAGE_READWRITE;
+        } else if (read && !write) {
+            new_flags = PAGE_READONLY;
+        } else if (!read && !write) {
+            new_flags = PAGE_NOACCESS;
+        } else {
+            UNIMPLEMENTED_MSG("Protection flag combination read={} write={}", read, write);
+        }
+        std::scoped_lock lock{mutex};
+        // Only mapped views can change protection, skip over the placeholders in the range
+        for (auto it = views.begin(); it != views.end(); ++it) {
+            const size_t begin = std::max(it->first, virtual_offset);
+            const size_t end = std::min(it->first + it->second.length, virtual_offset + length);
+            if (begin >= end) {
+                continue;
+            }
+            DWORD old_flags{};
+            if (!VirtualProtect(virtual_base + begin, end - begin, new_flags, &old_flags)) {
+                LOG_CRITICAL(HW_Memory, "Failed to change virtual memory protection");
+            }
+        }
+    }
+
+    u8* backing_base{};
+    u8* virtual_base{};
+
+private:
+    struct View {
+        size_t host_offset;
+        size_t length;
+    };
+    using ViewIterator = std::map<size_t, View>::iterator;
+
+    /// Free all resources, used when a partial construction fails and on destruction
+    void Release() {
+        if (virtual_base) {
+            if (!VirtualFree(virtual_base, 0, MEM_RELEASE)) {
+                LOG_CRITICAL(HW_Memory, "Failed to free virtual memory arena");
+            }
+        }
+        if (backing_base) {
+            if (!pfn_UnmapViewOfFile2(process, backing_base, 0)) {
+                LOG_CRITICAL(HW_Memory, "Failed to unmap backing memory view");
+            }
+        }
+        if (backing_handle) {
+            CloseHandle(backing_handle);
+        }
+    }
+
+    /// Carve a placeholder with the exact bounds [virtual_offset, virtual_offset + length) out of
+    /// the placeholder containing it. No-op when the bounds already match.
+    void SplitPlaceholder(size_t virtual_offset, size_t length) {
+        const auto interval =
+            boost::icl::interval<size_t>::right_open(virtual_offset, virtual_offset + length);
+        const auto it = placeholders.find(interval);
+        ASSERT_MSG(it != placeholders.end() && boost::icl::contains(*it, interval),
+                   "Mapping over non-placeholder memory");
+        if (it->lower() == virtual_offset && it->upper() == virtual_offset + length) {
+            return;
+        }
+        if (!VirtualFree(virtual_base + virtual_offset, length,
+                         MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER)) {
+            LOG_CRITICAL(HW_Memory, "Failed to split placeholder");
+        }
+    }
+
+    /// Replace the placeholder at virtual_offset with a view of the backing file
+    void MapView(size_t virtual_offset, size_t host_offset, size_t length) {
+        void* const ret =
+            pfn_MapViewOfFile3(backing_handle, process, virtual_base + virtual_offset, host_offset,
+                               length, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+        ASSERT_MSG(ret, "Failed to map placeholder");
+        placeholders.erase(
+            boost::icl::interval<size_t>::right_open(virtual_offset, virtual_offset + length));
+        views.emplace(virtual_offset, View{host_offset, length});
+    }
+
+    /// Release the given view, restoring it as a placeholder and remapping any part of it that
+    /// protrudes out of [virtual_offset, virtual_offset + length)
+    void UnmapView(ViewIterator it, size_t virtual_offset, size_t length) {
+        const size_t view_begin = it->first;
+        const View view = it->second;
+        if (!pfn_UnmapViewOfFile2(process, virtual_base + view_begin, MEM_PRESERVE_PLACEHOLDER)) {
+            LOG_CRITICAL(HW_Memory, "Failed to unmap placeholder view");
+        }
+        views.erase(it);
+        placeholders.insert(
+            boost::icl::interval<size_t>::right_open(view_begin, view_begin + view.length));
+        if (view_begin < virtual_offset) {
+            SplitPlaceholder(view_begin, virtual_offset - view_begin);
+            MapView(view_begin, view.host_offset, virtual_offset - view_begin);
+        }
+        const size_t view_end = view_begin + view.length;
+        const size_t range_end = virtual_offset + length;
+        if (view_end > range_end) {
+            SplitPlaceholder(range_end, view_end - range_end);
+            MapView(range_end, view.host_offset + (range_end - view_begin), view_end - range_end);
+        }
+    }
+
+    /// Merge the placeholders covering [virtual_offset, virtual_offset + length) with their
+    /// unmapped neighbors, keeping the host placeholders in sync with 'placeholders'
+    void CoalescePlaceholders(size_t virtual_offset, size_t length) {
+        const auto it = placeholders.find(
+            boost::icl::interval<size_t>::right_open(virtual_offset, virtual_offset + length));
+        if (it == placeholders.end() || it->upper() - it->lower() <= length) {
+            return;
+        }
+        if (!VirtualFree(virtual_base + it->lower(), it->upper() - it->lower(),
+                         MEM_RELEASE | MEM_COALESCE_PLACEHOLDERS)) {
+            LOG_CRITICAL(HW_Memory, "Failed to coalesce placeholders");
+        }
+    }
+
+    [[nodiscard]] std::optional<ViewIterator> FindIntersectingView(size_t virtual_offset,
+                                                                  size_t length) {
+        auto it = views.upper_bound(virtual_offset);
+        if (it != views.begin()) {
+            --it;
+        }
+        while (it != views.end() && it->first < virtual_offset + length) {
+            if (it->first + it->second.length > virtual_offset) {
+                return it;
+            }
+            ++it;
+        }
+        return std::nullopt;
+    }
+
+    size_t backing_size{};
+    size_t virtual_size{};
+
+    HANDLE process{};        ///< Current process handle
+    HANDLE backing_handle{}; ///< File based backing memory
+
+    DynamicLibrary kernelbase_dll;
+    PFN_CreateFileMapping2 pfn_CreateFileMapping2{};
+    PFN_VirtualAlloc2 pfn_VirtualAlloc2{};
+    PFN_MapViewOfFile3 pfn_MapViewOfFile3{};
+    PFN_UnmapViewOfFile2 pfn_UnmapViewOfFile2{};
+
+    std::mutex mutex;
+    std::map<size_t, View> views;                  ///< Mapped views, keyed by virtual offset
+    boost::icl::interval_set<size_t> placeholders; ///< Unmapped regions of the virtual arena
+};
+
+#elif defined(__linux__) // ^^^ Windows ^^^ vvv Linux vvv
+
+class HostMemory::Impl {
+public:
+    explicit Impl(size_t backing_size_, size_t virtual_size_)
+        : backing_size{backing_size_}, virtual_size{virtual_size_} {
+        // Backing memory initialization
+        fd = memfd_create("HostMemory", 0);
+        if (fd < 0) {
+            LOG_CRITICAL(HW_Memory, "memfd_create failed: {}", strerror(errno));
+            throw std::bad_alloc{};
+        }
+
+        // Defined to extend the file with zeros
+        if (ftruncate(fd, static_cast<off_t>(backing_size)) < 0) {
+            LOG_CRITICAL(HW_Memory, "ftruncate failed with {}, are you out of memory?",
+                         strerror(errno));
+            throw std::bad_alloc{};
+        }
+
+        backing_base = static_cast<u8*>(
+            mmap(nullptr, backing_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+        if (backing_base == MAP_FAILED) {
+            LOG_CRITICAL(HW_Memory, "mmap failed: {}", strerror(errno));
+            throw std::bad_alloc{};
+        }
+
+        // Virtual memory initialization, reserved with no permissions so stray accesses fault
+        virtual_base = static_cast<u8*>(mmap(nullptr, virtual_size, PROT_NONE,
+                                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+        if (virtual_base == MAP_FAILED) {
+            LOG_CRITICAL(HW_Memory, "mmap failed: {}", strerror(errno));
+            throw std::bad_alloc{};
+        }
+    }
+
+    ~Impl() {
+        if (virtual_base) {
+            ASSERT(munmap(virtual_base, virtual_size) == 0);
+        }
+        if (backing_base) {
+            ASSERT(munmap(backing_base, backing_size) == 0);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    void Map(size_t virtual_offset, size_t host_offset, size_t length) {
+        void* const ret = mmap(virtual_base + virtual_offset, length, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_FIXED, fd, static_cast<off_t>(host_offset));
+        ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+    }
+
+    void Unmap(size_t virtual_offset, size_t length) {
+        // Replace the mapping with a no-permission reservation instead of unmapping, to avoid
+        // leaving a hole another allocation could move into
+        void* const ret = mmap(virtual_base + virtual_offset, length, PROT_NONE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+        ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+    }
+
+    void Protect(size_t virtual_offset, size_t length, bool read, bool write) {
+        int flags = 0;
+        if (read) {
+            flags |= PROT_READ;
+        }
+        if (write) {
+            flags |= PROT_WRITE;
+        }
+        const int ret = mprotect(virtual_base + virtual_offset, length, flags);
+        ASSERT_MSG(ret == 0, "mprotect failed: {}", strerror(errno));
+    }
+
+    u8* backing_base{};
+    u8* virtual_base{};
+
+private:
+    const size_t backing_size;
+    const size_t virtual_size;
+    int fd = -1; // memfd file descriptor, -1 is the error value of memfd_create
+};
+
+#else // ^^^ Linux ^^^ vvv Generic vvv
+
+class HostMemory::Impl {
+public:
+    explicit Impl(size_t /*backing_size*/, size_t /*virtual_size*/) {
+        // This platform is unsupported, fall back to a regular allocation
+        throw std::bad_alloc{};
+    }
+
+    void Map([[maybe_unused]] size_t virtual_offset, [[maybe_unused]] size_t host_offset,
+             [[maybe_unused]] size_t length) {}
+
+    void Unmap([[maybe_unused]] size_t virtual_offset, [[maybe_unused]] size_t length) {}
+
+    void Protect([[maybe_unused]] size_t virtual_offset, [[maybe_unused]] size_t length,
+                 [[maybe_unused]] bool read, [[maybe_unused]] bool write) {}
+
+    u8* backing_base{};
+    u8* virtual_base{};
+};
+
+#endif // ^^^ Generic ^^^
+
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+    : backing_size{backing_size_}, virtual_size{virtual_size_} {
+    try {
+        // Try to allocate a fastmem arena.
+        // The implementation will fail with std::bad_alloc on errors.
+        impl = std::make_unique<HostMemory::Impl>(backing_size, virtual_size);
+        backing_base = impl->backing_base;
+        virtual_base = impl->virtual_base;
+    } catch (const std::bad_alloc&) {
+        LOG_CRITICAL(HW_Memory,
+                     "Fastmem unavailable, falling back to VirtualBuffer for memory allocation");
+        fallback_buffer = std::make_unique<Common::VirtualBuffer<u8>>(backing_size);
+        backing_base = fallback_buffer->data();
+        virtual_base = nullptr;
+    }
+}
+
+HostMemory::~HostMemory() = default;
+
+HostMemory::HostMemory(HostMemory&&) noexcept = default;
+
+HostMemory& HostMemory::operator=(HostMemory&&) noexcept = default;
+
+void HostMemory::Map(size_t virtual_offset, size_t host_offset, size_t length) {
+    ASSERT(virtual_offset % PageAlignment == 0);
+    ASSERT(host_offset % PageAlignment == 0);
+    ASSERT(length % PageAlignment == 0);
+    ASSERT(virtual_offset + length <= virtual_size);
+    ASSERT(host_offset + length <= backing_size);
+    if (length == 0 || !virtual_base) {
+        return;
+    }
+    impl->Map(virtual_offset, host_offset, length);
+}
+
+void HostMemory::Unmap(size_t virtual_offset, size_t length) {
+    ASSERT(virtual_offset % PageAlignment == 0);
+    ASSERT(length % PageAlignment == 0);
+    ASSERT(virtual_offset + length <= virtual_size);
+    if (length == 0 || !virtual_base) {
+        return;
+    }
+    impl->Unmap(virtual_offset, length);
+}
+
+void HostMemory::Protect(size_t virtual_offset, size_t length, bool read, bool write) {
+    ASSERT(virtual_offset % PageAlignment == 0);
+    ASSERT(length % PageAlignment == 0);
+    ASSERT(virtual_offset + length <= virtual_size);
+    if (length == 0 || !virtual_base) {
+        return;
+    }
+    impl->Protect(virtual_offset, length, read, write);
+}
+
+} // namespace Common
@@ -25,7 +25,7 @@ struct Entry {
     Level log_level{};
     const char* filename = nullptr;
     unsigned int line_num = 0;
-    std::string function;
+    const char* function = nullptr;
     std::string message;
     bool final_entry = false;
 };
@@ -135,4 +135,10 @@ const char* GetLevelName(Level log_level);
  * never get the message
  */
 void SetGlobalFilter(const Filter& filter);
+
+/**
+ * Returns whether a message of the given class and level would pass the global filter. Useful to
+ * avoid building expensive log messages that would only be discarded.
+ */
+bool IsFilterMatch(Class log_class, Level log_level);
 } // namespace Log
\ No newline at end of file
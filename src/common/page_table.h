@@ -105,6 +105,9 @@ struct PageTable {
     VirtualBuffer<PageInfo> pointers;
 
     VirtualBuffer<u64> backing_addr;
+
+    /// Base address of the virtual arena mirroring this address space, when fastmem is enabled
+    u8* fastmem_arena{};
 };
 
 } // namespace Common
@@ -0,0 +1,62 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <atomic>
+
+#include "common/perf_counters.h"
+
+namespace Common {
+
+namespace {
+
+std::array<std::atomic<u64>, NumPerfCounters> g_perf_counters{};
+
+} // Anonymous namespace
+
+const char* GetPerfCounterName(PerfCounter counter) {
+    switch (counter) {
+    case PerfCounter::SvcCalls:
+        return "svc_calls";
+    case PerfCounter::GpuCommands:
+        return "gpu_commands";
+    case PerfCounter::DrawCalls:
+        return "draw_calls";
+    case PerfCounter::TextureCacheHits:
+        return "texture_cache_hits";
+    case PerfCounter::TextureCacheMisses:
+        return "texture_cache_misses";
+    case PerfCounter::BufferCacheHits:
+        return "buffer_cache_hits";
+    case PerfCounter::BufferCacheMisses:
+        return "buffer_cache_misses";
+    case PerfCounter::BufferUploadBytes:
+        return "buffer_upload_bytes";
+    case PerfCounter::BufferUploadSkippedBytes:
+        return "buffer_upload_skipped_bytes";
+    case PerfCounter::FramePacingErrorUs:
+        return "frame_pacing_error_us";
+    case PerfCounter::MacroHleCalls:
+        return "macro_hle_calls";
+    case PerfCounter::MacroLleCalls:
+        return "macro_lle_calls";
+    case PerfCounter::Count:
+        break;
+    }
+    return "unknown";
+}
+
+void AddPerfCounter(PerfCounter counter, u64 amount) {
+    g_perf_counters[static_cast<std::size_t>(counter)].fetch_add(amount,
+                                                                 std::memory_order_relaxed);
+}
+
+PerfCounterValues ExchangePerfCounters() {
+    PerfCounterValues values{};
+    for (std::size_t i = 0; i < NumPerfCounters; ++i) {
+        values[i] = g_perf_counters[i].exchange(0, std::memory_order_relaxed);
+    }
+    return values;
+}
+
+} // namespace Common
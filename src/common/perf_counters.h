@@ -0,0 +1,47 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Always-on subsystem event counters. Unlike MicroProfile these need no GUI connection and cost
+/// a single relaxed atomic increment per event, so they stay enabled in production builds and are
+/// harvested once per stats interval by Core::PerfStats for post-incident diagnosis.
+enum class PerfCounter : std::size_t {
+    SvcCalls,           ///< Supervisor calls dispatched by the kernel
+    GpuCommands,        ///< Commands pushed to the asynchronous GPU thread queue
+    DrawCalls,          ///< Draw calls issued by the active rasterizer
+    TextureCacheHits,   ///< Image lookups served by an existing texture cache entry
+    TextureCacheMisses, ///< Image lookups that had to create and upload a new image
+    BufferCacheHits,    ///< Buffer maps served by an existing cache interval
+    BufferCacheMisses,  ///< Buffer maps that required an upload or an interval rebuild
+    BufferUploadBytes,  ///< Bytes uploaded into cached GPU buffer blocks
+    BufferUploadSkippedBytes, ///< Bytes a binding covered that were already resident on the GPU
+    FramePacingErrorUs, ///< Accumulated error between frame release and its predicted slot
+    MacroHleCalls,      ///< Macro executions served by a native HLE replacement
+    MacroLleCalls,      ///< Macro executions that ran through the JIT or interpreter
+    Count,
+};
+
+constexpr std::size_t NumPerfCounters = static_cast<std::size_t>(PerfCounter::Count);
+
+/// Snapshot of every counter, indexed by PerfCounter
+using PerfCounterValues = std::array<u64, NumPerfCounters>;
+
+/// Returns the name of the given counter, for CSV headers and status displays
+[[nodiscard]] const char* GetPerfCounterName(PerfCounter counter);
+
+/// Adds the given amount to a counter. Thread-safe and wait-free.
+void AddPerfCounter(PerfCounter counter, u64 amount = 1);
+
+/// Returns the current value of every counter and resets them all to zero
+[[nodiscard]] PerfCounterValues ExchangePerfCounters();
+
+} // namespace Common
@@ -2,6 +2,8 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <thread>
+
 #include "common/spin_lock.h"
 
 #if _MSC_VER
@@ -35,8 +37,24 @@ void ThreadPause() {
 namespace Common {
 
 void SpinLock::lock() {
+    if (!lck.test_and_set(std::memory_order_acquire)) {
+        return;
+    }
+    contention_count.fetch_add(1, std::memory_order_relaxed);
+
+    // Spin with exponentially growing pause batches; if the lock is still held after that, the
+    // holder has most likely been preempted, so hand the timeslice back instead of burning it
+    int pauses = 1;
+    constexpr int max_pauses = 64;
     while (lck.test_and_set(std::memory_order_acquire)) {
-        ThreadPause();
+        if (pauses < max_pauses) {
+            for (int i = 0; i < pauses; ++i) {
+                ThreadPause();
+            }
+            pauses *= 2;
+        } else {
+            std::this_thread::yield();
+        }
     }
 }
 
@@ -6,6 +6,8 @@
 
 #include <atomic>
 
+#include "common/common_types.h"
+
 namespace Common {
 
 /**
@@ -27,8 +29,15 @@ public:
     void unlock();
     [[nodiscard]] bool try_lock();
 
+    /// Number of times lock() found the lock already held; read from a debugger or logged to
+    /// identify which call sites actually contend
+    [[nodiscard]] u64 ContentionCount() const {
+        return contention_count.load(std::memory_order_relaxed);
+    }
+
 private:
     std::atomic_flag lck = ATOMIC_FLAG_INIT;
+    std::atomic<u64> contention_count{0};
 };
 
 } // namespace Common
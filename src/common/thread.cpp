@@ -54,6 +54,18 @@ void SetCurrentThreadPriority(ThreadPriority new_priority) {
     SetThreadPriority(handle, windows_priority);
 }
 
+void SetCurrentThreadAffinity(std::span<const u32> cpu_ids) {
+    DWORD_PTR mask = 0;
+    for (const u32 cpu : cpu_ids) {
+        if (cpu < sizeof(DWORD_PTR) * 8) {
+            mask |= DWORD_PTR{1} << cpu;
+        }
+    }
+    if (mask != 0) {
+        SetThreadAffinityMask(GetCurrentThread(), mask);
+    }
+}
+
 #else
 
 void SetCurrentThreadPriority(ThreadPriority new_priority) {
@@ -73,6 +85,20 @@ void SetCurrentThreadPriority(ThreadPriority new_priority) {
     pthread_setschedparam(this_thread, SCHED_OTHER, &params);
 }
 
+void SetCurrentThreadAffinity(std::span<const u32> cpu_ids) {
+#if defined(__linux__) || defined(__FreeBSD__)
+    if (cpu_ids.empty()) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const u32 cpu : cpu_ids) {
+        CPU_SET(cpu, &set);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
 #endif
 
 #ifdef _MSC_VER
@@ -9,6 +9,7 @@
 #include <condition_variable>
 #include <cstddef>
 #include <mutex>
+#include <span>
 #include <thread>
 #include "common/common_types.h"
 
@@ -96,6 +97,10 @@ enum class ThreadPriority : u32 {
 
 void SetCurrentThreadPriority(ThreadPriority new_priority);
 
+/// Restricts the current thread to the given logical CPUs. No-op when the list is empty or the
+/// platform does not support thread affinity.
+void SetCurrentThreadAffinity(std::span<const u32> cpu_ids);
+
 void SetCurrentThreadName(const char* name);
 
 } // namespace Common
@@ -50,7 +50,7 @@ ThreadWorker::~ThreadWorker() {
 void ThreadWorker::QueueWork(std::function<void()>&& work) {
     {
         std::unique_lock lock{queue_mutex};
-        requests.emplace(work);
+        requests.emplace(std::move(work));
     }
     condition.notify_one();
 }
@@ -5,11 +5,13 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <mutex>
+#include <queue>
 #include <string>
+#include <thread>
 #include <vector>
-#include <queue>
 
 namespace Common {
 
@@ -23,6 +23,7 @@ public:
     ~SPSCQueue() {
         // this will empty out the whole queue
         delete read_ptr;
+        delete free_list.load();
     }
 
     [[nodiscard]] std::size_t Size() const {
@@ -41,9 +42,9 @@ public:
     void Push(Arg&& t) {
         // create the element, add it to the queue
         write_ptr->current = std::forward<Arg>(t);
-        // set the next pointer to a new element ptr
+        // set the next pointer to a recycled or new element ptr
         // then advance the write pointer
-        ElementPtr* new_ptr = new ElementPtr();
+        ElementPtr* new_ptr = TakeFreeNode();
         write_ptr->next.store(new_ptr, std::memory_order_release);
         write_ptr = new_ptr;
 
@@ -66,7 +67,8 @@ public:
         read_ptr = tmpptr->next.load();
         // set the next element to nullptr to stop the recursive deletion
         tmpptr->next.store(nullptr);
-        delete tmpptr; // this also deletes the element
+        tmpptr->current = T();
+        ReturnFreeNode(tmpptr);
     }
 
     bool Pop(T& t) {
@@ -79,7 +81,7 @@ public:
         read_ptr = tmpptr->next.load(std::memory_order_acquire);
         t = std::move(tmpptr->current);
         tmpptr->next.store(nullptr);
-        delete tmpptr;
+        ReturnFreeNode(tmpptr);
         return true;
     }
 
@@ -117,8 +119,42 @@ private:
         std::atomic<ElementPtr*> next{nullptr};
     };
 
+    // Nodes are recycled through a small lock-free stack instead of hitting the allocator on
+    // every push/pop pair. The reader is the only thread that pushes free nodes and the writer
+    // the only one that pops them, so the usual ABA concerns do not apply.
+    ElementPtr* TakeFreeNode() {
+        ElementPtr* node = free_list.load(std::memory_order_acquire);
+        while (node != nullptr) {
+            ElementPtr* const next = node->next.load(std::memory_order_relaxed);
+            if (free_list.compare_exchange_weak(node, next, std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+                node->next.store(nullptr, std::memory_order_relaxed);
+                --free_count;
+                return node;
+            }
+        }
+        return new ElementPtr();
+    }
+
+    void ReturnFreeNode(ElementPtr* node) {
+        if (free_count.load(std::memory_order_relaxed) >= MAX_FREE_NODES) {
+            delete node;
+            return;
+        }
+        ++free_count;
+        ElementPtr* head = free_list.load(std::memory_order_relaxed);
+        do {
+            node->next.store(head, std::memory_order_relaxed);
+        } while (!free_list.compare_exchange_weak(head, node, std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed));
+    }
+
+    static constexpr std::size_t MAX_FREE_NODES = 64;
+
     ElementPtr* write_ptr;
     ElementPtr* read_ptr;
+    std::atomic<ElementPtr*> free_list{nullptr};
+    std::atomic_size_t free_count{0};
     std::atomic_size_t size{0};
     std::mutex cv_mutex;
     std::condition_variable cv;
@@ -145,7 +181,7 @@ public:
     template <typename Arg>
     void Push(Arg&& t) {
         std::lock_guard lock{write_lock};
-        spsc_queue.Push(t);
+        spsc_queue.Push(std::forward<Arg>(t));
     }
 
     void Pop() {
@@ -8,19 +8,59 @@
 #include <sys/mman.h>
 #endif
 
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/virtual_buffer.h"
 
 namespace Common {
 
+namespace {
+
+// Large backings (page tables, guest RAM fallback) are sized in whole 2MiB multiples, and backing
+// them with huge pages noticeably lowers dTLB pressure on guest memory accesses.
+constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+} // Anonymous namespace
+
 void* AllocateMemoryPages(std::size_t size) noexcept {
 #ifdef _WIN32
-    void* base{VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_READWRITE)};
+    void* base = nullptr;
+    // Large pages require SeLockMemoryPrivilege and a size multiple of the minimum large page;
+    // when either is missing VirtualAlloc fails cleanly and we take the regular path below.
+    const std::size_t large_page_size = GetLargePageMinimum();
+    if (large_page_size != 0 && size >= large_page_size && IsAligned(size, large_page_size)) {
+        base = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+                            PAGE_READWRITE);
+    }
+    if (!base) {
+        base = VirtualAlloc(nullptr, size, MEM_COMMIT, PAGE_READWRITE);
+    }
 #else
-    void* base{mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0)};
+    void* base = nullptr;
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    // Explicit hugepages fail at map time when none are reserved, which makes falling back to
+    // regular pages safe.
+    if (size >= huge_page_size && IsAligned(size, huge_page_size)) {
+        base = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_ANON | MAP_PRIVATE | MAP_HUGETLB, -1, 0);
+        if (base == MAP_FAILED) {
+            base = nullptr;
+        }
+    }
+#endif
+    if (!base) {
+        base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
 
-    if (base == MAP_FAILED) {
-        base = nullptr;
+        if (base == MAP_FAILED) {
+            base = nullptr;
+        }
+#ifdef MADV_HUGEPAGE
+        else if (size >= huge_page_size) {
+            // Hint transparent hugepages for large regions; pages are still populated on first
+            // touch, so they land on the NUMA node of the thread that uses them.
+            madvise(base, size, MADV_HUGEPAGE);
+        }
+#endif
     }
 #endif
 
@@ -3,9 +3,9 @@
 // Refer to the license.txt file included.
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <limits>
-#include <mutex>
 #include <thread>
 
 #ifdef _MSC_VER
@@ -17,7 +17,6 @@
 #include <x86intrin.h>
 #endif
 
-#include "common/atomic_ops.h"
 #include "common/uint128.h"
 #include "common/x64/native_clock.h"
 
@@ -103,8 +102,7 @@ NativeClock::NativeClock(u64 emulated_cpu_frequency_, u64 emulated_clock_frequen
     : WallClock(emulated_cpu_frequency_, emulated_clock_frequency_, true), rtsc_frequency{
                                                                                rtsc_frequency_} {
     _mm_mfence();
-    time_point.inner.last_measure = __rdtsc();
-    time_point.inner.accumulated_ticks = 0U;
+    epoch_measure = __rdtsc();
     ns_rtsc_factor = GetFixedPoint64Factor(1000000000, rtsc_frequency);
     us_rtsc_factor = GetFixedPoint64Factor(1000000, rtsc_frequency);
     ms_rtsc_factor = GetFixedPoint64Factor(1000, rtsc_frequency);
@@ -113,35 +111,45 @@ NativeClock::NativeClock(u64 emulated_cpu_frequency_, u64 emulated_clock_frequen
 }
 
 u64 NativeClock::GetRTSC() {
-    TimePoint new_time_point{};
-    TimePoint current_time_point{};
+    u64 sequence;
+    u64 accumulated;
+    u64 measure;
     do {
-        current_time_point.pack = time_point.pack;
-        _mm_mfence();
-        const u64 current_measure = __rdtsc();
-        u64 diff = current_measure - current_time_point.inner.last_measure;
-        diff = diff & ~static_cast<u64>(static_cast<s64>(diff) >> 63); // max(diff, 0)
-        new_time_point.inner.last_measure = current_measure > current_time_point.inner.last_measure
-                                                ? current_measure
-                                                : current_time_point.inner.last_measure;
-        new_time_point.inner.accumulated_ticks = current_time_point.inner.accumulated_ticks + diff;
-    } while (!Common::AtomicCompareAndSwap(time_point.pack.data(), new_time_point.pack,
-                                           current_time_point.pack));
+        sequence = epoch_sequence.load(std::memory_order_acquire);
+        accumulated = epoch_accumulated.load(std::memory_order_relaxed);
+        measure = epoch_measure.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1) != 0 ||
+             sequence != epoch_sequence.load(std::memory_order_relaxed));
+    _mm_mfence();
+    const u64 current_measure = __rdtsc();
+    // Cross-core TSC skew can place our counter read slightly behind the epoch measurement,
+    // e.g. right after a pause rebases it; clamp the delta to zero to keep the clock monotonic
+    const u64 diff = current_measure - measure;
+    const u64 clamped_diff = diff & ~static_cast<u64>(static_cast<s64>(diff) >> 63);
     /// The clock cannot be more precise than the guest timer, remove the lower bits
-    return new_time_point.inner.accumulated_ticks & inaccuracy_mask;
+    return (accumulated + clamped_diff) & inaccuracy_mask;
+}
+
+void NativeClock::UpdateEpoch(u64 new_accumulated, u64 new_measure) {
+    epoch_sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    epoch_accumulated.store(new_accumulated, std::memory_order_relaxed);
+    epoch_measure.store(new_measure, std::memory_order_relaxed);
+    epoch_sequence.fetch_add(1, std::memory_order_release);
 }
 
 void NativeClock::Pause(bool is_paused) {
-    if (!is_paused) {
-        TimePoint current_time_point{};
-        TimePoint new_time_point{};
-        do {
-            current_time_point.pack = time_point.pack;
-            new_time_point.pack = current_time_point.pack;
-            _mm_mfence();
-            new_time_point.inner.last_measure = __rdtsc();
-        } while (!Common::AtomicCompareAndSwap(time_point.pack.data(), new_time_point.pack,
-                                               current_time_point.pack));
+    _mm_mfence();
+    const u64 current_measure = __rdtsc();
+    if (is_paused) {
+        // Bank the time elapsed so far, so that resuming can rebase the epoch without losing it
+        const u64 accumulated = epoch_accumulated.load(std::memory_order_relaxed);
+        const u64 measure = epoch_measure.load(std::memory_order_relaxed);
+        UpdateEpoch(accumulated + (current_measure - measure), current_measure);
+    } else {
+        // Rebase onto the current counter so the interval spent paused is excluded
+        UpdateEpoch(epoch_accumulated.load(std::memory_order_relaxed), current_measure);
     }
 }
 
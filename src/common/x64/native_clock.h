@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include <optional>
+#include <atomic>
 
 #include "common/wall_clock.h"
 
@@ -31,21 +31,20 @@ public:
 private:
     u64 GetRTSC();
 
-    union alignas(16) TimePoint {
-        TimePoint() : pack{} {}
-        u128 pack{};
-        struct Inner {
-            u64 last_measure{};
-            u64 accumulated_ticks{};
-        } inner;
-    };
+    void UpdateEpoch(u64 new_accumulated, u64 new_measure);
 
     /// value used to reduce the native clocks accuracy as some apss rely on
     /// undefined behavior where the level of accuracy in the clock shouldn't
     /// be higher.
     static constexpr u64 inaccuracy_mask = ~(UINT64_C(0x400) - 1);
 
-    TimePoint time_point;
+    /// Seqlock-published epoch. Readers only perform loads, so time queries from every core
+    /// leave the cacheline in the shared state; the epoch is rewritten exclusively on the rare
+    /// pause/resume edges. The clock is only instantiated with an invariant TSC, so readers can
+    /// derive the current time from the epoch without writing back.
+    std::atomic<u64> epoch_sequence{0};
+    std::atomic<u64> epoch_accumulated{0};
+    std::atomic<u64> epoch_measure{0};
     // factors
     u64 clock_rtsc_factor{};
     u64 cpu_rtsc_factor{};
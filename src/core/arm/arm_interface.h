@@ -172,6 +172,10 @@ public:
     /// Prepare core for thread reschedule (if needed to correctly handle state)
     virtual void PrepareReschedule() = 0;
 
+    /// Signals the core to stop executing as soon as possible. Unlike the other members, this is
+    /// safe to call from other threads while the core is running.
+    virtual void SignalInterrupt() = 0;
+
     struct BacktraceEntry {
         std::string module;
         u64 address;
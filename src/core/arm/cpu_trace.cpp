@@ -0,0 +1,122 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstdlib>
+#include <cstring>
+
+#include "common/logging/log.h"
+#include "common/lz4_compression.h"
+#include "core/arm/cpu_trace.h"
+#include "core/memory.h"
+
+namespace Core {
+
+namespace {
+
+/// Default capture budget when YUZU_CPU_TRACE_INSTS is not set
+constexpr u64 DEFAULT_INSTRUCTION_LIMIT = 100'000'000;
+
+} // Anonymous namespace
+
+CpuTraceWriter::CpuTraceWriter(const std::string& path, u64 instruction_limit_)
+    : file{path, "wb"}, instruction_limit{instruction_limit_} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(Core_ARM, "Failed to open CPU trace file '{}'", path);
+        return;
+    }
+    file.WriteObject(CpuTrace::TRACE_MAGIC);
+    file.WriteObject(CpuTrace::TRACE_VERSION);
+    LOG_INFO(Core_ARM, "Recording CPU execution windows to '{}' ({} instruction budget)", path,
+             instruction_limit);
+}
+
+CpuTraceWriter::~CpuTraceWriter() {
+    if (file.IsOpen()) {
+        LOG_INFO(Core_ARM, "CPU trace closed with {} windows covering {} instructions",
+                 recorded_windows, recorded_instructions);
+    }
+}
+
+std::unique_ptr<CpuTraceWriter> CpuTraceWriter::CreateFromEnvironment() {
+    const char* const path = std::getenv("YUZU_CPU_TRACE");
+    if (path == nullptr || *path == '\0') {
+        return nullptr;
+    }
+    u64 instruction_limit = DEFAULT_INSTRUCTION_LIMIT;
+    if (const char* const limit = std::getenv("YUZU_CPU_TRACE_INSTS")) {
+        instruction_limit = std::strtoull(limit, nullptr, 0);
+        if (instruction_limit == 0) {
+            instruction_limit = DEFAULT_INSTRUCTION_LIMIT;
+        }
+    }
+    auto writer = std::make_unique<CpuTraceWriter>(path, instruction_limit);
+    if (!writer->IsOpen()) {
+        return nullptr;
+    }
+    return writer;
+}
+
+void CpuTraceWriter::BeginWindow(const ARM_Interface::ThreadContext64& context, u64 tpidrro) {
+    if (!file.IsOpen() || IsFull()) {
+        return;
+    }
+    in_window = true;
+    window_context = context;
+    window_tpidrro = tpidrro;
+}
+
+void CpuTraceWriter::TouchMemory(Memory::Memory& memory, u64 vaddr, std::size_t size) {
+    if (!in_window) {
+        return;
+    }
+    const u64 first_page = vaddr & ~(CpuTrace::TRACE_PAGE_SIZE - 1);
+    const u64 last_page = (vaddr + size - 1) & ~(CpuTrace::TRACE_PAGE_SIZE - 1);
+    for (u64 page = first_page; page <= last_page; page += CpuTrace::TRACE_PAGE_SIZE) {
+        if (!touched_pages.insert(page).second) {
+            continue;
+        }
+        if (!memory.IsValidVirtualAddress(page)) {
+            continue;
+        }
+        const std::size_t offset = page_data.size();
+        page_data.resize(offset + sizeof(u64) + CpuTrace::TRACE_PAGE_SIZE);
+        std::memcpy(page_data.data() + offset, &page, sizeof(u64));
+        memory.ReadBlock(page, page_data.data() + offset + sizeof(u64),
+                         CpuTrace::TRACE_PAGE_SIZE);
+        ++num_pages;
+    }
+}
+
+void CpuTraceWriter::EndWindow(CpuTrace::WindowEnd reason) {
+    if (!in_window) {
+        return;
+    }
+    in_window = false;
+    if (window_instructions != 0) {
+        const std::vector<u8> compressed =
+            Common::Compression::CompressDataLZ4(page_data.data(), page_data.size());
+        const CpuTrace::WindowHeader header{
+            .instructions = window_instructions,
+            .num_pages = num_pages,
+            .end_reason = reason,
+            .context = window_context,
+            .tpidrro = window_tpidrro,
+            .uncompressed_size = static_cast<u32>(page_data.size()),
+            .compressed_size = static_cast<u32>(compressed.size()),
+        };
+        file.WriteObject(header);
+        file.WriteArray(compressed.data(), compressed.size());
+        recorded_instructions += window_instructions;
+        ++recorded_windows;
+        if (IsFull()) {
+            LOG_INFO(Core_ARM, "CPU trace instruction budget reached, capture finished");
+        }
+    }
+    window_instructions = 0;
+    touched_pages.clear();
+    page_data.clear();
+    num_pages = 0;
+}
+
+} // namespace Core
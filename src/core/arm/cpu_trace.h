@@ -0,0 +1,114 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/file_util.h"
+#include "core/arm/arm_interface.h"
+
+namespace Core::Memory {
+class Memory;
+}
+
+namespace Core {
+
+namespace CpuTrace {
+
+constexpr u32 TRACE_MAGIC = 0x54504359; // 'YCPT'
+constexpr u32 TRACE_VERSION = 1;
+
+/// Granularity of the captured memory images. Matches the guest page size.
+constexpr u64 TRACE_PAGE_SIZE = 0x1000;
+
+/// Reason a captured execution window ended.
+enum class WindowEnd : u32 {
+    Svc = 0,      ///< The guest issued a supervisor call
+    SliceEnd = 1, ///< The core's time slice ran out or execution was interrupted
+};
+
+/// Fixed-size header preceding each window record in the trace file. The page images follow as an
+/// LZ4 compressed sequence of (u64 page address, TRACE_PAGE_SIZE bytes) pairs.
+struct WindowHeader {
+    u64 instructions;                    ///< Number of guest instructions executed in the window
+    u32 num_pages;                       ///< Number of page images in the compressed payload
+    WindowEnd end_reason;                ///< Why the window ended
+    ARM_Interface::ThreadContext64 context; ///< Register state at the start of the window
+    u64 tpidrro;                         ///< TPIDRRO_EL0 at the start of the window
+    u32 uncompressed_size;               ///< Size in bytes of the decompressed page payload
+    u32 compressed_size;                 ///< Size in bytes of the stored page payload
+};
+static_assert(std::is_trivially_copyable_v<WindowHeader>);
+
+} // namespace CpuTrace
+
+/**
+ * Captures windows of guest CPU execution for offline replay.
+ *
+ * A window covers the instructions executed between two supervisor calls (or time slice ends),
+ * together with the register context at its start and an image of every guest page the window
+ * touched, snapshotted on first access. That makes each window self-contained: a replay harness
+ * can reload the context and pages and re-execute the window without the kernel or the rest of
+ * the emulated system, which is what the yuzu-cpu-replay tool in src/tests does to benchmark the
+ * JIT on real game workloads.
+ *
+ * Capture is enabled by pointing the YUZU_CPU_TRACE environment variable at the output path and
+ * stops once YUZU_CPU_TRACE_INSTS guest instructions have been recorded. Only core 0 records, so
+ * the writer is single-threaded and needs no locking.
+ */
+class CpuTraceWriter {
+public:
+    explicit CpuTraceWriter(const std::string& path, u64 instruction_limit_);
+    ~CpuTraceWriter();
+
+    /// Creates a writer when the YUZU_CPU_TRACE environment variable is set, null otherwise.
+    [[nodiscard]] static std::unique_ptr<CpuTraceWriter> CreateFromEnvironment();
+
+    /// Returns true when the output file could be opened.
+    [[nodiscard]] bool IsOpen() const {
+        return file.IsOpen();
+    }
+
+    /// Returns true once the configured instruction budget has been recorded.
+    [[nodiscard]] bool IsFull() const {
+        return recorded_instructions >= instruction_limit;
+    }
+
+    /// Opens a window starting at the given register state. No-op once the trace is full.
+    void BeginWindow(const ARM_Interface::ThreadContext64& context, u64 tpidrro);
+
+    /// Accumulates executed instructions into the open window.
+    void AddInstructions(u64 num_instructions) {
+        window_instructions += num_instructions;
+    }
+
+    /// Snapshots the pages covering [vaddr, vaddr + size) unless already captured this window.
+    void TouchMemory(Memory::Memory& memory, u64 vaddr, std::size_t size);
+
+    /// Serializes the open window and resets the capture state. Empty windows are dropped.
+    void EndWindow(CpuTrace::WindowEnd reason);
+
+private:
+    Common::FS::IOFile file;
+    const u64 instruction_limit;
+    u64 recorded_instructions = 0;
+    u64 recorded_windows = 0;
+
+    bool in_window = false;
+    u64 window_instructions = 0;
+    ARM_Interface::ThreadContext64 window_context{};
+    u64 window_tpidrro = 0;
+    std::unordered_set<u64> touched_pages;
+    /// Concatenated (u64 page address, TRACE_PAGE_SIZE bytes) pairs for the open window
+    std::vector<u8> page_data;
+    u32 num_pages = 0;
+};
+
+} // namespace Core
@@ -283,6 +283,14 @@ void ARM_Dynarmic_32::PrepareReschedule() {
     jit->HaltExecution();
 }
 
+void ARM_Dynarmic_32::SignalInterrupt() {
+    // Called from other threads while this core is running, so the jit binding has to be read
+    // atomically against PageTableChanged
+    if (const auto current_jit = std::atomic_load(&jit)) {
+        current_jit->HaltExecution();
+    }
+}
+
 void ARM_Dynarmic_32::ClearInstructionCache() {
     if (!jit) {
         return;
@@ -306,14 +314,21 @@ void ARM_Dynarmic_32::ClearExclusiveState() {
 
 void ARM_Dynarmic_32::PageTableChanged(Common::PageTable& page_table,
                                        std::size_t new_address_space_size_in_bits) {
-    auto key = std::make_pair(&page_table, new_address_space_size_in_bits);
+    const auto key = std::make_pair(&page_table, new_address_space_size_in_bits);
+    // Threads of the same process resume on this core far more often than the process changes,
+    // so skip the cache lookup and jit rebind when the page table is already bound
+    if (key == current_jit_key) {
+        return;
+    }
+    current_jit_key = key;
     auto iter = jit_cache.find(key);
     if (iter != jit_cache.end()) {
-        jit = iter->second;
+        std::atomic_store(&jit, iter->second);
         return;
     }
-    jit = MakeJit(page_table, new_address_space_size_in_bits);
-    jit_cache.emplace(key, jit);
+    auto new_jit = MakeJit(page_table, new_address_space_size_in_bits);
+    std::atomic_store(&jit, new_jit);
+    jit_cache.emplace(key, std::move(new_jit));
 }
 
 } // namespace Core
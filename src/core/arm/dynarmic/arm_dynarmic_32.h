@@ -60,6 +60,7 @@ public:
     void LoadContext(const ThreadContext64& ctx) override {}
 
     void PrepareReschedule() override;
+    void SignalInterrupt() override;
     void ClearExclusiveState() override;
 
     void ClearInstructionCache() override;
@@ -80,6 +81,8 @@ private:
 
     std::unique_ptr<DynarmicCallbacks32> cb;
     JitCacheType jit_cache;
+    /// Key of the page table the jit is currently bound to, to elide redundant rebinds
+    JitCacheKey current_jit_key{};
     std::shared_ptr<Dynarmic::A32::Jit> jit;
     std::shared_ptr<DynarmicCP15> cp15;
     std::size_t core_index;
@@ -10,6 +10,7 @@
 #include "common/logging/log.h"
 #include "common/page_table.h"
 #include "core/arm/cpu_interrupt_handler.h"
+#include "core/arm/cpu_trace.h"
 #include "core/arm/dynarmic/arm_dynarmic_64.h"
 #include "core/arm/dynarmic/arm_exclusive_monitor.h"
 #include "core/core.h"
@@ -29,54 +30,81 @@ class DynarmicCallbacks64 : public Dynarmic::A64::UserCallbacks {
 public:
     explicit DynarmicCallbacks64(ARM_Dynarmic_64& parent) : parent(parent) {}
 
+    /// Snapshots the pages an access covers when trace capture is active. While capturing, the
+    /// jit is built without a page table or fastmem so every access reaches these callbacks.
+    void TraceTouch(u64 vaddr, std::size_t size) {
+        if (parent.trace_writer) {
+            parent.trace_writer->TouchMemory(parent.system.Memory(), vaddr, size);
+        }
+    }
+
     u8 MemoryRead8(u64 vaddr) override {
+        TraceTouch(vaddr, sizeof(u8));
         return parent.system.Memory().Read8(vaddr);
     }
     u16 MemoryRead16(u64 vaddr) override {
+        TraceTouch(vaddr, sizeof(u16));
         return parent.system.Memory().Read16(vaddr);
     }
     u32 MemoryRead32(u64 vaddr) override {
+        TraceTouch(vaddr, sizeof(u32));
         return parent.system.Memory().Read32(vaddr);
     }
     u64 MemoryRead64(u64 vaddr) override {
+        TraceTouch(vaddr, sizeof(u64));
         return parent.system.Memory().Read64(vaddr);
     }
     Vector MemoryRead128(u64 vaddr) override {
+        TraceTouch(vaddr, sizeof(Vector));
         auto& memory = parent.system.Memory();
         return {memory.Read64(vaddr), memory.Read64(vaddr + 8)};
     }
+    u32 MemoryReadCode(u64 vaddr) override {
+        TraceTouch(vaddr, sizeof(u32));
+        return parent.system.Memory().Read32(vaddr);
+    }
 
     void MemoryWrite8(u64 vaddr, u8 value) override {
+        TraceTouch(vaddr, sizeof(u8));
         parent.system.Memory().Write8(vaddr, value);
     }
     void MemoryWrite16(u64 vaddr, u16 value) override {
+        TraceTouch(vaddr, sizeof(u16));
         parent.system.Memory().Write16(vaddr, value);
     }
     void MemoryWrite32(u64 vaddr, u32 value) override {
+        TraceTouch(vaddr, sizeof(u32));
         parent.system.Memory().Write32(vaddr, value);
     }
     void MemoryWrite64(u64 vaddr, u64 value) override {
+        TraceTouch(vaddr, sizeof(u64));
         parent.system.Memory().Write64(vaddr, value);
     }
     void MemoryWrite128(u64 vaddr, Vector value) override {
+        TraceTouch(vaddr, sizeof(Vector));
         auto& memory = parent.system.Memory();
         memory.Write64(vaddr, value[0]);
         memory.Write64(vaddr + 8, value[1]);
     }
 
     bool MemoryWriteExclusive8(u64 vaddr, std::uint8_t value, std::uint8_t expected) override {
+        TraceTouch(vaddr, sizeof(u8));
         return parent.system.Memory().WriteExclusive8(vaddr, value, expected);
     }
     bool MemoryWriteExclusive16(u64 vaddr, std::uint16_t value, std::uint16_t expected) override {
+        TraceTouch(vaddr, sizeof(u16));
         return parent.system.Memory().WriteExclusive16(vaddr, value, expected);
     }
     bool MemoryWriteExclusive32(u64 vaddr, std::uint32_t value, std::uint32_t expected) override {
+        TraceTouch(vaddr, sizeof(u32));
         return parent.system.Memory().WriteExclusive32(vaddr, value, expected);
     }
     bool MemoryWriteExclusive64(u64 vaddr, std::uint64_t value, std::uint64_t expected) override {
+        TraceTouch(vaddr, sizeof(u64));
         return parent.system.Memory().WriteExclusive64(vaddr, value, expected);
     }
     bool MemoryWriteExclusive128(u64 vaddr, Vector value, Vector expected) override {
+        TraceTouch(vaddr, sizeof(Vector));
         return parent.system.Memory().WriteExclusive128(vaddr, value, expected);
     }
 
@@ -102,10 +130,23 @@ public:
     }
 
     void CallSVC(u32 swi) override {
+        // Dynarmic syncs the guest context before HLE calls, so the jit state read here and after
+        // the call is a valid window boundary for trace capture
+        if (auto* const trace = parent.trace_writer.get()) {
+            trace->EndWindow(CpuTrace::WindowEnd::Svc);
+        }
         Kernel::Svc::Call(parent.system, swi);
+        if (auto* const trace = parent.trace_writer.get()) {
+            ARM_Interface::ThreadContext64 ctx{};
+            parent.SaveContext(ctx);
+            trace->BeginWindow(ctx, tpidrro_el0);
+        }
     }
 
     void AddTicks(u64 ticks) override {
+        if (auto* const trace = parent.trace_writer.get()) {
+            trace->AddInstructions(ticks);
+        }
         if (parent.uses_wall_clock) {
             return;
         }
@@ -158,6 +199,17 @@ std::shared_ptr<Dynarmic::A64::Jit> ARM_Dynarmic_64::MakeJit(Common::PageTable&
     config.detect_misaligned_access_via_page_table = 16 | 32 | 64 | 128;
     config.only_detect_misalignment_via_page_table_on_page_boundary = true;
 
+    config.fastmem_pointer = page_table.fastmem_arena;
+    config.fastmem_address_space_bits = address_space_bits;
+    config.silently_mirror_fastmem = false;
+
+    // Trace capture snapshots pages on first access, so every access has to go through the
+    // callbacks while recording
+    if (trace_writer) {
+        config.page_table = nullptr;
+        config.fastmem_pointer = nullptr;
+    }
+
     // Multi-process state
     config.processor_id = core_index;
     config.global_monitor = &exclusive_monitor.monitor;
@@ -201,6 +253,9 @@ std::shared_ptr<Dynarmic::A64::Jit> ARM_Dynarmic_64::MakeJit(Common::PageTable&
         if (!Settings::values.cpuopt_reduce_misalign_checks) {
             config.only_detect_misalignment_via_page_table_on_page_boundary = false;
         }
+        if (!Settings::values.cpuopt_fastmem) {
+            config.fastmem_pointer = nullptr;
+        }
     }
 
     // Unsafe optimizations
@@ -221,7 +276,15 @@ std::shared_ptr<Dynarmic::A64::Jit> ARM_Dynarmic_64::MakeJit(Common::PageTable&
 }
 
 void ARM_Dynarmic_64::Run() {
+    if (trace_writer) {
+        ThreadContext64 ctx{};
+        SaveContext(ctx);
+        trace_writer->BeginWindow(ctx, cb->tpidrro_el0);
+    }
     jit->Run();
+    if (trace_writer) {
+        trace_writer->EndWindow(CpuTrace::WindowEnd::SliceEnd);
+    }
 }
 
 void ARM_Dynarmic_64::ExceptionalExit() {
@@ -237,7 +300,12 @@ ARM_Dynarmic_64::ARM_Dynarmic_64(System& system, CPUInterrupts& interrupt_handle
                                  std::size_t core_index)
     : ARM_Interface{system, interrupt_handlers, uses_wall_clock},
       cb(std::make_unique<DynarmicCallbacks64>(*this)), core_index{core_index},
-      exclusive_monitor{dynamic_cast<DynarmicExclusiveMonitor&>(exclusive_monitor)} {}
+      exclusive_monitor{dynamic_cast<DynarmicExclusiveMonitor&>(exclusive_monitor)} {
+    // Only core 0 records so the trace file has a single writer
+    if (core_index == 0) {
+        trace_writer = CpuTraceWriter::CreateFromEnvironment();
+    }
+}
 
 ARM_Dynarmic_64::~ARM_Dynarmic_64() = default;
 
@@ -325,6 +393,14 @@ void ARM_Dynarmic_64::PrepareReschedule() {
     jit->HaltExecution();
 }
 
+void ARM_Dynarmic_64::SignalInterrupt() {
+    // Called from other threads while this core is running, so the jit binding has to be read
+    // atomically against PageTableChanged
+    if (const auto current_jit = std::atomic_load(&jit)) {
+        current_jit->HaltExecution();
+    }
+}
+
 void ARM_Dynarmic_64::ClearInstructionCache() {
     if (!jit) {
         return;
@@ -348,14 +424,21 @@ void ARM_Dynarmic_64::ClearExclusiveState() {
 
 void ARM_Dynarmic_64::PageTableChanged(Common::PageTable& page_table,
                                        std::size_t new_address_space_size_in_bits) {
-    auto key = std::make_pair(&page_table, new_address_space_size_in_bits);
+    const auto key = std::make_pair(&page_table, new_address_space_size_in_bits);
+    // Threads of the same process resume on this core far more often than the process changes,
+    // so skip the cache lookup and jit rebind when the page table is already bound
+    if (key == current_jit_key) {
+        return;
+    }
+    current_jit_key = key;
     auto iter = jit_cache.find(key);
     if (iter != jit_cache.end()) {
-        jit = iter->second;
+        std::atomic_store(&jit, iter->second);
         return;
     }
-    jit = MakeJit(page_table, new_address_space_size_in_bits);
-    jit_cache.emplace(key, jit);
+    auto new_jit = MakeJit(page_table, new_address_space_size_in_bits);
+    std::atomic_store(&jit, new_jit);
+    jit_cache.emplace(key, std::move(new_jit));
 }
 
 } // namespace Core
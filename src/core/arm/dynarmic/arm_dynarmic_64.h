@@ -19,6 +19,7 @@ class Memory;
 
 namespace Core {
 
+class CpuTraceWriter;
 class DynarmicCallbacks64;
 class CPUInterruptHandler;
 class DynarmicExclusiveMonitor;
@@ -53,6 +54,7 @@ public:
     void LoadContext(const ThreadContext64& ctx) override;
 
     void PrepareReschedule() override;
+    void SignalInterrupt() override;
     void ClearExclusiveState() override;
 
     void ClearInstructionCache() override;
@@ -71,7 +73,11 @@ private:
     friend class DynarmicCallbacks64;
     std::unique_ptr<DynarmicCallbacks64> cb;
     JitCacheType jit_cache;
+    /// Key of the page table the jit is currently bound to, to elide redundant rebinds
+    JitCacheKey current_jit_key{};
     std::shared_ptr<Dynarmic::A64::Jit> jit;
+    /// Captures execution windows for offline replay. Only allocated on core 0 when requested
+    std::unique_ptr<CpuTraceWriter> trace_writer;
 
     std::size_t core_index;
     DynarmicExclusiveMonitor& exclusive_monitor;
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <array>
+#include <future>
 #include <memory>
 #include <utility>
 
@@ -14,6 +15,7 @@
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
+#include "core/crypto/key_manager.h"
 #include "core/device_memory.h"
 #include "core/file_sys/bis_factory.h"
 #include "core/file_sys/card_image.h"
@@ -165,21 +167,11 @@ struct System::Impl {
         cpu_manager.SetAsyncGpu(is_async_gpu);
         core_timing.SetMulticore(is_multicore);
 
-        core_timing.Initialize([&system]() { system.RegisterHostThread(); });
-        kernel.Initialize();
-        cpu_manager.Initialize();
-
         const auto current_time = std::chrono::duration_cast<std::chrono::seconds>(
             std::chrono::system_clock::now().time_since_epoch());
         Settings::values.custom_rtc_differential =
             Settings::values.custom_rtc.GetValue().value_or(current_time) - current_time;
 
-        // Create a default fs if one doesn't already exist.
-        if (virtual_filesystem == nullptr)
-            virtual_filesystem = std::make_shared<FileSys::RealVfsFilesystem>();
-        if (content_provider == nullptr)
-            content_provider = std::make_unique<FileSys::ContentProviderUnion>();
-
         /// Create default implementations of applets if one is not provided.
         applet_manager.SetDefaultAppletsIfMissing();
 
@@ -188,7 +180,20 @@ struct System::Impl {
 
         telemetry_session = std::make_unique<Core::TelemetrySession>();
 
+        // Kernel, scheduler and timing bring-up never touches the GPU and renderer/device
+        // creation never touches the kernel, so the two heaviest boot stages run concurrently.
+        // Services can observe both, so they are only constructed after the join.
+        auto kernel_init = std::async(std::launch::async, [this, &system] {
+            core_timing.Initialize([&system]() { system.RegisterHostThread(); });
+            kernel.Initialize();
+            cpu_manager.Initialize();
+
+            // Initialize time manager, which must happen after kernel is created
+            time_manager.Initialize();
+        });
+
         gpu_core = VideoCore::CreateGPU(emu_window, system);
+        kernel_init.get();
         if (!gpu_core) {
             return ResultStatus::ErrorVideoCore;
         }
@@ -197,9 +202,6 @@ struct System::Impl {
         services = std::make_unique<Service::Services>(service_manager, system);
         interrupt_manager = std::make_unique<Hardware::InterruptManager>(system);
 
-        // Initialize time manager, which must happen after kernel is created
-        time_manager.Initialize();
-
         is_powered_on = true;
         exit_lock = false;
 
@@ -215,15 +217,33 @@ struct System::Impl {
 
     ResultStatus Load(System& system, Frontend::EmuWindow& emu_window, const std::string& filepath,
                       std::size_t program_index) {
-        app_loader = Loader::GetLoader(system, GetGameFileFromPath(virtual_filesystem, filepath),
-                                       program_index);
+        // Create a default fs if one doesn't already exist, before the concurrent boot stages
+        // below can observe it.
+        if (virtual_filesystem == nullptr)
+            virtual_filesystem = std::make_shared<FileSys::RealVfsFilesystem>();
+        if (content_provider == nullptr)
+            content_provider = std::make_unique<FileSys::ContentProviderUnion>();
 
+        // Boot stages without mutual dependencies run concurrently: key derivation only builds
+        // the key manager singleton, loader identification only parses the game file, and system
+        // initialization brings up the kernel, GPU and services. Each result is joined right
+        // before its first consumer.
+        auto key_derivation =
+            std::async(std::launch::async, [] { void(Core::Crypto::KeyManager::Instance()); });
+        auto loader_future =
+            std::async(std::launch::async, [this, &system, &filepath, program_index] {
+                return Loader::GetLoader(
+                    system, GetGameFileFromPath(virtual_filesystem, filepath), program_index);
+            });
+
+        const ResultStatus init_result{Init(system, emu_window)};
+
+        app_loader = loader_future.get();
         if (!app_loader) {
             LOG_CRITICAL(Core, "Failed to obtain loader for {}!", filepath);
+            Shutdown();
             return ResultStatus::ErrorGetLoader;
         }
-
-        ResultStatus init_result{Init(system, emu_window)};
         if (init_result != ResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to initialize system (Error {})!",
                          static_cast<int>(init_result));
@@ -234,6 +254,10 @@ struct System::Impl {
         telemetry_session->AddInitialInfo(*app_loader, fs_controller, *content_provider);
         auto main_process =
             Kernel::Process::Create(system, "main", Kernel::Process::ProcessType::Userland);
+
+        // Keys must be fully derived before the loader maps and decrypts the program.
+        key_derivation.get();
+
         const auto [load_result, load_parameters] = app_loader->Load(*main_process, system);
         if (load_result != Loader::ResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to load ROM (Error {})!", load_result);
@@ -414,6 +438,7 @@ struct System::Impl {
 
     std::unique_ptr<Core::PerfStats> perf_stats;
     Core::FrameLimiter frame_limiter;
+    Core::FramePacer frame_pacer;
 
     bool is_multicore{};
     bool is_async_gpu{};
@@ -616,6 +641,14 @@ const Core::FrameLimiter& System::FrameLimiter() const {
     return impl->frame_limiter;
 }
 
+Core::FramePacer& System::FramePacer() {
+    return impl->frame_pacer;
+}
+
+const Core::FramePacer& System::FramePacer() const {
+    return impl->frame_pacer;
+}
+
 Loader::ResultStatus System::GetGameName(std::string& out) const {
     return impl->GetGameName(out);
 }
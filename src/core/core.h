@@ -96,6 +96,7 @@ class CpuManager;
 class DeviceMemory;
 class ExclusiveMonitor;
 class FrameLimiter;
+class FramePacer;
 class PerfStats;
 class Reporter;
 class TelemetrySession;
@@ -299,6 +300,12 @@ public:
     /// Provides a constant referent to the frame limiter
     [[nodiscard]] const Core::FrameLimiter& FrameLimiter() const;
 
+    /// Provides a reference to the frame pacer
+    [[nodiscard]] Core::FramePacer& FramePacer();
+
+    /// Provides a constant reference to the frame pacer
+    [[nodiscard]] const Core::FramePacer& FramePacer() const;
+
     /// Gets the name of the current game
     [[nodiscard]] Loader::ResultStatus GetGameName(std::string& out) const;
 
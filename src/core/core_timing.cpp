@@ -16,6 +16,20 @@ namespace Core::Timing {
 
 constexpr s64 MAX_SLICE_LENGTH = 4000;
 
+// Events that land within this window of one another fire in the same wake of the timer thread,
+// and waits shorter than it are spun on the wall clock rather than slept. This absorbs the
+// scheduling granularity of the host OS timer, which a timed condition variable wait cannot
+// resolve.
+constexpr s64 TIMER_SLACK_NS = 100'000;
+
+// Timer wheel geometry: level 0 spans ~8.4ms in ~131us slots and level 1 spans ~537ms in ~8.4ms
+// slots. A level 0 slot is close to the timer slack, so nearly every periodic event inserts and
+// expires without ever touching level 1.
+constexpr u64 WHEEL_SHIFT_0 = 17;
+constexpr u64 WHEEL_SHIFT_1 = 23;
+constexpr u64 WHEEL_MASK = 63;
+static_assert(WHEEL_SHIFT_1 == WHEEL_SHIFT_0 + 6, "Each level 1 slot must span all of level 0");
+
 std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callback) {
     return std::make_shared<EventType>(std::move(callback), std::move(name));
 }
@@ -25,16 +39,7 @@ struct CoreTiming::Event {
     u64 fifo_order;
     std::uintptr_t user_data;
     std::weak_ptr<EventType> type;
-
-    // Sort by time, unless the times are the same, in which case sort by
-    // the order added to the queue
-    friend bool operator>(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-    }
-
-    friend bool operator<(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
-    }
+    Event* next;
 };
 
 CoreTiming::CoreTiming()
@@ -102,7 +107,176 @@ bool CoreTiming::IsRunning() const {
 }
 
 bool CoreTiming::HasPendingEvents() const {
-    return !(wait_set && event_queue.empty());
+    return !(wait_set && num_events.load(std::memory_order_relaxed) == 0);
+}
+
+CoreTiming::Event* CoreTiming::AcquireNode() {
+    if (free_list != nullptr) {
+        Event* ev = free_list;
+        free_list = ev->next;
+        return ev;
+    }
+    event_pool.push_back(std::make_unique<Event>());
+    return event_pool.back().get();
+}
+
+void CoreTiming::ReleaseNode(Event* ev) {
+    ev->type.reset();
+    ev->next = free_list;
+    free_list = ev;
+}
+
+void CoreTiming::InsertEvent(Event* ev) {
+    // Deadlines behind the cursor keep their time for ordering but are filed in the current slot
+    const u64 time = std::max(ev->time, wheel_time);
+    const u64 delta = time - wheel_time;
+    if ((delta >> WHEEL_SHIFT_0) < NUM_WHEEL_SLOTS) {
+        Event*& head = wheel_level0[(time >> WHEEL_SHIFT_0) & WHEEL_MASK];
+        ev->next = head;
+        head = ev;
+    } else if ((delta >> WHEEL_SHIFT_1) < NUM_WHEEL_SLOTS) {
+        Event*& head = wheel_level1[(time >> WHEEL_SHIFT_1) & WHEEL_MASK];
+        ev->next = head;
+        head = ev;
+    } else {
+        ev->next = overflow;
+        overflow = ev;
+    }
+}
+
+void CoreTiming::InsertDue(Event* ev) {
+    Event** link = &due_list;
+    while (*link != nullptr && std::tie((*link)->time, (*link)->fifo_order) <=
+                                   std::tie(ev->time, ev->fifo_order)) {
+        link = &(*link)->next;
+    }
+    ev->next = *link;
+    *link = ev;
+}
+
+void CoreTiming::CascadeWheel() {
+    const size_t slot = (wheel_time >> WHEEL_SHIFT_1) & WHEEL_MASK;
+    Event* node = wheel_level1[slot];
+    wheel_level1[slot] = nullptr;
+    while (node != nullptr) {
+        Event* const next = node->next;
+        InsertEvent(node);
+        node = next;
+    }
+    if (slot == 0) {
+        // The wheel crossed its full horizon; overflow events may be in range now
+        node = overflow;
+        overflow = nullptr;
+        while (node != nullptr) {
+            Event* const next = node->next;
+            InsertEvent(node);
+            node = next;
+        }
+    }
+}
+
+void CoreTiming::ExpireEvents(u64 target) {
+    if (num_events.load(std::memory_order_relaxed) == 0) {
+        // Nothing pending; snap the cursor so long idle periods are not walked slot by slot
+        wheel_time = std::max(wheel_time, target);
+        return;
+    }
+    // Expire whole slots while they lie entirely at or before the target
+    while ((((wheel_time >> WHEEL_SHIFT_0) + 1) << WHEEL_SHIFT_0) <= target) {
+        Event*& head = wheel_level0[(wheel_time >> WHEEL_SHIFT_0) & WHEEL_MASK];
+        // With the cursor mid-slot, a deadline a full rotation ahead can share the cursor's
+        // slot; hold such events back and refile them once the cursor has moved past the slot
+        // instead of letting them go due a rotation early.
+        Event* deferred = nullptr;
+        while (head != nullptr) {
+            Event* const ev = head;
+            head = ev->next;
+            if (ev->time <= target) {
+                InsertDue(ev);
+            } else {
+                ev->next = deferred;
+                deferred = ev;
+            }
+        }
+        wheel_time = ((wheel_time >> WHEEL_SHIFT_0) + 1) << WHEEL_SHIFT_0;
+        while (deferred != nullptr) {
+            Event* const next = deferred->next;
+            InsertEvent(deferred);
+            deferred = next;
+        }
+        if (((wheel_time >> WHEEL_SHIFT_0) & WHEEL_MASK) == 0) {
+            CascadeWheel();
+        }
+    }
+    if (wheel_time > target) {
+        return;
+    }
+    // Partially expire the slot the target lands in
+    Event** link = &wheel_level0[(target >> WHEEL_SHIFT_0) & WHEEL_MASK];
+    while (*link != nullptr) {
+        Event* const ev = *link;
+        if (ev->time <= target) {
+            *link = ev->next;
+            InsertDue(ev);
+        } else {
+            link = &ev->next;
+        }
+    }
+    wheel_time = target;
+}
+
+CoreTiming::Event* CoreTiming::PopDueEvent(u64 target) {
+    ExpireEvents(target);
+    Event* const ev = due_list;
+    if (ev != nullptr) {
+        due_list = ev->next;
+    }
+    return ev;
+}
+
+void CoreTiming::RemoveEvents(const EventType* type, const std::uintptr_t* user_data) {
+    const auto filter = [&](Event*& head) {
+        Event** link = &head;
+        while (*link != nullptr) {
+            Event* const ev = *link;
+            if (ev->type.lock().get() == type &&
+                (user_data == nullptr || ev->user_data == *user_data)) {
+                *link = ev->next;
+                ReleaseNode(ev);
+                num_events.fetch_sub(1, std::memory_order_relaxed);
+            } else {
+                link = &ev->next;
+            }
+        }
+    };
+    for (Event*& head : wheel_level0) {
+        filter(head);
+    }
+    for (Event*& head : wheel_level1) {
+        filter(head);
+    }
+    filter(overflow);
+    filter(due_list);
+}
+
+std::optional<u64> CoreTiming::NextEventTime() const {
+    std::optional<u64> next;
+    const auto scan = [&](const Event* head) {
+        for (const Event* ev = head; ev != nullptr; ev = ev->next) {
+            if (!next || ev->time < *next) {
+                next = ev->time;
+            }
+        }
+    };
+    for (const Event* head : wheel_level0) {
+        scan(head);
+    }
+    for (const Event* head : wheel_level1) {
+        scan(head);
+    }
+    scan(overflow);
+    scan(due_list);
+    return next;
 }
 
 void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
@@ -112,9 +286,13 @@ void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
         std::scoped_lock scope{basic_lock};
         const u64 timeout = static_cast<u64>((GetGlobalTimeNs() + ns_into_future).count());
 
-        event_queue.emplace_back(Event{timeout, event_fifo_id++, user_data, event_type});
-
-        std::push_heap(event_queue.begin(), event_queue.end(), std::greater<>());
+        Event* const ev = AcquireNode();
+        ev->time = timeout;
+        ev->fifo_order = event_fifo_id++;
+        ev->user_data = user_data;
+        ev->type = event_type;
+        InsertEvent(ev);
+        num_events.fetch_add(1, std::memory_order_relaxed);
     }
     event.Set();
 }
@@ -122,15 +300,7 @@ void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
 void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
                                  std::uintptr_t user_data) {
     std::scoped_lock scope{basic_lock};
-    const auto itr = std::remove_if(event_queue.begin(), event_queue.end(), [&](const Event& e) {
-        return e.type.lock().get() == event_type.get() && e.user_data == user_data;
-    });
-
-    // Removing random items breaks the invariant so we have to re-establish it.
-    if (itr != event_queue.end()) {
-        event_queue.erase(itr, event_queue.end());
-        std::make_heap(event_queue.begin(), event_queue.end(), std::greater<>());
-    }
+    RemoveEvents(event_type.get(), &user_data);
 }
 
 void CoreTiming::AddTicks(u64 ticks) {
@@ -139,9 +309,9 @@ void CoreTiming::AddTicks(u64 ticks) {
 }
 
 void CoreTiming::Idle() {
-    if (!event_queue.empty()) {
-        const u64 next_event_time = event_queue.front().time;
-        const u64 next_ticks = nsToCycles(std::chrono::nanoseconds(next_event_time)) + 10U;
+    std::scoped_lock lock{basic_lock};
+    if (const auto next_event_time = NextEventTime()) {
+        const u64 next_ticks = nsToCycles(std::chrono::nanoseconds(*next_event_time)) + 10U;
         if (next_ticks > ticks) {
             ticks = next_ticks;
         }
@@ -169,45 +339,55 @@ u64 CoreTiming::GetClockTicks() const {
 }
 
 void CoreTiming::ClearPendingEvents() {
-    event_queue.clear();
+    std::scoped_lock lock{basic_lock};
+    const auto drop = [this](Event*& head) {
+        while (head != nullptr) {
+            Event* const ev = head;
+            head = ev->next;
+            ReleaseNode(ev);
+        }
+    };
+    for (Event*& head : wheel_level0) {
+        drop(head);
+    }
+    for (Event*& head : wheel_level1) {
+        drop(head);
+    }
+    drop(overflow);
+    drop(due_list);
+    num_events.store(0, std::memory_order_relaxed);
 }
 
 void CoreTiming::RemoveEvent(const std::shared_ptr<EventType>& event_type) {
     std::scoped_lock lock{basic_lock};
-
-    const auto itr = std::remove_if(event_queue.begin(), event_queue.end(), [&](const Event& e) {
-        return e.type.lock().get() == event_type.get();
-    });
-
-    // Removing random items breaks the invariant so we have to re-establish it.
-    if (itr != event_queue.end()) {
-        event_queue.erase(itr, event_queue.end());
-        std::make_heap(event_queue.begin(), event_queue.end(), std::greater<>());
-    }
+    RemoveEvents(event_type.get(), nullptr);
 }
 
 std::optional<s64> CoreTiming::Advance() {
     std::scoped_lock lock{advance_lock, basic_lock};
     global_timer = GetGlobalTimeNs().count();
 
-    while (!event_queue.empty() && event_queue.front().time <= global_timer) {
-        Event evt = std::move(event_queue.front());
-        std::pop_heap(event_queue.begin(), event_queue.end(), std::greater<>());
-        event_queue.pop_back();
+    // Events within the slack window are coalesced into this wake instead of costing the timer
+    // thread a separate sub-granularity sleep each.
+    while (Event* const evt = PopDueEvent(global_timer + TIMER_SLACK_NS)) {
+        const auto event_type{evt->type.lock()};
+        const std::uintptr_t user_data = evt->user_data;
+        const u64 event_time = evt->time;
+        ReleaseNode(evt);
+        num_events.fetch_sub(1, std::memory_order_relaxed);
         basic_lock.unlock();
 
-        if (const auto event_type{evt.type.lock()}) {
-            event_type->callback(
-                evt.user_data, std::chrono::nanoseconds{static_cast<s64>(global_timer - evt.time)});
+        if (event_type) {
+            event_type->callback(user_data, std::chrono::nanoseconds{
+                                                static_cast<s64>(global_timer - event_time)});
         }
 
         basic_lock.lock();
         global_timer = GetGlobalTimeNs().count();
     }
 
-    if (!event_queue.empty()) {
-        const s64 next_time = event_queue.front().time - global_timer;
-        return next_time;
+    if (const auto next_event_time = NextEventTime()) {
+        return static_cast<s64>(*next_event_time) - static_cast<s64>(global_timer);
     } else {
         return std::nullopt;
     }
@@ -221,8 +401,22 @@ void CoreTiming::ThreadLoop() {
             const auto next_time = Advance();
             if (next_time) {
                 if (*next_time > 0) {
-                    std::chrono::nanoseconds next_time_ns = std::chrono::nanoseconds(*next_time);
-                    event.WaitFor(next_time_ns);
+                    const std::chrono::nanoseconds next_time_ns{*next_time};
+                    const auto deadline = GetGlobalTimeNs() + next_time_ns;
+                    bool wait_interrupted = false;
+                    if (*next_time > TIMER_SLACK_NS) {
+                        // Timed wait covers all but the last slack window. A Set() from
+                        // ScheduleEvent still interrupts it when a nearer event arrives.
+                        wait_interrupted =
+                            event.WaitFor(next_time_ns - std::chrono::nanoseconds{TIMER_SLACK_NS});
+                    }
+                    // Spin out the residue the OS timer cannot resolve. The clock reads use the
+                    // host's hardware counter when available, so this loop stays cheap and is
+                    // bounded by the slack window.
+                    while (!wait_interrupted && !paused && !shutting_down &&
+                           GetGlobalTimeNs() < deadline) {
+                        std::this_thread::yield();
+                    }
                 }
             } else {
                 wait_set = true;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <functional>
@@ -136,15 +137,41 @@ private:
     static void ThreadEntry(CoreTiming& instance);
     void ThreadLoop();
 
+    /// Takes a node from the free list, or grows the pool. Requires basic_lock to be held.
+    Event* AcquireNode();
+    /// Returns a node to the free list. Requires basic_lock to be held.
+    void ReleaseNode(Event* ev);
+    /// Files an event into the wheel level matching its distance from the cursor.
+    void InsertEvent(Event* ev);
+    /// Sorted insert into the due list by (time, fifo_order).
+    void InsertDue(Event* ev);
+    /// Feeds the level 1 slot at the cursor (and the overflow list on wrap) back into level 0.
+    void CascadeWheel();
+    /// Moves every event with a deadline at or before target onto the due list.
+    void ExpireEvents(u64 target);
+    /// Returns the earliest due event after expiring the wheel up to target, or nullptr.
+    Event* PopDueEvent(u64 target);
+    /// Unlinks and releases every pending event of a type; null user_data matches any.
+    void RemoveEvents(const EventType* type, const std::uintptr_t* user_data);
+    /// Returns the deadline of the earliest pending event, if any.
+    [[nodiscard]] std::optional<u64> NextEventTime() const;
+
     std::unique_ptr<Common::WallClock> clock;
 
     u64 global_timer = 0;
 
-    // The queue is a min-heap using std::make_heap/push_heap/pop_heap.
-    // We don't use std::priority_queue because we need to be able to serialize, unserialize and
-    // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't
-    // accomodated by the standard adaptor class.
-    std::vector<Event> event_queue;
+    // Pending events live in a two-level timer wheel of intrusive singly-linked lists, with the
+    // nodes recycled through a free list so kHz reschedulers never touch the allocator or
+    // reorder a heap. Events past the wheel horizon wait in an unsorted overflow list.
+    static constexpr size_t NUM_WHEEL_SLOTS = 64;
+    std::array<Event*, NUM_WHEEL_SLOTS> wheel_level0{};
+    std::array<Event*, NUM_WHEEL_SLOTS> wheel_level1{};
+    Event* overflow = nullptr;
+    Event* due_list = nullptr;
+    Event* free_list = nullptr;
+    std::vector<std::unique_ptr<Event>> event_pool;
+    u64 wheel_time = 0;
+    std::atomic<size_t> num_events{};
     u64 event_fifo_id = 0;
 
     std::shared_ptr<EventType> ev_lost;
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/cpu_topology.h"
 #include "common/fiber.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
@@ -14,6 +15,7 @@
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
+#include "core/settings.h"
 #include "video_core/gpu.h"
 
 namespace Core {
@@ -148,7 +150,8 @@ void CpuManager::MultiCoreRunSuspendThread() {
         auto core = kernel.GetCurrentHostThreadID();
         auto& scheduler = *kernel.CurrentScheduler();
         Kernel::KThread* current_thread = scheduler.GetCurrentThread();
-        Common::Fiber::YieldTo(current_thread->GetHostContext(), core_data[core].host_context);
+        Common::Fiber::YieldTo(current_thread->GetHostContext().get(),
+                               core_data[core].host_context.get());
         ASSERT(scheduler.ContextSwitchPending());
         ASSERT(core == kernel.GetCurrentHostThreadID());
         scheduler.RescheduleCurrentCore();
@@ -245,7 +248,8 @@ void CpuManager::SingleCoreRunSuspendThread() {
         auto core = kernel.GetCurrentHostThreadID();
         auto& scheduler = *kernel.CurrentScheduler();
         Kernel::KThread* current_thread = scheduler.GetCurrentThread();
-        Common::Fiber::YieldTo(current_thread->GetHostContext(), core_data[0].host_context);
+        Common::Fiber::YieldTo(current_thread->GetHostContext().get(),
+                               core_data[0].host_context.get());
         ASSERT(scheduler.ContextSwitchPending());
         ASSERT(core == kernel.GetCurrentHostThreadID());
         scheduler.RescheduleCurrentCore();
@@ -271,7 +275,8 @@ void CpuManager::PreemptSingleCore(bool from_running_enviroment) {
         scheduler.Unload(scheduler.GetCurrentThread());
 
         auto& next_scheduler = kernel.Scheduler(current_core);
-        Common::Fiber::YieldTo(current_thread->GetHostContext(), next_scheduler.ControlContext());
+        Common::Fiber::YieldTo(current_thread->GetHostContext().get(),
+                               next_scheduler.ControlContext().get());
     }
 
     // May have changed scheduler
@@ -329,6 +334,19 @@ void CpuManager::RunThread(std::size_t core) {
     MicroProfileOnThreadCreate(name.c_str());
     Common::SetCurrentThreadName(name.c_str());
     Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+    if (Settings::values.use_performance_core_affinity.GetValue()) {
+        const auto& topology = Common::GetCpuTopology();
+        if (topology.is_hybrid) {
+            // Keep the emulated cores off the efficiency cores, where a migration mid-session
+            // doubles frame times. The last performance CPU is left to the GPU thread when there
+            // are enough to go around.
+            std::span<const u32> cpus{topology.performance_cpus};
+            if (cpus.size() > Core::Hardware::NUM_CPU_CORES) {
+                cpus = cpus.first(cpus.size() - 1);
+            }
+            Common::SetCurrentThreadAffinity(cpus);
+        }
+    }
     auto& data = core_data[core];
     data.enter_barrier = std::make_unique<Common::Event>();
     data.exit_barrier = std::make_unique<Common::Event>();
@@ -363,7 +381,7 @@ void CpuManager::RunThread(std::size_t core) {
 
         auto current_thread = system.Kernel().CurrentScheduler()->GetCurrentThread();
         data.is_running = true;
-        Common::Fiber::YieldTo(data.host_context, current_thread->GetHostContext());
+        Common::Fiber::YieldTo(data.host_context.get(), current_thread->GetHostContext().get());
         data.is_running = false;
         data.is_paused = true;
         data.exit_barrier->Wait();
@@ -296,6 +296,10 @@ void KeyManager::DeriveGeneralPurposeKeys(std::size_t crypto_revision) {
 }
 
 RSAKeyPair<2048> KeyManager::GetETicketRSAKey() const {
+    if (eticket_rsa_key_cache) {
+        return *eticket_rsa_key_cache;
+    }
+
     if (IsAllZeroArray(eticket_extended_kek) || !HasKey(S128KeyType::ETicketRSAKek)) {
         return {};
     }
@@ -314,6 +318,7 @@ RSAKeyPair<2048> KeyManager::GetETicketRSAKey() const {
     std::memcpy(rsa_key.modulus.data(), extended_dec.data() + 0x100, rsa_key.modulus.size());
     std::memcpy(rsa_key.exponent.data(), extended_dec.data() + 0x200, rsa_key.exponent.size());
 
+    eticket_rsa_key_cache = rsa_key;
     return rsa_key;
 }
 
@@ -657,6 +662,7 @@ void KeyManager::LoadFromFile(const std::string& filename, bool is_title_keys) {
                 encrypted_keyblobs[index] = Common::HexStringToArray<0xB0>(out[1]);
             } else if (out[0].compare(0, 20, "eticket_extended_kek") == 0) {
                 eticket_extended_kek = Common::HexStringToArray<576>(out[1]);
+                eticket_rsa_key_cache.reset();
             } else {
                 for (const auto& kv : KEYS_VARIABLE_LENGTH) {
                     if (!ValidCryptoRevisionString(out[0], kv.second.size(), 2)) {
@@ -1100,6 +1106,7 @@ void KeyManager::DeriveETicket(PartitionDataManager& data,
     data.DecryptProdInfo(GetBISKey(0));
 
     eticket_extended_kek = data.GetETicketExtendedKek();
+    eticket_rsa_key_cache.reset();
     WriteKeyToFile(KeyCategory::Console, "eticket_extended_kek", eticket_extended_kek);
     PopulateTickets();
 }
@@ -282,6 +282,10 @@ private:
     std::array<std::array<u8, 0x90>, 0x20> keyblobs{};
     std::array<u8, 576> eticket_extended_kek{};
 
+    // The ETicket RSA key is unwrapped once and reused for every ticket parsed afterwards;
+    // cleared whenever the extended kek it derives from changes
+    mutable std::optional<RSAKeyPair<2048>> eticket_rsa_key_cache;
+
     bool dev_mode;
     void LoadFromFile(const std::string& filename, bool is_title_keys);
     void AttemptLoadKeyFile(const std::string& dir1, const std::string& dir2,
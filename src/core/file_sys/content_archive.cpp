@@ -14,6 +14,7 @@
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/nca_patch.h"
 #include "core/file_sys/partition_filesystem.h"
+#include "core/file_sys/vfs_cached.h"
 #include "core/file_sys/vfs_offset.h"
 #include "core/loader/loader.h"
 
@@ -504,7 +505,10 @@ VirtualFile NCA::Decrypt(const NCASectionHeader& s_header, VirtualFile in, u64 s
                 iv[i] = s_header.raw.section_ctr[8 - i - 1];
             }
             out->SetIV(iv);
-            return std::static_pointer_cast<VfsFile>(out);
+            // Cache decrypted blocks so seeks within the section do not decrypt the same data
+            // over and over
+            return std::static_pointer_cast<VfsFile>(
+                std::make_shared<CachedVfsFile>(std::move(out)));
         }
     case NCASectionCryptoType::XTS:
         // TODO(DarkLordZach): Find a test case for XTS-encrypted NCAs
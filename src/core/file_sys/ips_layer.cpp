@@ -9,6 +9,8 @@
 #include <string>
 #include <utility>
 
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/swap.h"
@@ -133,8 +135,38 @@ struct IPSwitchCompiler::IPSwitchPatch {
     std::map<u32, std::vector<u8>> records;
 };
 
+// Sidecar written next to the pchtxt holding its compiled records, so subsequent launches skip
+// the text parse entirely. Keyed by a hash of the source text; any edit to the patch file simply
+// makes the cache stale and it is regenerated.
+struct IPSwitchCacheHeader {
+    u32_le magic;
+    u32_le version;
+    u64_le source_hash;
+    std::array<u8, 0x20> build_id;
+    u32_le num_records;
+    u32_le reserved;
+};
+static_assert(sizeof(IPSwitchCacheHeader) == 0x38, "IPSwitchCacheHeader has incorrect size.");
+
+constexpr u32 IPSWITCH_CACHE_MAGIC = Common::MakeMagic('Y', 'I', 'P', 'C');
+constexpr u32 IPSWITCH_CACHE_VERSION = 1;
+constexpr char IPSWITCH_CACHE_EXTENSION[] = ".cache";
+
 IPSwitchCompiler::IPSwitchCompiler(VirtualFile patch_text_) : patch_text(std::move(patch_text_)) {
-    Parse();
+    const auto bytes = patch_text->ReadAllBytes();
+    const auto source_hash =
+        Common::CityHash64(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+
+    if (LoadFromCache(source_hash)) {
+        valid = true;
+        return;
+    }
+
+    Parse(bytes);
+    if (valid) {
+        Compile();
+        WriteCache(source_hash);
+    }
 }
 
 IPSwitchCompiler::~IPSwitchCompiler() = default;
@@ -179,8 +211,7 @@ void IPSwitchCompiler::ParseFlag(const std::string& line) {
     }
 }
 
-void IPSwitchCompiler::Parse() {
-    const auto bytes = patch_text->ReadAllBytes();
+void IPSwitchCompiler::Parse(const std::vector<u8>& bytes) {
     std::stringstream s;
     s.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
 
@@ -311,25 +342,148 @@ void IPSwitchCompiler::Parse() {
     valid = true;
 }
 
-VirtualFile IPSwitchCompiler::Apply(const VirtualFile& in) const {
-    if (in == nullptr || !valid)
-        return nullptr;
-
-    auto in_data = in->ReadAllBytes();
-
+// Flattens the parsed patches into the compiled record list. Application order is patch order,
+// then offset order within a patch, so overlaying in that same order preserves which write wins
+// where patches overlap.
+void IPSwitchCompiler::Compile() {
     for (const auto& patch : patches) {
         if (!patch.enabled)
             continue;
 
         for (const auto& record : patch.records) {
-            if (record.first >= in_data.size())
+            if (record.second.empty())
                 continue;
-            auto replace_size = record.second.size();
-            if (record.first + replace_size > in_data.size())
-                replace_size = in_data.size() - record.first;
-            for (std::size_t i = 0; i < replace_size; ++i)
-                in_data[i + record.first] = record.second[i];
+            Overlay(record.first, record.second);
+        }
+    }
+
+    // Only the compiled records are needed from here on
+    patches.clear();
+}
+
+void IPSwitchCompiler::Overlay(u32 offset, const std::vector<u8>& data) {
+    const auto end = offset + static_cast<u32>(data.size());
+
+    // Find the range of existing records that overlap or are adjacent to the new one
+    const auto first =
+        std::lower_bound(compiled.begin(), compiled.end(), offset,
+                         [](const CompiledRecord& record, u32 off) {
+                             return record.offset + record.data.size() < off;
+                         });
+    auto last = first;
+    while (last != compiled.end() && last->offset <= end) {
+        ++last;
+    }
+
+    if (first == last) {
+        compiled.insert(first, {offset, data});
+        return;
+    }
+
+    const auto merged_offset = std::min(offset, first->offset);
+    const auto merged_end =
+        std::max(end, std::prev(last)->offset + static_cast<u32>(std::prev(last)->data.size()));
+
+    std::vector<u8> merged(merged_end - merged_offset);
+    for (auto it = first; it != last; ++it) {
+        std::memcpy(merged.data() + (it->offset - merged_offset), it->data.data(),
+                    it->data.size());
+    }
+    std::memcpy(merged.data() + (offset - merged_offset), data.data(), data.size());
+
+    const auto insert_pos = compiled.erase(first, last);
+    compiled.insert(insert_pos, {merged_offset, std::move(merged)});
+}
+
+bool IPSwitchCompiler::LoadFromCache(u64 source_hash) {
+    const auto dir = patch_text->GetContainingDirectory();
+    if (dir == nullptr)
+        return false;
+
+    const auto cache_file = dir->GetFile(patch_text->GetName() + IPSWITCH_CACHE_EXTENSION);
+    if (cache_file == nullptr)
+        return false;
+
+    IPSwitchCacheHeader header{};
+    if (cache_file->ReadObject(&header) != sizeof(header))
+        return false;
+    if (header.magic != IPSWITCH_CACHE_MAGIC || header.version != IPSWITCH_CACHE_VERSION ||
+        header.source_hash != source_hash) {
+        LOG_DEBUG(Loader, "[IPSwitchCompiler ('{}')] Ignoring stale compiled patch cache",
+                  patch_text->GetName());
+        return false;
+    }
+
+    std::size_t offset = sizeof(header);
+    compiled.reserve(header.num_records);
+    for (u32 i = 0; i < header.num_records; ++i) {
+        std::array<u32_le, 2> entry{};
+        if (cache_file->ReadObject(&entry, offset) != sizeof(entry)) {
+            compiled.clear();
+            return false;
         }
+        offset += sizeof(entry);
+
+        std::vector<u8> data(entry[1]);
+        if (cache_file->Read(data.data(), data.size(), offset) != data.size()) {
+            compiled.clear();
+            return false;
+        }
+        offset += data.size();
+
+        compiled.push_back({entry[0], std::move(data)});
+    }
+
+    nso_build_id = header.build_id;
+    LOG_DEBUG(Loader, "[IPSwitchCompiler ('{}')] Loaded {} compiled records from cache",
+              patch_text->GetName(), compiled.size());
+    return true;
+}
+
+void IPSwitchCompiler::WriteCache(u64 source_hash) const {
+    const auto dir = patch_text->GetContainingDirectory();
+    if (dir == nullptr)
+        return;
+
+    const IPSwitchCacheHeader header{
+        .magic = IPSWITCH_CACHE_MAGIC,
+        .version = IPSWITCH_CACHE_VERSION,
+        .source_hash = source_hash,
+        .build_id = nso_build_id,
+        .num_records = static_cast<u32>(compiled.size()),
+    };
+
+    std::vector<u8> out(sizeof(header));
+    std::memcpy(out.data(), &header, sizeof(header));
+    for (const auto& record : compiled) {
+        const std::array<u32_le, 2> entry{record.offset, static_cast<u32>(record.data.size())};
+        const auto pos = out.size();
+        out.resize(pos + sizeof(entry) + record.data.size());
+        std::memcpy(out.data() + pos, &entry, sizeof(entry));
+        std::memcpy(out.data() + pos + sizeof(entry), record.data.data(), record.data.size());
+    }
+
+    // The mod directory may not be writable; the cache is purely an optimization, so failing to
+    // write it is not an error
+    const auto cache_file = dir->CreateFile(patch_text->GetName() + IPSWITCH_CACHE_EXTENSION);
+    if (cache_file == nullptr || !cache_file->Resize(out.size()) ||
+        cache_file->WriteBytes(out) != out.size()) {
+        LOG_DEBUG(Loader, "[IPSwitchCompiler ('{}')] Could not write compiled patch cache",
+                  patch_text->GetName());
+    }
+}
+
+VirtualFile IPSwitchCompiler::Apply(const VirtualFile& in) const {
+    if (in == nullptr || !valid)
+        return nullptr;
+
+    auto in_data = in->ReadAllBytes();
+
+    for (const auto& record : compiled) {
+        if (record.offset >= in_data.size())
+            continue;
+        const auto replace_size = std::min(record.data.size(), in_data.size() - record.offset);
+        std::memcpy(in_data.data() + record.offset, record.data.data(), replace_size);
     }
 
     return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
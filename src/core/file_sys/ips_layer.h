@@ -27,13 +27,25 @@ public:
 private:
     struct IPSwitchPatch;
 
+    /// A compiled, ready-to-apply span of replacement bytes. Records never overlap and are kept
+    /// sorted by offset, so Apply is a series of block copies.
+    struct CompiledRecord {
+        u32 offset;
+        std::vector<u8> data;
+    };
+
     void ParseFlag(const std::string& flag);
-    void Parse();
+    void Parse(const std::vector<u8>& bytes);
+    void Compile();
+    void Overlay(u32 offset, const std::vector<u8>& data);
+    bool LoadFromCache(u64 source_hash);
+    void WriteCache(u64 source_hash) const;
 
     bool valid = false;
 
     VirtualFile patch_text;
     std::vector<IPSwitchPatch> patches;
+    std::vector<CompiledRecord> compiled;
     std::array<u8, 0x20> nso_build_id{};
     bool is_little_endian = false;
     s64 offset_shift = 0;
@@ -12,71 +12,28 @@
 #include "core/file_sys/nca_patch.h"
 
 namespace FileSys {
-namespace {
-template <bool Subsection, typename BlockType, typename BucketType>
-std::pair<std::size_t, std::size_t> SearchBucketEntry(u64 offset, const BlockType& block,
-                                                      const BucketType& buckets) {
-    if constexpr (Subsection) {
-        const auto& last_bucket = buckets[block.number_buckets - 1];
-        if (offset >= last_bucket.entries[last_bucket.number_entries].address_patch) {
-            return {block.number_buckets - 1, last_bucket.number_entries};
-        }
-    } else {
-        ASSERT_MSG(offset <= block.size, "Offset is out of bounds in BKTR relocation block.");
-    }
-
-    std::size_t bucket_id = std::count_if(
-        block.base_offsets.begin() + 1, block.base_offsets.begin() + block.number_buckets,
-        [&offset](u64 base_offset) { return base_offset <= offset; });
-
-    const auto& bucket = buckets[bucket_id];
-
-    if (bucket.number_entries == 1) {
-        return {bucket_id, 0};
-    }
-
-    std::size_t low = 0;
-    std::size_t mid = 0;
-    std::size_t high = bucket.number_entries - 1;
-    while (low <= high) {
-        mid = (low + high) / 2;
-        if (bucket.entries[mid].address_patch > offset) {
-            high = mid - 1;
-        } else {
-            if (mid == bucket.number_entries - 1 ||
-                bucket.entries[mid + 1].address_patch > offset) {
-                return {bucket_id, mid};
-            }
-
-            low = mid + 1;
-        }
-    }
-    UNREACHABLE_MSG("Offset could not be found in BKTR block.");
-    return {0, 0};
-}
-} // Anonymous namespace
 
 BKTR::BKTR(VirtualFile base_romfs_, VirtualFile bktr_romfs_, RelocationBlock relocation_,
            std::vector<RelocationBucket> relocation_buckets_, SubsectionBlock subsection_,
            std::vector<SubsectionBucket> subsection_buckets_, bool is_encrypted_,
            Core::Crypto::Key128 key_, u64 base_offset_, u64 ivfc_offset_,
            std::array<u8, 8> section_ctr_)
-    : relocation(relocation_), relocation_buckets(std::move(relocation_buckets_)),
-      subsection(subsection_), subsection_buckets(std::move(subsection_buckets_)),
-      base_romfs(std::move(base_romfs_)), bktr_romfs(std::move(bktr_romfs_)),
-      encrypted(is_encrypted_), key(key_), base_offset(base_offset_), ivfc_offset(ivfc_offset_),
-      section_ctr(section_ctr_) {
-    for (std::size_t i = 0; i < relocation.number_buckets - 1; ++i) {
-        relocation_buckets[i].entries.push_back({relocation.base_offsets[i + 1], 0, 0});
+    : relocation(relocation_), subsection(subsection_), base_romfs(std::move(base_romfs_)),
+      bktr_romfs(std::move(bktr_romfs_)), encrypted(is_encrypted_), key(key_),
+      base_offset(base_offset_), ivfc_offset(ivfc_offset_), section_ctr(section_ctr_) {
+    // The bucket tree is only a storage format; flattening it into one sorted array per table
+    // makes a lookup a single binary search and lets sequential reads resume from a cursor
+    for (std::size_t i = 0; i < relocation.number_buckets; ++i) {
+        const auto& entries = relocation_buckets_[i].entries;
+        relocation_entries.insert(relocation_entries.end(), entries.begin(), entries.end());
     }
+    relocation_entries.push_back({relocation.size, 0, 0});
 
-    for (std::size_t i = 0; i < subsection.number_buckets - 1; ++i) {
-        subsection_buckets[i].entries.push_back({subsection_buckets[i + 1].entries[0].address_patch,
-                                                 {0},
-                                                 subsection_buckets[i + 1].entries[0].ctr});
+    for (std::size_t i = 0; i < subsection.number_buckets; ++i) {
+        const auto& entries = subsection_buckets_[i].entries;
+        subsection_entries.insert(subsection_entries.end(), entries.begin(), entries.end());
     }
-
-    relocation_buckets.back().entries.push_back({relocation.size, 0, 0});
+    subsection_entries.push_back({subsection.size, {0}, 0});
 }
 
 BKTR::~BKTR() = default;
@@ -154,29 +111,71 @@ std::size_t BKTR::Read(u8* data, std::size_t length, std::size_t offset) const {
 }
 
 RelocationEntry BKTR::GetRelocationEntry(u64 offset) const {
-    const auto res = SearchBucketEntry<false>(offset, relocation, relocation_buckets);
-    return relocation_buckets[res.first].entries[res.second];
+    return relocation_entries[FindRelocationIndex(offset)];
 }
 
 RelocationEntry BKTR::GetNextRelocationEntry(u64 offset) const {
-    const auto res = SearchBucketEntry<false>(offset, relocation, relocation_buckets);
-    const auto bucket = relocation_buckets[res.first];
-    if (res.second + 1 < bucket.entries.size())
-        return bucket.entries[res.second + 1];
-    return relocation_buckets[res.first + 1].entries[0];
+    return relocation_entries[FindRelocationIndex(offset) + 1];
 }
 
 SubsectionEntry BKTR::GetSubsectionEntry(u64 offset) const {
-    const auto res = SearchBucketEntry<true>(offset, subsection, subsection_buckets);
-    return subsection_buckets[res.first].entries[res.second];
+    return subsection_entries[FindSubsectionIndex(offset)];
 }
 
 SubsectionEntry BKTR::GetNextSubsectionEntry(u64 offset) const {
-    const auto res = SearchBucketEntry<true>(offset, subsection, subsection_buckets);
-    const auto bucket = subsection_buckets[res.first];
-    if (res.second + 1 < bucket.entries.size())
-        return bucket.entries[res.second + 1];
-    return subsection_buckets[res.first + 1].entries[0];
+    return subsection_entries[FindSubsectionIndex(offset) + 1];
+}
+
+std::size_t BKTR::FindRelocationIndex(u64 offset) const {
+    ASSERT_MSG(offset <= relocation.size, "Offset is out of bounds in BKTR relocation block.");
+
+    // Reads through a patched RomFS are overwhelmingly sequential, so the entry resolved by the
+    // previous read usually still covers this offset or is directly followed by the one that does
+    const auto covers = [this, offset](std::size_t index) {
+        return relocation_entries[index].address_patch <= offset &&
+               offset < relocation_entries[index + 1].address_patch;
+    };
+    if (covers(relocation_cursor)) {
+        return relocation_cursor;
+    }
+    if (relocation_cursor + 2 < relocation_entries.size() && covers(relocation_cursor + 1)) {
+        return ++relocation_cursor;
+    }
+
+    const auto next = std::upper_bound(
+        relocation_entries.begin(), relocation_entries.end(), offset,
+        [](u64 off, const RelocationEntry& entry) { return off < entry.address_patch; });
+    ASSERT_MSG(next != relocation_entries.begin(), "Offset could not be found in BKTR block.");
+    relocation_cursor =
+        static_cast<std::size_t>(std::distance(relocation_entries.begin(), next)) - 1;
+    return relocation_cursor;
+}
+
+std::size_t BKTR::FindSubsectionIndex(u64 offset) const {
+    const auto covers = [this, offset](std::size_t index) {
+        return subsection_entries[index].address_patch <= offset &&
+               offset < subsection_entries[index + 1].address_patch;
+    };
+    if (covers(subsection_cursor)) {
+        return subsection_cursor;
+    }
+    if (subsection_cursor + 2 < subsection_entries.size() && covers(subsection_cursor + 1)) {
+        return ++subsection_cursor;
+    }
+
+    // Offsets past the terminator resolve to the last real entry, as before
+    if (offset >= subsection_entries.back().address_patch) {
+        subsection_cursor = subsection_entries.size() - 2;
+        return subsection_cursor;
+    }
+
+    const auto next = std::upper_bound(
+        subsection_entries.begin(), subsection_entries.end(), offset,
+        [](u64 off, const SubsectionEntry& entry) { return off < entry.address_patch; });
+    ASSERT_MSG(next != subsection_entries.begin(), "Offset could not be found in BKTR block.");
+    subsection_cursor =
+        static_cast<std::size_t>(std::distance(subsection_entries.begin(), next)) - 1;
+    return subsection_cursor;
 }
 
 std::string BKTR::GetName() const {
@@ -123,10 +123,21 @@ private:
     SubsectionEntry GetSubsectionEntry(u64 offset) const;
     SubsectionEntry GetNextSubsectionEntry(u64 offset) const;
 
+    std::size_t FindRelocationIndex(u64 offset) const;
+    std::size_t FindSubsectionIndex(u64 offset) const;
+
     RelocationBlock relocation;
-    std::vector<RelocationBucket> relocation_buckets;
     SubsectionBlock subsection;
-    std::vector<SubsectionBucket> subsection_buckets;
+
+    // Relocation and subsection entries flattened out of their bucket trees into single sorted
+    // arrays, each terminated by a sentinel entry, so a lookup is one binary search at worst
+    std::vector<RelocationEntry> relocation_entries;
+    std::vector<SubsectionEntry> subsection_entries;
+
+    // Indices of the entries resolved by the previous read; sequential reads hit these without
+    // searching. Mutated by reads like the cipher state below.
+    mutable std::size_t relocation_cursor = 0;
+    mutable std::size_t subsection_cursor = 0;
 
     // Should be the raw base romfs, decrypted.
     VirtualFile base_romfs;
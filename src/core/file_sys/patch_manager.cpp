@@ -154,13 +154,8 @@ VirtualDir PatchManager::PatchExeFS(VirtualDir exefs) const {
     }
 
     // LayeredExeFS
-    const auto load_dir = fs_controller.GetModificationLoadRoot(title_id);
-    if (load_dir != nullptr && load_dir->GetSize() > 0) {
-        auto patch_dirs = load_dir->GetSubdirectories();
-        std::sort(
-            patch_dirs.begin(), patch_dirs.end(),
-            [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-
+    const auto& patch_dirs = GetPatchDirs();
+    if (!patch_dirs.empty()) {
         std::vector<VirtualDir> layers;
         layers.reserve(patch_dirs.size() + 1);
         for (const auto& subdir : patch_dirs) {
@@ -204,11 +199,11 @@ std::vector<VirtualFile> PatchManager::CollectPatches(const std::vector<VirtualD
                     if (build_id == this_build_id)
                         out.push_back(file);
                 } else if (file->GetExtension() == "pchtxt") {
-                    IPSwitchCompiler compiler{file};
-                    if (!compiler.IsValid())
+                    const auto compiler = GetIPSwitchCompiler(file);
+                    if (!compiler->IsValid())
                         continue;
 
-                    auto this_build_id = Common::HexToString(compiler.GetBuildID());
+                    auto this_build_id = Common::HexToString(compiler->GetBuildID());
                     this_build_id =
                         this_build_id.substr(0, this_build_id.find_last_not_of('0') + 1);
 
@@ -222,6 +217,34 @@ std::vector<VirtualFile> PatchManager::CollectPatches(const std::vector<VirtualD
     return out;
 }
 
+const std::vector<VirtualDir>& PatchManager::GetPatchDirs() const {
+    if (!patch_dirs_cache.has_value()) {
+        patch_dirs_cache.emplace();
+        const auto load_dir = fs_controller.GetModificationLoadRoot(title_id);
+        if (load_dir != nullptr && load_dir->GetSize() > 0) {
+            *patch_dirs_cache = load_dir->GetSubdirectories();
+            std::sort(patch_dirs_cache->begin(), patch_dirs_cache->end(),
+                      [](const VirtualDir& l, const VirtualDir& r) {
+                          return l->GetName() < r->GetName();
+                      });
+        }
+    }
+    return *patch_dirs_cache;
+}
+
+std::shared_ptr<IPSwitchCompiler> PatchManager::GetIPSwitchCompiler(
+    const VirtualFile& file) const {
+    const auto key = file->GetFullPath();
+    const auto iter = ipswitch_cache.find(key);
+    if (iter != ipswitch_cache.end()) {
+        return iter->second;
+    }
+
+    auto compiler = std::make_shared<IPSwitchCompiler>(file);
+    ipswitch_cache.emplace(key, compiler);
+    return compiler;
+}
+
 std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::string& name) const {
     if (nso.size() < sizeof(Loader::NSOHeader)) {
         return nso;
@@ -258,10 +281,7 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
         return nso;
     }
 
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-    const auto patches = CollectPatches(patch_dirs, build_id);
+    const auto patches = CollectPatches(GetPatchDirs(), build_id);
 
     auto out = nso;
     for (const auto& patch_file : patches) {
@@ -274,8 +294,8 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
         } else if (patch_file->GetExtension() == "pchtxt") {
             LOG_INFO(Loader, "    - Applying IPSwitch patch from mod \"{}\"",
                      patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
-            const IPSwitchCompiler compiler{patch_file};
-            const auto patched = compiler.Apply(std::make_shared<VectorVfsFile>(out));
+            const auto compiler = GetIPSwitchCompiler(patch_file);
+            const auto patched = compiler->Apply(std::make_shared<VectorVfsFile>(out));
             if (patched != nullptr)
                 out = patched->ReadAllBytes();
         }
@@ -301,11 +321,7 @@ bool PatchManager::HasNSOPatch(const BuildID& build_id_) const {
         return false;
     }
 
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-
-    return !CollectPatches(patch_dirs, build_id).empty();
+    return !CollectPatches(GetPatchDirs(), build_id).empty();
 }
 
 std::vector<Core::Memory::CheatEntry> PatchManager::CreateCheatList(
@@ -317,12 +333,9 @@ std::vector<Core::Memory::CheatEntry> PatchManager::CreateCheatList(
     }
 
     const auto& disabled = Settings::values.disabled_addons[title_id];
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
 
     std::vector<Core::Memory::CheatEntry> out;
-    for (const auto& subdir : patch_dirs) {
+    for (const auto& subdir : GetPatchDirs()) {
         if (std::find(disabled.cbegin(), disabled.cend(), subdir->GetName()) != disabled.cend()) {
             continue;
         }
@@ -344,10 +357,9 @@ std::vector<Core::Memory::CheatEntry> PatchManager::CreateCheatList(
 }
 
 static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType type,
-                           const Service::FileSystem::FileSystemController& fs_controller) {
-    const auto load_dir = fs_controller.GetModificationLoadRoot(title_id);
+                           const std::vector<VirtualDir>& patch_dirs) {
     if ((type != ContentRecordType::Program && type != ContentRecordType::Data) ||
-        load_dir == nullptr || load_dir->GetSize() <= 0) {
+        patch_dirs.empty()) {
         return;
     }
 
@@ -357,9 +369,6 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
     }
 
     const auto& disabled = Settings::values.disabled_addons[title_id];
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
 
     std::vector<VirtualDir> layers;
     std::vector<VirtualDir> layers_ext;
@@ -443,7 +452,7 @@ VirtualFile PatchManager::PatchRomFS(VirtualFile romfs, u64 ivfc_offset, Content
     }
 
     // LayeredFS
-    ApplyLayeredFS(romfs, title_id, type, fs_controller);
+    ApplyLayeredFS(romfs, title_id, type, GetPatchDirs());
 
     return romfs;
 }
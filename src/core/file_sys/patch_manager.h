@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 #include "common/common_types.h"
 #include "core/file_sys/nca_metadata.h"
 #include "core/file_sys/vfs_types.h"
@@ -24,6 +25,7 @@ class FileSystemController;
 namespace FileSys {
 
 class ContentProvider;
+class IPSwitchCompiler;
 class NCA;
 class NACP;
 
@@ -86,9 +88,21 @@ private:
     [[nodiscard]] std::vector<VirtualFile> CollectPatches(const std::vector<VirtualDir>& patch_dirs,
                                                           const std::string& build_id) const;
 
+    // Returns the sorted listing of the title's modification directory, built on first use.
+    [[nodiscard]] const std::vector<VirtualDir>& GetPatchDirs() const;
+
+    // Returns the parsed form of an IPSwitch patch file, parsing it on first use.
+    [[nodiscard]] std::shared_ptr<IPSwitchCompiler> GetIPSwitchCompiler(
+        const VirtualFile& file) const;
+
     u64 title_id;
     const Service::FileSystem::FileSystemController& fs_controller;
     const ContentProvider& content_provider;
+
+    // Every module of a title walks the same patch directories and patch files while it loads,
+    // so the directory listing and the parsed IPSwitch patches are only built once
+    mutable std::optional<std::vector<VirtualDir>> patch_dirs_cache;
+    mutable std::map<std::string, std::shared_ptr<IPSwitchCompiler>> ipswitch_cache;
 };
 
 } // namespace FileSys
@@ -3,13 +3,18 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <random>
 #include <regex>
+#include <thread>
 #include <mbedtls/sha256.h>
 #include "common/assert.h"
 #include "common/file_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
+#include "common/thread.h"
+#include "common/thread_worker.h"
 #include "core/crypto/key_manager.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
@@ -406,28 +411,51 @@ std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
 }
 
 void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
+    // Opening files goes through the backing filesystem's non-thread-safe caches, so it stays
+    // serial; decrypting and parsing each meta NCA is independent and is fanned out to workers.
+    std::vector<std::pair<NcaID, VirtualFile>> files;
+    files.reserve(ids.size());
     for (const auto& id : ids) {
-        const auto file = GetFileAtID(id);
-
-        if (file == nullptr)
-            continue;
-        const auto nca = std::make_shared<NCA>(parser(file, id), nullptr, 0);
-        if (nca->GetStatus() != Loader::ResultStatus::Success ||
-            nca->GetType() != NCAContentType::Meta) {
-            continue;
+        auto file = GetFileAtID(id);
+        if (file != nullptr) {
+            files.emplace_back(id, std::move(file));
         }
+    }
+    if (files.empty()) {
+        return;
+    }
 
-        const auto section0 = nca->GetSubdirectories()[0];
-
-        for (const auto& section0_file : section0->GetFiles()) {
-            if (section0_file->GetExtension() != "cnmt")
-                continue;
-
-            meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
-            meta_id.insert_or_assign(nca->GetTitleId(), id);
-            break;
-        }
+    static Common::ThreadWorker workers{
+        std::max<std::size_t>(std::thread::hardware_concurrency() / 2, 1), "yuzu:CacheScan"};
+    std::mutex meta_mutex;
+    std::atomic<u32> remaining_files{static_cast<u32>(files.size())};
+    Common::Event completion;
+
+    for (const auto& entry : files) {
+        workers.QueueWork([this, &entry, &meta_mutex, &remaining_files, &completion] {
+            const auto& [id, file] = entry;
+            const auto nca = std::make_shared<NCA>(parser(file, id), nullptr, 0);
+            if (nca->GetStatus() == Loader::ResultStatus::Success &&
+                nca->GetType() == NCAContentType::Meta) {
+                const auto section0 = nca->GetSubdirectories()[0];
+
+                for (const auto& section0_file : section0->GetFiles()) {
+                    if (section0_file->GetExtension() != "cnmt")
+                        continue;
+
+                    CNMT cnmt(section0_file);
+                    std::lock_guard lock{meta_mutex};
+                    meta.insert_or_assign(nca->GetTitleId(), std::move(cnmt));
+                    meta_id.insert_or_assign(nca->GetTitleId(), id);
+                    break;
+                }
+            }
+            if (remaining_files.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                completion.Set();
+            }
+        });
     }
+    completion.Wait();
 }
 
 void RegisteredCache::AccumulateYuzuMeta() {
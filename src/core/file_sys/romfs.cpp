@@ -2,7 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/string_util.h"
@@ -54,20 +56,22 @@ struct FileEntry {
 static_assert(sizeof(FileEntry) == 0x20, "FileEntry has incorrect size.");
 
 template <typename Entry>
-std::pair<Entry, std::string> GetEntry(const VirtualFile& file, std::size_t offset) {
+std::pair<Entry, std::string> GetEntry(const std::vector<u8>& table, std::size_t offset) {
     Entry entry{};
-    if (file->ReadObject(&entry, offset) != sizeof(Entry))
+    if (offset + sizeof(Entry) > table.size())
         return {};
-    std::string string(entry.name_length, '\0');
-    if (file->ReadArray(&string[0], string.size(), offset + sizeof(Entry)) != string.size())
+    std::memcpy(&entry, table.data() + offset, sizeof(Entry));
+    if (offset + sizeof(Entry) + entry.name_length > table.size())
         return {};
-    return {entry, string};
+    return {entry, std::string(reinterpret_cast<const char*>(table.data() + offset + sizeof(Entry)),
+                               entry.name_length)};
 }
 
-void ProcessFile(VirtualFile file, std::size_t file_offset, std::size_t data_offset,
-                 u32 this_file_offset, std::shared_ptr<VectorVfsDirectory> parent) {
+void ProcessFile(const VirtualFile& file, const std::vector<u8>& file_table,
+                 std::size_t data_offset, u32 this_file_offset,
+                 const std::shared_ptr<VectorVfsDirectory>& parent) {
     while (true) {
-        auto entry = GetEntry<FileEntry>(file, file_offset + this_file_offset);
+        auto entry = GetEntry<FileEntry>(file_table, this_file_offset);
 
         parent->AddFile(std::make_shared<OffsetVfsFile>(
             file, entry.first.size, entry.first.offset + data_offset, entry.second));
@@ -79,20 +83,21 @@ void ProcessFile(VirtualFile file, std::size_t file_offset, std::size_t data_off
     }
 }
 
-void ProcessDirectory(VirtualFile file, std::size_t dir_offset, std::size_t file_offset,
-                      std::size_t data_offset, u32 this_dir_offset,
-                      std::shared_ptr<VectorVfsDirectory> parent) {
+void ProcessDirectory(const VirtualFile& file, const std::vector<u8>& dir_table,
+                      const std::vector<u8>& file_table, std::size_t data_offset,
+                      u32 this_dir_offset, const std::shared_ptr<VectorVfsDirectory>& parent) {
     while (true) {
-        auto entry = GetEntry<DirectoryEntry>(file, dir_offset + this_dir_offset);
+        // Entries are read 4 bytes in, skipping the parent field
+        auto entry = GetEntry<DirectoryEntry>(dir_table, this_dir_offset + 4);
         auto current = std::make_shared<VectorVfsDirectory>(
             std::vector<VirtualFile>{}, std::vector<VirtualDir>{}, entry.second);
 
         if (entry.first.child_file != ROMFS_ENTRY_EMPTY) {
-            ProcessFile(file, file_offset, data_offset, entry.first.child_file, current);
+            ProcessFile(file, file_table, data_offset, entry.first.child_file, current);
         }
 
         if (entry.first.child_dir != ROMFS_ENTRY_EMPTY) {
-            ProcessDirectory(file, dir_offset, file_offset, data_offset, entry.first.child_dir,
+            ProcessDirectory(file, dir_table, file_table, data_offset, entry.first.child_dir,
                              current);
         }
 
@@ -112,14 +117,23 @@ VirtualDir ExtractRomFS(VirtualFile file, RomFSExtractionType type) {
     if (header.header_size != sizeof(RomFSHeader))
         return nullptr;
 
-    const u64 file_offset = header.file_meta.offset;
-    const u64 dir_offset = header.directory_meta.offset + 4;
+    // Read both metadata tables up front; parsing them in place costs two small reads per entry
+    // through whatever crypto or patch layers back the RomFS
+    const auto dir_table =
+        file->ReadBytes(static_cast<std::size_t>(header.directory_meta.size),
+                        static_cast<std::size_t>(header.directory_meta.offset));
+    const auto file_table = file->ReadBytes(static_cast<std::size_t>(header.file_meta.size),
+                                            static_cast<std::size_t>(header.file_meta.offset));
+    if (dir_table.size() != header.directory_meta.size ||
+        file_table.size() != header.file_meta.size) {
+        return nullptr;
+    }
 
     auto root =
         std::make_shared<VectorVfsDirectory>(std::vector<VirtualFile>{}, std::vector<VirtualDir>{},
                                              file->GetName(), file->GetContainingDirectory());
 
-    ProcessDirectory(file, dir_offset, file_offset, header.data_offset, 0, root);
+    ProcessDirectory(file, dir_table, file_table, header.data_offset, 0, root);
 
     VirtualDir out = std::move(root);
 
@@ -5,9 +5,14 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 222236> FONT_CHINESE_TRADITIONAL;
+/// Size in bytes of FONT_CHINESE_TRADITIONAL once decompressed
+constexpr std::size_t FONT_CHINESE_TRADITIONAL_DECOMPRESSED_SIZE = 222236;
+
+/// zstd-compressed font data; decompress with Common::Compression::DecompressDataZSTD
+extern const std::array<unsigned char, 75017> FONT_CHINESE_TRADITIONAL;
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -5,9 +5,14 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 293516> FONT_EXTENDED_CHINESE_SIMPLIFIED;
+/// Size in bytes of FONT_EXTENDED_CHINESE_SIMPLIFIED once decompressed
+constexpr std::size_t FONT_EXTENDED_CHINESE_SIMPLIFIED_DECOMPRESSED_SIZE = 293516;
+
+/// zstd-compressed font data; decompress with Common::Compression::DecompressDataZSTD
+extern const std::array<unsigned char, 109833> FONT_EXTENDED_CHINESE_SIMPLIFIED;
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -6,384 +6,231 @@
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-const std::array<unsigned char, 6024> FONT_NINTENDO_EXTENDED{{
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x00, 0x03, 0x00, 0x60, 0x4F, 0x53, 0x2F, 0x32,
-    0x34, 0x00, 0x1E, 0x26, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6D, 0x61, 0x70,
-    0xC1, 0xE7, 0xC8, 0xF3, 0x00, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x01, 0x72, 0x63, 0x76, 0x74, 0x20,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x00, 0x00, 0x00, 0x06, 0x66, 0x70, 0x67, 0x6D,
-    0x06, 0x59, 0x9C, 0x37, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0x73, 0x67, 0x61, 0x73, 0x70,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x17, 0x80, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6C, 0x79, 0x66,
-    0x50, 0x0B, 0xEA, 0xFA, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0x04, 0x68, 0x65, 0x61, 0x64,
-    0x18, 0x65, 0x81, 0x09, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-    0x09, 0x88, 0x03, 0x86, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78,
-    0x0A, 0xF0, 0x01, 0x94, 0x00, 0x00, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x42, 0x6C, 0x6F, 0x63, 0x61,
-    0x34, 0x80, 0x30, 0x6E, 0x00, 0x00, 0x05, 0x14, 0x00, 0x00, 0x00, 0x3A, 0x6D, 0x61, 0x78, 0x70,
-    0x02, 0x2C, 0x00, 0x72, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65,
-    0xDB, 0xC5, 0x42, 0x4D, 0x00, 0x00, 0x14, 0x54, 0x00, 0x00, 0x01, 0xFE, 0x70, 0x6F, 0x73, 0x74,
-    0xF4, 0xB4, 0xAC, 0xAB, 0x00, 0x00, 0x16, 0x54, 0x00, 0x00, 0x01, 0x2A, 0x70, 0x72, 0x65, 0x70,
-    0x1C, 0xFC, 0x7D, 0x9C, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0xC9, 0x16, 0x5B, 0x71, 0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x0B, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xD9, 0x44, 0x2F, 0x5D, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x02, 0x0D, 0xA7,
-    0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x9A, 0xFF, 0x80, 0x02, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xEC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x71,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xC4, 0x01, 0x90, 0x00, 0x05,
-    0x00, 0x04, 0x00, 0xD2, 0x00, 0xD2, 0x00, 0x00, 0x01, 0x26, 0x00, 0xD2, 0x00, 0xD2, 0x00, 0x00,
-    0x03, 0xDA, 0x00, 0x68, 0x02, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0xC0, 0x00, 0x0D, 0xE0, 0xF0, 0x03, 0x9A, 0xFF, 0x80,
-    0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x02, 0xCD, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x04, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14,
-    0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14,
-    0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14,
-    0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x20, 0xE0, 0xA9, 0xE0, 0xB4,
-    0xE0, 0xE9, 0xE0, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x20, 0xE0, 0xA0,
-    0xE0, 0xB3, 0xE0, 0xE0, 0xE0, 0xEF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF5, 0xFF, 0xE3, 0x1F, 0x64,
-    0x1F, 0x5B, 0x1F, 0x30, 0x1F, 0x2B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x2C, 0x4B, 0xB8, 0x00, 0x09, 0x50, 0x58, 0xB1, 0x01, 0x01, 0x8E, 0x59, 0xB8,
-    0x01, 0xFF, 0x85, 0xB8, 0x00, 0x44, 0x1D, 0xB9, 0x00, 0x09, 0x00, 0x03, 0x5F, 0x5E, 0x2D, 0xB8,
-    0x00, 0x01, 0x2C, 0x20, 0x20, 0x45, 0x69, 0x44, 0xB0, 0x01, 0x60, 0x2D, 0xB8, 0x00, 0x02, 0x2C,
-    0xB8, 0x00, 0x01, 0x2A, 0x21, 0x2D, 0xB8, 0x00, 0x03, 0x2C, 0x20, 0x46, 0xB0, 0x03, 0x25, 0x46,
-    0x52, 0x58, 0x23, 0x59, 0x20, 0x8A, 0x20, 0x8A, 0x49, 0x64, 0x8A, 0x20, 0x46, 0x20, 0x68, 0x61,
-    0x64, 0xB0, 0x04, 0x25, 0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8A, 0x59, 0x2F,
-    0x20, 0xB0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xB0, 0x00, 0x54, 0x58, 0x21, 0xB0, 0x40, 0x59, 0x1B,
-    0x69, 0x20, 0xB0, 0x00, 0x54, 0x58, 0x21, 0xB0, 0x40, 0x65, 0x59, 0x59, 0x3A, 0x2D, 0xB8, 0x00,
-    0x04, 0x2C, 0x20, 0x46, 0xB0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8A, 0x59, 0x20, 0x46, 0x20,
-    0x6A, 0x61, 0x64, 0xB0, 0x04, 0x25, 0x46, 0x20, 0x6A, 0x61, 0x64, 0x52, 0x58, 0x23, 0x8A, 0x59,
-    0x2F, 0xFD, 0x2D, 0xB8, 0x00, 0x05, 0x2C, 0x4B, 0x20, 0xB0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58,
-    0xB0, 0x80, 0x44, 0x1B, 0xB0, 0x40, 0x44, 0x59, 0x1B, 0x21, 0x21, 0x20, 0x45, 0xB0, 0xC0, 0x50,
-    0x58, 0xB0, 0xC0, 0x44, 0x1B, 0x21, 0x59, 0x59, 0x2D, 0xB8, 0x00, 0x06, 0x2C, 0x20, 0x20, 0x45,
-    0x69, 0x44, 0xB0, 0x01, 0x60, 0x20, 0x20, 0x45, 0x7D, 0x69, 0x18, 0x44, 0xB0, 0x01, 0x60, 0x2D,
-    0xB8, 0x00, 0x07, 0x2C, 0xB8, 0x00, 0x06, 0x2A, 0x2D, 0xB8, 0x00, 0x08, 0x2C, 0x4B, 0x20, 0xB0,
-    0x03, 0x26, 0x53, 0x58, 0xB0, 0x40, 0x1B, 0xB0, 0x00, 0x59, 0x8A, 0x8A, 0x20, 0xB0, 0x03, 0x26,
-    0x53, 0x58, 0x23, 0x21, 0xB0, 0x80, 0x8A, 0x8A, 0x1B, 0x8A, 0x23, 0x59, 0x20, 0xB0, 0x03, 0x26,
-    0x53, 0x58, 0x23, 0x21, 0xB8, 0x00, 0xC0, 0x8A, 0x8A, 0x1B, 0x8A, 0x23, 0x59, 0x20, 0xB0, 0x03,
-    0x26, 0x53, 0x58, 0x23, 0x21, 0xB8, 0x01, 0x00, 0x8A, 0x8A, 0x1B, 0x8A, 0x23, 0x59, 0x20, 0xB0,
-    0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xB8, 0x01, 0x40, 0x8A, 0x8A, 0x1B, 0x8A, 0x23, 0x59, 0x20,
-    0xB8, 0x00, 0x03, 0x26, 0x53, 0x58, 0xB0, 0x03, 0x25, 0x45, 0xB8, 0x01, 0x80, 0x50, 0x58, 0x23,
-    0x21, 0xB8, 0x01, 0x80, 0x23, 0x21, 0x1B, 0xB0, 0x03, 0x25, 0x45, 0x23, 0x21, 0x23, 0x21, 0x59,
-    0x1B, 0x21, 0x59, 0x44, 0x2D, 0xB8, 0x00, 0x09, 0x2C, 0x4B, 0x53, 0x58, 0x45, 0x44, 0x1B, 0x21,
-    0x21, 0x59, 0x2D, 0x00, 0xB8, 0x00, 0x00, 0x2B, 0x00, 0xBA, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07,
-    0x2B, 0xB8, 0x00, 0x00, 0x20, 0x45, 0x7D, 0x69, 0x18, 0x44, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x16, 0x00, 0x70,
-    0x00, 0xDC, 0x01, 0x34, 0x01, 0x7C, 0x01, 0xA2, 0x01, 0xF4, 0x02, 0x3C, 0x02, 0xA8, 0x03, 0x4C,
-    0x03, 0xE2, 0x04, 0x20, 0x04, 0x58, 0x04, 0x9A, 0x04, 0xEE, 0x05, 0x32, 0x05, 0x64, 0x05, 0x80,
-    0x05, 0xC6, 0x05, 0xF6, 0x06, 0x54, 0x06, 0xB2, 0x07, 0x38, 0x07, 0x60, 0x07, 0x82, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0xA4, 0xFF, 0xFF, 0x03, 0x5C, 0x03, 0x09, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
-    0x13, 0x11, 0x21, 0x11, 0x25, 0x21, 0x11, 0x21, 0xCD, 0x02, 0x66, 0xFD, 0x71, 0x02, 0xB8, 0xFD,
-    0x48, 0x02, 0xE0, 0xFD, 0x48, 0x02, 0xB8, 0x29, 0xFC, 0xF6, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14,
-    0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x39, 0x00, 0x00,
-    0x00, 0x22, 0x0E, 0x02, 0x14, 0x1E, 0x02, 0x32, 0x3E, 0x02, 0x34, 0x2E, 0x01, 0x24, 0x32, 0x1E,
-    0x02, 0x14, 0x0E, 0x02, 0x22, 0x2E, 0x02, 0x34, 0x3E, 0x01, 0x13, 0x12, 0x37, 0x33, 0x13, 0x12,
-    0x15, 0x16, 0x23, 0x2F, 0x01, 0x23, 0x07, 0x23, 0x22, 0x26, 0x25, 0x30, 0x27, 0x26, 0x2F, 0x01,
-    0x06, 0x07, 0x06, 0x32, 0x02, 0x5A, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77,
-    0x46, 0x46, 0x77, 0xFE, 0x9E, 0xC8, 0xB7, 0x83, 0x4E, 0x4E, 0x83, 0xB7, 0xC8, 0xB7, 0x83, 0x4E,
-    0x4E, 0x83, 0x23, 0x6C, 0x5E, 0x6D, 0x68, 0x68, 0x01, 0x39, 0x38, 0x2E, 0xD1, 0x2B, 0x37, 0x33,
-    0x04, 0x01, 0x48, 0x1D, 0x1C, 0x0A, 0x05, 0x01, 0x45, 0x01, 0x89, 0x03, 0x3F, 0x46, 0x77, 0xA4,
-    0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x4E, 0x83, 0xB7, 0xC8, 0xB7,
-    0x83, 0x4E, 0x4E, 0x83, 0xB7, 0xC8, 0xB7, 0x83, 0xFD, 0x64, 0x01, 0x1A, 0xEB, 0xFE, 0xFE, 0xFE,
-    0xFD, 0x03, 0x01, 0x01, 0x77, 0x78, 0x01, 0xCF, 0x4C, 0x4C, 0x1C, 0x0C, 0x02, 0xBE, 0x02, 0x00,
-    0x00, 0x05, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x2F,
-    0x00, 0x3A, 0x00, 0x44, 0x00, 0x00, 0x12, 0x14, 0x1E, 0x02, 0x32, 0x3E, 0x02, 0x34, 0x2E, 0x02,
-    0x22, 0x0E, 0x01, 0x02, 0x10, 0x3E, 0x01, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x26, 0x01,
-    0x16, 0x17, 0x14, 0x06, 0x07, 0x06, 0x2B, 0x01, 0x19, 0x01, 0x17, 0x32, 0x17, 0x16, 0x17, 0x16,
-    0x07, 0x06, 0x0F, 0x01, 0x36, 0x37, 0x34, 0x2E, 0x01, 0x27, 0x23, 0x15, 0x33, 0x32, 0x27, 0x32,
-    0x37, 0x36, 0x26, 0x27, 0x26, 0x2B, 0x01, 0x15, 0x45, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46,
-    0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE,
-    0xF4, 0xE2, 0x01, 0xF7, 0x61, 0x01, 0x4E, 0x3E, 0x29, 0xAF, 0x4E, 0x81, 0x8B, 0x1D, 0x3C, 0x1F,
-    0x19, 0x04, 0x06, 0x39, 0x57, 0x44, 0x01, 0x1B, 0x2D, 0x51, 0x46, 0x46, 0x47, 0x66, 0x70, 0x16,
-    0x1F, 0x01, 0x2C, 0x08, 0x4B, 0x4C, 0x01, 0xDE, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4,
-    0xA4, 0x77, 0x46, 0x46, 0x77, 0xFE, 0x7C, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2,
-    0x84, 0x84, 0x01, 0x6D, 0x21, 0x5B, 0x40, 0x50, 0x05, 0x03, 0x01, 0x03, 0x01, 0x05, 0x01, 0x05,
-    0x09, 0x30, 0x25, 0x29, 0x40, 0x21, 0xC2, 0x06, 0x3E, 0x1A, 0x21, 0x0B, 0x01, 0x8C, 0xE1, 0x0A,
-    0x0E, 0x54, 0x0B, 0x02, 0x79, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC,
-    0x03, 0x70, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x38, 0x00, 0x00, 0x12, 0x14, 0x1E, 0x02, 0x32, 0x3E,
-    0x02, 0x34, 0x2E, 0x02, 0x22, 0x0E, 0x01, 0x02, 0x10, 0x3E, 0x01, 0x20, 0x1E, 0x01, 0x10, 0x0E,
-    0x01, 0x20, 0x26, 0x36, 0x34, 0x3F, 0x01, 0x27, 0x26, 0x27, 0x33, 0x17, 0x16, 0x33, 0x36, 0x3F,
-    0x02, 0x32, 0x14, 0x06, 0x16, 0x12, 0x14, 0x2B, 0x01, 0x27, 0x26, 0x06, 0x0F, 0x01, 0x23, 0x45,
-    0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2,
-    0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x7B, 0x58, 0x58, 0x4D, 0x4F, 0x05, 0x7A,
-    0x34, 0x34, 0x02, 0x01, 0x33, 0x32, 0x3C, 0x3C, 0xA1, 0x01, 0xB0, 0x3E, 0x3F, 0x39, 0x3B, 0x02,
-    0x3A, 0x38, 0x3F, 0x01, 0xDE, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46,
-    0x46, 0x77, 0xFE, 0x7C, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x60,
-    0x02, 0x87, 0x88, 0x79, 0x7A, 0x06, 0x54, 0x54, 0x01, 0x53, 0x53, 0x01, 0x01, 0xFB, 0x04, 0xFE,
-    0xF8, 0x02, 0x5B, 0x5A, 0x03, 0x59, 0x59, 0x00, 0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC,
-    0x03, 0x70, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x22, 0x0E, 0x02, 0x14, 0x1E,
-    0x02, 0x32, 0x3E, 0x02, 0x34, 0x2E, 0x01, 0x24, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E,
-    0x01, 0x10, 0x36, 0x01, 0x35, 0x27, 0x26, 0x34, 0x3B, 0x01, 0x17, 0x16, 0x36, 0x3F, 0x01, 0x33,
-    0x03, 0x15, 0x23, 0x02, 0x5A, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46,
-    0x46, 0x77, 0xFE, 0x7C, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x01,
-    0x36, 0x5E, 0x5F, 0x3C, 0x3D, 0x3D, 0x3D, 0x03, 0x3B, 0x3B, 0x77, 0xBE, 0x68, 0x03, 0x3F, 0x46,
-    0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2, 0xFE,
-    0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFD, 0xF9, 0x6E, 0x96, 0x95, 0x01, 0x67, 0x67,
-    0x03, 0x66, 0x65, 0xFE, 0xD3, 0xDA, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0xFF, 0xBD, 0x03, 0xEC,
-    0x03, 0x4B, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x12, 0x00, 0x00, 0x01, 0x21, 0x22, 0x15, 0x30, 0x11,
-    0x21, 0x17, 0x21, 0x11, 0x10, 0x25, 0x21, 0x01, 0x11, 0x33, 0x11, 0x21, 0x15, 0x03, 0xBB, 0xFD,
-    0x77, 0xED, 0x03, 0x76, 0x31, 0xFC, 0x28, 0x01, 0x1E, 0x02, 0xBA, 0xFD, 0x5C, 0x68, 0x01, 0x08,
-    0x03, 0x1A, 0xEE, 0xFD, 0xC2, 0x31, 0x02, 0x6F, 0x01, 0x1E, 0x01, 0xFD, 0x36, 0x02, 0x07, 0xFE,
-    0x50, 0x57, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0xFF, 0xBD, 0x03, 0xEC, 0x03, 0x4B, 0x00, 0x06,
-    0x00, 0x0C, 0x00, 0x27, 0x00, 0x32, 0x00, 0x00, 0x05, 0x11, 0x34, 0x27, 0x30, 0x21, 0x11, 0x07,
-    0x11, 0x21, 0x20, 0x19, 0x01, 0x25, 0x11, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x07,
-    0x06, 0x07, 0x06, 0x07, 0x1E, 0x02, 0x15, 0x07, 0x23, 0x27, 0x2E, 0x01, 0x2F, 0x01, 0x15, 0x13,
-    0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x23, 0x15, 0x33, 0x36, 0x03, 0xBB, 0xED, 0xFD, 0x77, 0x31,
-    0x02, 0xBA, 0x01, 0x1E, 0xFD, 0x2A, 0x77, 0x76, 0x15, 0x49, 0x20, 0x35, 0x08, 0x04, 0x06, 0x13,
-    0x66, 0x0C, 0x01, 0x1F, 0x2E, 0x65, 0x3D, 0x3D, 0x2A, 0x56, 0x28, 0x2E, 0x19, 0x99, 0x3C, 0x20,
-    0x10, 0x56, 0x4F, 0x46, 0x47, 0x12, 0x02, 0x3E, 0xED, 0x01, 0xFC, 0xD4, 0x31, 0x03, 0x8E, 0xFE,
-    0xE1, 0xFD, 0x91, 0xC4, 0x02, 0x07, 0x01, 0x04, 0x13, 0x21, 0x44, 0x1D, 0x19, 0x58, 0x15, 0x02,
-    0x01, 0x13, 0x2D, 0xA2, 0x01, 0x01, 0x3D, 0x81, 0x1A, 0x01, 0x01, 0xDA, 0x01, 0x2D, 0x08, 0x3A,
-    0x29, 0x0F, 0x08, 0x01, 0x85, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0xFF, 0xF5, 0x03, 0xEC,
-    0x03, 0x13, 0x00, 0x09, 0x00, 0x11, 0x00, 0x26, 0x00, 0x32, 0x00, 0x00, 0x37, 0x21, 0x34, 0x10,
-    0x35, 0x34, 0x27, 0x21, 0x04, 0x11, 0x23, 0x10, 0x25, 0x21, 0x16, 0x15, 0x11, 0x21, 0x37, 0x35,
-    0x37, 0x36, 0x22, 0x2B, 0x01, 0x3D, 0x01, 0x3B, 0x01, 0x1D, 0x01, 0x0F, 0x01, 0x3B, 0x01, 0x1D,
-    0x01, 0x2B, 0x01, 0x25, 0x35, 0x3B, 0x01, 0x1D, 0x01, 0x3B, 0x01, 0x1D, 0x01, 0x2B, 0x01, 0x45,
-    0x03, 0x76, 0x45, 0xFE, 0x2D, 0xFE, 0xA2, 0x31, 0x01, 0x8F, 0x01, 0xD3, 0x76, 0xFC, 0x28, 0xA7,
-    0x68, 0x68, 0x01, 0x5B, 0x5D, 0x90, 0x91, 0x6C, 0x6D, 0x71, 0x70, 0xA0, 0xA0, 0x01, 0x75, 0x27,
-    0x28, 0x63, 0x63, 0x8B, 0x8A, 0x27, 0x69, 0x01, 0xA4, 0x69, 0x44, 0x01, 0x02, 0xFE, 0xA4, 0x01,
-    0x8C, 0x03, 0x01, 0x75, 0xFD, 0x58, 0xBB, 0x24, 0x80, 0x80, 0x21, 0x21, 0x1F, 0x1E, 0x85, 0x86,
-    0x20, 0x22, 0xC3, 0xC3, 0xA1, 0xA3, 0x20, 0x22, 0x00, 0x05, 0x00, 0x14, 0xFF, 0xF5, 0x03, 0xEC,
-    0x03, 0x13, 0x00, 0x08, 0x00, 0x10, 0x00, 0x2B, 0x00, 0x37, 0x00, 0x44, 0x00, 0x00, 0x37, 0x21,
-    0x11, 0x10, 0x25, 0x30, 0x21, 0x06, 0x15, 0x03, 0x11, 0x34, 0x37, 0x21, 0x04, 0x19, 0x01, 0x01,
-    0x35, 0x17, 0x32, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x16, 0x23, 0x2F, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x15, 0x23, 0x37, 0x32, 0x36, 0x37, 0x36, 0x35,
-    0x26, 0x27, 0x26, 0x2B, 0x01, 0x15, 0x05, 0x35, 0x37, 0x36, 0x26, 0x2B, 0x01, 0x35, 0x21, 0x15,
-    0x03, 0x17, 0x15, 0x45, 0x03, 0x76, 0xFE, 0xA2, 0xFE, 0x2D, 0x45, 0x31, 0x76, 0x01, 0xD3, 0x01,
-    0x8F, 0xFE, 0x1E, 0x65, 0x6F, 0x15, 0x46, 0x10, 0x05, 0x04, 0x0D, 0x4F, 0x09, 0x09, 0x1F, 0x1D,
-    0x3A, 0x06, 0x01, 0x30, 0x2F, 0x22, 0x37, 0x1E, 0x29, 0x14, 0x4E, 0x82, 0x34, 0x19, 0x0E, 0x13,
-    0x0A, 0x22, 0x07, 0x38, 0x37, 0xFE, 0x3E, 0x68, 0x68, 0x01, 0x5C, 0x5C, 0x01, 0x20, 0xD8, 0xE1,
-    0x27, 0x01, 0x5D, 0x01, 0x5B, 0x03, 0x01, 0x44, 0xFD, 0x58, 0x02, 0xA8, 0x75, 0x01, 0x03, 0xFE,
-    0x74, 0xFE, 0x71, 0x01, 0x5C, 0xC5, 0x01, 0x04, 0x0C, 0x43, 0x15, 0x1D, 0x44, 0x10, 0x04, 0x06,
-    0x14, 0x2B, 0x56, 0x10, 0x01, 0x01, 0x34, 0x52, 0x1C, 0x01, 0x01, 0xA5, 0xE3, 0x04, 0x06, 0x0A,
-    0x20, 0x2C, 0x04, 0x01, 0x65, 0xE3, 0x47, 0x80, 0x80, 0x01, 0x42, 0x3D, 0xFE, 0xF5, 0x01, 0x41,
-    0x00, 0x04, 0x00, 0x14, 0x00, 0x52, 0x03, 0xEC, 0x02, 0xB6, 0x00, 0x08, 0x00, 0x16, 0x00, 0x64,
-    0x00, 0x70, 0x00, 0x00, 0x25, 0x11, 0x21, 0x22, 0x15, 0x30, 0x15, 0x14, 0x33, 0x11, 0x21, 0x32,
-    0x15, 0x11, 0x14, 0x27, 0x21, 0x22, 0x26, 0x3D, 0x01, 0x34, 0x36, 0x13, 0x26, 0x27, 0x26, 0x27,
-    0x26, 0x37, 0x33, 0x36, 0x37, 0x36, 0x33, 0x16, 0x17, 0x16, 0x17, 0x16, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x34, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x0F, 0x01, 0x22, 0x06, 0x23,
-    0x27, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x27, 0x37, 0x35, 0x3B, 0x01, 0x1D, 0x01, 0x3B,
-    0x01, 0x1D, 0x01, 0x2B, 0x01, 0x03, 0xBB, 0xFD, 0x2A, 0xA0, 0xA0, 0x02, 0xEE, 0x19, 0x19, 0xFD,
-    0x12, 0x57, 0x7A, 0x7A, 0xCA, 0x38, 0x1D, 0x16, 0x08, 0x03, 0x01, 0x02, 0x0F, 0x0C, 0x1E, 0x01,
-    0x02, 0x04, 0x0C, 0x2B, 0x0F, 0x0E, 0x18, 0x0C, 0x09, 0x04, 0x15, 0x32, 0x23, 0x12, 0x1C, 0x0E,
-    0x09, 0x03, 0x01, 0x01, 0x09, 0x21, 0x0F, 0x14, 0x2E, 0x2A, 0x13, 0x0F, 0x0C, 0x08, 0x0B, 0x05,
-    0x02, 0x01, 0x02, 0x03, 0x36, 0x03, 0x02, 0x03, 0x08, 0x0D, 0x23, 0x16, 0x0E, 0x10, 0x01, 0x01,
-    0x07, 0x0B, 0x32, 0x25, 0x13, 0x26, 0x0F, 0x09, 0x01, 0x01, 0x0F, 0x11, 0x24, 0x21, 0x2A, 0xE3,
-    0x20, 0x20, 0x52, 0x50, 0x71, 0x71, 0x84, 0x02, 0x00, 0xAF, 0xA2, 0xAF, 0x02, 0x32, 0x19, 0xFD,
-    0xCE, 0x19, 0x01, 0x84, 0x5C, 0xA2, 0x5C, 0x85, 0xFE, 0x29, 0x04, 0x1E, 0x18, 0x26, 0x0F, 0x01,
-    0x02, 0x01, 0x03, 0x05, 0x0B, 0x29, 0x06, 0x02, 0x03, 0x04, 0x11, 0x0B, 0x0D, 0x0A, 0x06, 0x12,
-    0x0D, 0x0A, 0x07, 0x0C, 0x18, 0x0D, 0x10, 0x06, 0x18, 0x05, 0x27, 0x14, 0x09, 0x03, 0x0A, 0x0D,
-    0x06, 0x09, 0x09, 0x0D, 0x0F, 0x14, 0x0C, 0x06, 0x03, 0x02, 0x04, 0x10, 0x0A, 0x11, 0x08, 0x09,
-    0x0E, 0x0C, 0x07, 0x0C, 0x0C, 0x0A, 0x07, 0x0F, 0x20, 0x11, 0x18, 0x1E, 0x1A, 0x1E, 0x0C, 0x0B,
-    0x03, 0xAA, 0xA5, 0x89, 0x8A, 0x1C, 0x1B, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x53, 0x03, 0xEC,
-    0x02, 0xB6, 0x00, 0x08, 0x00, 0x16, 0x00, 0x2E, 0x00, 0x38, 0x00, 0x65, 0x00, 0x00, 0x01, 0x30,
-    0x21, 0x11, 0x21, 0x32, 0x3D, 0x01, 0x34, 0x27, 0x32, 0x16, 0x1D, 0x01, 0x14, 0x06, 0x23, 0x21,
-    0x26, 0x35, 0x11, 0x34, 0x33, 0x01, 0x11, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07,
-    0x17, 0x1E, 0x01, 0x1F, 0x01, 0x23, 0x2A, 0x01, 0x2E, 0x01, 0x23, 0x27, 0x15, 0x37, 0x32, 0x37,
-    0x36, 0x27, 0x2E, 0x01, 0x2B, 0x01, 0x15, 0x05, 0x26, 0x27, 0x37, 0x32, 0x3F, 0x01, 0x16, 0x17,
-    0x1E, 0x01, 0x37, 0x36, 0x27, 0x2E, 0x04, 0x37, 0x3E, 0x01, 0x33, 0x32, 0x17, 0x16, 0x17, 0x14,
-    0x06, 0x27, 0x26, 0x27, 0x26, 0x0E, 0x01, 0x1E, 0x02, 0x17, 0x16, 0x06, 0x07, 0x06, 0x07, 0x06,
-    0x03, 0x1B, 0xFD, 0x2A, 0x02, 0xD6, 0xA0, 0xA0, 0x57, 0x7A, 0x7A, 0x57, 0xFD, 0x12, 0x19, 0x19,
-    0x01, 0xD3, 0x47, 0x44, 0x11, 0x3E, 0x18, 0x21, 0x0B, 0x0C, 0x43, 0x04, 0x17, 0x1C, 0x1E, 0x16,
-    0x26, 0x26, 0x03, 0x4D, 0x18, 0x1E, 0x11, 0x25, 0x3A, 0x0C, 0x22, 0x08, 0x03, 0x1B, 0x3E, 0x29,
-    0xFE, 0xAC, 0x0D, 0x04, 0x02, 0x02, 0x1E, 0x1D, 0x03, 0x02, 0x0C, 0x4C, 0x13, 0x20, 0x07, 0x04,
-    0x1B, 0x56, 0x2D, 0x1C, 0x01, 0x02, 0x44, 0x35, 0x49, 0x1F, 0x10, 0x03, 0x41, 0x01, 0x06, 0x0A,
-    0x16, 0x3C, 0x18, 0x0C, 0x16, 0x5D, 0x15, 0x33, 0x03, 0x2B, 0x1E, 0x34, 0x59, 0x02, 0x84, 0xFE,
-    0x00, 0xAF, 0xA2, 0xAF, 0x32, 0x85, 0x5C, 0xA2, 0x5C, 0x84, 0x01, 0x17, 0x02, 0x32, 0x19, 0xFE,
-    0x2F, 0x01, 0x45, 0x01, 0x02, 0x19, 0x22, 0x32, 0x39, 0x0B, 0x08, 0x0F, 0x27, 0x2F, 0x24, 0x75,
-    0x12, 0x01, 0x88, 0xBB, 0x04, 0x09, 0x2A, 0x0F, 0x0D, 0x53, 0x8A, 0x17, 0x1E, 0x04, 0x03, 0x03,
-    0x0C, 0x04, 0x26, 0x0E, 0x0C, 0x14, 0x1A, 0x0E, 0x0E, 0x16, 0x16, 0x2C, 0x1A, 0x2D, 0x2D, 0x2A,
-    0x16, 0x1D, 0x06, 0x04, 0x01, 0x1A, 0x09, 0x11, 0x09, 0x17, 0x18, 0x0D, 0x17, 0x0C, 0x1B, 0x71,
-    0x1B, 0x12, 0x01, 0x03, 0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0F,
-    0x00, 0x1B, 0x00, 0x27, 0x00, 0x00, 0x00, 0x22, 0x0E, 0x02, 0x14, 0x1E, 0x02, 0x32, 0x3E, 0x02,
-    0x34, 0x2E, 0x01, 0x24, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36, 0x13,
-    0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x02, 0x5A, 0xB4, 0xA4, 0x77,
-    0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xFE, 0x7C, 0x01, 0x0C, 0xE2, 0x84,
-    0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x7C, 0xC5, 0x4E, 0xC5, 0xC4, 0x50, 0xC4, 0x03, 0x3F,
-    0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2,
-    0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFE, 0xC0, 0xC4, 0xC5, 0x4E, 0xC5, 0xC5,
-    0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x22, 0x0E, 0x02, 0x14, 0x1E, 0x02, 0x32, 0x3E, 0x02, 0x34, 0x2E, 0x01, 0x24,
-    0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36, 0x13, 0x35, 0x21, 0x15, 0x02,
-    0x5A, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xFE, 0x7C,
-    0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x7C, 0x01, 0xD8, 0x03, 0x3F,
-    0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x46, 0x46, 0x77, 0xA4, 0xB4, 0xA4, 0x77, 0x77, 0x84, 0xE2,
-    0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFE, 0x71, 0x4E, 0x4E, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B, 0x00, 0x1B, 0x00, 0x25,
-    0x00, 0x00, 0x00, 0x20, 0x0E, 0x01, 0x10, 0x1E, 0x01, 0x20, 0x3E, 0x01, 0x10, 0x26, 0x01, 0x12,
-    0x37, 0x33, 0x13, 0x12, 0x15, 0x16, 0x23, 0x2F, 0x01, 0x23, 0x07, 0x23, 0x22, 0x26, 0x25, 0x30,
-    0x27, 0x26, 0x2F, 0x01, 0x06, 0x07, 0x06, 0x32, 0x02, 0x86, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2,
-    0x01, 0x0C, 0xE2, 0x84, 0x84, 0xFD, 0xA0, 0x6C, 0x5E, 0x6D, 0x68, 0x68, 0x01, 0x39, 0x38, 0x2E,
-    0xD1, 0x2B, 0x37, 0x33, 0x04, 0x01, 0x48, 0x1D, 0x1C, 0x0A, 0x05, 0x01, 0x45, 0x01, 0x89, 0x03,
-    0x70, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFD, 0x9A, 0x01, 0x1A,
-    0xEB, 0xFE, 0xFE, 0xFE, 0xFD, 0x03, 0x01, 0x01, 0x77, 0x78, 0x01, 0xCF, 0x4C, 0x4C, 0x1C, 0x0C,
-    0x02, 0xBE, 0x02, 0x00, 0x00, 0x04, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B,
-    0x00, 0x20, 0x00, 0x2B, 0x00, 0x35, 0x00, 0x00, 0x36, 0x10, 0x3E, 0x01, 0x20, 0x1E, 0x01, 0x10,
-    0x0E, 0x01, 0x20, 0x26, 0x01, 0x30, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26, 0x23, 0x27,
-    0x19, 0x01, 0x33, 0x32, 0x37, 0x3E, 0x01, 0x35, 0x26, 0x07, 0x06, 0x2B, 0x01, 0x35, 0x33, 0x1E,
-    0x02, 0x15, 0x06, 0x27, 0x23, 0x35, 0x33, 0x16, 0x17, 0x16, 0x14, 0x07, 0x06, 0x14, 0x84, 0xE2,
-    0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x01, 0xF7, 0x0A, 0x3A, 0x05, 0x04, 0x19,
-    0x20, 0x3B, 0x1D, 0x8B, 0x81, 0x4E, 0xAF, 0x29, 0x3E, 0x4E, 0x01, 0xAE, 0x0D, 0x47, 0x46, 0x46,
-    0x52, 0x2C, 0x1B, 0x01, 0xB7, 0x27, 0x4C, 0x4C, 0x07, 0x2C, 0x1E, 0x16, 0xFE, 0x01, 0x0C, 0xE2,
-    0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x01, 0x6D, 0x06, 0x21, 0x40, 0x2A, 0x24, 0x30,
-    0x09, 0x05, 0x01, 0xFE, 0xFB, 0xFE, 0xFD, 0x03, 0x05, 0x4F, 0x41, 0x5B, 0x9B, 0x01, 0x8C, 0x01,
-    0x0B, 0x21, 0x1A, 0x3E, 0xDA, 0x79, 0x01, 0x01, 0x0B, 0x54, 0x0E, 0x0A, 0x00, 0x02, 0x00, 0x14,
-    0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B, 0x00, 0x29, 0x00, 0x00, 0x36, 0x10, 0x3E, 0x01,
-    0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x26, 0x36, 0x14, 0x3B, 0x01, 0x37, 0x36, 0x37, 0x36,
-    0x1F, 0x01, 0x33, 0x32, 0x34, 0x02, 0x26, 0x36, 0x34, 0x23, 0x0F, 0x01, 0x06, 0x07, 0x22, 0x2F,
-    0x01, 0x23, 0x16, 0x1F, 0x01, 0x07, 0x14, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE,
-    0xF4, 0xE2, 0x7B, 0x3D, 0x3F, 0x38, 0x3A, 0x01, 0x02, 0x3A, 0x39, 0x3F, 0x3E, 0xB0, 0x01, 0xA1,
-    0x3C, 0x3C, 0x32, 0x33, 0x01, 0x02, 0x34, 0x34, 0x7A, 0x05, 0x4F, 0x4D, 0x58, 0xFE, 0x01, 0x0C,
-    0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x62, 0x02, 0x59, 0x59, 0x02, 0x01, 0x5A,
-    0x5B, 0x02, 0x01, 0x08, 0x04, 0xFB, 0x01, 0x01, 0x53, 0x53, 0x01, 0x54, 0x54, 0x06, 0x7A, 0x79,
-    0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B,
-    0x00, 0x1B, 0x00, 0x00, 0x00, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36,
-    0x01, 0x15, 0x33, 0x35, 0x13, 0x23, 0x07, 0x0E, 0x01, 0x2F, 0x01, 0x23, 0x22, 0x16, 0x1F, 0x01,
-    0x01, 0x7A, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x01, 0x36, 0x68,
-    0xBE, 0x77, 0x3B, 0x3C, 0x02, 0x3D, 0x3D, 0x3D, 0x3D, 0x01, 0x5F, 0x5E, 0x03, 0x70, 0x84, 0xE2,
-    0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFD, 0xF9, 0x6D, 0xDA, 0x01, 0x2D, 0x65,
-    0x66, 0x03, 0x67, 0x67, 0x01, 0x95, 0x96, 0x00, 0x00, 0x02, 0x00, 0x14, 0xFF, 0xBF, 0x03, 0xEC,
-    0x03, 0x4A, 0x00, 0x05, 0x00, 0x0B, 0x00, 0x00, 0x05, 0x21, 0x11, 0x10, 0x05, 0x21, 0x01, 0x21,
-    0x35, 0x21, 0x11, 0x23, 0x03, 0xEC, 0xFC, 0x28, 0x01, 0x14, 0x02, 0xC4, 0xFD, 0x5C, 0x01, 0x70,
-    0xFE, 0xF8, 0x68, 0x41, 0x02, 0x77, 0x01, 0x14, 0x01, 0xFD, 0x38, 0x57, 0x01, 0xB0, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x14, 0xFF, 0xBF, 0x03, 0xEC, 0x03, 0x49, 0x00, 0x05, 0x00, 0x20, 0x00, 0x2B,
-    0x00, 0x00, 0x17, 0x11, 0x21, 0x20, 0x19, 0x01, 0x25, 0x33, 0x35, 0x17, 0x1E, 0x01, 0x1F, 0x01,
-    0x33, 0x37, 0x2E, 0x02, 0x27, 0x34, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x2B, 0x01, 0x05, 0x06, 0x2B, 0x01, 0x35, 0x33, 0x16, 0x17, 0x16, 0x15, 0x14, 0x14, 0x02, 0xC4,
-    0x01, 0x14, 0xFD, 0x2A, 0x69, 0x19, 0x2E, 0x28, 0x56, 0x2A, 0x3D, 0x3D, 0x01, 0x65, 0x2C, 0x20,
-    0x0D, 0x66, 0x13, 0x06, 0x04, 0x09, 0x34, 0x20, 0x49, 0x15, 0x76, 0x77, 0x01, 0x02, 0x0C, 0x47,
-    0x46, 0x4F, 0x56, 0x10, 0x20, 0x41, 0x03, 0x8A, 0xFE, 0xED, 0xFD, 0x89, 0xC2, 0xDA, 0x01, 0x01,
-    0x1A, 0x81, 0x3D, 0x01, 0x01, 0xA3, 0x2C, 0x13, 0x01, 0x02, 0x13, 0x5A, 0x1A, 0x1C, 0x44, 0x21,
-    0x13, 0x04, 0x01, 0xDA, 0x02, 0x85, 0x01, 0x08, 0x0F, 0x29, 0x3A, 0x00, 0x00, 0x03, 0x00, 0x14,
-    0xFF, 0xFB, 0x03, 0xEC, 0x03, 0x0E, 0x00, 0x08, 0x00, 0x15, 0x00, 0x1B, 0x00, 0x00, 0x05, 0x21,
-    0x11, 0x10, 0x21, 0x30, 0x21, 0x32, 0x15, 0x01, 0x21, 0x35, 0x23, 0x13, 0x35, 0x21, 0x15, 0x33,
-    0x32, 0x22, 0x0F, 0x01, 0x05, 0x21, 0x35, 0x23, 0x11, 0x23, 0x03, 0xEC, 0xFC, 0x28, 0x01, 0x8A,
-    0x01, 0xEC, 0x62, 0xFC, 0xCF, 0x01, 0x40, 0xE1, 0xD9, 0xFE, 0xDF, 0x5D, 0x5C, 0x01, 0x67, 0x68,
-    0x01, 0x75, 0x01, 0x15, 0xC6, 0x4F, 0x05, 0x01, 0x89, 0x01, 0x8A, 0x63, 0xFD, 0xE1, 0x42, 0x01,
-    0x0B, 0x3D, 0x42, 0x80, 0x80, 0x48, 0x42, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14,
-    0xFF, 0xFB, 0x03, 0xEC, 0x03, 0x0E, 0x00, 0x07, 0x00, 0x22, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x00,
-    0x17, 0x11, 0x34, 0x37, 0x21, 0x20, 0x19, 0x01, 0x01, 0x15, 0x33, 0x35, 0x17, 0x1E, 0x01, 0x1F,
-    0x02, 0x32, 0x35, 0x26, 0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26,
-    0x23, 0x27, 0x17, 0x30, 0x23, 0x35, 0x33, 0x32, 0x17, 0x16, 0x17, 0x14, 0x07, 0x0E, 0x01, 0x05,
-    0x21, 0x35, 0x27, 0x13, 0x35, 0x21, 0x15, 0x33, 0x32, 0x14, 0x0F, 0x01, 0x14, 0x62, 0x01, 0xEC,
-    0x01, 0x8A, 0xFE, 0x1E, 0x4E, 0x14, 0x29, 0x1E, 0x37, 0x22, 0x2F, 0x2F, 0x06, 0x3A, 0x1D, 0x1F,
-    0x09, 0x09, 0x4E, 0x0E, 0x04, 0x05, 0x0F, 0x47, 0x15, 0x6F, 0x65, 0x82, 0x34, 0x37, 0x38, 0x07,
-    0x23, 0x09, 0x13, 0x0D, 0x1A, 0xFD, 0xD6, 0x01, 0x40, 0xE1, 0xD8, 0xFE, 0xE0, 0x5C, 0x5C, 0x67,
-    0x68, 0x05, 0x02, 0xB0, 0x62, 0x01, 0xFE, 0x76, 0xFE, 0x77, 0x01, 0x56, 0xC5, 0xA5, 0x01, 0x01,
-    0x1C, 0x52, 0x34, 0x01, 0x01, 0x0E, 0x58, 0x2C, 0x13, 0x06, 0x04, 0x0F, 0x45, 0x1E, 0x14, 0x42,
-    0x0D, 0x04, 0x01, 0xA7, 0x65, 0x01, 0x04, 0x2C, 0x21, 0x09, 0x07, 0x03, 0xE3, 0x41, 0x01, 0x01,
-    0x0B, 0x3D, 0x42, 0x01, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x14, 0x00, 0x5D, 0x03, 0xEC,
-    0x02, 0xAB, 0x00, 0x08, 0x00, 0x37, 0x00, 0x3D, 0x00, 0x00, 0x13, 0x30, 0x21, 0x11, 0x21, 0x22,
-    0x3D, 0x01, 0x34, 0x05, 0x37, 0x34, 0x27, 0x26, 0x27, 0x26, 0x07, 0x06, 0x07, 0x0E, 0x01, 0x17,
-    0x1E, 0x01, 0x17, 0x16, 0x14, 0x07, 0x06, 0x26, 0x27, 0x26, 0x27, 0x22, 0x06, 0x07, 0x22, 0x17,
-    0x1E, 0x01, 0x17, 0x16, 0x37, 0x36, 0x27, 0x26, 0x27, 0x2E, 0x02, 0x37, 0x36, 0x33, 0x32, 0x1F,
-    0x02, 0x33, 0x35, 0x23, 0x11, 0x23, 0xD6, 0x03, 0x16, 0xFC, 0xEA, 0xC2, 0x01, 0xC6, 0x02, 0x01,
-    0x0C, 0x3A, 0x2B, 0x2D, 0x13, 0x10, 0x2B, 0x01, 0x33, 0x17, 0x55, 0x15, 0x04, 0x09, 0x14, 0x58,
-    0x0C, 0x04, 0x02, 0x02, 0x26, 0x14, 0x01, 0x03, 0x08, 0x33, 0x38, 0x5F, 0x20, 0x10, 0x01, 0x03,
-    0x3C, 0x12, 0x59, 0x11, 0x01, 0x02, 0x39, 0x2C, 0x09, 0x02, 0x9D, 0xE2, 0xA2, 0x40, 0x02, 0xAB,
-    0xFD, 0xB2, 0xD2, 0xAA, 0xD2, 0xDC, 0x03, 0x07, 0x0B, 0x38, 0x10, 0x0C, 0x09, 0x04, 0x08, 0x19,
-    0x6C, 0x17, 0x0B, 0x17, 0x11, 0x07, 0x17, 0x0A, 0x1A, 0x0A, 0x29, 0x0C, 0x04, 0x04, 0x02, 0x10,
-    0x25, 0x37, 0x04, 0x06, 0x37, 0x1D, 0x1C, 0x3F, 0x19, 0x08, 0x16, 0x13, 0x0B, 0x1F, 0x2B, 0x04,
-    0xE9, 0x37, 0x01, 0x13, 0x00, 0x04, 0x00, 0x14, 0x00, 0x5D, 0x03, 0xEC, 0x02, 0xAB, 0x00, 0x07,
-    0x00, 0x1F, 0x00, 0x2A, 0x00, 0x58, 0x00, 0x00, 0x01, 0x32, 0x1D, 0x01, 0x14, 0x23, 0x21, 0x11,
-    0x01, 0x33, 0x35, 0x17, 0x1E, 0x03, 0x3B, 0x01, 0x27, 0x2E, 0x01, 0x2F, 0x01, 0x36, 0x37, 0x36,
-    0x27, 0x26, 0x27, 0x26, 0x2B, 0x01, 0x17, 0x30, 0x23, 0x35, 0x33, 0x32, 0x16, 0x17, 0x16, 0x07,
-    0x06, 0x05, 0x16, 0x37, 0x36, 0x37, 0x3E, 0x01, 0x27, 0x2E, 0x03, 0x3E, 0x01, 0x17, 0x16, 0x17,
-    0x30, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26, 0x27, 0x22, 0x06, 0x07, 0x06, 0x1E, 0x03, 0x17, 0x16,
-    0x07, 0x06, 0x26, 0x27, 0x26, 0x27, 0x07, 0x06, 0x23, 0x07, 0x16, 0x03, 0x2A, 0xC2, 0xC2, 0xFC,
-    0xEA, 0x01, 0xEC, 0x41, 0x11, 0x1F, 0x17, 0x4D, 0x02, 0x27, 0x26, 0x16, 0x1E, 0x1C, 0x17, 0x04,
-    0x43, 0x0C, 0x0B, 0x21, 0x18, 0x3E, 0x0F, 0x46, 0x47, 0x66, 0x25, 0x29, 0x3E, 0x1B, 0x03, 0x08,
-    0x22, 0x0C, 0xFE, 0x4D, 0x22, 0x59, 0x34, 0x1E, 0x2B, 0x03, 0x33, 0x16, 0x5C, 0x16, 0x0C, 0x18,
-    0x3C, 0x16, 0x0B, 0x05, 0x22, 0x21, 0x01, 0x03, 0x10, 0x1F, 0x49, 0x36, 0x43, 0x02, 0x01, 0x1C,
-    0x2D, 0x56, 0x1B, 0x04, 0x07, 0x20, 0x13, 0x4B, 0x0D, 0x01, 0x04, 0x1D, 0x1E, 0x02, 0x02, 0x04,
-    0x02, 0xAB, 0xD2, 0xAA, 0xD2, 0x02, 0x4E, 0xFE, 0x39, 0x89, 0x01, 0x01, 0x11, 0x75, 0x01, 0x25,
-    0x2F, 0x27, 0x0F, 0x08, 0x0C, 0x38, 0x33, 0x21, 0x19, 0x02, 0x01, 0x8A, 0x53, 0x0D, 0x0F, 0x2A,
-    0x09, 0x04, 0x8A, 0x3A, 0x03, 0x01, 0x12, 0x1B, 0x71, 0x1B, 0x0C, 0x17, 0x0D, 0x18, 0x17, 0x09,
-    0x11, 0x09, 0x1A, 0x01, 0x01, 0x07, 0x1E, 0x15, 0x29, 0x01, 0x2D, 0x2D, 0x1A, 0x2C, 0x16, 0x16,
-    0x0D, 0x0F, 0x1A, 0x14, 0x0C, 0x0D, 0x27, 0x04, 0x0C, 0x03, 0x03, 0x04, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00,
-    0x00, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36, 0x13, 0x15, 0x33, 0x15,
-    0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x15, 0x01, 0x7A, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2,
-    0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x7C, 0xC4, 0x50, 0xC4, 0xC5, 0x4E, 0x03, 0x70, 0x84, 0xE2, 0xFE,
-    0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFE, 0xC0, 0x4F, 0xC5, 0xC5, 0x4E, 0xC5, 0xC4,
-    0x00, 0x02, 0x00, 0x14, 0xFF, 0x98, 0x03, 0xEC, 0x03, 0x70, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x20, 0x1E, 0x01, 0x10, 0x0E, 0x01, 0x20, 0x2E, 0x01, 0x10, 0x36, 0x13, 0x21, 0x35, 0x21,
-    0x01, 0x7A, 0x01, 0x0C, 0xE2, 0x84, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0x7C, 0x01, 0xD8,
-    0xFE, 0x28, 0x03, 0x70, 0x84, 0xE2, 0xFE, 0xF4, 0xE2, 0x84, 0x84, 0xE2, 0x01, 0x0C, 0xE2, 0xFE,
-    0x71, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x85, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0xAF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x10, 0x00, 0xE2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0D,
-    0x01, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, 0x01, 0x3F, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x01, 0x00, 0x20, 0x00, 0x42, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0E,
-    0x00, 0x75, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x20, 0x00, 0x8D, 0x00, 0x03,
-    0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x20, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x05, 0x00, 0x1A, 0x00, 0xF3, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x20,
-    0x01, 0x1D, 0x00, 0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x20, 0x00, 0x45, 0x00, 0x6D,
-    0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x20, 0x00, 0x50,
-    0x00, 0x72, 0x00, 0x6F, 0x00, 0x6A, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x00, 0x59, 0x75,
-    0x7A, 0x75, 0x20, 0x45, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x50, 0x72, 0x6F, 0x6A,
-    0x65, 0x63, 0x74, 0x00, 0x00, 0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x4F, 0x00, 0x53,
-    0x00, 0x53, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x69,
-    0x00, 0x6F, 0x00, 0x6E, 0x00, 0x00, 0x59, 0x75, 0x7A, 0x75, 0x4F, 0x53, 0x53, 0x45, 0x78, 0x74,
-    0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00,
-    0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x00, 0x52, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x00, 0x00,
-    0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x53, 0x00, 0x45, 0x00,
-    0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-    0x00, 0x59, 0x75, 0x7A, 0x75, 0x4F, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F,
-    0x6E, 0x00, 0x00, 0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x53,
-    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F,
-    0x00, 0x6E, 0x00, 0x00, 0x59, 0x75, 0x7A, 0x75, 0x4F, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6E,
-    0x73, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00,
-    0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x00, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x2E, 0x30, 0x30, 0x30, 0x00, 0x00,
-    0x59, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x75, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x53, 0x00, 0x45, 0x00,
-    0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-    0x00, 0x59, 0x75, 0x7A, 0x75, 0x4F, 0x53, 0x53, 0x45, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F,
-    0x6E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB5, 0x00, 0x32,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03, 0x00, 0x03, 0x01, 0x04,
-    0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C,
-    0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14,
-    0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1A, 0x01, 0x1B, 0x07, 0x75,
-    0x6E, 0x69, 0x30, 0x30, 0x30, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30, 0x30, 0x44, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x31, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x33, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x35, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x37, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x41, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x41, 0x39, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x42, 0x34, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x31, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x33, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x35, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x37, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x45, 0x39, 0x07, 0x75,
-    0x6E, 0x69, 0x45, 0x30, 0x45, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x45, 0x30, 0x46, 0x30, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F,
+const std::array<unsigned char, 3584> FONT_NINTENDO_EXTENDED{{
+    0x28, 0xb5, 0x2f, 0xfd, 0x64, 0x88, 0x16, 0x95, 0x6f, 0x00, 0xda, 0xc1, 0xc0, 0x2a, 0x53, 0x40,
+    0x96, 0x5d, 0xe7, 0xd0, 0x29, 0x87, 0x00, 0x29, 0x02, 0xf9, 0x6b, 0xa1, 0x02, 0xb9, 0x8c, 0x75,
+    0x49, 0x09, 0xc6, 0xd2, 0x87, 0x75, 0xec, 0x74, 0x62, 0xca, 0x01, 0x9e, 0x7c, 0x98, 0xa1, 0x06,
+    0x74, 0xc8, 0xe5, 0x2b, 0xd0, 0x28, 0xb9, 0x38, 0xf0, 0xc9, 0xcb, 0x6d, 0xb2, 0x44, 0xbe, 0x64,
+    0x2f, 0x04, 0x62, 0xe9, 0x13, 0xab, 0x64, 0x89, 0xb9, 0xc1, 0xe6, 0xfb, 0xbe, 0x64, 0xf3, 0xdd,
+    0x7b, 0xa9, 0x46, 0x12, 0xa4, 0xff, 0xfc, 0x34, 0xbe, 0xf3, 0xed, 0x3b, 0xbf, 0x97, 0x36, 0x91,
+    0x32, 0xa5, 0x9a, 0x02, 0xa0, 0x02, 0x95, 0x02, 0x2f, 0xa3, 0xbd, 0x2e, 0x7e, 0x25, 0x4d, 0xbf,
+    0x8c, 0xa7, 0x5b, 0x3c, 0x27, 0x97, 0xba, 0x6b, 0x1b, 0x34, 0xfb, 0x52, 0xa3, 0x06, 0x10, 0x5f,
+    0xa4, 0xea, 0x7f, 0x3f, 0xe7, 0x79, 0x86, 0x02, 0xf7, 0x3f, 0x9e, 0x55, 0x3d, 0x5b, 0xc9, 0x07,
+    0x7d, 0xca, 0xf2, 0x02, 0x13, 0xc0, 0xa3, 0xc5, 0x64, 0x30, 0x08, 0x9a, 0x1b, 0x9c, 0x6f, 0x6a,
+    0x7a, 0x2a, 0x00, 0x48, 0x2f, 0x06, 0x06, 0x86, 0x86, 0x18, 0x88, 0x61, 0x07, 0x10, 0xe6, 0x26,
+    0x55, 0x42, 0x42, 0x55, 0x4d, 0x5c, 0xc8, 0xa1, 0x89, 0xea, 0xaa, 0x7e, 0x8d, 0xef, 0x37, 0x8c,
+    0xf1, 0xf1, 0x7a, 0x6b, 0xef, 0x6b, 0x7a, 0xf0, 0xdb, 0x52, 0x2b, 0x26, 0x5b, 0x6a, 0xaf, 0x34,
+    0x6a, 0x1a, 0x9e, 0x96, 0xb9, 0x5a, 0x47, 0x7c, 0xf1, 0x34, 0x46, 0xad, 0x24, 0x6a, 0x9d, 0xab,
+    0x65, 0x3c, 0x1c, 0xaf, 0xf1, 0x9d, 0xcf, 0x50, 0x2c, 0xae, 0xc8, 0x64, 0x69, 0xe9, 0x00, 0x9e,
+    0x59, 0x5a, 0xea, 0xb9, 0xa4, 0x7d, 0x90, 0x5b, 0x39, 0xa6, 0x95, 0xdb, 0x9a, 0xfb, 0xea, 0xdb,
+    0x5f, 0x3b, 0x69, 0x6f, 0x6d, 0x35, 0x59, 0x60, 0xed, 0xb1, 0xde, 0xac, 0x2c, 0xa8, 0x47, 0x2a,
+    0x16, 0xa9, 0x0e, 0xe9, 0x55, 0xfa, 0x23, 0x25, 0xa6, 0x52, 0xa0, 0x1c, 0xa0, 0x4b, 0x34, 0x46,
+    0xab, 0xec, 0x1a, 0xbb, 0x04, 0xbd, 0xa3, 0xad, 0x78, 0x26, 0x9f, 0xc0, 0x1b, 0x3f, 0x09, 0x8f,
+    0x82, 0xdd, 0x3d, 0xb8, 0xbe, 0xcf, 0xe0, 0xc1, 0x19, 0x26, 0x50, 0xd0, 0xd2, 0x88, 0x86, 0xf0,
+    0x05, 0xc4, 0x94, 0x7b, 0x72, 0x2f, 0x27, 0xf7, 0xae, 0x8a, 0xae, 0x3e, 0x2b, 0xc8, 0xb3, 0x7c,
+    0xfc, 0x9f, 0x78, 0x96, 0x33, 0xe7, 0x74, 0x5e, 0x61, 0xc9, 0x3d, 0xa7, 0x93, 0xe9, 0x58, 0x39,
+    0x1f, 0xac, 0xa5, 0x91, 0x0b, 0xa8, 0xae, 0x2e, 0x4e, 0x0a, 0xa8, 0x4c, 0xa6, 0x9c, 0x03, 0x7a,
+    0x82, 0xb5, 0x2c, 0x7a, 0x82, 0x15, 0x14, 0xcb, 0x72, 0x8e, 0x09, 0xe4, 0x83, 0x95, 0x03, 0xba,
+    0xc2, 0x5a, 0x0e, 0xb0, 0x2c, 0xf2, 0x6d, 0xac, 0x98, 0x86, 0x30, 0x7d, 0x1e, 0x70, 0x00, 0xd3,
+    0x89, 0xa2, 0x39, 0x4c, 0x66, 0x33, 0xc7, 0xf4, 0xc1, 0x92, 0x97, 0x47, 0x4e, 0x4b, 0x23, 0xc7,
+    0x8a, 0x6b, 0x98, 0xce, 0x66, 0x0c, 0x8a, 0xf5, 0x43, 0xa9, 0x29, 0x16, 0x8a, 0x9d, 0x3f, 0x66,
+    0x38, 0x63, 0x67, 0xcc, 0xec, 0x2d, 0x6f, 0x08, 0xc5, 0x6c, 0x2c, 0xa1, 0x58, 0xb8, 0x65, 0xa0,
+    0x50, 0xf7, 0x78, 0x2c, 0x20, 0xa7, 0xa0, 0x38, 0x16, 0xbe, 0x67, 0xcd, 0x14, 0xc0, 0x63, 0xfb,
+    0xcb, 0x65, 0x80, 0x01, 0xf2, 0xac, 0x24, 0x5b, 0x9f, 0xc5, 0x9c, 0xe0, 0x7f, 0x85, 0x65, 0xd1,
+    0xcb, 0xb3, 0x68, 0x08, 0xdd, 0xb3, 0xb4, 0x7e, 0x57, 0xdf, 0xdf, 0x83, 0xbb, 0xe1, 0x4e, 0xc7,
+    0xee, 0xc7, 0x8e, 0x89, 0xad, 0x2b, 0xb6, 0x7e, 0x0a, 0x2d, 0x2d, 0xad, 0x16, 0xb4, 0x96, 0x6c,
+    0x6d, 0x51, 0xa1, 0xe5, 0x84, 0x96, 0x0b, 0x5a, 0x26, 0x68, 0xc5, 0x1e, 0x73, 0x5a, 0xd1, 0x0b,
+    0x90, 0x97, 0xed, 0xae, 0x7f, 0x93, 0x77, 0x1f, 0xb4, 0xa3, 0xef, 0x9b, 0x0a, 0xad, 0x98, 0x3f,
+    0xf1, 0xd8, 0x69, 0xef, 0xac, 0x6e, 0xf2, 0x29, 0xdb, 0xf7, 0x2e, 0x44, 0xea, 0x15, 0x7c, 0x94,
+    0x8d, 0xba, 0xb3, 0x48, 0xf9, 0x4b, 0xea, 0xef, 0x56, 0xb6, 0xeb, 0xab, 0x2d, 0x0e, 0xde, 0xb5,
+    0x47, 0x6d, 0x2b, 0x5b, 0x83, 0x2d, 0xd7, 0x49, 0x88, 0xe9, 0x24, 0x7c, 0x47, 0x0d, 0xd0, 0x11,
+    0x8e, 0xc2, 0xfc, 0x8a, 0x9d, 0x19, 0x0f, 0x29, 0x1d, 0x30, 0x0f, 0x6e, 0x05, 0xea, 0xee, 0x81,
+    0x02, 0x57, 0x5e, 0xa2, 0x9a, 0x53, 0x51, 0x40, 0xd8, 0x1d, 0x85, 0x14, 0x5c, 0xb0, 0x62, 0x88,
+    0x10, 0xa8, 0xa8, 0xf9, 0xdd, 0x8f, 0x5c, 0x77, 0x1b, 0x3f, 0x52, 0x90, 0x68, 0x3e, 0x29, 0x05,
+    0x89, 0x03, 0x98, 0x72, 0xa1, 0x8e, 0x2a, 0xa2, 0xf4, 0x94, 0xe3, 0xa6, 0xee, 0x41, 0x86, 0x57,
+    0x46, 0x25, 0x1f, 0x50, 0x40, 0x7e, 0x76, 0xb8, 0xe0, 0xa9, 0x60, 0x29, 0x32, 0xe4, 0xa9, 0xe9,
+    0xc5, 0x8b, 0x77, 0x6f, 0x60, 0x3f, 0xf0, 0x6a, 0x42, 0xba, 0xbb, 0x15, 0x77, 0x7f, 0x1d, 0x69,
+    0xba, 0xfc, 0x50, 0x6a, 0x36, 0xa1, 0x33, 0xf7, 0x22, 0x2e, 0x9e, 0x80, 0x15, 0x2d, 0x19, 0x01,
+    0xc2, 0xe4, 0x72, 0x9b, 0x3b, 0xcd, 0xdd, 0xa3, 0x84, 0x28, 0x31, 0x09, 0x79, 0xf7, 0xab, 0xed,
+    0x9e, 0xf4, 0x80, 0xa9, 0x3e, 0x31, 0x45, 0x2d, 0xa9, 0x9e, 0xba, 0xeb, 0xf1, 0x10, 0x22, 0x3e,
+    0xa6, 0xde, 0x9d, 0xd5, 0xee, 0x55, 0xec, 0xd0, 0x04, 0x0e, 0x51, 0x4a, 0x4f, 0x3e, 0x7a, 0xb8,
+    0x7b, 0xd3, 0xbb, 0xfb, 0x74, 0x6e, 0x24, 0xd6, 0x18, 0x11, 0xf5, 0xf0, 0xed, 0x57, 0x2e, 0x73,
+    0xf7, 0xf7, 0x56, 0x38, 0x5a, 0x9e, 0xb7, 0x9b, 0x14, 0x7a, 0xc9, 0x12, 0x60, 0xf2, 0xc7, 0xeb,
+    0xf5, 0x54, 0xde, 0xcf, 0x8c, 0xc9, 0x62, 0x31, 0xf9, 0xf3, 0xd5, 0x90, 0xc6, 0xe7, 0xf1, 0xf1,
+    0xe4, 0x9f, 0xdb, 0xbe, 0x44, 0xb9, 0x2d, 0xba, 0x6f, 0x1b, 0xe3, 0x1e, 0xe5, 0x3f, 0x1c, 0x86,
+    0x41, 0x5b, 0xd9, 0x37, 0x3c, 0xc6, 0x5f, 0x31, 0xf3, 0xfc, 0xfc, 0xd5, 0x95, 0x0c, 0x26, 0x9a,
+    0x8f, 0x0a, 0x63, 0x16, 0x15, 0x65, 0x62, 0x84, 0xff, 0x97, 0x1b, 0xc6, 0x7f, 0x1a, 0x52, 0xd0,
+    0x55, 0x51, 0x1a, 0x10, 0xcc, 0x0b, 0x00, 0x8b, 0xbe, 0x94, 0xa4, 0x97, 0x9a, 0x87, 0xcc, 0xfb,
+    0xa9, 0x4a, 0xd0, 0xcb, 0x27, 0xd0, 0x6f, 0x1d, 0xbf, 0xe3, 0x7f, 0x54, 0x8c, 0x88, 0x3f, 0x29,
+    0x49, 0x39, 0x27, 0x6f, 0x56, 0x1e, 0x4b, 0x4d, 0x76, 0x33, 0x2e, 0x30, 0xe4, 0xca, 0xe8, 0x92,
+    0xbc, 0x9a, 0xe1, 0xab, 0x39, 0x30, 0xbb, 0xd7, 0x8b, 0x28, 0x86, 0xa6, 0x34, 0xa1, 0x17, 0xaa,
+    0xa9, 0x9b, 0x29, 0xf8, 0x21, 0x9e, 0x88, 0x4d, 0xd0, 0xcc, 0xcc, 0x64, 0x7e, 0x6d, 0xc7, 0xf4,
+    0x88, 0x4c, 0x22, 0x89, 0xc9, 0x1e, 0xd1, 0x76, 0xfc, 0xbf, 0xa1, 0x72, 0xd2, 0xd8, 0xee, 0x57,
+    0x95, 0x87, 0xc9, 0xa4, 0x07, 0x9d, 0xe6, 0xae, 0xd4, 0x79, 0xb1, 0x08, 0x21, 0xe4, 0x90, 0x03,
+    0x2f, 0x6e, 0x20, 0x89, 0x6e, 0x27, 0xcb, 0x57, 0x57, 0x2f, 0x68, 0x58, 0x3e, 0xa9, 0x7e, 0x47,
+    0xf0, 0x4d, 0x66, 0xfd, 0x40, 0x4e, 0x4d, 0xde, 0xe9, 0xe7, 0x84, 0xc0, 0x87, 0x0f, 0x18, 0x3f,
+    0xaa, 0x5f, 0xb2, 0x24, 0x4a, 0xea, 0x09, 0x88, 0x05, 0x15, 0xec, 0xd0, 0x41, 0x02, 0x8c, 0x2b,
+    0x44, 0x86, 0x78, 0x0a, 0xde, 0x86, 0xc9, 0x3c, 0x33, 0x07, 0x11, 0xd9, 0x41, 0xc7, 0x98, 0x0f,
+    0xce, 0x1e, 0xe6, 0x75, 0x9e, 0xe7, 0x83, 0x3c, 0x64, 0xf2, 0x98, 0x94, 0xdb, 0x17, 0xee, 0xb5,
+    0xa8, 0x4c, 0x33, 0xca, 0x49, 0x9f, 0xb7, 0xfe, 0xf2, 0xda, 0x15, 0x9f, 0xe4, 0x5d, 0x33, 0x99,
+    0x1c, 0xd7, 0xcc, 0x4f, 0xf9, 0xc7, 0x1d, 0xe1, 0xf9, 0x67, 0x32, 0x53, 0x7b, 0xfd, 0x2e, 0x6f,
+    0x30, 0x40, 0x72, 0x0d, 0xfd, 0x55, 0x47, 0xb1, 0xe0, 0x49, 0x65, 0x9e, 0x60, 0xdb, 0x10, 0x71,
+    0xe5, 0xa3, 0x50, 0xea, 0x16, 0x19, 0x42, 0x44, 0x48, 0xb4, 0x78, 0x67, 0x83, 0x1b, 0x0d, 0x0c,
+    0x24, 0x20, 0x0f, 0x4f, 0x93, 0x66, 0xf7, 0xec, 0x52, 0x4d, 0x45, 0x5d, 0xc7, 0x78, 0xc6, 0x4b,
+    0xa4, 0x0a, 0xf8, 0xd4, 0xfd, 0x0c, 0xda, 0xa6, 0xea, 0x19, 0x05, 0x0d, 0x1b, 0xe9, 0xfb, 0x19,
+    0x8f, 0xc8, 0xda, 0xfb, 0x35, 0x4f, 0xf3, 0xeb, 0xad, 0xaf, 0xd6, 0x15, 0xdb, 0x98, 0xbf, 0xc5,
+    0x72, 0xbb, 0xb6, 0xf2, 0xf0, 0x67, 0x6c, 0x53, 0x77, 0xa2, 0xff, 0x50, 0x77, 0xc7, 0x51, 0x34,
+    0xaf, 0x1a, 0xf9, 0x7c, 0xdd, 0x43, 0x69, 0x1b, 0x28, 0x4f, 0x29, 0x70, 0xdb, 0xf5, 0x4d, 0x49,
+    0xcf, 0x19, 0xb4, 0xee, 0x61, 0x5c, 0xb1, 0x21, 0xb2, 0xa3, 0xa8, 0x7a, 0xd2, 0xb0, 0x5f, 0xb9,
+    0x2d, 0xb6, 0x2f, 0xc7, 0xd0, 0x5a, 0xd9, 0x26, 0xb7, 0xc3, 0x97, 0x27, 0xbf, 0x7b, 0x8b, 0xb3,
+    0xae, 0x3a, 0x8d, 0x1a, 0xa6, 0x0c, 0x31, 0x37, 0x97, 0x36, 0x13, 0xd3, 0x63, 0x90, 0x41, 0x90,
+    0x2d, 0x9e, 0x4d, 0x36, 0x54, 0xe9, 0xe8, 0x6c, 0x1e, 0x1e, 0x9e, 0x1d, 0x1e, 0x05, 0x20, 0x73,
+    0xe8, 0xde, 0xbb, 0x8b, 0xdf, 0x83, 0x84, 0x6d, 0xaf, 0x63, 0xf4, 0xfd, 0x8e, 0x8f, 0xa4, 0x3d,
+    0x4d, 0x90, 0xc9, 0xdc, 0x39, 0x74, 0x68, 0x2d, 0x66, 0xb4, 0x8b, 0x7f, 0x23, 0xa3, 0x3f, 0x3a,
+    0x52, 0xad, 0x8c, 0x3c, 0xe0, 0x80, 0xee, 0xd1, 0x73, 0x93, 0xa3, 0x75, 0x70, 0x7a, 0x94, 0x58,
+    0x1f, 0xc2, 0xce, 0x0e, 0xb1, 0xf8, 0xda, 0x68, 0xb4, 0x4a, 0x89, 0x6c, 0x2c, 0x97, 0x08, 0xf4,
+    0x82, 0x6e, 0x0b, 0xac, 0xba, 0x44, 0xdd, 0x83, 0x2c, 0xc2, 0xb6, 0xe2, 0xcf, 0xf7, 0xfb, 0x1e,
+    0x23, 0xf2, 0x66, 0xbb, 0xbb, 0x1b, 0xd1, 0xb0, 0x23, 0x19, 0x0b, 0x95, 0x08, 0x1e, 0x26, 0xe3,
+    0x94, 0x2a, 0x14, 0xd9, 0x47, 0x26, 0x66, 0xf8, 0x4a, 0x3f, 0xfd, 0xfd, 0x3b, 0x2d, 0xf2, 0xd1,
+    0x21, 0x3f, 0x7d, 0x02, 0x4a, 0x7c, 0x0d, 0x1a, 0x2e, 0xe1, 0xef, 0xe0, 0xa8, 0x25, 0x19, 0x42,
+    0x42, 0x03, 0xcc, 0xe4, 0x1e, 0x08, 0x07, 0x8e, 0x8a, 0xde, 0x76, 0x3b, 0x30, 0x10, 0x1c, 0x19,
+    0x72, 0x22, 0xa3, 0x1c, 0x7a, 0xa5, 0x2c, 0xbe, 0x8a, 0x15, 0x73, 0x15, 0x24, 0x48, 0xaa, 0xb0,
+    0x5f, 0x05, 0x49, 0xd0, 0xfb, 0x41, 0xdf, 0xcf, 0x87, 0x4c, 0x12, 0x7f, 0xc4, 0xe2, 0xdb, 0xfb,
+    0x25, 0x91, 0x3f, 0x53, 0x57, 0xd8, 0x06, 0xdb, 0x88, 0xb6, 0xbf, 0x7d, 0xd0, 0xb5, 0xc1, 0xef,
+    0x8b, 0x03, 0x2e, 0x97, 0x75, 0x91, 0x23, 0x33, 0x73, 0x7d, 0x12, 0x3d, 0xe5, 0xd1, 0x9a, 0x0c,
+    0xf4, 0x82, 0xcb, 0x51, 0xd3, 0x5f, 0x13, 0x8a, 0xf0, 0xcf, 0x73, 0x04, 0xf7, 0x3f, 0x05, 0x8a,
+    0x92, 0x67, 0x14, 0xb3, 0x73, 0xc7, 0x88, 0x69, 0x48, 0x44, 0x42, 0x32, 0x58, 0xfd, 0x55, 0x44,
+    0xde, 0x19, 0xb1, 0xf1, 0x85, 0xaa, 0xb5, 0xa5, 0x58, 0x2c, 0x6c, 0x02, 0x91, 0x60, 0xd0, 0xdc,
+    0x9c, 0x80, 0x4f, 0xf7, 0xdd, 0x37, 0x35, 0xfe, 0x34, 0x4d, 0xb2, 0x78, 0x2c, 0xda, 0x7c, 0xc6,
+    0x76, 0x77, 0xac, 0xc7, 0x71, 0xf3, 0x7c, 0xf7, 0xab, 0x74, 0x8c, 0x26, 0x2d, 0xe6, 0xa8, 0x4f,
+    0x7a, 0x46, 0xd1, 0xee, 0xc3, 0xb8, 0x62, 0x65, 0xf7, 0x5a, 0xf9, 0x28, 0xbf, 0x9c, 0xa6, 0x9e,
+    0xba, 0x00, 0x37, 0x64, 0x80, 0xc1, 0x33, 0x31, 0xed, 0xa5, 0xe6, 0xcc, 0x4f, 0x79, 0xda, 0xa2,
+    0x00, 0x1e, 0xcf, 0xa3, 0x77, 0x74, 0xaa, 0x6c, 0x68, 0xb2, 0x7a, 0xde, 0xcb, 0xd6, 0x5e, 0xed,
+    0x58, 0x7c, 0xdd, 0xb5, 0x3f, 0x60, 0xc4, 0x4a, 0x3d, 0x3a, 0xfa, 0x2e, 0x50, 0xd7, 0x6b, 0x1d,
+    0x39, 0x5e, 0x33, 0x99, 0xda, 0x80, 0xa5, 0x0d, 0xa2, 0xd4, 0xca, 0x68, 0xd4, 0x5f, 0x24, 0xee,
+    0xec, 0x84, 0xf0, 0x58, 0xca, 0x1e, 0x9c, 0x1c, 0xfd, 0x39, 0x37, 0x3d, 0x3c, 0x08, 0xac, 0xbf,
+    0x83, 0x79, 0xb3, 0x9e, 0x36, 0xee, 0x5e, 0xc7, 0x45, 0xca, 0x68, 0x67, 0x91, 0x1d, 0xc1, 0xfe,
+    0x8d, 0x4c, 0x51, 0xe2, 0x64, 0xd8, 0x47, 0xf0, 0x1d, 0xe8, 0x88, 0x41, 0x94, 0x76, 0x31, 0x7f,
+    0xfa, 0x1a, 0xbe, 0x00, 0xfa, 0xc8, 0xea, 0x0c, 0xeb, 0x84, 0x6b, 0x8d, 0x1a, 0xbf, 0x18, 0x3e,
+    0x27, 0xbc, 0x21, 0x24, 0x24, 0x23, 0xa6, 0xc2, 0x0f, 0x29, 0x65, 0x9c, 0x0c, 0x1d, 0x81, 0x00,
+    0x46, 0x27, 0xbe, 0xa1, 0x69, 0x0e, 0x8b, 0xab, 0xae, 0xee, 0xb1, 0xf7, 0x53, 0x8b, 0x47, 0xdf,
+    0xf1, 0xf6, 0x1b, 0x22, 0xdd, 0x8f, 0x1e, 0xf4, 0x18, 0xe5, 0x20, 0x6a, 0xc9, 0xb3, 0x81, 0xf7,
+    0xd1, 0x5e, 0x19, 0xbf, 0x8e, 0xf6, 0xb2, 0x38, 0x06, 0x36, 0x34, 0x24, 0x65, 0xc4, 0xef, 0xa4,
+    0x44, 0x79, 0x32, 0x47, 0x29, 0x8a, 0x22, 0x65, 0x48, 0x4a, 0x02, 0xc7, 0xde, 0xdb, 0x7b, 0x8b,
+    0x6f, 0xf1, 0x58, 0xac, 0xfd, 0xf6, 0xb7, 0xe4, 0xa4, 0x72, 0xac, 0x2d, 0xe6, 0x62, 0x7b, 0xb5,
+    0x2f, 0xdc, 0xa3, 0x2a, 0x0c, 0x0c, 0x9c, 0x99, 0xc1, 0x09, 0x61, 0x58, 0x26, 0xc3, 0xb9, 0xac,
+    0xcc, 0x87, 0xb2, 0x7b, 0xa3, 0x3a, 0x9b, 0xd3, 0x28, 0x36, 0x03, 0xbe, 0x50, 0x1a, 0x1e, 0xf8,
+    0x16, 0xaa, 0x17, 0x35, 0xbf, 0x99, 0x0b, 0x86, 0x43, 0xe4, 0xdd, 0xf4, 0x07, 0x7d, 0xcd, 0x6c,
+    0x7b, 0x24, 0x49, 0x88, 0x33, 0x12, 0xcd, 0x34, 0xea, 0x82, 0xbb, 0xf8, 0xee, 0x80, 0x59, 0x97,
+    0x1d, 0x98, 0x45, 0xfd, 0x18, 0x9b, 0xb6, 0x9b, 0x71, 0x04, 0xd2, 0xff, 0x32, 0x83, 0x94, 0x43,
+    0xd7, 0xb8, 0x56, 0x83, 0xd5, 0x1b, 0x46, 0xa7, 0x35, 0x1a, 0x4b, 0x61, 0x96, 0x51, 0xe6, 0xb6,
+    0x8b, 0xc7, 0xe6, 0xc4, 0xb4, 0x3a, 0x17, 0x1b, 0xdb, 0xe7, 0x83, 0x75, 0x2f, 0x36, 0x14, 0x00,
+    0x16, 0x26, 0xbb, 0x28, 0x5b, 0x20, 0x19, 0x43, 0xfc, 0xed, 0xd6, 0xf2, 0xc4, 0xb1, 0x64, 0x49,
+    0x11, 0x1a, 0xf8, 0xcc, 0xed, 0x55, 0x85, 0x6d, 0x32, 0xd5, 0x7d, 0x65, 0x12, 0x85, 0xbf, 0x87,
+    0x98, 0xfc, 0xf9, 0xd2, 0xe4, 0xfb, 0xeb, 0x01, 0x7b, 0xbf, 0x7b, 0x9d, 0xad, 0xd8, 0x7e, 0xd1,
+    0xd8, 0x1e, 0x7d, 0x72, 0x4f, 0x75, 0x1f, 0x06, 0x26, 0xfe, 0xe4, 0xe1, 0xbb, 0x37, 0xfd, 0xc6,
+    0x69, 0x8c, 0x3c, 0xf7, 0xe2, 0x54, 0x32, 0xc2, 0x09, 0x1b, 0xc6, 0xea, 0x70, 0x3a, 0x97, 0x36,
+    0x9e, 0xad, 0x2c, 0x2c, 0xbb, 0xb2, 0xb2, 0x97, 0xab, 0x65, 0xa1, 0xa1, 0x7a, 0xab, 0xac, 0x3b,
+    0x8b, 0xbd, 0x5e, 0x6a, 0x8c, 0x65, 0xbf, 0xdc, 0x5f, 0xea, 0xa2, 0xd2, 0x62, 0x2e, 0xec, 0xca,
+    0x12, 0x6b, 0x51, 0x59, 0x62, 0xb0, 0x16, 0xdd, 0x5a, 0x95, 0x81, 0xa5, 0xfb, 0xf5, 0xcf, 0x7c,
+    0x2e, 0x3a, 0x54, 0x66, 0x4e, 0x92, 0xc4, 0x24, 0x09, 0xc9, 0xdf, 0x7e, 0x78, 0xde, 0x88, 0xda,
+    0x09, 0x13, 0x27, 0xae, 0x91, 0x48, 0x49, 0x15, 0xdd, 0x88, 0x63, 0x26, 0x80, 0xf2, 0x8b, 0x76,
+    0xf6, 0xff, 0x9a, 0xf9, 0x6a, 0x31, 0x44, 0xd8, 0x2a, 0x83, 0x7b, 0x31, 0xd7, 0xd6, 0x1b, 0xb9,
+    0xf5, 0xeb, 0x14, 0xe6, 0x62, 0x67, 0x35, 0x20, 0x8d, 0x3b, 0x93, 0x5f, 0xff, 0xfb, 0x25, 0x7b,
+    0x69, 0xe9, 0x11, 0x5f, 0xf4, 0xc5, 0xba, 0xc8, 0x66, 0x41, 0x16, 0xd5, 0xaf, 0x63, 0x67, 0xfa,
+    0xb7, 0x0b, 0x86, 0xb9, 0xe9, 0xc1, 0x2a, 0x33, 0xdf, 0xda, 0xfa, 0xa1, 0x90, 0x10, 0xce, 0x4d,
+    0x12, 0x79, 0x34, 0x16, 0x89, 0x36, 0xc3, 0xa0, 0xe2, 0x0f, 0xce, 0x4d, 0x12, 0x79, 0x34, 0x16,
+    0x89, 0x36, 0xc3, 0x18, 0xc3, 0x20, 0xa0, 0xa1, 0x53, 0x10, 0xaa, 0x35, 0xf7, 0xb8, 0xbf, 0xbd,
+    0xcb, 0xdb, 0x1e, 0xfe, 0xf7, 0xdd, 0xaf, 0x7d, 0xcb, 0xb7, 0x4f, 0xfb, 0xd9, 0xcb, 0x3e, 0xf6,
+    0xec, 0xc3, 0x9e, 0xe5, 0x5f, 0xef, 0xfa, 0xf5, 0xd5, 0x4f, 0x1f, 0xfd, 0xed, 0xfb, 0xf5, 0xbb,
+    0xbf, 0x38, 0xd1, 0x5f, 0xd8, 0x1a, 0x0e, 0x87, 0x34, 0x36, 0xf1, 0x54, 0x73, 0xe8, 0x34, 0x6e,
+    0xe3, 0xf1, 0x14, 0xd2, 0x14, 0x53, 0x73, 0x8a, 0xe9, 0x06, 0x94, 0x93, 0x90, 0x20, 0xcd, 0x21,
+    0x45, 0x82, 0x8c, 0x8c, 0x88, 0x82, 0x38, 0xb9, 0x10, 0x0f, 0x32, 0xc4, 0x8b, 0x78, 0x90, 0x91,
+    0x13, 0xf9, 0x68, 0x1e, 0x00, 0x35, 0x55, 0x14, 0x4f, 0x41, 0x0d, 0x51, 0x02, 0x42, 0xf5, 0x14,
+    0x14, 0x53, 0x59, 0x51, 0x31, 0xdd, 0x87, 0x37, 0xfd, 0x00, 0x87, 0x2a, 0x9a, 0x72, 0x28, 0x1f,
+    0xe2, 0x4a, 0x0e, 0xe4, 0xc9, 0x83, 0x3c, 0xb6, 0x62, 0x3a, 0xcc, 0xc7, 0xae, 0x56, 0xe1, 0x38,
+    0x4f, 0x9f, 0xa0, 0x12, 0x6c, 0x2a, 0xfd, 0xe3, 0xb1, 0xbf, 0xbb, 0xbf, 0xd0, 0xef, 0x79, 0x9a,
+    0xab, 0xb3, 0x8f, 0x79, 0x5a, 0x05, 0x75, 0xb2, 0x93, 0xe8, 0x1f, 0x4e, 0xf3, 0x17, 0xfa, 0xeb,
+    0xef, 0x2a, 0xb8, 0xcc, 0x61, 0xcc, 0x46, 0xfc, 0x4c, 0x0a, 0x51, 0xd4, 0x1e, 0x92, 0x12, 0xa5,
+    0x28, 0x4a, 0x02, 0x6f, 0xef, 0x58, 0x7c, 0x6b, 0x36, 0x1d, 0xba, 0x37, 0x8b, 0xfe, 0x62, 0xac,
+    0x8b, 0x9b, 0xc5, 0x60, 0x58, 0x88, 0x9b, 0x99, 0x79, 0x99, 0x57, 0xb7, 0xfe, 0xe3, 0x5e, 0xed,
+    0xcb, 0xe6, 0x12, 0xb3, 0xb1, 0x39, 0xa9, 0x5c, 0xcb, 0xef, 0x1c, 0x27, 0xfa, 0x02, 0xce, 0x62,
+    0x46, 0xce, 0xd7, 0x37, 0xb9, 0x78, 0xc3, 0xba, 0x66, 0xbf, 0x9a, 0x98, 0xa7, 0x6a, 0xff, 0x95,
+    0xe0, 0xcc, 0x43, 0x1a, 0x05, 0x8d, 0x6a, 0xad, 0x83, 0x41, 0x3f, 0x46, 0xa3, 0x16, 0xaf, 0x68,
+    0x0e, 0x69, 0xe6, 0xe5, 0x35, 0x00, 0xc8, 0x19, 0x3b, 0xda, 0x7e, 0x99, 0x97, 0xc2, 0xe0, 0x1d,
+    0x17, 0x16, 0x4e, 0x82, 0x8b, 0x3b, 0xa8, 0x33, 0x32, 0x79, 0x36, 0x66, 0x96, 0xe7, 0xda, 0x39,
+    0xa5, 0x4c, 0xcc, 0x92, 0x0c, 0xa1, 0x99, 0xd2, 0x45, 0x86, 0xb1, 0x00, 0xa0, 0xb6, 0x17, 0x1d,
+    0xec, 0xfb, 0x69, 0x1b, 0xb6, 0x5d, 0x1b, 0xc3, 0xca, 0x3f, 0x71, 0x05, 0x0a, 0x14, 0xe0, 0x86,
+    0xd7, 0x9e, 0xba, 0x6e, 0x9d, 0x3a, 0x7c, 0xe5, 0x56, 0x26, 0xd3, 0x0f, 0xbe, 0xce, 0xfe, 0x56,
+    0xee, 0x11, 0xdf, 0x7d, 0xe9, 0x40, 0xdf, 0xf9, 0x8a, 0x7a, 0xed, 0x93, 0x4e, 0xa0, 0xc1, 0x1d,
+    0xac, 0x06, 0xbb, 0x6e, 0x3d, 0x2f, 0x30, 0x49, 0x15, 0x4d, 0xc6, 0xd0, 0x34, 0x8a, 0xb2, 0x32,
+    0x2c, 0x38, 0x16, 0xdb, 0xda, 0xda, 0x60, 0x36, 0x20, 0x37, 0x17, 0xed, 0x06, 0xb6, 0xee, 0x24,
+    0x84, 0x38, 0x41, 0x08, 0x16, 0x9e, 0x28, 0x68, 0x1f, 0x26, 0x55, 0x3e, 0xd0, 0x2f, 0x21, 0x8e,
+    0xfe, 0x96, 0xd9, 0xb2, 0xb3, 0x9f, 0x16, 0xf3, 0xb8, 0x29, 0xba, 0xf6, 0xbb, 0x3e, 0xad, 0x51,
+    0x76, 0xe9, 0xbe, 0xd0, 0x97, 0x00, 0x5b, 0xf1, 0x83, 0xb4, 0xda, 0x4c, 0x30, 0x87, 0x7d, 0xad,
+    0xc3, 0x43, 0x79, 0xe2, 0x0a, 0xbc, 0x8b, 0x28, 0xea, 0x1d, 0x51, 0xd3, 0xf0, 0xd4, 0x35, 0x99,
+    0xf2, 0x6a, 0xee, 0x3c, 0x9e, 0x44, 0x61, 0x87, 0x5f, 0x5d, 0xfd, 0xc7, 0x60, 0x62, 0xaf, 0x2f,
+    0x59, 0x88, 0x7e, 0x93, 0x84, 0x47, 0x63, 0x3f, 0xae, 0x2e, 0x68, 0x26, 0x5c, 0xca, 0xfe, 0x8d,
+    0x37, 0x5e, 0xfe, 0x47, 0x90, 0x82, 0xf4, 0x55, 0x33, 0x91, 0xf9, 0x0d, 0xc0, 0xd2, 0x69, 0x13,
+    0x53, 0x52, 0x92, 0xd6, 0x6c, 0x44, 0x11, 0x4f, 0x5c, 0xac, 0xf6, 0xea, 0xad, 0x37, 0x49, 0xe3,
+    0x02, 0x4d, 0xa8, 0x57, 0xc6, 0x2c, 0x45, 0x65, 0x43, 0xaf, 0xd7, 0x0e, 0x26, 0x47, 0xad, 0xa9,
+    0xe1, 0x25, 0x75, 0x32, 0xee, 0x90, 0x6e, 0x76, 0xbe, 0x95, 0x37, 0xc0, 0xfd, 0x99, 0xfb, 0x3b,
+    0xf6, 0x86, 0xb6, 0x23, 0x51, 0xbf, 0xf1, 0x8e, 0xd7, 0x38, 0xcf, 0x57, 0xd4, 0x81, 0xfe, 0x27,
+    0x80, 0xab, 0xab, 0x1f, 0x1e, 0xd8, 0xff, 0x50, 0x79, 0xfa, 0x70, 0xbe, 0x92, 0x4f, 0x89, 0x74,
+    0x78, 0x9f, 0xea, 0x9b, 0x98, 0x3e, 0x69, 0xc7, 0x12, 0xf3, 0x11, 0x54, 0x7c, 0x1e, 0x88, 0x2b,
+    0x06, 0x58, 0x79, 0x67, 0xfa, 0x33, 0x1e, 0xb1, 0xd8, 0x1b, 0xca, 0x39, 0x7f, 0x3d, 0x81, 0x96,
+    0xa8, 0xc1, 0x40, 0x88, 0x10, 0x12, 0x12, 0x11, 0x11, 0x91, 0x20, 0x49, 0x92, 0xe4, 0xc1, 0x90,
+    0x42, 0x4c, 0x31, 0xeb, 0xcc, 0x36, 0x42, 0x6b, 0x92, 0x64, 0x1a, 0x46, 0x64, 0x88, 0x64, 0x94,
+    0x94, 0x14, 0x24, 0x49, 0xfd, 0x68, 0x33, 0x17, 0xe3, 0xda, 0xc6, 0xab, 0xad, 0xf6, 0xb4, 0x74,
+    0x7e, 0xdd, 0x46, 0x72, 0xb7, 0x8d, 0x53, 0x6f, 0x6d, 0xcd, 0xa5, 0xa7, 0xf7, 0xb5, 0xa4, 0xcb,
+    0xc5, 0xc2, 0xea, 0x83, 0xf9, 0x14, 0xa2, 0xe6, 0xa9, 0x0c, 0x2b, 0x50, 0xd5, 0x27, 0xed, 0x43,
+    0x08, 0x9c, 0x39, 0xc9, 0x60, 0x64, 0xa3, 0x1d, 0x8e, 0x59, 0x0c, 0x28, 0xc0, 0xb0, 0x95, 0x50,
+    0xa3, 0x1a, 0xb7, 0x5d, 0x0a, 0xf4, 0xa8, 0xa9, 0x2b, 0x53, 0xd4, 0x06, 0xb5, 0xf7, 0x3b, 0x87,
+    0x43, 0xea, 0x94, 0xa9, 0x15, 0xbc, 0x06, 0xa1, 0x4e, 0x1c, 0xab, 0x2b, 0x25, 0x76, 0xaf, 0x6d,
+    0xfa, 0xe8, 0xfb, 0x85, 0x1b, 0xd3, 0xf3, 0x93, 0x0f, 0x61, 0x65, 0x41, 0xfc, 0xd6, 0x1c, 0xc5,
+    0x67, 0x5f, 0xd0, 0x04, 0x47, 0x96, 0x69, 0x29, 0x33, 0x2c, 0x16, 0x03, 0xc0, 0x47, 0xd9, 0x4d,
+    0x45, 0x9c, 0x8a, 0x08, 0x14, 0x94, 0x2e, 0xbd, 0xc0, 0x4c, 0xaa, 0x56, 0xa2, 0x4b, 0x67, 0x3c,
+    0xc8, 0x03, 0x51, 0xb9, 0x79, 0x2a, 0xb7, 0x73, 0x24, 0x0d, 0x46, 0x36, 0x04, 0x22, 0xc2, 0x0d,
+    0xaf, 0xb0, 0xc3, 0x6a, 0xcd, 0x70, 0xde, 0xe9, 0x5c, 0x12, 0x7a, 0x5b, 0x3d, 0x20, 0x0e, 0x3b,
+    0xb2, 0xe3, 0xc7, 0xb4, 0x38, 0xda, 0xa3, 0x7e, 0xc0, 0xa9, 0xbd, 0xaa, 0x49, 0xd9, 0x4c, 0xa7,
+    0x5d, 0x3b, 0x5a, 0xd1, 0xb5, 0x31, 0xce, 0x47, 0xde, 0xdf, 0x6c, 0xb1, 0x74, 0x0f, 0xde, 0x0e,
+    0x13, 0xd2, 0x7d, 0x55, 0xb4, 0x0d, 0xa7, 0xde, 0x9c, 0xf9, 0x2e, 0x25, 0x59, 0x4c, 0xf9, 0x93,
+    0x54, 0xb3, 0x7b, 0x89, 0x0a, 0x2f, 0x16, 0x9c, 0x35, 0x19, 0x3d, 0xb2, 0x27, 0xdb, 0x0b, 0x71,
+    0x2e, 0x46, 0xfb, 0x0e, 0x84, 0xac, 0x74, 0x01, 0xe2, 0xd0, 0x86, 0x39, 0x96, 0x23, 0xb3, 0x26,
+    0x61, 0x2a, 0xe2, 0x8f, 0xfc, 0x4d, 0x86, 0xcb, 0xe4, 0xc4, 0x18, 0x66, 0xed, 0xe0, 0x44, 0xb0,
+    0xe9, 0xab, 0x9d, 0xf0, 0xb6, 0xed, 0x78, 0x78, 0x7e, 0xbc, 0xc2, 0xfb, 0xa5, 0xc9, 0xa9, 0xa6,
+    0x7e, 0xe7, 0x38, 0xa7, 0x04, 0xa8, 0xb5, 0x2c, 0xf3, 0xf0, 0x87, 0xbe, 0x70, 0xbd, 0x49, 0x0a,
+    0x3f, 0x7a, 0xdd, 0xbe, 0xa3, 0x98, 0x14, 0x80, 0x2a, 0x7e, 0x4a, 0xbc, 0xe1, 0xd8, 0x77, 0xec,
+    0xac, 0xbc, 0x39, 0x81, 0x76, 0x14, 0x70, 0xca, 0xe3, 0x53, 0x46, 0xb3, 0xd5, 0xa2, 0x25, 0x07,
+    0x77, 0xa5, 0x40, 0x5d, 0x49, 0x07, 0x4f, 0x9e, 0x7f, 0xe4, 0x1f, 0x1d, 0xc2, 0x82, 0x0e, 0x8e,
+    0xd8, 0x9a, 0xc8, 0xb6, 0x8e, 0x5f, 0x77, 0x4c, 0x0a, 0x24, 0x28, 0xa6, 0x43, 0x58, 0x70, 0x85,
+    0xaf, 0xbc, 0x11, 0xc5, 0x7c, 0x86, 0x8f, 0x48, 0xdd, 0x54, 0x23, 0x7c, 0x87, 0x5f, 0x3c, 0xd2,
+    0xb8, 0xef, 0x40, 0x37, 0x2b, 0xec, 0xdb, 0x20, 0xfa, 0xe4, 0x13, 0xf6, 0x2f, 0xf7, 0xd0, 0xc6,
+    0x52, 0x85, 0x8e, 0x67, 0x2b, 0x68, 0x73, 0x07, 0x29, 0xbe, 0xa2, 0x35, 0xa4, 0xad, 0x06, 0x94,
+    0xaa, 0x1d, 0x55, 0xe9, 0x40, 0x9d, 0x8e, 0xf8, 0x00, 0x54, 0x8a, 0x6e, 0x49, 0xb7, 0x66, 0x10,
+    0x2e, 0x70, 0x2d, 0xe3, 0x64, 0x43, 0x7c, 0x42, 0x10, 0x72, 0x8a, 0x7c, 0x20, 0x15, 0x1c, 0x21,
+    0x60, 0x49, 0xf3, 0xdf, 0xbb, 0x61, 0x2d, 0xda, 0xa1, 0x5d, 0x5a, 0x3b, 0x55, 0xb7, 0x58, 0xae,
+    0x4c, 0xe2, 0xd7, 0xdd, 0x6e, 0xe5, 0xfa, 0x48, 0x92, 0x04, 0xb4, 0x84, 0xf3, 0xb5, 0xf5, 0xde,
+    0x94, 0x12, 0xd4, 0x4e, 0xef, 0x25, 0xca, 0x2d, 0xc9, 0x19, 0x6b, 0x56, 0x85, 0xd2, 0x7f, 0xca,
+    0xb3, 0x05, 0x2f, 0xd8, 0x09, 0x6f, 0x64, 0x45, 0x7a, 0x74, 0xa5, 0xc0, 0x76, 0xd1, 0x0b, 0xc1,
+    0x8e, 0xd9, 0x80, 0xd7, 0xdb, 0x5c, 0xf4, 0xdc, 0x64, 0xfc, 0x5b, 0x8b, 0xfe, 0x28, 0x66, 0x2b,
+    0x0a, 0x89, 0x3d, 0xaf, 0x20, 0x60, 0xc5, 0xbc, 0xee, 0x14, 0xa2, 0xfe, 0x22, 0x9e, 0x52, 0x52,
+    0xa2, 0x2b, 0x94, 0x18, 0xbd, 0x78, 0xe4, 0x1a, 0x1e, 0xba, 0xc4, 0x26, 0x45, 0x44, 0xb9, 0x25,
+    0x2e, 0x19, 0x81, 0x59, 0xc0, 0x52, 0xb7, 0xc7, 0x93, 0x82, 0x99, 0xc9, 0x49, 0x60, 0xc2, 0x2b,
+    0x37, 0x5d, 0x0f, 0xac, 0x51, 0x7a, 0x95, 0x23, 0xb0, 0x75, 0x84, 0x2d, 0x03, 0xcd, 0x71, 0x14,
+    0x78, 0xfc, 0x1e, 0x76, 0xfa, 0xe6, 0xc9, 0x34, 0xa4, 0x36, 0xcf, 0x1e, 0xb3, 0xe0, 0xe1, 0x8d,
+    0x7b, 0x54, 0x2d, 0xb3, 0x1f, 0xb6, 0xa7, 0x09, 0xb0, 0x64, 0x91, 0x0f, 0x3d, 0x8e, 0x14, 0xa2,
+    0x22, 0xee, 0xa5, 0x4f, 0xc6, 0x21, 0x70, 0xdb, 0x41, 0x3a, 0x62, 0x33, 0x80, 0x6a, 0xf5, 0xee,
+    0x8a, 0xe6, 0x7c, 0xc6, 0x4f, 0x74, 0x10, 0x8a, 0x7d, 0x5e, 0x03, 0x34, 0xf5, 0x85, 0x75, 0x70,
+    0x94, 0xc4, 0x99, 0x12, 0x2c, 0x6b, 0x7a, 0x4c, 0x91, 0x80, 0xa1, 0x80, 0xfa, 0xd6, 0x3d, 0x92,
+    0x5b, 0xbd, 0x58, 0xca, 0x42, 0x09, 0x13, 0x83, 0xae, 0x0b, 0xc5, 0xfd, 0x6a, 0x4b, 0x65, 0xc2,
+    0xe6, 0x09, 0x83, 0x6f, 0x5b, 0xc6, 0x7a, 0x63, 0xa8, 0x7b, 0x83, 0x3b, 0xd3, 0xa5, 0xda, 0x71,
+    0x9c, 0x84, 0x3b, 0xae, 0x2a, 0xbf, 0x10, 0xf8, 0x7c, 0xcf, 0xe4, 0x2b, 0xf8, 0xdf, 0x76, 0x6a,
+    0x5a, 0x76, 0x2f, 0x8a, 0x7f, 0x06, 0xdf, 0xa8, 0x47, 0x0b, 0x93, 0x16, 0x3b, 0x9d, 0xc0, 0x24,
+    0x70, 0x69, 0x09, 0x0f, 0x62, 0x4f, 0x3c, 0x1c, 0xd0, 0xfe, 0x85, 0x85, 0xdd, 0x90, 0x1a, 0x95,
+    0x06, 0x6d, 0x48, 0x39, 0xab, 0xfb, 0x7a, 0x0e, 0x9e, 0x5e, 0xb9, 0x0d, 0x05, 0xc3, 0x61, 0x0d,
+    0xb3, 0x61, 0xf1, 0xea, 0xde, 0x75, 0xe1, 0x1c, 0x0f, 0x30, 0x26, 0x5c, 0x29, 0x9d, 0xec, 0x53,
+    0x22, 0x3a, 0x92, 0xe8, 0x24, 0xa8, 0xe1, 0x51, 0x62, 0x90, 0xc3, 0x1f, 0x07, 0x9d, 0x78, 0xe9,
 }};
 
 } // namespace FileSys::SystemArchive::SharedFontData
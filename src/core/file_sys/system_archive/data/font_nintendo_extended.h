@@ -5,9 +5,14 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 6024> FONT_NINTENDO_EXTENDED;
+/// Size in bytes of FONT_NINTENDO_EXTENDED once decompressed
+constexpr std::size_t FONT_NINTENDO_EXTENDED_DECOMPRESSED_SIZE = 6024;
+
+/// zstd-compressed font data; decompress with Common::Compression::DecompressDataZSTD
+extern const std::array<unsigned char, 3584> FONT_NINTENDO_EXTENDED;
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -5,9 +5,14 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 
 namespace FileSys::SystemArchive::SharedFontData {
 
-extern const std::array<unsigned char, 217276> FONT_STANDARD;
+/// Size in bytes of FONT_STANDARD once decompressed
+constexpr std::size_t FONT_STANDARD_DECOMPRESSED_SIZE = 217276;
+
+/// zstd-compressed font data; decompress with Common::Compression::DecompressDataZSTD
+extern const std::array<unsigned char, 73544> FONT_STANDARD;
 
 } // namespace FileSys::SystemArchive::SharedFontData
@@ -7,8 +7,10 @@
 #include "core/file_sys/system_archive/data/font_extended_chinese_simplified.h"
 #include "core/file_sys/system_archive/data/font_korean.h"
 #include "core/file_sys/system_archive/data/font_nintendo_extended.h"
+#include "common/zstd_compression.h"
 #include "core/file_sys/system_archive/data/font_standard.h"
 #include "core/file_sys/system_archive/shared_font.h"
+#include "core/file_sys/vfs_lazy.h"
 #include "core/file_sys/vfs_vector.h"
 #include "core/hle/service/ns/pl_u.h"
 
@@ -16,16 +18,26 @@ namespace FileSys::SystemArchive {
 
 namespace {
 
-template <std::size_t Size>
-VirtualFile PackBFTTF(const std::array<u8, Size>& data, const std::string& name) {
-    std::vector<u32> vec(Size / sizeof(u32));
-    std::memcpy(vec.data(), data.data(), vec.size() * sizeof(u32));
+template <std::size_t CompressedSize>
+VirtualFile PackBFTTF(const std::array<u8, CompressedSize>& compressed, std::size_t font_size,
+                      const std::string& name) {
+    // The font data ships zstd-compressed and a BFTTF is only built the first time the file is
+    // actually read; every font is mounted at boot whether or not the title uses it
+    return std::make_shared<LazyVfsFile>(
+        [&compressed, font_size] {
+            const std::vector<u8> data = Common::Compression::DecompressDataZSTD(
+                std::vector<u8>(compressed.begin(), compressed.end()));
 
-    std::vector<u8> bfttf(Size + sizeof(u64));
+            std::vector<u32> vec(font_size / sizeof(u32));
+            std::memcpy(vec.data(), data.data(), vec.size() * sizeof(u32));
 
-    size_t offset = 0;
-    Service::NS::EncryptSharedFont(vec, bfttf, offset);
-    return std::make_shared<VectorVfsFile>(std::move(bfttf), name);
+            std::vector<u8> bfttf(font_size + sizeof(u64));
+
+            size_t offset = 0;
+            Service::NS::EncryptSharedFont(vec, bfttf, offset);
+            return bfttf;
+        },
+        font_size + sizeof(u64), name);
 }
 
 } // Anonymous namespace
@@ -33,8 +45,12 @@ VirtualFile PackBFTTF(const std::array<u8, Size>& data, const std::string& name)
 VirtualDir FontNintendoExtension() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
-            PackBFTTF(SharedFontData::FONT_NINTENDO_EXTENDED, "nintendo_ext_003.bfttf"),
-            PackBFTTF(SharedFontData::FONT_NINTENDO_EXTENDED, "nintendo_ext2_003.bfttf"),
+            PackBFTTF(SharedFontData::FONT_NINTENDO_EXTENDED,
+                      SharedFontData::FONT_NINTENDO_EXTENDED_DECOMPRESSED_SIZE,
+                      "nintendo_ext_003.bfttf"),
+            PackBFTTF(SharedFontData::FONT_NINTENDO_EXTENDED,
+                      SharedFontData::FONT_NINTENDO_EXTENDED_DECOMPRESSED_SIZE,
+                      "nintendo_ext2_003.bfttf"),
         },
         std::vector<VirtualDir>{});
 }
@@ -42,7 +58,9 @@ VirtualDir FontNintendoExtension() {
 VirtualDir FontStandard() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
-            PackBFTTF(SharedFontData::FONT_STANDARD, "nintendo_udsg-r_std_003.bfttf"),
+            PackBFTTF(SharedFontData::FONT_STANDARD,
+                      SharedFontData::FONT_STANDARD_DECOMPRESSED_SIZE,
+                      "nintendo_udsg-r_std_003.bfttf"),
         },
         std::vector<VirtualDir>{});
 }
@@ -50,7 +68,8 @@ VirtualDir FontStandard() {
 VirtualDir FontKorean() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
-            PackBFTTF(SharedFontData::FONT_KOREAN, "nintendo_udsg-r_ko_003.bfttf"),
+            PackBFTTF(SharedFontData::FONT_KOREAN, SharedFontData::FONT_KOREAN_DECOMPRESSED_SIZE,
+                      "nintendo_udsg-r_ko_003.bfttf"),
         },
         std::vector<VirtualDir>{});
 }
@@ -59,6 +78,7 @@ VirtualDir FontChineseTraditional() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
             PackBFTTF(SharedFontData::FONT_CHINESE_TRADITIONAL,
+                      SharedFontData::FONT_CHINESE_TRADITIONAL_DECOMPRESSED_SIZE,
                       "nintendo_udjxh-db_zh-tw_003.bfttf"),
         },
         std::vector<VirtualDir>{});
@@ -68,8 +88,10 @@ VirtualDir FontChineseSimple() {
     return std::make_shared<VectorVfsDirectory>(
         std::vector<VirtualFile>{
             PackBFTTF(SharedFontData::FONT_CHINESE_SIMPLIFIED,
+                      SharedFontData::FONT_CHINESE_SIMPLIFIED_DECOMPRESSED_SIZE,
                       "nintendo_udsg-r_org_zh-cn_003.bfttf"),
             PackBFTTF(SharedFontData::FONT_EXTENDED_CHINESE_SIMPLIFIED,
+                      SharedFontData::FONT_EXTENDED_CHINESE_SIMPLIFIED_DECOMPRESSED_SIZE,
                       "nintendo_udsg-r_ext_zh-cn_003.bfttf"),
         },
         std::vector<VirtualDir>{});
@@ -2,6 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <mutex>
+#include <unordered_map>
+
 #include "common/logging/log.h"
 #include "core/file_sys/romfs.h"
 #include "core/file_sys/system_archive/mii_model.h"
@@ -73,11 +76,20 @@ VirtualFile SynthesizeSystemArchive(const u64 title_id) {
 
     const auto& desc = SYSTEM_ARCHIVES[title_id - SYSTEM_ARCHIVE_BASE_TITLE_ID];
 
-    LOG_INFO(Service_FS, "Synthesizing system archive '{}' (0x{:016X}).", desc.name, desc.title_id);
-
     if (desc.supplier == nullptr)
         return nullptr;
 
+    // Synthesized archives are immutable and read positionally, so every session can share one
+    // instance instead of re-decrypting the backing data on each open
+    static std::mutex cache_mutex;
+    static std::unordered_map<u64, VirtualFile> cache;
+    std::lock_guard lock{cache_mutex};
+    if (const auto it = cache.find(title_id); it != cache.end()) {
+        return it->second;
+    }
+
+    LOG_INFO(Service_FS, "Synthesizing system archive '{}' (0x{:016X}).", desc.name, desc.title_id);
+
     const auto dir = desc.supplier();
 
     if (dir == nullptr)
@@ -88,6 +100,8 @@ VirtualFile SynthesizeSystemArchive(const u64 title_id) {
     if (romfs == nullptr)
         return nullptr;
 
+    cache.emplace(title_id, romfs);
+
     LOG_INFO(Service_FS, "    - System archive generation successful!");
     return romfs;
 }
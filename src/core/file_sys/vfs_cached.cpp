@@ -0,0 +1,132 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "core/file_sys/vfs_cached.h"
+
+namespace FileSys {
+
+CachedVfsFile::CachedVfsFile(VirtualFile base_, std::size_t block_size_, std::size_t cache_size_)
+    : base(std::move(base_)), block_size(block_size_), cache_size(cache_size_) {}
+
+CachedVfsFile::~CachedVfsFile() = default;
+
+std::string CachedVfsFile::GetName() const {
+    return base->GetName();
+}
+
+std::size_t CachedVfsFile::GetSize() const {
+    return base->GetSize();
+}
+
+bool CachedVfsFile::Resize(std::size_t new_size) {
+    return false;
+}
+
+std::shared_ptr<VfsDirectory> CachedVfsFile::GetContainingDirectory() const {
+    return base->GetContainingDirectory();
+}
+
+bool CachedVfsFile::IsWritable() const {
+    return false;
+}
+
+bool CachedVfsFile::IsReadable() const {
+    return true;
+}
+
+std::size_t CachedVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    std::size_t read = 0;
+    while (read < length) {
+        const u64 block_index = (offset + read) / block_size;
+        const std::size_t block_offset = (offset + read) % block_size;
+
+        const auto* block = FindBlock(block_index);
+        if (block == nullptr) {
+            block = FetchBlock(block_index);
+        }
+        if (block == nullptr || block_offset >= block->size()) {
+            break;
+        }
+
+        const auto copy_size = std::min(length - read, block->size() - block_offset);
+        std::memcpy(data + read, block->data() + block_offset, copy_size);
+        read += copy_size;
+
+        // A short block means the base file ended inside it
+        if (block->size() < block_size) {
+            break;
+        }
+    }
+    return read;
+}
+
+std::size_t CachedVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    return 0;
+}
+
+bool CachedVfsFile::Rename(std::string_view name) {
+    return base->Rename(name);
+}
+
+const std::vector<u8>* CachedVfsFile::FindBlock(u64 index) const {
+    const auto iter = block_map.find(index);
+    if (iter == block_map.end()) {
+        return nullptr;
+    }
+    // Move the block to the front of the MRU list
+    blocks.splice(blocks.begin(), blocks, iter->second);
+    return &blocks.front().data;
+}
+
+const std::vector<u8>* CachedVfsFile::FetchBlock(u64 index) const {
+    // Misses that continue a sequential run pull in several consecutive blocks with one base
+    // read, so streaming accesses pay for the underlying layers once per run instead of once
+    // per block
+    const auto fetch_count = index == next_sequential_block ? READAHEAD_BLOCKS : std::size_t{1};
+    auto fetched = base->ReadBytes(block_size * fetch_count, index * block_size);
+
+    for (std::size_t i = 1; i < fetch_count; i++) {
+        const auto begin = std::min(fetched.size(), block_size * i);
+        const auto end = std::min(fetched.size(), block_size * (i + 1));
+        if (begin >= end) {
+            break;
+        }
+        InsertBlock(index + i, std::vector<u8>(fetched.begin() + static_cast<std::ptrdiff_t>(begin),
+                                               fetched.begin() + static_cast<std::ptrdiff_t>(end)));
+    }
+
+    fetched.resize(std::min(fetched.size(), block_size));
+    if (fetched.empty()) {
+        return nullptr;
+    }
+    // The next miss of a sequential run lands right after the blocks fetched here
+    next_sequential_block = index + fetch_count;
+    InsertBlock(index, std::move(fetched));
+    return &blocks.front().data;
+}
+
+void CachedVfsFile::InsertBlock(u64 index, std::vector<u8>&& data) const {
+    if (const auto iter = block_map.find(index); iter != block_map.end()) {
+        cached_bytes -= iter->second->data.size();
+        blocks.erase(iter->second);
+        block_map.erase(iter);
+    }
+
+    cached_bytes += data.size();
+    blocks.push_front(CacheBlock{index, std::move(data)});
+    block_map.insert_or_assign(index, blocks.begin());
+
+    while (cached_bytes > cache_size && !blocks.empty()) {
+        const auto& victim = blocks.back();
+        cached_bytes -= victim.data.size();
+        block_map.erase(victim.index);
+        blocks.pop_back();
+    }
+}
+
+} // namespace FileSys
@@ -0,0 +1,63 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "core/file_sys/vfs.h"
+
+namespace FileSys {
+
+// Read-only wrapper that keeps recently read blocks of its base file in an LRU cache and reads
+// ahead on sequential access. Intended to sit on top of expensive layers such as the NCA crypto
+// stack, where re-reading a hot block means decrypting it again.
+class CachedVfsFile : public VfsFile {
+public:
+    /// Default size of a cached block; matches the granularity of the NCA crypto layers
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 0x4000;
+    /// Default total cache capacity per file
+    static constexpr std::size_t DEFAULT_CACHE_SIZE = 8 * 1024 * 1024;
+    /// Number of consecutive blocks fetched from the base file on a sequential miss
+    static constexpr std::size_t READAHEAD_BLOCKS = 4;
+
+    explicit CachedVfsFile(VirtualFile base, std::size_t block_size_ = DEFAULT_BLOCK_SIZE,
+                           std::size_t cache_size_ = DEFAULT_CACHE_SIZE);
+    ~CachedVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    std::shared_ptr<VfsDirectory> GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view name) override;
+
+private:
+    struct CacheBlock {
+        u64 index;
+        std::vector<u8> data;
+    };
+
+    const std::vector<u8>* FindBlock(u64 index) const;
+    const std::vector<u8>* FetchBlock(u64 index) const;
+    void InsertBlock(u64 index, std::vector<u8>&& data) const;
+
+    VirtualFile base;
+    std::size_t block_size;
+    std::size_t cache_size;
+
+    // MRU-ordered block list with an index for lookup; mutated by reads like the cipher
+    // contexts in the layers this wraps
+    mutable std::list<CacheBlock> blocks;
+    mutable std::unordered_map<u64, std::list<CacheBlock>::iterator> block_map;
+    mutable std::size_t cached_bytes = 0;
+    mutable u64 next_sequential_block = 0;
+};
+
+} // namespace FileSys
@@ -0,0 +1,74 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/assert.h"
+#include "core/file_sys/vfs_lazy.h"
+
+namespace FileSys {
+
+LazyVfsFile::LazyVfsFile(Generator generator_, std::size_t size_, std::string name_,
+                         VirtualDir parent_)
+    : generator{std::move(generator_)}, size{size_}, name{std::move(name_)},
+      parent{std::move(parent_)} {}
+
+LazyVfsFile::~LazyVfsFile() = default;
+
+std::string LazyVfsFile::GetName() const {
+    return name;
+}
+
+std::size_t LazyVfsFile::GetSize() const {
+    return size;
+}
+
+bool LazyVfsFile::Resize(std::size_t new_size) {
+    return false;
+}
+
+VirtualDir LazyVfsFile::GetContainingDirectory() const {
+    return parent;
+}
+
+bool LazyVfsFile::IsWritable() const {
+    return false;
+}
+
+bool LazyVfsFile::IsReadable() const {
+    return true;
+}
+
+std::size_t LazyVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    const std::vector<u8>& file_contents = Materialize();
+    if (offset >= file_contents.size()) {
+        return 0;
+    }
+    const auto read = std::min(length, file_contents.size() - offset);
+    std::memcpy(data, file_contents.data() + offset, read);
+    return read;
+}
+
+std::size_t LazyVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    return 0;
+}
+
+bool LazyVfsFile::Rename(std::string_view new_name) {
+    name = new_name;
+    return true;
+}
+
+const std::vector<u8>& LazyVfsFile::Materialize() const {
+    std::lock_guard lock{mutex};
+    if (!materialized) {
+        contents = generator();
+        ASSERT_MSG(contents.size() == size, "Lazy file '{}' materialized {} bytes, expected {}",
+                   name, contents.size(), size);
+        materialized = true;
+    }
+    return contents;
+}
+
+} // namespace FileSys
@@ -0,0 +1,52 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "core/file_sys/vfs.h"
+
+namespace FileSys {
+
+// Read-only file whose contents are produced by a generator on first access. Used for data that
+// is expensive to materialize (decompression, decryption) and often never read, such as the
+// built-in system archive fonts, which are mounted at boot whether or not the title uses them.
+class LazyVfsFile : public VfsFile {
+public:
+    using Generator = std::function<std::vector<u8>()>;
+
+    explicit LazyVfsFile(Generator generator_, std::size_t size_, std::string name_,
+                         VirtualDir parent_ = nullptr);
+    ~LazyVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    VirtualDir GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view new_name) override;
+
+private:
+    const std::vector<u8>& Materialize() const;
+
+    Generator generator;
+    std::size_t size;
+    std::string name;
+    VirtualDir parent;
+
+    // Contents are produced on first read, possibly from a guest thread, so the generator call
+    // is serialized
+    mutable std::mutex mutex;
+    mutable std::vector<u8> contents;
+    mutable bool materialized = false;
+};
+
+} // namespace FileSys
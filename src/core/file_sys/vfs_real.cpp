@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <utility>
 #include "common/assert.h"
@@ -12,10 +13,96 @@
 #include "common/logging/log.h"
 #include "core/file_sys/vfs_real.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#include "common/string_util.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace FileSys {
 
 namespace FS = Common::FS;
 
+// Read-only view of a file mapped into the address space, letting reads be serviced as copies
+// out of the page cache instead of a seek+read syscall pair per call
+class FileMapping {
+public:
+    static std::unique_ptr<FileMapping> Create(const std::string& path) {
+#ifdef _WIN32
+        const HANDLE file = CreateFileW(Common::UTF8ToUTF16W(path).c_str(), GENERIC_READ,
+                                        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+            CloseHandle(file);
+            return nullptr;
+        }
+        const HANDLE view = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (view == nullptr) {
+            return nullptr;
+        }
+        u8* const data = static_cast<u8*>(MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0));
+        CloseHandle(view);
+        if (data == nullptr) {
+            return nullptr;
+        }
+        return std::unique_ptr<FileMapping>(
+            new FileMapping(data, static_cast<std::size_t>(file_size.QuadPart)));
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            return nullptr;
+        }
+        struct stat file_info {};
+        if (::fstat(fd, &file_info) == -1 || file_info.st_size == 0) {
+            ::close(fd);
+            return nullptr;
+        }
+        const auto size = static_cast<std::size_t>(file_info.st_size);
+        void* const data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            return nullptr;
+        }
+        return std::unique_ptr<FileMapping>(new FileMapping(static_cast<u8*>(data), size));
+#endif
+    }
+
+    ~FileMapping() {
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        ::munmap(data, size);
+#endif
+    }
+
+    FileMapping(const FileMapping&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+
+    std::size_t Read(u8* dest, std::size_t length, std::size_t offset) const {
+        if (offset >= size) {
+            return 0;
+        }
+        const auto read_length = std::min(length, size - offset);
+        std::memcpy(dest, data + offset, read_length);
+        return read_length;
+    }
+
+private:
+    FileMapping(u8* data_, std::size_t size_) : data{data_}, size{size_} {}
+
+    u8* data;
+    std::size_t size;
+};
+
 static std::string ModeFlagsToString(Mode mode) {
     std::string mode_str;
 
@@ -266,6 +353,8 @@ std::size_t RealVfsFile::GetSize() const {
 }
 
 bool RealVfsFile::Resize(std::size_t new_size) {
+    mapping.reset();
+    mapping_failed = false;
     return backing->Resize(new_size);
 }
 
@@ -282,14 +371,28 @@ bool RealVfsFile::IsReadable() const {
 }
 
 std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
-    if (!backing->Seek(static_cast<s64>(offset), SEEK_SET)) {
+    // Files opened without write access cannot change under us, so their reads can be served
+    // from a shared read-only mapping instead of the seek+read pair below
+    if (perms == Mode::Read) {
+        if (mapping == nullptr && !mapping_failed) {
+            mapping = FileMapping::Create(path);
+            mapping_failed = mapping == nullptr;
+        }
+        if (mapping != nullptr) {
+            return mapping->Read(data, length, offset);
+        }
+    }
+
+    if (!backing->SeekIfRequired(offset, false)) {
         return 0;
     }
     return backing->ReadBytes(data, length);
 }
 
 std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
-    if (!backing->Seek(static_cast<s64>(offset), SEEK_SET)) {
+    // Skipping the reposition on sequential writes lets the stdio buffer coalesce the many
+    // small writes that save data traffic consists of
+    if (!backing->SeekIfRequired(offset, true)) {
         return 0;
     }
     return backing->WriteBytes(data, length);
@@ -300,6 +403,7 @@ bool RealVfsFile::Rename(std::string_view name) {
 }
 
 bool RealVfsFile::Close() {
+    mapping.reset();
     return backing->Close();
 }
 
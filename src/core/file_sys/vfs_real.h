@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string_view>
 #include <boost/container/flat_map.hpp>
 #include "core/file_sys/mode.h"
@@ -15,6 +16,8 @@ class IOFile;
 
 namespace FileSys {
 
+class FileMapping;
+
 class RealVfsFilesystem : public VfsFilesystem {
 public:
     RealVfsFilesystem();
@@ -65,6 +68,10 @@ private:
 
     RealVfsFilesystem& base;
     std::shared_ptr<Common::FS::IOFile> backing;
+    /// Read-only view of the backing file mapped into the address space, created lazily on the
+    /// first read when the file was opened without write access
+    mutable std::unique_ptr<FileMapping> mapping;
+    mutable bool mapping_failed{};
     std::string path;
     std::string parent_path;
     std::vector<std::string> path_components;
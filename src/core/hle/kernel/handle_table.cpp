@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <bit>
 #include <utility>
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -50,12 +51,20 @@ ResultCode HandleTable::SetSize(s32 handle_table_size) {
 ResultVal<Handle> HandleTable::Create(std::shared_ptr<Object> obj) {
     DEBUG_ASSERT(obj != nullptr);
 
-    const u16 slot = next_free_slot;
+    // Find the lowest free slot with a trailing zero scan over the bitmap
+    std::size_t slot = MAX_COUNT;
+    for (std::size_t word_index = 0; word_index < free_slots.size(); ++word_index) {
+        const u64 word = free_slots[word_index];
+        if (word != 0) {
+            slot = word_index * BITMAP_WORD_BITS + static_cast<std::size_t>(std::countr_zero(word));
+            break;
+        }
+    }
     if (slot >= table_size) {
         LOG_ERROR(Kernel, "Unable to allocate Handle, too many slots in use.");
         return ERR_HANDLE_TABLE_FULL;
     }
-    next_free_slot = generations[slot];
+    free_slots[slot / BITMAP_WORD_BITS] &= ~(u64{1} << (slot % BITMAP_WORD_BITS));
 
     const u16 generation = next_generation++;
 
@@ -65,10 +74,10 @@ ResultVal<Handle> HandleTable::Create(std::shared_ptr<Object> obj) {
         next_generation = 1;
     }
 
-    generations[slot] = generation;
-    objects[slot] = std::move(obj);
+    entries[slot].generation = generation;
+    entries[slot].object = std::move(obj);
 
-    Handle handle = generation | (slot << 15);
+    const Handle handle = generation | static_cast<Handle>(slot << 15);
     return MakeResult<Handle>(handle);
 }
 
@@ -89,14 +98,12 @@ ResultCode HandleTable::Close(Handle handle) {
 
     const u16 slot = GetSlot(handle);
 
-    if (objects[slot].use_count() == 1) {
-        objects[slot]->Finalize();
+    if (entries[slot].object.use_count() == 1) {
+        entries[slot].object->Finalize();
     }
 
-    objects[slot] = nullptr;
-
-    generations[slot] = next_free_slot;
-    next_free_slot = slot;
+    entries[slot].object = nullptr;
+    free_slots[slot / BITMAP_WORD_BITS] |= u64{1} << (slot % BITMAP_WORD_BITS);
     return RESULT_SUCCESS;
 }
 
@@ -104,7 +111,8 @@ bool HandleTable::IsValid(Handle handle) const {
     const std::size_t slot = GetSlot(handle);
     const u16 generation = GetGeneration(handle);
 
-    return slot < table_size && objects[slot] != nullptr && generations[slot] == generation;
+    return slot < table_size && entries[slot].object != nullptr &&
+           entries[slot].generation == generation;
 }
 
 std::shared_ptr<Object> HandleTable::GetGeneric(Handle handle) const {
@@ -117,15 +125,15 @@ std::shared_ptr<Object> HandleTable::GetGeneric(Handle handle) const {
     if (!IsValid(handle)) {
         return nullptr;
     }
-    return objects[GetSlot(handle)];
+    return entries[GetSlot(handle)].object;
 }
 
 void HandleTable::Clear() {
     for (u16 i = 0; i < table_size; ++i) {
-        generations[i] = static_cast<u16>(i + 1);
-        objects[i] = nullptr;
+        entries[i].generation = 0;
+        entries[i].object = nullptr;
     }
-    next_free_slot = 0;
+    free_slots.fill(~u64{0});
 }
 
 } // namespace Kernel
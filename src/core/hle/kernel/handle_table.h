@@ -38,12 +38,10 @@ enum KernelHandle : Handle {
  * "generations" array). When looking up a handle, the Handle's generation must match with the
  * value stored on the class, otherwise the Handle is considered invalid.
  *
- * To find free slots when allocating a Handle without needing to scan the entire object array, the
- * generations field of unallocated slots is re-purposed as a linked list of indices to free slots.
- * When a Handle is created, an index is popped off the list and used for the new Handle. When it
- * is destroyed, it is again pushed onto the list to be re-used by the next allocation. It is
- * likely that this allocation strategy differs from the one used in CTR-OS, but this hasn't been
- * verified and isn't likely to cause any problems.
+ * To find free slots when allocating a Handle without needing to scan the entire entry array, a
+ * bitmap with one bit per slot is kept, and the lowest free slot is found with a trailing zero
+ * scan. It is likely that this allocation strategy differs from the one used in CTR-OS, but this
+ * hasn't been verified and isn't likely to cause any problems.
  */
 class HandleTable final : NonCopyable {
 public:
@@ -112,14 +110,26 @@ public:
     void Clear();
 
 private:
-    /// Stores the Object referenced by the handle or null if the slot is empty.
-    std::array<std::shared_ptr<Object>, MAX_COUNT> objects;
-
     /**
-     * The value of `next_generation` when the handle was created, used to check for validity. For
-     * empty slots, contains the index of the next free slot in the list.
+     * A single entry of the handle table. The generation that validates a handle is packed next
+     * to the object it references, so resolving a handle touches one cache line.
      */
-    std::array<u16, MAX_COUNT> generations;
+    struct Entry {
+        /// The Object referenced by the handle, or null if the slot is empty.
+        std::shared_ptr<Object> object;
+
+        /// The value of `next_generation` when the handle was created, checked for validity.
+        u16 generation = 0;
+    };
+
+    /// Number of bits per word of the free slot bitmap.
+    static constexpr std::size_t BITMAP_WORD_BITS = 64;
+
+    /// Table entries, indexed by the slot field of a handle.
+    std::array<Entry, MAX_COUNT> entries;
+
+    /// Bitmap of free slots; a set bit marks the corresponding slot as free.
+    std::array<u64, MAX_COUNT / BITMAP_WORD_BITS> free_slots{};
 
     /**
      * The limited size of the handle table. This can be specified by process
@@ -134,9 +144,6 @@ private:
      */
     u16 next_generation = 1;
 
-    /// Head of the free slots linked list.
-    u16 next_free_slot = 0;
-
     /// Underlying kernel instance that this handle table operates under.
     KernelCore& kernel;
 };
@@ -186,10 +186,6 @@ ResultCode HLERequestContext::WriteToOutgoingCommandBuffer(KThread& thread) {
     auto& owner_process = *thread.GetOwnerProcess();
     auto& handle_table = owner_process.GetHandleTable();
 
-    std::array<u32, IPC::COMMAND_BUFFER_LENGTH> dst_cmdbuf;
-    memory.ReadBlock(owner_process, thread.GetTLSAddress(), dst_cmdbuf.data(),
-                     dst_cmdbuf.size() * sizeof(u32));
-
     // The header was already built in the internal command buffer. Attempt to parse it to verify
     // the integrity and then copy it over to the target command buffer.
     ParseCommandBuffer(handle_table, cmd_buf.data(), false);
@@ -200,6 +196,7 @@ ResultCode HLERequestContext::WriteToOutgoingCommandBuffer(KThread& thread) {
     if (domain_message_header)
         size -= sizeof(IPC::DomainMessageHeader) / sizeof(u32);
 
+    std::array<u32, IPC::COMMAND_BUFFER_LENGTH> dst_cmdbuf;
     std::copy_n(cmd_buf.begin(), size, dst_cmdbuf.data());
 
     if (command_header->enable_handle_descriptor) {
@@ -243,9 +240,11 @@ ResultCode HLERequestContext::WriteToOutgoingCommandBuffer(KThread& thread) {
         }
     }
 
-    // Copy the translated command buffer back into the thread's command buffer area.
+    // Copy the translated command buffer back into the thread's command buffer area. Only the
+    // words the reply occupies are written; the tail of the TLS buffer is left untouched, which
+    // avoids having to read the guest buffer back just to preserve it.
     memory.WriteBlock(owner_process, thread.GetTLSAddress(), dst_cmdbuf.data(),
-                      dst_cmdbuf.size() * sizeof(u32));
+                      size * sizeof(u32));
 
     return RESULT_SUCCESS;
 }
@@ -272,6 +271,51 @@ std::vector<u8> HLERequestContext::ReadBuffer(std::size_t buffer_index) const {
     return buffer;
 }
 
+std::span<const u8> HLERequestContext::ReadBufferSpan(std::size_t buffer_index) const {
+    const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
+                           BufferDescriptorA()[buffer_index].Size()};
+
+    VAddr address{};
+    std::size_t size{};
+    if (is_buffer_a) {
+        ASSERT_OR_EXECUTE_MSG(
+            BufferDescriptorA().size() > buffer_index, { return {}; },
+            "BufferDescriptorA invalid buffer_index {}", buffer_index);
+        address = BufferDescriptorA()[buffer_index].Address();
+        size = BufferDescriptorA()[buffer_index].Size();
+    } else {
+        ASSERT_OR_EXECUTE_MSG(
+            BufferDescriptorX().size() > buffer_index, { return {}; },
+            "BufferDescriptorX invalid buffer_index {}", buffer_index);
+        address = BufferDescriptorX()[buffer_index].Address();
+        size = BufferDescriptorX()[buffer_index].Size();
+    }
+
+    if (const auto span = memory.GetContiguousSpan(address, size); !span.empty()) {
+        return span;
+    }
+
+    // The payload is not contiguously backed, read it into a copy owned by this context
+    auto& copy = read_buffer_copies.emplace_back(size);
+    memory.ReadBlock(address, copy.data(), size);
+    return copy;
+}
+
+std::span<u8> HLERequestContext::GetWriteBufferSpan(std::size_t buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+
+    if (is_buffer_b) {
+        return memory.GetContiguousSpan(BufferDescriptorB()[buffer_index].Address(),
+                                        BufferDescriptorB()[buffer_index].Size());
+    }
+    ASSERT_OR_EXECUTE_MSG(
+        BufferDescriptorC().size() > buffer_index, { return {}; },
+        "BufferDescriptorC invalid buffer_index {}", buffer_index);
+    return memory.GetContiguousSpan(BufferDescriptorC()[buffer_index].Address(),
+                                    BufferDescriptorC()[buffer_index].Size());
+}
+
 std::size_t HLERequestContext::WriteBuffer(const void* buffer, std::size_t size,
                                            std::size_t buffer_index) const {
     if (size == 0) {
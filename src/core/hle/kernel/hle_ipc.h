@@ -8,6 +8,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -145,19 +146,25 @@ public:
         return data_payload_offset;
     }
 
-    const std::vector<IPC::BufferDescriptorX>& BufferDescriptorX() const {
+    /// Requests carry at most a couple of buffer descriptors of each type, so they are stored
+    /// with inline capacity to keep command buffer parsing free of heap allocations
+    using BufferDescriptorXList = boost::container::small_vector<IPC::BufferDescriptorX, 2>;
+    using BufferDescriptorABWList = boost::container::small_vector<IPC::BufferDescriptorABW, 2>;
+    using BufferDescriptorCList = boost::container::small_vector<IPC::BufferDescriptorC, 2>;
+
+    const BufferDescriptorXList& BufferDescriptorX() const {
         return buffer_x_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorA() const {
+    const BufferDescriptorABWList& BufferDescriptorA() const {
         return buffer_a_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorB() const {
+    const BufferDescriptorABWList& BufferDescriptorB() const {
         return buffer_b_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorC>& BufferDescriptorC() const {
+    const BufferDescriptorCList& BufferDescriptorC() const {
         return buffer_c_desciptors;
     }
 
@@ -172,6 +179,24 @@ public:
     /// Helper function to read a buffer using the appropriate buffer descriptor
     std::vector<u8> ReadBuffer(std::size_t buffer_index = 0) const;
 
+    /**
+     * Helper function to read a buffer without copying when possible.
+     *
+     * The returned span aliases guest memory when the descriptor payload is contiguously
+     * backed, and points to a copy owned by this context otherwise. In either case it is
+     * only valid until the request completes.
+     */
+    [[nodiscard]] std::span<const u8> ReadBufferSpan(std::size_t buffer_index = 0) const;
+
+    /**
+     * Helper function to resolve the output buffer as guest memory that can be written
+     * directly, avoiding the copy WriteBuffer performs.
+     *
+     * @returns A span over the whole output buffer, or an empty span when the payload is not
+     *          contiguously backed and WriteBuffer has to be used instead.
+     */
+    [[nodiscard]] std::span<u8> GetWriteBufferSpan(std::size_t buffer_index = 0) const;
+
     /// Helper function to write a buffer using the appropriate buffer descriptor
     std::size_t WriteBuffer(const void* buffer, std::size_t size,
                             std::size_t buffer_index = 0) const;
@@ -293,11 +318,11 @@ private:
     std::optional<IPC::HandleDescriptorHeader> handle_descriptor_header;
     std::optional<IPC::DataPayloadHeader> data_payload_header;
     std::optional<IPC::DomainMessageHeader> domain_message_header;
-    std::vector<IPC::BufferDescriptorX> buffer_x_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_a_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_b_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_w_desciptors;
-    std::vector<IPC::BufferDescriptorC> buffer_c_desciptors;
+    BufferDescriptorXList buffer_x_desciptors;
+    BufferDescriptorABWList buffer_a_desciptors;
+    BufferDescriptorABWList buffer_b_desciptors;
+    BufferDescriptorABWList buffer_w_desciptors;
+    BufferDescriptorCList buffer_c_desciptors;
 
     unsigned data_payload_offset{};
     unsigned buffer_c_offset{};
@@ -306,6 +331,9 @@ private:
     std::vector<std::shared_ptr<SessionRequestHandler>> domain_request_handlers;
     bool is_thread_waiting{};
 
+    /// Copies backing ReadBufferSpan results for discontiguous descriptor payloads
+    mutable boost::container::small_vector<std::vector<u8>, 1> read_buffer_copies;
+
     KernelCore& kernel;
     Core::Memory::Memory& memory;
 };
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/scope_exit.h"
 #include "core/arm/exclusive_monitor.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_address_arbiter.h"
@@ -87,7 +88,43 @@ bool UpdateIfEqual(Core::System& system, s32* out, VAddr address, s32 value, s32
 
 } // namespace
 
+std::optional<ResultCode> KAddressArbiter::TrySignalWithoutWaiters(VAddr addr, s32 value,
+                                                                   s32 count) {
+    // Probe for waiters before doing anything else. A stale non-zero read only costs us the
+    // locked path.
+    if (GetWaiterCount(addr).load() != 0) {
+        return std::nullopt;
+    }
+
+    // Update the userspace value through the exclusive monitor alone.
+    s32 user_value{};
+    if (!UpdateIfEqual(system, std::addressof(user_value), addr, value, value + 1)) {
+        return Svc::ResultInvalidCurrentMemory;
+    }
+    if (user_value != value) {
+        return Svc::ResultInvalidState;
+    }
+
+    // Re-probe after the update. The wait paths publish themselves before reading the userspace
+    // value, so a waiter that could have observed the old value is visible here; the fence keeps
+    // the update from being reordered past the probe.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (GetWaiterCount(addr).load() == 0) {
+        return RESULT_SUCCESS;
+    }
+
+    // A waiter raced in while we updated; wake it through the locked path.
+    return Signal(addr, count);
+}
+
 ResultCode KAddressArbiter::Signal(VAddr addr, s32 count) {
+    // The signaled value was written by the caller before the SVC, so when no wait is published
+    // there is no thread to wake and the scheduler lock can be skipped entirely.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (GetWaiterCount(addr).load() == 0) {
+        return RESULT_SUCCESS;
+    }
+
     // Perform signaling.
     s32 num_waiters{};
     {
@@ -111,6 +148,11 @@ ResultCode KAddressArbiter::Signal(VAddr addr, s32 count) {
 }
 
 ResultCode KAddressArbiter::SignalAndIncrementIfEqual(VAddr addr, s32 value, s32 count) {
+    // Try the uncontended path first.
+    if (const auto result = TrySignalWithoutWaiters(addr, value, count)) {
+        return *result;
+    }
+
     // Perform signaling.
     s32 num_waiters{};
     {
@@ -143,6 +185,12 @@ ResultCode KAddressArbiter::SignalAndIncrementIfEqual(VAddr addr, s32 value, s32
 }
 
 ResultCode KAddressArbiter::SignalAndModifyByWaitingCountIfEqual(VAddr addr, s32 value, s32 count) {
+    // With no waiters the updated value is value + 1 in every firmware revision, so this
+    // collapses to the same uncontended path as SignalAndIncrementIfEqual.
+    if (const auto result = TrySignalWithoutWaiters(addr, value, count)) {
+        return *result;
+    }
+
     // Perform signaling.
     s32 num_waiters{};
     {
@@ -239,6 +287,11 @@ ResultCode KAddressArbiter::WaitIfLessThan(VAddr addr, s32 value, bool decrement
     // Prepare to wait.
     KThread* cur_thread = kernel.CurrentScheduler()->GetCurrentThread();
 
+    // Publish this wait before reading the userspace value, so that the unlocked probes in the
+    // signal paths cannot miss us. The count stays raised for as long as we may be asleep.
+    GetWaiterCount(addr).fetch_add(1);
+    SCOPE_EXIT({ GetWaiterCount(addr).fetch_sub(1); });
+
     {
         KScopedSchedulerLockAndSleep slp{kernel, cur_thread, timeout};
 
@@ -306,6 +359,11 @@ ResultCode KAddressArbiter::WaitIfEqual(VAddr addr, s32 value, s64 timeout) {
     // Prepare to wait.
     KThread* cur_thread = kernel.CurrentScheduler()->GetCurrentThread();
 
+    // Publish this wait before reading the userspace value, so that the unlocked probes in the
+    // signal paths cannot miss us. The count stays raised for as long as we may be asleep.
+    GetWaiterCount(addr).fetch_add(1);
+    SCOPE_EXIT({ GetWaiterCount(addr).fetch_sub(1); });
+
     {
         KScopedSchedulerLockAndSleep slp{kernel, cur_thread, timeout};
 
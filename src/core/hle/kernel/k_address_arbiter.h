@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <optional>
+
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "core/hle/kernel/k_condition_variable.h"
@@ -61,8 +65,31 @@ private:
     [[nodiscard]] ResultCode WaitIfLessThan(VAddr addr, s32 value, bool decrement, s64 timeout);
     [[nodiscard]] ResultCode WaitIfEqual(VAddr addr, s32 value, s64 timeout);
 
+    /**
+     * Attempts the uncontended signal path shared by SignalAndIncrementIfEqual and
+     * SignalAndModifyByWaitingCountIfEqual, whose updated value is also value + 1 when no thread
+     * is waiting. Returns an empty optional when a waiter exists and the locked path has to run.
+     */
+    [[nodiscard]] std::optional<ResultCode> TrySignalWithoutWaiters(VAddr addr, s32 value,
+                                                                    s32 count);
+
+    /**
+     * Gets the waiter count bucket for an address. Buckets are probed without the scheduler lock
+     * by the signal paths to skip all work when no thread can be waiting on the address; hash
+     * collisions only cause a harmless fallback to the locked path.
+     */
+    [[nodiscard]] std::atomic<s32>& GetWaiterCount(VAddr addr) {
+        return waiter_counts[(addr >> 2) % waiter_counts.size()];
+    }
+
+    /// Number of hashed per-address waiter count buckets.
+    static constexpr std::size_t NumWaiterCountBuckets = 256;
+
     ThreadTree thread_tree;
 
+    /// Approximate number of wait attempts in progress per address hash bucket.
+    std::array<std::atomic<s32>, NumWaiterCountBuckets> waiter_counts{};
+
     Core::System& system;
     KernelCore& kernel;
 };
@@ -5,6 +5,8 @@
 #include "core/hle/kernel/k_event.h"
 #include "core/hle/kernel/k_readable_event.h"
 #include "core/hle/kernel/k_writable_event.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/object_pool.h"
 
 namespace Kernel {
 
@@ -13,7 +15,7 @@ KEvent::KEvent(KernelCore& kernel, std::string&& name) : Object{kernel, std::mov
 KEvent::~KEvent() = default;
 
 std::shared_ptr<KEvent> KEvent::Create(KernelCore& kernel, std::string&& name) {
-    return std::make_shared<KEvent>(kernel, std::move(name));
+    return kernel.GetObjectPool<KEvent>().Make(kernel, std::move(name));
 }
 
 void KEvent::Initialize() {
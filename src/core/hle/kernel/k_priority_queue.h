@@ -152,7 +152,9 @@ public:
 
     class KPriorityQueueImpl {
     public:
-        constexpr KPriorityQueueImpl() = default;
+        constexpr KPriorityQueueImpl() {
+            front_priorities.fill(LowestPriority + 1);
+        }
 
         constexpr void PushBack(s32 priority, s32 core, Member* member) {
             ASSERT(IsValidCore(core));
@@ -165,6 +167,10 @@ public:
             if (this->queues[priority].PushBack(core, member)) {
                 this->available_priorities[core].SetBit(priority);
             }
+            if (priority < this->front_priorities[core]) {
+                this->front_cache[core] = member;
+                this->front_priorities[core] = priority;
+            }
         }
 
         constexpr void PushFront(s32 priority, s32 core, Member* member) {
@@ -178,6 +184,10 @@ public:
             if (this->queues[priority].PushFront(core, member)) {
                 this->available_priorities[core].SetBit(priority);
             }
+            if (priority <= this->front_priorities[core]) {
+                this->front_cache[core] = member;
+                this->front_priorities[core] = priority;
+            }
         }
 
         constexpr void Remove(s32 priority, s32 core, Member* member) {
@@ -191,18 +201,17 @@ public:
             if (this->queues[priority].Remove(core, member)) {
                 this->available_priorities[core].ClearBit(priority);
             }
+            if (member == this->front_cache[core]) {
+                this->RefreshFrontCache(core);
+            }
         }
 
         constexpr Member* GetFront(s32 core) const {
             ASSERT(IsValidCore(core));
 
-            const s32 priority =
-                static_cast<s32>(this->available_priorities[core].CountLeadingZero());
-            if (priority <= LowestPriority) {
-                return this->queues[priority].GetFront(core);
-            } else {
-                return nullptr;
-            }
+            // The cache is kept up to date by every mutator, so the scheduler's common
+            // no-change query never rescans the priority bitset.
+            return this->front_cache[core];
         }
 
         constexpr Member* GetFront(s32 priority, s32 core) const {
@@ -237,6 +246,10 @@ public:
             if (priority <= LowestPriority) {
                 this->queues[priority].Remove(core, member);
                 this->queues[priority].PushFront(core, member);
+                if (priority <= this->front_priorities[core]) {
+                    this->front_cache[core] = member;
+                    this->front_priorities[core] = priority;
+                }
             }
         }
 
@@ -247,6 +260,9 @@ public:
             if (priority <= LowestPriority) {
                 this->queues[priority].Remove(core, member);
                 this->queues[priority].PushBack(core, member);
+                if (member == this->front_cache[core]) {
+                    this->RefreshFrontCache(core);
+                }
                 return this->queues[priority].GetFront(core);
             } else {
                 return nullptr;
@@ -254,8 +270,27 @@ public:
         }
 
     private:
+        /// Rescans the priority bitset after the cached front of a core was removed or yielded
+        constexpr void RefreshFrontCache(s32 core) {
+            const s32 priority =
+                static_cast<s32>(this->available_priorities[core].CountLeadingZero());
+            if (priority <= LowestPriority) {
+                this->front_cache[core] = this->queues[priority].GetFront(core);
+                this->front_priorities[core] = priority;
+            } else {
+                this->front_cache[core] = nullptr;
+                this->front_priorities[core] = LowestPriority + 1;
+            }
+        }
+
         std::array<KPerCoreQueue, NumPriority> queues{};
         std::array<Common::BitSet64<NumPriority>, NumCores> available_priorities{};
+
+        // Cached head of every per-core schedule, maintained incrementally so GetFront is a
+        // plain load. front_priorities holds the priority the cached member was queued at;
+        // LowestPriority + 1 means the core has no queued members.
+        std::array<Member*, NumCores> front_cache{};
+        std::array<s32, NumCores> front_priorities{};
     };
 
 private:
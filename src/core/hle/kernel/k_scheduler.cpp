@@ -31,6 +31,12 @@ static void IncrementScheduledCount(Kernel::KThread* thread) {
     }
 }
 
+static void IncrementMigrationCount(Kernel::KThread* thread) {
+    if (auto process = thread->GetOwnerProcess(); process) {
+        process->IncrementCoreMigrationCount();
+    }
+}
+
 void KScheduler::RescheduleCores(KernelCore& kernel, u64 cores_pending_reschedule) {
     auto scheduler = kernel.CurrentScheduler();
 
@@ -149,6 +155,7 @@ u64 KScheduler::UpdateHighestPriorityThreadsImpl(KernelCore& kernel) {
                     // The suggested thread isn't bound to its core, so we can migrate it!
                     suggested->SetActiveCore(core_id);
                     priority_queue.ChangeCore(suggested_core, suggested);
+                    IncrementMigrationCount(suggested);
 
                     top_threads[core_id] = suggested;
                     cores_needing_scheduling |=
@@ -182,6 +189,7 @@ u64 KScheduler::UpdateHighestPriorityThreadsImpl(KernelCore& kernel) {
                         // Perform the migration.
                         suggested->SetActiveCore(core_id);
                         priority_queue.ChangeCore(candidate_core, suggested);
+                        IncrementMigrationCount(suggested);
 
                         top_threads[core_id] = suggested;
                         cores_needing_scheduling |=
@@ -303,6 +311,7 @@ void KScheduler::RotateScheduledQueue(s32 core_id, s32 priority) {
                     suggested->SetActiveCore(core_id);
                     priority_queue.ChangeCore(suggested_core, suggested, true);
                     IncrementScheduledCount(suggested);
+                    IncrementMigrationCount(suggested);
                     break;
                 }
             }
@@ -345,6 +354,7 @@ void KScheduler::RotateScheduledQueue(s32 core_id, s32 priority) {
                         suggested->SetActiveCore(core_id);
                         priority_queue.ChangeCore(suggested_core, suggested, true);
                         IncrementScheduledCount(suggested);
+                        IncrementMigrationCount(suggested);
                         break;
                     }
                 }
@@ -506,6 +516,7 @@ void KScheduler::YieldWithCoreMigration(KernelCore& kernel) {
                         suggested->SetActiveCore(core_id);
                         priority_queue.ChangeCore(suggested_core, suggested, true);
                         IncrementScheduledCount(suggested);
+                        IncrementMigrationCount(suggested);
                         break;
                     } else {
                         // We couldn't perform a migration, but we should check again on a future
@@ -580,6 +591,7 @@ void KScheduler::YieldToAnyThread(KernelCore& kernel) {
                             suggested->SetActiveCore(core_id);
                             priority_queue.ChangeCore(suggested_core, suggested);
                             IncrementScheduledCount(suggested);
+                            IncrementMigrationCount(suggested);
                         }
 
                         // Regardless of whether we migrated, we had a candidate, so we're done.
@@ -726,15 +738,15 @@ void KScheduler::ScheduleImpl() {
     // Save context for previous thread
     Unload(previous_thread);
 
-    std::shared_ptr<Common::Fiber>* old_context;
+    Common::Fiber* old_context;
     if (previous_thread != nullptr) {
-        old_context = &previous_thread->GetHostContext();
+        old_context = previous_thread->GetHostContext().get();
     } else {
-        old_context = &idle_thread->GetHostContext();
+        old_context = idle_thread->GetHostContext().get();
     }
     guard.unlock();
 
-    Common::Fiber::YieldTo(*old_context, switch_fiber);
+    Common::Fiber::YieldTo(old_context, switch_fiber.get());
     /// When a thread wakes up, the scheduler may have changed to other in another core.
     auto& next_scheduler = *system.Kernel().CurrentScheduler();
     next_scheduler.SwitchContextStep2();
@@ -769,13 +781,13 @@ void KScheduler::SwitchToCurrent() {
                     break;
                 }
             }
-            std::shared_ptr<Common::Fiber>* next_context;
+            Common::Fiber* next_context;
             if (next_thread != nullptr) {
-                next_context = &next_thread->GetHostContext();
+                next_context = next_thread->GetHostContext().get();
             } else {
-                next_context = &idle_thread->GetHostContext();
+                next_context = idle_thread->GetHostContext().get();
             }
-            Common::Fiber::YieldTo(switch_fiber, *next_context);
+            Common::Fiber::YieldTo(switch_fiber.get(), next_context);
         } while (!is_switch_pending());
     }
 }
@@ -29,6 +29,7 @@
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/memory/memory_layout.h"
 #include "core/hle/kernel/object.h"
+#include "core/hle/kernel/object_pool.h"
 #include "core/hle/kernel/process.h"
 #include "core/hle/kernel/svc_results.h"
 #include "core/hle/kernel/time_manager.h"
@@ -1015,7 +1016,7 @@ ResultVal<std::shared_ptr<KThread>> KThread::Create(Core::System& system, Thread
                                                     void* thread_start_parameter) {
     auto& kernel = system.Kernel();
 
-    std::shared_ptr<KThread> thread = std::make_shared<KThread>(kernel);
+    std::shared_ptr<KThread> thread = kernel.GetObjectPool<KThread>().Make(kernel);
 
     if (const auto result =
             thread->InitializeThread(thread.get(), entry_point, arg, stack_top, priority,
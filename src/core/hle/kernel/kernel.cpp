@@ -8,14 +8,12 @@
 #include <functional>
 #include <memory>
 #include <thread>
-#include <unordered_set>
 #include <utility>
 
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/thread.h"
-#include "common/thread_worker.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/cpu_interrupt_handler.h"
 #include "core/arm/exclusive_monitor.h"
@@ -28,6 +26,7 @@
 #include "core/hle/kernel/client_port.h"
 #include "core/hle/kernel/errors.h"
 #include "core/hle/kernel/handle_table.h"
+#include "core/hle/kernel/k_event.h"
 #include "core/hle/kernel/k_resource_limit.h"
 #include "core/hle/kernel/k_scheduler.h"
 #include "core/hle/kernel/k_thread.h"
@@ -35,8 +34,10 @@
 #include "core/hle/kernel/memory/memory_layout.h"
 #include "core/hle/kernel/memory/memory_manager.h"
 #include "core/hle/kernel/memory/slab_heap.h"
+#include "core/hle/kernel/object_pool.h"
 #include "core/hle/kernel/physical_core.h"
 #include "core/hle/kernel/process.h"
+#include "core/hle/kernel/server_session.h"
 #include "core/hle/kernel/service_thread.h"
 #include "core/hle/kernel/shared_memory.h"
 #include "core/hle/kernel/time_manager.h"
@@ -61,8 +62,8 @@ struct KernelCore::Impl {
 
         RegisterHostThread();
 
-        service_thread_manager =
-            std::make_unique<Common::ThreadWorker>(1, "yuzu:ServiceThreadManager");
+        default_service_thread = std::make_shared<Kernel::ServiceThread>(
+            kernel, Core::Hardware::NUM_CPU_CORES, "DefaultServiceThread");
         is_phantom_mode_for_singlecore = false;
 
         InitializePhysicalCores();
@@ -82,9 +83,8 @@ struct KernelCore::Impl {
     void Shutdown() {
         process_list.clear();
 
-        // Ensures all service threads gracefully shutdown
-        service_thread_manager.reset();
-        service_threads.clear();
+        // Ensures the service worker threads gracefully shutdown
+        default_service_thread.reset();
 
         next_object_id = 0;
         next_kernel_process_id = Process::InitialKIPIDMin;
@@ -335,6 +335,11 @@ struct KernelCore::Impl {
     std::unique_ptr<Core::ExclusiveMonitor> exclusive_monitor;
     std::vector<Kernel::PhysicalCore> cores;
 
+    // Instruction cache range invalidations performed this session, for spotting titles that
+    // rewrite code regions and trigger retranslation storms
+    std::atomic<u64> cache_invalidation_count{0};
+    std::atomic<u64> cache_invalidation_bytes{0};
+
     // Next host thead ID to use, 0-3 IDs represent core threads, >3 represent others
     std::atomic<u32> next_host_thread_id{Core::Hardware::NUM_CPU_CORES};
 
@@ -348,12 +353,13 @@ struct KernelCore::Impl {
     std::shared_ptr<Kernel::SharedMemory> irs_shared_mem;
     std::shared_ptr<Kernel::SharedMemory> time_shared_mem;
 
-    // Threads used for services
-    std::unordered_set<std::shared_ptr<Kernel::ServiceThread>> service_threads;
+    // Shared worker pool executing the service requests of every ServerSession
+    std::shared_ptr<Kernel::ServiceThread> default_service_thread;
 
-    // Service threads are managed by a worker thread, so that a calling service thread can queue up
-    // the release of itself
-    std::unique_ptr<Common::ThreadWorker> service_thread_manager;
+    // Allocation pools for the kernel object types titles churn through
+    ObjectPool<KThread> thread_pool;
+    ObjectPool<KEvent> event_pool;
+    ObjectPool<ServerSession> server_session_pool;
 
     std::array<std::shared_ptr<KThread>, Core::Hardware::NUM_CPU_CORES> suspend_threads{};
     std::array<Core::CPUInterruptHandler, Core::Hardware::NUM_CPU_CORES> interrupts{};
@@ -495,6 +501,17 @@ void KernelCore::InvalidateAllInstructionCaches() {
 }
 
 void KernelCore::InvalidateCpuInstructionCacheRange(VAddr addr, std::size_t size) {
+    // Range invalidations force the jit to retranslate every block they touch, so make storms of
+    // them visible: titles that rewrite code during loading show up here, and the periodic totals
+    // tell us which ranges are getting retranslated
+    const u64 count = impl->cache_invalidation_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    const u64 bytes =
+        impl->cache_invalidation_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    if ((count & 255) == 0) {
+        LOG_INFO(Kernel, "Instruction cache invalidation storm: {} ranges, {} bytes total", count,
+                 bytes);
+    }
+
     for (auto& physical_core : impl->cores) {
         if (!physical_core.IsInitialized()) {
             continue;
@@ -644,19 +661,29 @@ void KernelCore::ExitSVCProfile() {
     MicroProfileLeave(MICROPROFILE_TOKEN(Kernel_SVC), impl->svc_ticks[core]);
 }
 
-std::weak_ptr<Kernel::ServiceThread> KernelCore::CreateServiceThread(const std::string& name) {
-    auto service_thread = std::make_shared<Kernel::ServiceThread>(*this, 1, name);
-    impl->service_thread_manager->QueueWork(
-        [this, service_thread] { impl->service_threads.emplace(service_thread); });
-    return service_thread;
+std::weak_ptr<Kernel::ServiceThread> KernelCore::CreateServiceThread(
+    [[maybe_unused]] const std::string& name) {
+    return impl->default_service_thread;
 }
 
-void KernelCore::ReleaseServiceThread(std::weak_ptr<Kernel::ServiceThread> service_thread) {
-    impl->service_thread_manager->QueueWork([this, service_thread] {
-        if (auto strong_ptr = service_thread.lock()) {
-            impl->service_threads.erase(strong_ptr);
-        }
-    });
+void KernelCore::ReleaseServiceThread(
+    [[maybe_unused]] std::weak_ptr<Kernel::ServiceThread> service_thread) {
+    // Every session shares the default service thread, which lives as long as the kernel
+}
+
+template <>
+ObjectPool<KThread>& KernelCore::GetObjectPool() {
+    return impl->thread_pool;
+}
+
+template <>
+ObjectPool<KEvent>& KernelCore::GetObjectPool() {
+    return impl->event_pool;
+}
+
+template <>
+ObjectPool<ServerSession>& KernelCore::GetObjectPool() {
+    return impl->server_session_pool;
 }
 
 bool KernelCore::IsPhantomModeForSingleCore() const {
@@ -36,10 +36,14 @@ class SlabHeap;
 class ClientPort;
 class GlobalSchedulerContext;
 class HandleTable;
+template <typename T>
+class ObjectPool;
 class PhysicalCore;
 class Process;
+class KEvent;
 class KResourceLimit;
 class KScheduler;
+class ServerSession;
 class SharedMemory;
 class ServiceThread;
 class Synchronization;
@@ -226,21 +230,28 @@ public:
     void ExitSVCProfile();
 
     /**
-     * Creates an HLE service thread, which are used to execute service routines asynchronously.
-     * While these are allocated per ServerSession, these need to be owned and managed outside of
-     * ServerSession to avoid a circular dependency.
-     * @param name String name for the ServerSession creating this thread, used for debug purposes.
-     * @returns The a weak pointer newly created service thread.
+     * Gets the HLE service thread used to execute service routines asynchronously. Every
+     * ServerSession shares one pooled service thread, which guarantees the ordering of the
+     * requests of each individual session.
+     * @param name String name for the ServerSession requesting the thread, for debug purposes.
+     * @returns A weak pointer to the shared service thread.
      */
     std::weak_ptr<Kernel::ServiceThread> CreateServiceThread(const std::string& name);
 
     /**
-     * Releases a HLE service thread, instructing KernelCore to free it. This should be called when
-     * the ServerSession associated with the thread is destroyed.
+     * Releases an HLE service thread. This should be called when the ServerSession associated
+     * with it is destroyed.
      * @param service_thread Service thread to release.
      */
     void ReleaseServiceThread(std::weak_ptr<Kernel::ServiceThread> service_thread);
 
+    /**
+     * Gets the pool that recycles allocations of a hot kernel object type. Only specialized for
+     * the types that titles create and destroy frequently.
+     */
+    template <typename T>
+    ObjectPool<T>& GetObjectPool();
+
     /// Workaround for single-core mode when preempting threads while idle.
     bool IsPhantomModeForSingleCore() const;
     void SetIsPhantomModeForSingleCore(bool value);
@@ -273,4 +284,11 @@ private:
     bool exception_exited{};
 };
 
+template <>
+ObjectPool<KThread>& KernelCore::GetObjectPool();
+template <>
+ObjectPool<KEvent>& KernelCore::GetObjectPool();
+template <>
+ObjectPool<ServerSession>& KernelCore::GetObjectPool();
+
 } // namespace Kernel
@@ -74,11 +74,11 @@ public:
             return RESULT_SUCCESS;
         }
         if (!nodes.empty()) {
-            const auto node = nodes.back();
+            auto& node = nodes.back();
             if (node.GetAddress() + node.GetNumPages() * PageSize == address) {
-                address = node.GetAddress();
-                num_pages += node.GetNumPages();
-                nodes.pop_back();
+                // Extend the last node in place instead of reallocating it.
+                node = {node.GetAddress(), node.GetNumPages() + num_pages};
+                return RESULT_SUCCESS;
             }
         }
         nodes.push_back({address, num_pages});
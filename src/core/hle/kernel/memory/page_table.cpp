@@ -916,13 +916,22 @@ bool PageTable::IsRegionContiguous(VAddr addr, u64 size) const {
 void PageTable::AddRegionToPages(VAddr start, std::size_t num_pages,
                                  PageLinkedList& page_linked_list) {
     VAddr addr{start};
-    while (addr < start + (num_pages * PageSize)) {
+    const VAddr end_addr{start + num_pages * PageSize};
+    while (addr < end_addr) {
         const PAddr paddr{GetPhysicalAddr(addr)};
         if (!paddr) {
             UNREACHABLE();
         }
-        page_linked_list.AddBlock(paddr, 1);
-        addr += PageSize;
+
+        // Coalesce physically contiguous pages into a single block so that large regions apply
+        // one block-list edit per contiguous range instead of one per page.
+        VAddr next_addr{addr + PageSize};
+        while (next_addr < end_addr && GetPhysicalAddr(next_addr) == paddr + (next_addr - addr)) {
+            next_addr += PageSize;
+        }
+
+        page_linked_list.AddBlock(paddr, (next_addr - addr) / PageSize);
+        addr = next_addr;
     }
 }
 
@@ -0,0 +1,100 @@
+// Copyright 2021 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Kernel {
+
+/**
+ * Recycles the fused object/control-block allocations std::allocate_shared performs for a single
+ * kernel object type. Hot types such as threads, events and sessions are created and destroyed
+ * constantly by some titles; returning their blocks to a free list instead of the host heap avoids
+ * both the allocator round-trips and the fragmentation they cause.
+ *
+ * Blocks freed after the pool is destroyed are handled gracefully, as every outstanding
+ * shared_ptr's allocator keeps the underlying free list alive.
+ */
+template <typename T>
+class ObjectPool final : NonCopyable {
+public:
+    ObjectPool() = default;
+    ~ObjectPool() = default;
+
+    /// Creates an object of the pooled type, reusing a previously freed block when one exists.
+    template <typename... Args>
+    std::shared_ptr<T> Make(Args&&... args) {
+        return std::allocate_shared<T>(Allocator<T>{state}, std::forward<Args>(args)...);
+    }
+
+private:
+    /// Free list shared between the pool and the allocators of all live objects made from it.
+    struct State {
+        ~State() {
+            for (void* block : free_blocks) {
+                ::operator delete(block);
+            }
+        }
+
+        std::mutex mutex;
+        std::vector<void*> free_blocks;
+    };
+
+    /// Allocator handed to std::allocate_shared. The standard library rebinds it to a single
+    /// internal node type, so every block passing through one pool has the same size.
+    template <typename U>
+    struct Allocator {
+        using value_type = U;
+
+        explicit Allocator(std::shared_ptr<State> state_) : state{std::move(state_)} {}
+
+        template <typename V>
+        Allocator(const Allocator<V>& other) : state{other.state} {}
+
+        U* allocate(std::size_t n) {
+            if (n != 1) {
+                return static_cast<U*>(::operator new(n * sizeof(U)));
+            }
+            std::scoped_lock lock{state->mutex};
+            if (state->free_blocks.empty()) {
+                return static_cast<U*>(::operator new(sizeof(U)));
+            }
+            U* const block = static_cast<U*>(state->free_blocks.back());
+            state->free_blocks.pop_back();
+            return block;
+        }
+
+        void deallocate(U* ptr, std::size_t n) {
+            if (n != 1) {
+                ::operator delete(ptr);
+                return;
+            }
+            std::scoped_lock lock{state->mutex};
+            state->free_blocks.push_back(ptr);
+        }
+
+        template <typename V>
+        bool operator==(const Allocator<V>& other) const {
+            return state == other.state;
+        }
+
+        template <typename V>
+        bool operator!=(const Allocator<V>& other) const {
+            return state != other.state;
+        }
+
+        std::shared_ptr<State> state;
+    };
+
+    std::shared_ptr<State> state = std::make_shared<State>();
+};
+
+} // namespace Kernel
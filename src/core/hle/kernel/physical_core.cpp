@@ -50,6 +50,11 @@ bool PhysicalCore::IsInterrupted() const {
 void PhysicalCore::Interrupt() {
     guard->lock();
     interrupts[core_index].SetInterrupt(true);
+    // Halt the jit directly instead of waiting for the next interrupt poll at a block boundary,
+    // which can be several milliseconds of guest execution away on long time slices
+    if (arm_interface) {
+        arm_interface->SignalInterrupt();
+    }
     guard->unlock();
 }
 
@@ -358,6 +358,9 @@ void Process::PrepareForTermination() {
     FreeTLSRegion(tls_region_address);
     tls_region_address = 0;
 
+    LOG_INFO(Kernel, "Process '{}' scheduled {} times with {} cross-core thread migrations", name,
+             schedule_count, core_migration_count);
+
     ChangeStatus(ProcessStatus::Exited);
 }
 
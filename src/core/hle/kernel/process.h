@@ -245,6 +245,16 @@ public:
         ++schedule_count;
     }
 
+    /// Gets the number of times threads of this process were migrated across cores.
+    u64 GetCoreMigrationCount() const {
+        return core_migration_count;
+    }
+
+    /// Increments the cross-core migration count, used for scheduling telemetry.
+    void IncrementCoreMigrationCount() {
+        ++core_migration_count;
+    }
+
     void IncrementThreadCount();
     void DecrementThreadCount();
 
@@ -463,6 +473,9 @@ private:
     /// Schedule count of this process
     s64 schedule_count{};
 
+    /// Number of cross-core thread migrations performed for this process
+    u64 core_migration_count{};
+
     bool is_signaled{};
     bool is_suspended{};
 
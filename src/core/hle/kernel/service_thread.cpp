@@ -6,6 +6,7 @@
 #include <functional>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 #include <queue>
 
@@ -29,8 +30,16 @@ public:
     void QueueSyncRequest(ServerSession& session, std::shared_ptr<HLERequestContext>&& context);
 
 private:
+    /// Requests pending for one session. At most one of them is in flight at any time, which
+    /// preserves the per-session ordering the dedicated per-session threads used to provide.
+    struct SessionQueue {
+        std::queue<std::function<void()>> pending;
+        bool in_flight{};
+    };
+
     std::vector<std::thread> threads;
-    std::queue<std::function<void()>> requests;
+    std::unordered_map<const ServerSession*, SessionQueue> session_queues;
+    std::queue<const ServerSession*> ready_sessions;
     std::mutex queue_mutex;
     std::condition_variable condition;
     const std::string service_name;
@@ -46,44 +55,69 @@ ServiceThread::Impl::Impl(KernelCore& kernel, std::size_t num_threads, const std
             // Wait for first request before trying to acquire a render context
             {
                 std::unique_lock lock{queue_mutex};
-                condition.wait(lock, [this] { return stop || !requests.empty(); });
+                condition.wait(lock, [this] { return stop || !ready_sessions.empty(); });
             }
 
             kernel.RegisterHostThread();
 
+            std::unique_lock lock{queue_mutex};
             while (true) {
-                std::function<void()> task;
-
-                {
-                    std::unique_lock lock{queue_mutex};
-                    condition.wait(lock, [this] { return stop || !requests.empty(); });
-                    if (stop || requests.empty()) {
-                        return;
-                    }
-                    task = std::move(requests.front());
-                    requests.pop();
+                condition.wait(lock, [this] { return stop || !ready_sessions.empty(); });
+                if (stop) {
+                    return;
+                }
+                if (ready_sessions.empty()) {
+                    continue;
                 }
+                const ServerSession* const session = ready_sessions.front();
+                ready_sessions.pop();
+
+                auto& queue = session_queues.at(session);
+                std::function<void()> task = std::move(queue.pending.front());
+                queue.pending.pop();
 
+                lock.unlock();
                 task();
+                lock.lock();
+
+                // The map may have rehashed while the task ran, resolve the entry again
+                auto& completed_queue = session_queues.at(session);
+                if (completed_queue.pending.empty()) {
+                    session_queues.erase(session);
+                } else {
+                    // Hand the session's next request to any idle worker
+                    ready_sessions.push(session);
+                    condition.notify_one();
+                }
             }
         });
 }
 
 void ServiceThread::Impl::QueueSyncRequest(ServerSession& session,
                                            std::shared_ptr<HLERequestContext>&& context) {
+    bool session_ready = false;
     {
         std::unique_lock lock{queue_mutex};
 
         // ServerSession owns the service thread, so we cannot caption a strong pointer here in the
         // event that the ServerSession is terminated.
         std::weak_ptr<ServerSession> weak_ptr{SharedFrom(&session)};
-        requests.emplace([weak_ptr, context{std::move(context)}]() {
+        auto& queue = session_queues[&session];
+        queue.pending.emplace([weak_ptr, context{std::move(context)}]() {
             if (auto strong_ptr = weak_ptr.lock()) {
                 strong_ptr->CompleteSyncRequest(*context);
             }
         });
+        // A session with a request in flight is requeued by the worker that completes it
+        if (!queue.in_flight) {
+            queue.in_flight = true;
+            ready_sessions.push(&session);
+            session_ready = true;
+        }
+    }
+    if (session_ready) {
+        condition.notify_one();
     }
-    condition.notify_one();
 }
 
 ServiceThread::Impl::~Impl() {
@@ -14,6 +14,7 @@
 #include "common/fiber.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/scope_exit.h"
 #include "common/string_util.h"
 #include "core/arm/exclusive_monitor.h"
@@ -2443,7 +2444,41 @@ static const FunctionDef* GetSVCInfo64(u32 func_num) {
     return &SVC_Table_64[func_num];
 }
 
+/// Dispatches an SVC that is eligible for the fast path. Returns false when the given id has to
+/// go through the full dispatch below.
+static bool CallFastPath(Core::System& system, u32 immediate) {
+    // SVCs dispatched here only read immutable or monotonic state: they cannot block,
+    // reschedule or raise exceptions, so the profile transitions and the per-call thread
+    // bookkeeping of the full dispatch can be skipped. Both tables use the same ids for
+    // the functions below.
+    const bool is_64bit = system.CurrentProcess()->Is64BitProcess();
+    switch (immediate) {
+    case 0x0C: // svcGetThreadPriority
+        if (is_64bit) {
+            SvcWrap64<GetThreadPriority>(system);
+        } else {
+            SvcWrap32<GetThreadPriority32>(system);
+        }
+        return true;
+    case 0x1E: // svcGetSystemTick
+        if (is_64bit) {
+            SvcWrap64<GetSystemTick>(system);
+        } else {
+            SvcWrap32<GetSystemTick32>(system);
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
 void Call(Core::System& system, u32 immediate) {
+    Common::AddPerfCounter(Common::PerfCounter::SvcCalls);
+
+    if (CallFastPath(system, immediate)) {
+        return;
+    }
+
     system.ExitDynarmicProfile();
     auto& kernel = system.Kernel();
     kernel.EnterSVCProfile();
@@ -22,6 +22,7 @@
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/service/audio/audren_u.h"
 #include "core/hle/service/audio/errors.h"
+#include "core/perf_stats.h"
 
 namespace Service::Audio {
 
@@ -102,6 +103,8 @@ private:
             ctx.WriteBuffer(output_params);
         }
 
+        system.GetPerfStats().AddAudioUnderruns(renderer->GetAndResetUnderrunCount());
+
         IPC::ResponseBuilder rb{ctx, 2};
         rb.Push(result);
     }
@@ -5,6 +5,9 @@
 #include <chrono>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
 #include <vector>
 
 #include <opus.h>
@@ -17,6 +20,7 @@
 #include "core/hle/service/audio/hwopus.h"
 
 namespace Service::Audio {
+
 namespace {
 struct OpusDeleter {
     void operator()(OpusMSDecoder* ptr) const {
@@ -25,7 +29,41 @@ struct OpusDeleter {
 };
 
 using OpusDecoderPtr = std::unique_ptr<OpusMSDecoder, OpusDeleter>;
+} // Anonymous namespace
+
+/// Pools decoder contexts per (sample rate, channel count) so sessions that are opened and
+/// closed repeatedly, as voice chat titles do per participant, reuse them instead of paying
+/// for a fresh opus_multistream_decoder_create each time.
+class OpusDecoderPool {
+public:
+    /// Returns a reset pooled decoder, or nullptr when none with these parameters is free
+    OpusDecoderPtr Acquire(u32 sample_rate, u32 channel_count) {
+        std::lock_guard lock{mutex};
+        auto& entries = pool[Key(sample_rate, channel_count)];
+        if (entries.empty()) {
+            return nullptr;
+        }
+        OpusDecoderPtr decoder = std::move(entries.back());
+        entries.pop_back();
+        opus_multistream_decoder_ctl(decoder.get(), OPUS_RESET_STATE);
+        return decoder;
+    }
+
+    void Release(OpusDecoderPtr decoder, u32 sample_rate, u32 channel_count) {
+        std::lock_guard lock{mutex};
+        pool[Key(sample_rate, channel_count)].push_back(std::move(decoder));
+    }
+
+private:
+    static u64 Key(u32 sample_rate, u32 channel_count) {
+        return (u64{sample_rate} << 32) | channel_count;
+    }
+
+    std::mutex mutex;
+    std::unordered_map<u64, std::vector<OpusDecoderPtr>> pool;
+};
 
+namespace {
 struct OpusPacketHeader {
     // Packet size in bytes.
     u32_be size;
@@ -50,8 +88,18 @@ public:
         Enabled,
     };
 
-    explicit OpusDecoderState(OpusDecoderPtr decoder, u32 sample_rate, u32 channel_count)
-        : decoder{std::move(decoder)}, sample_rate{sample_rate}, channel_count{channel_count} {}
+    explicit OpusDecoderState(std::shared_ptr<OpusDecoderPool> pool_, OpusDecoderPtr decoder_,
+                              u32 sample_rate_, u32 channel_count_)
+        : pool{std::move(pool_)}, decoder{std::move(decoder_)}, sample_rate{sample_rate_},
+          channel_count{channel_count_} {}
+
+    ~OpusDecoderState() {
+        if (pool && decoder) {
+            pool->Release(std::move(decoder), sample_rate, channel_count);
+        }
+    }
+
+    OpusDecoderState(OpusDecoderState&&) = default;
 
     // Decodes interleaved Opus packets. Optionally allows reporting time taken to
     // perform the decoding, as well as any relevant extra behavior.
@@ -70,13 +118,33 @@ private:
                                  ExtraBehavior extra_behavior) {
         u32 consumed = 0;
         u32 sample_count = 0;
-        std::vector<opus_int16> samples(ctx.GetWriteBufferSize() / sizeof(opus_int16));
 
         if (extra_behavior == ExtraBehavior::ResetContext) {
             ResetDecoderContext();
         }
 
-        if (!DecodeOpusData(consumed, sample_count, ctx.ReadBuffer(), samples, performance)) {
+        bool decoded = false;
+        if (const auto output = ctx.GetWriteBufferSpan(); !output.empty()) {
+            // Decode straight into guest memory
+            const std::span<opus_int16> samples{reinterpret_cast<opus_int16*>(output.data()),
+                                                output.size() / sizeof(opus_int16)};
+            decoded = DecodeOpusData(consumed, sample_count, ctx.ReadBufferSpan(), samples,
+                                     performance);
+        } else {
+            const std::size_t num_samples = ctx.GetWriteBufferSize() / sizeof(opus_int16);
+            if (sample_buffer.size() < num_samples) {
+                sample_buffer.resize(num_samples);
+            }
+            const std::span<opus_int16> samples{sample_buffer.data(), num_samples};
+            decoded = DecodeOpusData(consumed, sample_count, ctx.ReadBufferSpan(), samples,
+                                     performance);
+            if (decoded) {
+                // Only the decoded samples have to be copied back
+                ctx.WriteBuffer(sample_buffer.data(),
+                                std::size_t{sample_count} * channel_count * sizeof(opus_int16));
+            }
+        }
+        if (!decoded) {
             LOG_ERROR(Audio, "Failed to decode opus data");
             IPC::ResponseBuilder rb{ctx, 2};
             // TODO(ogniK): Use correct error code
@@ -92,11 +160,10 @@ private:
         if (performance) {
             rb.Push<u64>(*performance);
         }
-        ctx.WriteBuffer(samples);
     }
 
-    bool DecodeOpusData(u32& consumed, u32& sample_count, const std::vector<u8>& input,
-                        std::vector<opus_int16>& output, u64* out_performance_time) const {
+    bool DecodeOpusData(u32& consumed, u32& sample_count, std::span<const u8> input,
+                        std::span<opus_int16> output, u64* out_performance_time) const {
         const auto start_time = std::chrono::high_resolution_clock::now();
         const std::size_t raw_output_sz = output.size() * sizeof(opus_int16);
         if (sizeof(OpusPacketHeader) > input.size()) {
@@ -153,9 +220,12 @@ private:
         opus_multistream_decoder_ctl(decoder.get(), OPUS_RESET_STATE);
     }
 
+    std::shared_ptr<OpusDecoderPool> pool;
     OpusDecoderPtr decoder;
     u32 sample_rate;
     u32 channel_count;
+    /// Grow-only scratch for the copying fallback when the output is not contiguously backed
+    std::vector<opus_int16> sample_buffer;
 };
 
 class IHardwareOpusDecoderManager final : public ServiceFramework<IHardwareOpusDecoderManager> {
@@ -273,25 +343,29 @@ void HwOpus::OpenOpusDecoder(Kernel::HLERequestContext& ctx) {
     const int num_stereo_streams = channel_count == 2 ? 1 : 0;
     const auto mapping_table = CreateMappingTable(channel_count);
 
-    int error = 0;
-    OpusDecoderPtr decoder{
-        opus_multistream_decoder_create(sample_rate, static_cast<int>(channel_count), 1,
-                                        num_stereo_streams, mapping_table.data(), &error)};
-    if (error != OPUS_OK || decoder == nullptr) {
-        LOG_ERROR(Audio, "Failed to create Opus decoder (error={}).", error);
-        IPC::ResponseBuilder rb{ctx, 2};
-        // TODO(ogniK): Use correct error code
-        rb.Push(RESULT_UNKNOWN);
-        return;
+    OpusDecoderPtr decoder = decoder_pool->Acquire(sample_rate, channel_count);
+    if (!decoder) {
+        int error = 0;
+        decoder = OpusDecoderPtr{
+            opus_multistream_decoder_create(sample_rate, static_cast<int>(channel_count), 1,
+                                            num_stereo_streams, mapping_table.data(), &error)};
+        if (error != OPUS_OK || decoder == nullptr) {
+            LOG_ERROR(Audio, "Failed to create Opus decoder (error={}).", error);
+            IPC::ResponseBuilder rb{ctx, 2};
+            // TODO(ogniK): Use correct error code
+            rb.Push(RESULT_UNKNOWN);
+            return;
+        }
     }
 
     IPC::ResponseBuilder rb{ctx, 2, 0, 1};
     rb.Push(RESULT_SUCCESS);
     rb.PushIpcInterface<IHardwareOpusDecoderManager>(
-        system, OpusDecoderState{std::move(decoder), sample_rate, channel_count});
+        system, OpusDecoderState{decoder_pool, std::move(decoder), sample_rate, channel_count});
 }
 
-HwOpus::HwOpus(Core::System& system_) : ServiceFramework{system_, "hwopus"} {
+HwOpus::HwOpus(Core::System& system_)
+    : ServiceFramework{system_, "hwopus"}, decoder_pool{std::make_shared<OpusDecoderPool>()} {
     static const FunctionInfo functions[] = {
         {0, &HwOpus::OpenOpusDecoder, "OpenOpusDecoder"},
         {1, &HwOpus::GetWorkBufferSize, "GetWorkBufferSize"},
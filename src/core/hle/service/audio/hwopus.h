@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "core/hle/service/service.h"
 
 namespace Core {
@@ -12,6 +14,8 @@ class System;
 
 namespace Service::Audio {
 
+class OpusDecoderPool;
+
 class HwOpus final : public ServiceFramework<HwOpus> {
 public:
     explicit HwOpus(Core::System& system_);
@@ -20,6 +24,8 @@ public:
 private:
     void OpenOpusDecoder(Kernel::HLERequestContext& ctx);
     void GetWorkBufferSize(Kernel::HLERequestContext& ctx);
+
+    std::shared_ptr<OpusDecoderPool> decoder_pool;
 };
 
 } // namespace Service::Audio
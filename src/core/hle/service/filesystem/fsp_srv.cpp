@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 #include <iterator>
@@ -94,10 +95,14 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
-        // Write the data to memory
-        ctx.WriteBuffer(output);
+        // Read the data from the Storage backend, directly into guest memory when the output
+        // buffer is contiguously backed
+        if (const auto output = ctx.GetWriteBufferSpan(); !output.empty()) {
+            backend->Read(output.data(), std::min(static_cast<std::size_t>(length), output.size()),
+                          offset);
+        } else {
+            ctx.WriteBuffer(backend->ReadBytes(length, offset));
+        }
 
         IPC::ResponseBuilder rb{ctx, 2};
         rb.Push(RESULT_SUCCESS);
@@ -151,15 +156,21 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
-
-        // Write the data to memory
-        ctx.WriteBuffer(output);
+        // Read the data from the Storage backend, directly into guest memory when the output
+        // buffer is contiguously backed
+        std::size_t read_size{};
+        if (const auto output = ctx.GetWriteBufferSpan(); !output.empty()) {
+            read_size = backend->Read(
+                output.data(), std::min(static_cast<std::size_t>(length), output.size()), offset);
+        } else {
+            const std::vector<u8> data = backend->ReadBytes(length, offset);
+            read_size = data.size();
+            ctx.WriteBuffer(data);
+        }
 
         IPC::ResponseBuilder rb{ctx, 4};
         rb.Push(RESULT_SUCCESS);
-        rb.Push(static_cast<u64>(output.size()));
+        rb.Push(static_cast<u64>(read_size));
     }
 
     void Write(Kernel::HLERequestContext& ctx) {
@@ -185,7 +196,7 @@ private:
             return;
         }
 
-        const std::vector<u8> data = ctx.ReadBuffer();
+        const auto data = ctx.ReadBufferSpan();
 
         ASSERT_MSG(
             static_cast<s64>(data.size()) <= length,
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <utility>
 #include "common/assert.h"
 #include "common/bit_field.h"
 #include "common/common_types.h"
@@ -144,6 +145,7 @@ bool Controller_NPad::IsDeviceHandleValid(const DeviceHandle& device_handle) {
 
 Controller_NPad::Controller_NPad(Core::System& system) : ControllerBase(system), system(system) {
     latest_vibration_values.fill({DEFAULT_VIBRATION_VALUE, DEFAULT_VIBRATION_VALUE});
+    npad_entry_dirty.fill(true);
 }
 
 Controller_NPad::~Controller_NPad() {
@@ -235,6 +237,8 @@ void Controller_NPad::InitNewlyAddedController(std::size_t controller_idx) {
     controller.battery_level_left = BATTERY_FULL;
     controller.battery_level_right = BATTERY_FULL;
 
+    npad_entry_dirty[controller_idx] = true;
+
     SignalStyleSetChangedEvent(IndexToNPad(controller_idx));
 }
 
@@ -541,8 +545,32 @@ void Controller_NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing, u8*
 
         press_state |= static_cast<u32>(pad_state.pad_states.raw);
     }
-    std::memcpy(data + NPAD_OFFSET, shared_memory_entries.data(),
-                shared_memory_entries.size() * sizeof(NPadEntry));
+    // Write back to guest memory. A full entry copy is only needed when connection state or
+    // controller metadata changed; on a regular tick only the lifo headers and the entries
+    // pushed above differ from what the guest already sees.
+    for (std::size_t i = 0; i < shared_memory_entries.size(); ++i) {
+        const auto& npad = shared_memory_entries[i];
+        u8* const entry_out = data + NPAD_OFFSET + i * sizeof(NPadEntry);
+        const u8* const entry_in = reinterpret_cast<const u8*>(&npad);
+        if (std::exchange(npad_entry_dirty[i], false)) {
+            std::memcpy(entry_out, entry_in, sizeof(NPadEntry));
+            continue;
+        }
+        const auto copy_section = [entry_out, entry_in](const void* section, std::size_t size) {
+            const auto offset =
+                static_cast<std::size_t>(static_cast<const u8*>(section) - entry_in);
+            std::memcpy(entry_out + offset, section, size);
+        };
+        const std::array<const NPadGeneric*, 7> controller_npads{
+            &npad.fullkey_states,   &npad.handheld_states,  &npad.joy_dual_states,
+            &npad.joy_left_states,  &npad.joy_right_states, &npad.palma_states,
+            &npad.system_ext_states};
+        for (const NPadGeneric* main_controller : controller_npads) {
+            copy_section(&main_controller->common, sizeof(CommonHeader));
+            copy_section(&main_controller->npad[main_controller->common.last_entry_index],
+                         sizeof(GenericStates));
+        }
+    }
 }
 
 void Controller_NPad::OnMotionUpdate(const Core::Timing::CoreTiming& core_timing, u8* data,
@@ -678,8 +706,25 @@ void Controller_NPad::OnMotionUpdate(const Core::Timing::CoreTiming& core_timing
             break;
         }
     }
-    std::memcpy(data + NPAD_OFFSET, shared_memory_entries.data(),
-                shared_memory_entries.size() * sizeof(NPadEntry));
+    // Only the sixaxis lifos advance here; full entry copies are handled by OnUpdate
+    for (std::size_t i = 0; i < shared_memory_entries.size(); ++i) {
+        const auto& npad = shared_memory_entries[i];
+        u8* const entry_out = data + NPAD_OFFSET + i * sizeof(NPadEntry);
+        const u8* const entry_in = reinterpret_cast<const u8*>(&npad);
+        const auto copy_section = [entry_out, entry_in](const void* section, std::size_t size) {
+            const auto offset =
+                static_cast<std::size_t>(static_cast<const u8*>(section) - entry_in);
+            std::memcpy(entry_out + offset, section, size);
+        };
+        const std::array<const SixAxisGeneric*, 6> controller_sixaxes{
+            &npad.sixaxis_fullkey,    &npad.sixaxis_handheld, &npad.sixaxis_dual_left,
+            &npad.sixaxis_dual_right, &npad.sixaxis_left,     &npad.sixaxis_right};
+        for (const SixAxisGeneric* sixaxis_sensor : controller_sixaxes) {
+            copy_section(&sixaxis_sensor->common, sizeof(CommonHeader));
+            copy_section(&sixaxis_sensor->sixaxis[sixaxis_sensor->common.last_entry_index],
+                         sizeof(SixAxisStates));
+        }
+    }
 }
 
 void Controller_NPad::SetSupportedStyleSet(NpadStyleSet style_set) {
@@ -735,6 +780,7 @@ void Controller_NPad::SetNpadMode(u32 npad_id, NpadAssignments assignment_mode)
     ASSERT(npad_index < shared_memory_entries.size());
     if (shared_memory_entries[npad_index].assignment_mode != assignment_mode) {
         shared_memory_entries[npad_index].assignment_mode = assignment_mode;
+        npad_entry_dirty[npad_index] = true;
     }
 }
 
@@ -954,6 +1000,8 @@ void Controller_NPad::DisconnectNpadAtIndex(std::size_t npad_index) {
     controller.assignment_mode = NpadAssignments::Dual;
     controller.footer_type = AppletFooterUiType::None;
 
+    npad_entry_dirty[npad_index] = true;
+
     SignalStyleSetChangedEvent(IndexToNPad(npad_index));
 }
 
@@ -526,6 +526,8 @@ private:
 
     NpadStyleSet style{};
     std::array<NPadEntry, 10> shared_memory_entries{};
+    /// Entries whose non-lifo sections changed and need a full copy on the next OnUpdate
+    std::array<bool, 10> npad_entry_dirty{};
     using ButtonArray = std::array<
         std::array<std::unique_ptr<Input::ButtonDevice>, Settings::NativeButton::NUM_BUTTONS_HID>,
         10>;
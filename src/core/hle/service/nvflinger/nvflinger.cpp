@@ -140,9 +140,15 @@ std::optional<u64> NVFlinger::CreateLayer(u64 display_id) {
 
     const u64 layer_id = next_layer_id++;
     const u32 buffer_queue_id = next_buffer_queue_id++;
-    buffer_queues.emplace_back(
-        std::make_unique<BufferQueue>(system.Kernel(), buffer_queue_id, layer_id));
-    display->CreateLayer(layer_id, *buffer_queues.back());
+    BufferQueue* buffer_queue;
+    {
+        const std::scoped_lock queue_lock{buffer_queue_mutex};
+        buffer_queue = buffer_queues
+                           .emplace_back(std::make_unique<BufferQueue>(system.Kernel(),
+                                                                       buffer_queue_id, layer_id))
+                           .get();
+    }
+    display->CreateLayer(layer_id, *buffer_queue);
     return layer_id;
 }
 
@@ -177,7 +183,9 @@ std::shared_ptr<Kernel::KReadableEvent> NVFlinger::FindVsyncEvent(u64 display_id
 }
 
 BufferQueue* NVFlinger::FindBufferQueue(u32 id) {
-    const auto guard = Lock();
+    // Queues are only ever appended and have stable storage, so the main guard is not needed
+    // here; taking it would block every vi buffer IPC for the duration of a composition.
+    const std::scoped_lock lock{buffer_queue_mutex};
     const auto itr = std::find_if(buffer_queues.begin(), buffer_queues.end(),
                                   [id](const auto& queue) { return queue->GetId() == id; });
 
@@ -122,6 +122,10 @@ private:
 
     std::shared_ptr<std::mutex> guard;
 
+    /// Protects the buffer queue list on its own so that the per-IPC queue lookups from the vi
+    /// service do not serialize against the VSync thread holding the main guard through Compose.
+    mutable std::mutex buffer_queue_mutex;
+
     Core::System& system;
 
     std::unique_ptr<std::thread> vsync_thread;
@@ -80,7 +80,9 @@ void BSD::RecvWork::Execute(BSD* bsd) {
 }
 
 void BSD::RecvWork::Response(Kernel::HLERequestContext& ctx) {
-    ctx.WriteBuffer(message);
+    if (ret > 0) {
+        ctx.WriteBuffer(message.data(), static_cast<std::size_t>(ret));
+    }
 
     IPC::ResponseBuilder rb{ctx, 4};
     rb.Push(RESULT_SUCCESS);
@@ -93,7 +95,9 @@ void BSD::RecvFromWork::Execute(BSD* bsd) {
 }
 
 void BSD::RecvFromWork::Response(Kernel::HLERequestContext& ctx) {
-    ctx.WriteBuffer(message, 0);
+    if (ret > 0) {
+        ctx.WriteBuffer(message.data(), static_cast<std::size_t>(ret), 0);
+    }
     if (!addr.empty()) {
         ctx.WriteBuffer(addr, 1);
     }
@@ -181,7 +185,7 @@ void BSD::Poll(Kernel::HLERequestContext& ctx) {
     ExecuteWork(ctx, PollWork{
                          .nfds = nfds,
                          .timeout = timeout,
-                         .read_buffer = ctx.ReadBuffer(),
+                         .read_buffer = ctx.ReadBufferSpan(),
                          .write_buffer = std::vector<u8>(ctx.GetWriteBufferSize()),
                      });
 }
@@ -378,7 +382,7 @@ void BSD::Send(Kernel::HLERequestContext& ctx) {
     ExecuteWork(ctx, SendWork{
                          .fd = fd,
                          .flags = flags,
-                         .message = ctx.ReadBuffer(),
+                         .message = ctx.ReadBufferSpan(),
                      });
 }
 
@@ -393,8 +397,8 @@ void BSD::SendTo(Kernel::HLERequestContext& ctx) {
     ExecuteWork(ctx, SendToWork{
                          .fd = fd,
                          .flags = flags,
-                         .message = ctx.ReadBuffer(0),
-                         .addr = ctx.ReadBuffer(1),
+                         .message = ctx.ReadBufferSpan(0),
+                         .addr = ctx.ReadBufferSpan(1),
                      });
 }
 
@@ -407,7 +411,7 @@ void BSD::Write(Kernel::HLERequestContext& ctx) {
     ExecuteWork(ctx, SendWork{
                          .fd = fd,
                          .flags = 0,
-                         .message = ctx.ReadBuffer(),
+                         .message = ctx.ReadBufferSpan(),
                      });
 }
 
@@ -465,7 +469,7 @@ std::pair<s32, Errno> BSD::SocketImpl(Domain domain, Type type, Protocol protoco
     return {fd, Errno::SUCCESS};
 }
 
-std::pair<s32, Errno> BSD::PollImpl(std::vector<u8>& write_buffer, std::vector<u8> read_buffer,
+std::pair<s32, Errno> BSD::PollImpl(std::vector<u8>& write_buffer, std::span<const u8> read_buffer,
                                     s32 nfds, s32 timeout) {
     if (write_buffer.size() < nfds * sizeof(PollFD)) {
         return {-1, Errno::INVAL};
@@ -750,15 +754,15 @@ std::pair<s32, Errno> BSD::RecvFromImpl(s32 fd, u32 flags, std::vector<u8>& mess
     return {ret, bsd_errno};
 }
 
-std::pair<s32, Errno> BSD::SendImpl(s32 fd, u32 flags, const std::vector<u8>& message) {
+std::pair<s32, Errno> BSD::SendImpl(s32 fd, u32 flags, std::span<const u8> message) {
     if (!IsFileDescriptorValid(fd)) {
         return {-1, Errno::BADF};
     }
     return Translate(file_descriptors[fd]->socket->Send(message, flags));
 }
 
-std::pair<s32, Errno> BSD::SendToImpl(s32 fd, u32 flags, const std::vector<u8>& message,
-                                      const std::vector<u8>& addr) {
+std::pair<s32, Errno> BSD::SendToImpl(s32 fd, u32 flags, std::span<const u8> message,
+                                      std::span<const u8> addr) {
     if (!IsFileDescriptorValid(fd)) {
         return {-1, Errno::BADF};
     }
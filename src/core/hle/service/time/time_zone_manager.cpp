@@ -2,7 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <climits>
+#include <limits>
 
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -815,6 +817,42 @@ static ResultCode ToCalendarTimeInternal(const TimeZoneRule& rules, s64 time,
     return RESULT_SUCCESS;
 }
 
+static bool GetRuleInterval(const TimeZoneRule& rules, s64 time, s64& interval_start,
+                            s64& interval_end) {
+    // The extrapolated regions are handled recursively by ToCalendarTimeInternal and do not map
+    // to a single transition interval, so they are not memoized.
+    if ((rules.go_ahead && time < rules.ats[0]) ||
+        (rules.go_back && time > rules.ats[rules.time_count - 1])) {
+        return false;
+    }
+
+    interval_start = std::numeric_limits<s64>::min();
+    interval_end = std::numeric_limits<s64>::max();
+    if (rules.time_count == 0) {
+        return true;
+    }
+    if (time < rules.ats[0]) {
+        interval_end = rules.ats[0];
+        return true;
+    }
+
+    s32 low{1};
+    s32 high{rules.time_count};
+    while (low < high) {
+        s32 mid{(low + high) >> 1};
+        if (time < rules.ats[mid]) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    interval_start = rules.ats[low - 1];
+    if (low < rules.time_count) {
+        interval_end = rules.ats[low];
+    }
+    return true;
+}
+
 static ResultCode ToCalendarTimeImpl(const TimeZoneRule& rules, s64 time, CalendarInfo& calendar) {
     CalendarTimeInternal calendar_time{};
     const ResultCode result{
@@ -845,6 +883,7 @@ ResultCode TimeZoneManager::SetDeviceLocationNameWithTimeZoneRule(const std::str
     if (ParseTimeZoneBinary(rule, vfs_file)) {
         device_location_name = location_name;
         time_zone_rule = rule;
+        calendar_cache_valid = false;
         return RESULT_SUCCESS;
     }
     return ERROR_TIME_ZONE_CONVERSION_FAILED;
@@ -856,11 +895,43 @@ ResultCode TimeZoneManager::SetUpdatedTime(const Clock::SteadyClockTimePoint& va
 }
 
 ResultCode TimeZoneManager::ToCalendarTimeWithMyRules(s64 time, CalendarInfo& calendar) const {
-    if (is_initialized) {
-        return ToCalendarTime(time_zone_rule, time, calendar);
-    } else {
+    if (!is_initialized) {
         return ERROR_UNINITIALIZED_CLOCK;
     }
+
+    if (calendar_cache_valid && time >= calendar_cache_start && time < calendar_cache_end) {
+        // Within the cached day and rule interval only the time-of-day fields change.
+        calendar = cached_calendar;
+        const s64 second_of_day{time - calendar_cache_day_start};
+        calendar.time.hour = static_cast<s8>(second_of_day / seconds_per_hour);
+        calendar.time.minute =
+            static_cast<s8>((second_of_day % seconds_per_hour) / seconds_per_minute);
+        calendar.time.second = static_cast<s8>(second_of_day % seconds_per_minute);
+        return RESULT_SUCCESS;
+    }
+
+    const ResultCode result{ToCalendarTime(time_zone_rule, time, calendar)};
+    if (result != RESULT_SUCCESS) {
+        return result;
+    }
+
+    // Memoize the window around this conversion so repeated polls hit the fast path above. The
+    // window is the rest of the current day, clamped to the surrounding rule transitions so that
+    // a DST change always falls back to the full evaluation.
+    s64 interval_start{};
+    s64 interval_end{};
+    if (GetRuleInterval(time_zone_rule, time, interval_start, interval_end)) {
+        const s64 second_of_day{calendar.time.hour * static_cast<s64>(seconds_per_hour) +
+                                calendar.time.minute * seconds_per_minute + calendar.time.second};
+        calendar_cache_day_start = time - second_of_day;
+        calendar_cache_start = std::max(interval_start, calendar_cache_day_start);
+        calendar_cache_end = std::min(interval_end, calendar_cache_day_start + seconds_per_day);
+        cached_calendar = calendar;
+        calendar_cache_valid = true;
+    } else {
+        calendar_cache_valid = false;
+    }
+    return result;
 }
 
 ResultCode TimeZoneManager::ParseTimeZoneRuleBinary(TimeZoneRule& rules,
@@ -49,6 +49,15 @@ private:
     std::size_t total_location_name_count{};
     Clock::SteadyClockTimePoint time_zone_update_time_point{
         Clock::SteadyClockTimePoint::GetRandom()};
+
+    /// Memoized result of the last ToCalendarTimeWithMyRules conversion. While a posix time stays
+    /// within [calendar_cache_start, calendar_cache_end) - the same day inside the same rule
+    /// interval - only the time-of-day fields change, so the full rule evaluation is skipped.
+    mutable CalendarInfo cached_calendar{};
+    mutable s64 calendar_cache_day_start{};
+    mutable s64 calendar_cache_start{};
+    mutable s64 calendar_cache_end{};
+    mutable bool calendar_cache_valid{};
 };
 
 } // namespace Service::Time::TimeZone
@@ -143,12 +143,31 @@ static bool LoadNroImpl(Kernel::Process& process, const std::vector<u8>& data,
         return {};
     }
 
-    // Build program image
-    Kernel::PhysicalMemory program_image(PageAlignSize(nro_header.file_size));
-    std::memcpy(program_image.data(), data.data(), program_image.size());
-    if (program_image.size() != PageAlignSize(nro_header.file_size)) {
-        return {};
+    // Default .bss to NRO header bss size if MOD0 section doesn't exist
+    u32 bss_size{PageAlignSize(nro_header.bss_size)};
+
+    // Read MOD header
+    ModHeader mod_header{};
+    std::memcpy(&mod_header, data.data() + nro_header.module_header_offset, sizeof(ModHeader));
+
+    const bool has_mod_header{mod_header.magic == Common::MakeMagic('M', 'O', 'D', '0')};
+    if (has_mod_header) {
+        // Include the .bss section from the MOD0 header
+        bss_size = PageAlignSize(mod_header.bss_end_offset - mod_header.bss_start_offset);
+    }
+
+    // Size the final image up front so the backing memory is allocated and zeroed exactly once.
+    const u32 aligned_file_size{PageAlignSize(nro_header.file_size)};
+    const bool has_arguments{!Settings::values.program_args.empty()};
+    u32 image_size{aligned_file_size};
+    if (has_arguments) {
+        image_size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
     }
+    image_size += bss_size;
+
+    // Build program image
+    Kernel::PhysicalMemory program_image(image_size);
+    std::memcpy(program_image.data(), data.data(), aligned_file_size);
 
     Kernel::CodeSet codeset;
     for (std::size_t i = 0; i < nro_header.segments.size(); ++i) {
@@ -157,35 +176,18 @@ static bool LoadNroImpl(Kernel::Process& process, const std::vector<u8>& data,
         codeset.segments[i].size = PageAlignSize(nro_header.segments[i].size);
     }
 
-    if (!Settings::values.program_args.empty()) {
+    if (has_arguments) {
         const auto arg_data = Settings::values.program_args;
         codeset.DataSegment().size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
         NSOArgumentHeader args_header{
             NSO_ARGUMENT_DATA_ALLOCATION_SIZE, static_cast<u32_le>(arg_data.size()), {}};
-        const auto end_offset = program_image.size();
-        program_image.resize(static_cast<u32>(program_image.size()) +
-                             NSO_ARGUMENT_DATA_ALLOCATION_SIZE);
-        std::memcpy(program_image.data() + end_offset, &args_header, sizeof(NSOArgumentHeader));
-        std::memcpy(program_image.data() + end_offset + sizeof(NSOArgumentHeader), arg_data.data(),
-                    arg_data.size());
-    }
-
-    // Default .bss to NRO header bss size if MOD0 section doesn't exist
-    u32 bss_size{PageAlignSize(nro_header.bss_size)};
-
-    // Read MOD header
-    ModHeader mod_header{};
-    std::memcpy(&mod_header, program_image.data() + nro_header.module_header_offset,
-                sizeof(ModHeader));
-
-    const bool has_mod_header{mod_header.magic == Common::MakeMagic('M', 'O', 'D', '0')};
-    if (has_mod_header) {
-        // Resize program image to include .bss section and page align each section
-        bss_size = PageAlignSize(mod_header.bss_end_offset - mod_header.bss_start_offset);
+        std::memcpy(program_image.data() + aligned_file_size, &args_header,
+                    sizeof(NSOArgumentHeader));
+        std::memcpy(program_image.data() + aligned_file_size + sizeof(NSOArgumentHeader),
+                    arg_data.data(), arg_data.size());
     }
 
     codeset.DataSegment().size += bss_size;
-    program_image.resize(static_cast<u32>(program_image.size()) + bss_size);
 
     // Setup the process code layout
     if (process.LoadFromMetadata(FileSys::ProgramMetadata::GetDefault(), program_image.size())
@@ -2,6 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cinttypes>
 #include <cstring>
 #include <vector>
@@ -12,6 +15,8 @@
 #include "common/logging/log.h"
 #include "common/lz4_compression.h"
 #include "common/swap.h"
+#include "common/thread.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/hle/kernel/code_set.h"
@@ -91,13 +96,62 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::Process& process, Core::S
     // Build program image
     Kernel::CodeSet codeset;
     Kernel::PhysicalMemory program_image;
+
+    // Read every segment up front; the file may sit on stateful crypto layers, so the reads have
+    // to stay serial, but the decompression of each segment is independent
+    std::array<std::vector<u8>, 3> segment_data;
+    std::vector<std::size_t> compressed_segments;
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-        std::vector<u8> data =
+        segment_data[i] =
             file.ReadBytes(nso_header.segments_compressed_size[i], nso_header.segments[i].offset);
         if (nso_header.IsSegmentCompressed(i)) {
-            data = DecompressSegment(data, nso_header.segments[i]);
+            compressed_segments.push_back(i);
         }
-        program_image.resize(nso_header.segments[i].location + static_cast<u32>(data.size()));
+    }
+
+    if (compressed_segments.size() > 1) {
+        // Decompress the remaining segments on workers while this thread handles the first
+        // (usually .text, the largest)
+        static Common::ThreadWorker workers{2, "yuzu:NsoDecompress"};
+        std::atomic<u32> remaining_segments{static_cast<u32>(compressed_segments.size() - 1)};
+        Common::Event completion;
+        for (std::size_t list_index = 1; list_index < compressed_segments.size(); ++list_index) {
+            const auto i = compressed_segments[list_index];
+            workers.QueueWork([i, &segment_data, &nso_header, &remaining_segments, &completion] {
+                segment_data[i] = DecompressSegment(segment_data[i], nso_header.segments[i]);
+                if (remaining_segments.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    completion.Set();
+                }
+            });
+        }
+        const auto first = compressed_segments.front();
+        segment_data[first] = DecompressSegment(segment_data[first], nso_header.segments[first]);
+        completion.Wait();
+    } else if (compressed_segments.size() == 1) {
+        const auto i = compressed_segments.front();
+        segment_data[i] = DecompressSegment(segment_data[i], nso_header.segments[i]);
+    }
+
+    // Size the final image up front so the backing memory is allocated and zeroed exactly once,
+    // instead of being re-zeroed and copied around by every segment append.
+    std::size_t segments_end{};
+    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
+        segments_end = std::max<std::size_t>(
+            segments_end, nso_header.segments[i].location + segment_data[i].size());
+    }
+
+    const bool has_arguments{should_pass_arguments && !Settings::values.program_args.empty()};
+    const std::size_t arguments_offset{segments_end};
+    if (has_arguments) {
+        segments_end += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
+    }
+
+    const u32 image_size{
+        PageAlignSize(static_cast<u32>(segments_end) + nso_header.segments[2].bss_size)};
+    program_image.resize(image_size);
+
+    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
+        const auto& data = segment_data[i];
         std::memcpy(program_image.data() + nso_header.segments[i].location, data.data(),
                     data.size());
         codeset.segments[i].addr = nso_header.segments[i].location;
@@ -105,24 +159,19 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::Process& process, Core::S
         codeset.segments[i].size = nso_header.segments[i].size;
     }
 
-    if (should_pass_arguments && !Settings::values.program_args.empty()) {
+    if (has_arguments) {
         const auto arg_data{Settings::values.program_args};
 
         codeset.DataSegment().size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
         NSOArgumentHeader args_header{
             NSO_ARGUMENT_DATA_ALLOCATION_SIZE, static_cast<u32_le>(arg_data.size()), {}};
-        const auto end_offset = program_image.size();
-        program_image.resize(static_cast<u32>(program_image.size()) +
-                             NSO_ARGUMENT_DATA_ALLOCATION_SIZE);
-        std::memcpy(program_image.data() + end_offset, &args_header, sizeof(NSOArgumentHeader));
-        std::memcpy(program_image.data() + end_offset + sizeof(NSOArgumentHeader), arg_data.data(),
-                    arg_data.size());
+        std::memcpy(program_image.data() + arguments_offset, &args_header,
+                    sizeof(NSOArgumentHeader));
+        std::memcpy(program_image.data() + arguments_offset + sizeof(NSOArgumentHeader),
+                    arg_data.data(), arg_data.size());
     }
 
     codeset.DataSegment().size += nso_header.segments[2].bss_size;
-    const u32 image_size{
-        PageAlignSize(static_cast<u32>(program_image.size()) + nso_header.segments[2].bss_size)};
-    program_image.resize(image_size);
 
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
         codeset.segments[i].size = PageAlignSize(codeset.segments[i].size);
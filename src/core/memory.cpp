@@ -20,6 +20,7 @@
 #include "core/hle/kernel/physical_memory.h"
 #include "core/hle/kernel/process.h"
 #include "core/memory.h"
+#include "core/settings.h"
 #include "video_core/gpu.h"
 
 namespace Core::Memory {
@@ -32,6 +33,7 @@ struct Memory::Impl {
 
     void SetCurrentPageTable(Kernel::Process& process, u32 core_id) {
         current_page_table = &process.PageTable().PageTableImpl();
+        current_page_table->fastmem_arena = system.DeviceMemory().buffer.VirtualBasePointer();
 
         const std::size_t address_space_width = process.PageTable().GetAddressSpaceWidth();
 
@@ -41,13 +43,22 @@ struct Memory::Impl {
     void MapMemoryRegion(Common::PageTable& page_table, VAddr base, u64 size, PAddr target) {
         ASSERT_MSG((size & PAGE_MASK) == 0, "non-page aligned size: {:016X}", size);
         ASSERT_MSG((base & PAGE_MASK) == 0, "non-page aligned base: {:016X}", base);
+        ASSERT_MSG(target >= DramMemoryMap::Base, "Out of bounds target: {:016X}", target);
         MapPages(page_table, base / PAGE_SIZE, size / PAGE_SIZE, target, Common::PageType::Memory);
+
+        if (Settings::IsFastmemEnabled()) {
+            system.DeviceMemory().buffer.Map(base, target - DramMemoryMap::Base, size);
+        }
     }
 
     void UnmapRegion(Common::PageTable& page_table, VAddr base, u64 size) {
         ASSERT_MSG((size & PAGE_MASK) == 0, "non-page aligned size: {:016X}", size);
         ASSERT_MSG((base & PAGE_MASK) == 0, "non-page aligned base: {:016X}", base);
         MapPages(page_table, base / PAGE_SIZE, size / PAGE_SIZE, 0, Common::PageType::Unmapped);
+
+        if (Settings::IsFastmemEnabled()) {
+            system.DeviceMemory().buffer.Unmap(base, size);
+        }
     }
 
     bool IsValidVirtualAddress(const Kernel::Process& process, const VAddr vaddr) const {
@@ -178,6 +189,42 @@ struct Memory::Impl {
         return string;
     }
 
+    /**
+     * Returns the number of bytes, starting at the given page and offset, that can be copied
+     * through a single host memcpy. Stored page pointers are rebased against the virtual page
+     * base, so adjacent pages share one contiguous backing allocation exactly when they store
+     * the same raw page table entry.
+     */
+    [[nodiscard]] std::size_t ContiguousSize(const Common::PageTable& page_table,
+                                             std::size_t page_index, std::size_t page_offset,
+                                             std::size_t remaining_size) const {
+        const uintptr_t raw_pointer = page_table.pointers[page_index].Raw();
+        std::size_t contiguous_size = PAGE_SIZE - page_offset;
+        while (contiguous_size < remaining_size &&
+               page_table.pointers[page_index + 1].Raw() == raw_pointer) {
+            ++page_index;
+            contiguous_size += PAGE_SIZE;
+        }
+        return std::min(contiguous_size, remaining_size);
+    }
+
+    [[nodiscard]] std::span<u8> GetContiguousSpan(VAddr vaddr, std::size_t size) const {
+        if (size == 0) {
+            return {};
+        }
+        const auto& page_table = *current_page_table;
+        const std::size_t page_index = vaddr >> PAGE_BITS;
+        const std::size_t page_offset = vaddr & PAGE_MASK;
+        const auto [pointer, type] = page_table.pointers[page_index].PointerType();
+        if (type != Common::PageType::Memory) {
+            return {};
+        }
+        if (ContiguousSize(page_table, page_index, page_offset, size) < size) {
+            return {};
+        }
+        return {pointer + vaddr, size};
+    }
+
     void ReadBlock(const Kernel::Process& process, const VAddr src_addr, void* dest_buffer,
                    const std::size_t size) {
         const auto& page_table = process.PageTable().PageTableImpl();
@@ -187,7 +234,7 @@ struct Memory::Impl {
         std::size_t page_offset = src_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -203,6 +250,8 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(pointer);
                 const u8* const src_ptr = pointer + page_offset + (page_index << PAGE_BITS);
+                // Extend the copy across adjacent pages sharing this backing allocation
+                copy_amount = ContiguousSize(page_table, page_index, page_offset, remaining_size);
                 std::memcpy(dest_buffer, src_ptr, copy_amount);
                 break;
             }
@@ -216,7 +265,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index = (current_vaddr + copy_amount) >> PAGE_BITS;
             page_offset = 0;
             dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
             remaining_size -= copy_amount;
@@ -232,7 +281,7 @@ struct Memory::Impl {
         std::size_t page_offset = src_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -248,6 +297,8 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(pointer);
                 const u8* const src_ptr = pointer + page_offset + (page_index << PAGE_BITS);
+                // Extend the copy across adjacent pages sharing this backing allocation
+                copy_amount = ContiguousSize(page_table, page_index, page_offset, remaining_size);
                 std::memcpy(dest_buffer, src_ptr, copy_amount);
                 break;
             }
@@ -260,7 +311,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index = (current_vaddr + copy_amount) >> PAGE_BITS;
             page_offset = 0;
             dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
             remaining_size -= copy_amount;
@@ -283,7 +334,7 @@ struct Memory::Impl {
         std::size_t page_offset = dest_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -298,6 +349,8 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(pointer);
                 u8* const dest_ptr = pointer + page_offset + (page_index << PAGE_BITS);
+                // Extend the copy across adjacent pages sharing this backing allocation
+                copy_amount = ContiguousSize(page_table, page_index, page_offset, remaining_size);
                 std::memcpy(dest_ptr, src_buffer, copy_amount);
                 break;
             }
@@ -311,7 +364,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index = (current_vaddr + copy_amount) >> PAGE_BITS;
             page_offset = 0;
             src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
             remaining_size -= copy_amount;
@@ -326,7 +379,7 @@ struct Memory::Impl {
         std::size_t page_offset = dest_addr & PAGE_MASK;
 
         while (remaining_size > 0) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
             const auto current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -341,6 +394,8 @@ struct Memory::Impl {
             case Common::PageType::Memory: {
                 DEBUG_ASSERT(pointer);
                 u8* const dest_ptr = pointer + page_offset + (page_index << PAGE_BITS);
+                // Extend the copy across adjacent pages sharing this backing allocation
+                copy_amount = ContiguousSize(page_table, page_index, page_offset, remaining_size);
                 std::memcpy(dest_ptr, src_buffer, copy_amount);
                 break;
             }
@@ -353,7 +408,7 @@ struct Memory::Impl {
                 UNREACHABLE();
             }
 
-            page_index++;
+            page_index = (current_vaddr + copy_amount) >> PAGE_BITS;
             page_offset = 0;
             src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
             remaining_size -= copy_amount;
@@ -466,6 +521,15 @@ struct Memory::Impl {
         if (vaddr == 0) {
             return;
         }
+        if (Settings::IsFastmemEnabled()) {
+            // Only trap reads when the accuracy level flushes the GPU on CPU reads; below Extreme
+            // no flush would happen anyway, so reads of cached regions (render target readbacks
+            // in particular) stay on native fastmem accesses and only actual writes pay for the
+            // fault that notifies the rasterizer.
+            const bool is_read_enable = !Settings::IsGPULevelExtreme() || !cached;
+            system.DeviceMemory().buffer.Protect(vaddr, size, is_read_enable, !cached);
+        }
+
         // Iterate over a contiguous CPU address space, which corresponds to the specified GPU
         // address space, marking the region as un/cached. The region is marked un/cached at a
         // granularity of CPU pages, hence why we iterate on a CPU page basis (note: GPU page size
@@ -745,6 +809,14 @@ const u8* Memory::GetPointer(VAddr vaddr) const {
     return impl->GetPointer(vaddr);
 }
 
+std::span<u8> Memory::GetContiguousSpan(VAddr vaddr, std::size_t size) {
+    return impl->GetContiguousSpan(vaddr, size);
+}
+
+std::span<const u8> Memory::GetContiguousSpan(VAddr vaddr, std::size_t size) const {
+    return impl->GetContiguousSpan(vaddr, size);
+}
+
 u8 Memory::Read8(const VAddr addr) {
     return impl->Read8(addr);
 }
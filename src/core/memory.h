@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
 #include "common/common_types.h"
 
@@ -126,6 +127,30 @@ public:
      */
     const u8* GetPointer(VAddr vaddr) const;
 
+    /**
+     * Gets a span of host memory backing the given range in the current process' address space.
+     *
+     * @param vaddr Start virtual address of the range.
+     * @param size  Size of the range in bytes.
+     *
+     * @returns A span covering the whole range when it is contiguously backed by plain memory.
+     *          An empty span is returned for ranges that cross a backing discontinuity or touch
+     *          rasterizer cached pages, which have to go through the block interfaces.
+     */
+    [[nodiscard]] std::span<u8> GetContiguousSpan(VAddr vaddr, std::size_t size);
+
+    /**
+     * Gets a span of host memory backing the given range in the current process' address space.
+     *
+     * @param vaddr Start virtual address of the range.
+     * @param size  Size of the range in bytes.
+     *
+     * @returns A span covering the whole range when it is contiguously backed by plain memory.
+     *          An empty span is returned for ranges that cross a backing discontinuity or touch
+     *          rasterizer cached pages, which have to go through the block interfaces.
+     */
+    [[nodiscard]] std::span<const u8> GetContiguousSpan(VAddr vaddr, std::size_t size) const;
+
     /**
      * Reads an 8-bit unsigned value from the current process' address space
      * at the given virtual address.
@@ -284,6 +284,8 @@ public:
 
         virtual void DebugLog(u8 id, u64 value) = 0;
         virtual void CommandLog(std::string_view data) = 0;
+        /// Whether CommandLog output is consumed; when false, the VM skips formatting it.
+        virtual bool CommandLogEnabled() = 0;
     };
 
     static constexpr std::size_t MaximumProgramOpcodeCount = 0x400;
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <utility>
 
 #if defined(_WIN32)
@@ -60,9 +61,9 @@ public:
 
     std::pair<s32, Errno> RecvFrom(int flags, std::vector<u8>& message, SockAddrIn* addr);
 
-    std::pair<s32, Errno> Send(const std::vector<u8>& message, int flags);
+    std::pair<s32, Errno> Send(std::span<const u8> message, int flags);
 
-    std::pair<s32, Errno> SendTo(u32 flags, const std::vector<u8>& message, const SockAddrIn* addr);
+    std::pair<s32, Errno> SendTo(u32 flags, std::span<const u8> message, const SockAddrIn* addr);
 
     Errno SetLinger(bool enable, u32 linger);
 
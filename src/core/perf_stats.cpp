@@ -4,15 +4,15 @@
 
 #include <algorithm>
 #include <chrono>
-#include <iterator>
 #include <mutex>
 #include <numeric>
-#include <sstream>
+#include <string>
 #include <thread>
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 #include "common/file_util.h"
 #include "common/math_util.h"
+#include "common/zstd_compression.h"
 #include "core/perf_stats.h"
 #include "core/settings.h"
 
@@ -25,25 +25,61 @@ using std::chrono::microseconds;
 // booting that we shouldn't account for
 constexpr std::size_t IgnoreFrames = 5;
 
+// Number of frametime entries to keep when session recording is disabled (one hour at 60 FPS)
+constexpr std::size_t BoundedHistorySize = 216000;
+
 namespace Core {
 
-PerfStats::PerfStats(u64 title_id) : title_id(title_id) {}
+PerfStats::PerfStats(u64 title_id) : title_id(title_id) {
+    record_session = Settings::values.record_frame_times && title_id != 0;
+}
 
 PerfStats::~PerfStats() {
-    if (!Settings::values.record_frame_times || title_id == 0) {
+    if (!record_session) {
         return;
     }
+    WriteSessionLog();
+}
 
+void PerfStats::WriteSessionLog() const {
     const std::time_t t = std::time(nullptr);
-    std::ostringstream stream;
-    std::copy(perf_history.begin() + IgnoreFrames, perf_history.begin() + current_index,
-              std::ostream_iterator<double>(stream, "\n"));
     const std::string& path = Common::FS::GetUserPath(Common::FS::UserPath::LogDir);
     // %F Date format expanded is "%Y-%m-%d"
-    const std::string filename =
-        fmt::format("{}/{:%F-%H-%M}_{:016X}.csv", path, *std::localtime(&t), title_id);
-    Common::FS::IOFile file(filename, "w");
-    file.WriteString(stream.str());
+    const std::string prefix =
+        fmt::format("{}/{:%F-%H-%M}_{:016X}", path, *std::localtime(&t), title_id);
+
+    const auto write_compressed = [](const std::string& filename, const std::string& contents) {
+        const std::vector<u8> compressed = Common::Compression::CompressDataZSTDDefault(
+            reinterpret_cast<const u8*>(contents.data()), contents.size());
+        Common::FS::IOFile file(filename, "wb");
+        file.WriteBytes(compressed.data(), compressed.size());
+    };
+
+    // Whole sessions of frametimes compress well; a plain zstd frame keeps the files small
+    // while remaining readable with standard tooling
+    std::string frametimes;
+    frametimes.reserve(perf_history.size() * 8);
+    for (std::size_t i = IgnoreFrames; i < perf_history.size(); ++i) {
+        frametimes += fmt::format("{}\n", perf_history[i]);
+    }
+    write_compressed(fmt::format("{}.csv.zst", prefix), frametimes);
+
+    std::string stats{"system_time_us,system_fps,game_fps,frametime,speed,audio_underruns"};
+    for (std::size_t i = 0; i < Common::NumPerfCounters; ++i) {
+        stats +=
+            fmt::format(",{}", Common::GetPerfCounterName(static_cast<Common::PerfCounter>(i)));
+    }
+    stats += '\n';
+    for (const auto& [system_time_us, results] : results_history) {
+        stats += fmt::format("{},{},{},{},{},{}", system_time_us, results.system_fps,
+                             results.game_fps, results.frametime, results.emulation_speed,
+                             results.audio_underruns);
+        for (const u64 counter : results.counters) {
+            stats += fmt::format(",{}", counter);
+        }
+        stats += '\n';
+    }
+    write_compressed(fmt::format("{}_stats.csv.zst", prefix), stats);
 }
 
 void PerfStats::BeginSystemFrame() {
@@ -57,9 +93,8 @@ void PerfStats::EndSystemFrame() {
 
     auto frame_end = Clock::now();
     const auto frame_time = frame_end - frame_begin;
-    if (current_index < perf_history.size()) {
-        perf_history[current_index++] =
-            std::chrono::duration<double, std::milli>(frame_time).count();
+    if (record_session || perf_history.size() < BoundedHistorySize) {
+        perf_history.push_back(std::chrono::duration<double, std::milli>(frame_time).count());
     }
     accumulated_frametime += frame_time;
     system_frames += 1;
@@ -72,18 +107,51 @@ void PerfStats::EndGameFrame() {
     std::lock_guard lock{object_mutex};
 
     game_frames += 1;
+    total_game_frames += 1;
+}
+
+void PerfStats::AddAudioUnderruns(std::size_t underruns) {
+    std::lock_guard lock{object_mutex};
+
+    audio_underruns += underruns;
 }
 
 double PerfStats::GetMeanFrametime() const {
     std::lock_guard lock{object_mutex};
 
-    if (current_index <= IgnoreFrames) {
+    if (perf_history.size() <= IgnoreFrames) {
         return 0;
     }
 
-    const double sum = std::accumulate(perf_history.begin() + IgnoreFrames,
-                                       perf_history.begin() + current_index, 0.0);
-    return sum / static_cast<double>(current_index - IgnoreFrames);
+    const double sum =
+        std::accumulate(perf_history.begin() + IgnoreFrames, perf_history.end(), 0.0);
+    return sum / static_cast<double>(perf_history.size() - IgnoreFrames);
+}
+
+FrametimePercentiles PerfStats::GetFrametimePercentiles() const {
+    std::lock_guard lock{object_mutex};
+
+    if (perf_history.size() <= IgnoreFrames) {
+        return {};
+    }
+    std::vector<double> sorted(perf_history.begin() + IgnoreFrames, perf_history.end());
+    std::sort(sorted.begin(), sorted.end());
+    const auto percentile = [&sorted](double fraction) {
+        const auto last = static_cast<double>(sorted.size() - 1);
+        return sorted[static_cast<std::size_t>(fraction * last)];
+    };
+    return {
+        .p50 = percentile(0.50),
+        .p90 = percentile(0.90),
+        .p95 = percentile(0.95),
+        .p99 = percentile(0.99),
+    };
+}
+
+u64 PerfStats::GetTotalGameFrames() const {
+    std::lock_guard lock{object_mutex};
+
+    return total_game_frames;
 }
 
 PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us) {
@@ -101,14 +169,21 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .audio_underruns = audio_underruns,
+        .counters = Common::ExchangePerfCounters(),
     };
 
+    if (record_session) {
+        results_history.push_back({current_system_time_us.count(), results});
+    }
+
     // Reset counters
     reset_point = now;
     reset_point_system_us = current_system_time_us;
     accumulated_frametime = Clock::duration::zero();
     system_frames = 0;
     game_frames = 0;
+    audio_underruns = 0;
 
     return results;
 }
@@ -154,4 +229,55 @@ void FrameLimiter::DoFrameLimiting(microseconds current_system_time_us) {
     previous_walltime = now;
 }
 
+void FramePacer::PaceFrame() {
+    if (!Settings::values.use_frame_pacing.GetValue()) {
+        return;
+    }
+
+    const auto arrival = Clock::now();
+    interval_history[history_index] = arrival - previous_arrival;
+    history_index = (history_index + 1) % HistorySize;
+    num_recorded_intervals = std::min(num_recorded_intervals + 1, HistorySize);
+    previous_arrival = arrival;
+
+    if (num_recorded_intervals < HistorySize / 2) {
+        previous_release = arrival;
+        return;
+    }
+
+    // Predict the display interval as the median of the recent arrival intervals; the median
+    // tracks cadence changes quickly while rejecting one-off spikes from slow frames
+    std::array<Clock::duration, HistorySize> sorted_intervals;
+    std::copy_n(interval_history.begin(), num_recorded_intervals, sorted_intervals.begin());
+    const auto mid = sorted_intervals.begin() + num_recorded_intervals / 2;
+    std::nth_element(sorted_intervals.begin(), mid,
+                     sorted_intervals.begin() + num_recorded_intervals);
+    const Clock::duration predicted_interval = *mid;
+
+    const auto target = previous_release + predicted_interval;
+    if (arrival >= target) {
+        // The frame missed its slot; release it immediately and restart the cadence from here
+        Common::AddPerfCounter(
+            Common::PerfCounter::FramePacingErrorUs,
+            static_cast<u64>(duration_cast<microseconds>(arrival - target).count()));
+        previous_release = arrival;
+        return;
+    }
+
+    // Coarse sleep, then spin away the sub-millisecond remainder
+    constexpr auto spin_threshold = 1ms;
+    if (target - arrival > spin_threshold) {
+        std::this_thread::sleep_for(target - arrival - spin_threshold);
+    }
+    while (Clock::now() < target) {
+        std::this_thread::yield();
+    }
+
+    const auto release = Clock::now();
+    Common::AddPerfCounter(
+        Common::PerfCounter::FramePacingErrorUs,
+        static_cast<u64>(duration_cast<microseconds>(release - target).count()));
+    previous_release = release;
+}
+
 } // namespace Core
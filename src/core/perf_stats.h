@@ -8,7 +8,9 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <vector>
 #include "common/common_types.h"
+#include "common/perf_counters.h"
 
 namespace Core {
 
@@ -21,6 +23,18 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Number of audio sink underruns
+    std::size_t audio_underruns;
+    /// Subsystem event counts accumulated since the last report
+    Common::PerfCounterValues counters;
+};
+
+/// Frametime percentile summary over the recorded history, in milliseconds
+struct FrametimePercentiles {
+    double p50;
+    double p90;
+    double p95;
+    double p99;
 };
 
 /**
@@ -38,6 +52,9 @@ public:
     void EndSystemFrame();
     void EndGameFrame();
 
+    /// Adds audio sink underruns reported by the audio backend since the last report
+    void AddAudioUnderruns(std::size_t underruns);
+
     PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
 
     /**
@@ -45,6 +62,14 @@ public:
      */
     double GetMeanFrametime() const;
 
+    /**
+     * Returns frametime percentiles computed over the performance history.
+     */
+    FrametimePercentiles GetFrametimePercentiles() const;
+
+    /// Returns the cumulative number of game frames submitted since the session started
+    u64 GetTotalGameFrames() const;
+
     /**
      * Gets the ratio between walltime and the emulated time of the previous system frame. This is
      * useful for scaling inputs or outputs moving between the two time domains.
@@ -52,15 +77,26 @@ public:
     double GetLastFrameTimeScale() const;
 
 private:
+    /// Periodic snapshot of the cumulative statistics, paired with the system time it was taken at
+    struct ResultsSample {
+        s64 system_time_us;
+        PerfStatsResults results;
+    };
+
+    /// Compresses and writes the recorded session samples to the log directory
+    void WriteSessionLog() const;
+
     mutable std::mutex object_mutex;
 
     /// Title ID for the game that is running. 0 if there is no game running yet
     u64 title_id{0};
-    /// Current index for writing to the perf_history array
-    std::size_t current_index{0};
-    /// Stores an hour of historical frametime data useful for processing and tracking performance
-    /// regressions with code changes.
-    std::array<double, 216000> perf_history{};
+    /// Whether samples are kept for the whole session and written out compressed on exit
+    bool record_session{false};
+    /// Stores historical frametime data useful for processing and tracking performance
+    /// regressions with code changes. Bounded to an hour unless session recording is enabled.
+    std::vector<double> perf_history;
+    /// Snapshots taken by GetAndResetStats over the session, kept only while recording
+    std::vector<ResultsSample> results_history;
 
     /// Point when the cumulative counters were reset
     Clock::time_point reset_point = Clock::now();
@@ -73,6 +109,10 @@ private:
     u32 system_frames = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     u32 game_frames = 0;
+    /// Session-wide number of game frames, never reset
+    u64 total_game_frames = 0;
+    /// Cumulative number of audio sink underruns since last reset
+    std::size_t audio_underruns = 0;
 
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
@@ -98,4 +138,32 @@ private:
     std::chrono::microseconds frame_limiting_delta_err{0};
 };
 
+/**
+ * Paces frame release to the display cadence. The frame limiter keeps the average emulation speed
+ * correct but says nothing about when individual frames are released, so delivery jitters even at
+ * full speed. The pacer predicts the next display interval from a rolling window of frame arrival
+ * intervals and delays each swap until its predicted slot, using a coarse sleep followed by a
+ * spin for sub-millisecond precision.
+ */
+class FramePacer {
+public:
+    using Clock = std::chrono::high_resolution_clock;
+
+    /// Blocks the calling (GPU) thread until the predicted presentation slot of the next frame.
+    /// Called between GPU frame completion and the renderer swap.
+    void PaceFrame();
+
+private:
+    static constexpr std::size_t HistorySize = 32;
+
+    /// Rolling window of frame arrival intervals used to predict the display interval
+    std::array<Clock::duration, HistorySize> interval_history{};
+    std::size_t history_index = 0;
+    std::size_t num_recorded_intervals = 0;
+    /// Walltime when the previous frame arrived at the pacer
+    Clock::time_point previous_arrival = Clock::now();
+    /// Walltime when the previous frame was released to the renderer
+    Clock::time_point previous_release = Clock::now();
+};
+
 } // namespace Core
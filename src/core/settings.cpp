@@ -17,6 +17,28 @@ namespace Settings {
 Values values = {};
 static bool configuring_global = true;
 
+namespace {
+
+// Snapshot of the settings that hot paths (buffer cache, DMA engine, GPU tick computation) read
+// per operation. Keeping them in dedicated atomics on their own cache line means those reads do
+// not share a line with the mutable Values struct the UI thread writes, and IsGPULevelHigh() does
+// not have to walk the Setting global/local indirection every call. Refreshed by
+// UpdateCachedValues(), which every mutation path reaches through Apply() or RestoreGlobalState().
+struct alignas(64) CachedValues {
+    std::atomic<GPUAccuracy> gpu_accuracy{GPUAccuracy::Normal};
+    std::atomic<bool> use_fast_gpu_time{false};
+};
+
+CachedValues cached_values;
+
+} // Anonymous namespace
+
+void UpdateCachedValues() {
+    cached_values.gpu_accuracy.store(values.gpu_accuracy.GetValue(), std::memory_order_relaxed);
+    cached_values.use_fast_gpu_time.store(values.use_fast_gpu_time.GetValue(),
+                                          std::memory_order_relaxed);
+}
+
 std::string GetTimeZoneString() {
     static constexpr std::array timezones{
         "auto",      "default",   "CET", "CST6CDT", "Cuba",    "EET",    "Egypt",     "Eire",
@@ -33,6 +55,8 @@ std::string GetTimeZoneString() {
 }
 
 void Apply(Core::System& system) {
+    UpdateCachedValues();
+
     if (system.IsPoweredOn()) {
         system.Renderer().RefreshBaseSettings();
     }
@@ -54,9 +78,11 @@ void LogSettings() {
     log_setting("System_TimeZoneIndex", values.time_zone_index.GetValue());
     log_setting("Core_UseMultiCore", values.use_multi_core.GetValue());
     log_setting("CPU_Accuracy", values.cpu_accuracy);
+    log_setting("CPU_UsePerformanceCoreAffinity", values.use_performance_core_affinity.GetValue());
     log_setting("Renderer_UseResolutionFactor", values.resolution_factor.GetValue());
     log_setting("Renderer_UseFrameLimit", values.use_frame_limit.GetValue());
     log_setting("Renderer_FrameLimit", values.frame_limit.GetValue());
+    log_setting("Renderer_UseFramePacing", values.use_frame_pacing.GetValue());
     log_setting("Renderer_UseDiskShaderCache", values.use_disk_shader_cache.GetValue());
     log_setting("Renderer_GPUAccuracyLevel", values.gpu_accuracy.GetValue());
     log_setting("Renderer_UseAsynchronousGpuEmulation",
@@ -68,6 +94,7 @@ void LogSettings() {
     log_setting("Renderer_AnisotropicFilteringLevel", values.max_anisotropy.GetValue());
     log_setting("Audio_OutputEngine", values.sink_id);
     log_setting("Audio_EnableAudioStretching", values.enable_audio_stretching.GetValue());
+    log_setting("Audio_StretchingQuality", values.audio_stretching_quality);
     log_setting("Audio_OutputDevice", values.audio_device_id);
     log_setting("DataStorage_UseVirtualSd", values.use_virtual_sd);
     log_setting("DataStorage_CacheDir", Common::FS::GetUserPath(Common::FS::UserPath::CacheDir));
@@ -89,12 +116,23 @@ void SetConfiguringGlobal(bool is_global) {
 }
 
 bool IsGPULevelExtreme() {
-    return values.gpu_accuracy.GetValue() == GPUAccuracy::Extreme;
+    return cached_values.gpu_accuracy.load(std::memory_order_relaxed) == GPUAccuracy::Extreme;
 }
 
 bool IsGPULevelHigh() {
-    return values.gpu_accuracy.GetValue() == GPUAccuracy::Extreme ||
-           values.gpu_accuracy.GetValue() == GPUAccuracy::High;
+    const auto accuracy = cached_values.gpu_accuracy.load(std::memory_order_relaxed);
+    return accuracy == GPUAccuracy::Extreme || accuracy == GPUAccuracy::High;
+}
+
+bool IsFastGpuTimeEnabled() {
+    return cached_values.use_fast_gpu_time.load(std::memory_order_relaxed);
+}
+
+bool IsFastmemEnabled() {
+    if (values.cpu_accuracy == CPUAccuracy::DebugMode) {
+        return values.cpuopt_fastmem;
+    }
+    return true;
 }
 
 float Volume() {
@@ -117,6 +155,9 @@ void RestoreGlobalState(bool is_powered_on) {
     // Core
     values.use_multi_core.SetGlobal(true);
 
+    // Cpu
+    values.use_performance_core_affinity.SetGlobal(true);
+
     // Renderer
     values.renderer_backend.SetGlobal(true);
     values.vulkan_device.SetGlobal(true);
@@ -124,6 +165,7 @@ void RestoreGlobalState(bool is_powered_on) {
     values.max_anisotropy.SetGlobal(true);
     values.use_frame_limit.SetGlobal(true);
     values.frame_limit.SetGlobal(true);
+    values.use_frame_pacing.SetGlobal(true);
     values.use_disk_shader_cache.SetGlobal(true);
     values.gpu_accuracy.SetGlobal(true);
     values.use_asynchronous_gpu_emulation.SetGlobal(true);
@@ -149,6 +191,8 @@ void RestoreGlobalState(bool is_powered_on) {
     values.use_docked_mode.SetGlobal(true);
     values.vibration_enabled.SetGlobal(true);
     values.motion_enabled.SetGlobal(true);
+
+    UpdateCachedValues();
 }
 
 } // namespace Settings
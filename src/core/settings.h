@@ -37,6 +37,12 @@ enum class CPUAccuracy {
     DebugMode = 2,
 };
 
+enum class AudioStretchingQuality : u32 {
+    Fast = 0,
+    Balanced = 1,
+    High = 2,
+};
+
 template <typename Type>
 class Setting final {
 public:
@@ -112,6 +118,7 @@ struct Values {
     std::string sink_id;
     bool audio_muted;
     Setting<bool> enable_audio_stretching;
+    AudioStretchingQuality audio_stretching_quality;
     Setting<float> volume;
 
     // Core
@@ -119,6 +126,8 @@ struct Values {
 
     // Cpu
     CPUAccuracy cpu_accuracy;
+    /// Pin emulation threads to performance cores on heterogeneous hosts
+    Setting<bool> use_performance_core_affinity{true};
 
     bool cpuopt_page_tables;
     bool cpuopt_block_linking;
@@ -128,6 +137,7 @@ struct Values {
     bool cpuopt_const_prop;
     bool cpuopt_misc_ir;
     bool cpuopt_reduce_misalign_checks;
+    bool cpuopt_fastmem;
 
     bool cpuopt_unsafe_unfuse_fma;
     bool cpuopt_unsafe_reduce_fp_error;
@@ -143,6 +153,7 @@ struct Values {
     Setting<int> max_anisotropy;
     Setting<bool> use_frame_limit;
     Setting<u16> frame_limit;
+    Setting<bool> use_frame_pacing;
     Setting<bool> use_disk_shader_cache;
     Setting<GPUAccuracy> gpu_accuracy;
     Setting<bool> use_asynchronous_gpu_emulation;
@@ -248,6 +259,14 @@ void SetConfiguringGlobal(bool is_global);
 bool IsGPULevelExtreme();
 bool IsGPULevelHigh();
 
+bool IsFastGpuTimeEnabled();
+
+// Refreshes the atomic snapshot of the settings that hot paths read per operation. Called by
+// Apply() and RestoreGlobalState(); only needed directly when mutating values outside of those.
+void UpdateCachedValues();
+
+bool IsFastmemEnabled();
+
 float Volume();
 
 std::string GetTimeZoneString();
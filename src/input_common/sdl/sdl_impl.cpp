@@ -61,23 +61,32 @@ public:
           sdl_controller{game_controller, &SDL_GameControllerClose} {}
 
     void SetButton(int button, bool value) {
-        std::lock_guard lock{mutex};
-        state.buttons.insert_or_assign(button, value);
+        if (button < 0 || button >= static_cast<int>(state.buttons.size())) {
+            return;
+        }
+        state.buttons[button].store(value, std::memory_order_relaxed);
     }
 
     bool GetButton(int button) const {
-        std::lock_guard lock{mutex};
-        return state.buttons.at(button);
+        if (button < 0 || button >= static_cast<int>(state.buttons.size())) {
+            return false;
+        }
+        return state.buttons[button].load(std::memory_order_relaxed);
     }
 
     void SetAxis(int axis, Sint16 value) {
-        std::lock_guard lock{mutex};
-        state.axes.insert_or_assign(axis, value);
+        if (axis < 0 || axis >= static_cast<int>(state.axes.size())) {
+            return;
+        }
+        state.axes[axis].store(value, std::memory_order_relaxed);
     }
 
     float GetAxis(int axis, float range) const {
-        std::lock_guard lock{mutex};
-        return static_cast<float>(state.axes.at(axis)) / (32767.0f * range);
+        if (axis < 0 || axis >= static_cast<int>(state.axes.size())) {
+            return 0.0f;
+        }
+        return static_cast<float>(state.axes[axis].load(std::memory_order_relaxed)) /
+               (32767.0f * range);
     }
 
     bool RumblePlay(u16 amp_low, u16 amp_high) {
@@ -116,13 +125,17 @@ public:
     }
 
     void SetHat(int hat, Uint8 direction) {
-        std::lock_guard lock{mutex};
-        state.hats.insert_or_assign(hat, direction);
+        if (hat < 0 || hat >= static_cast<int>(state.hats.size())) {
+            return;
+        }
+        state.hats[hat].store(direction, std::memory_order_relaxed);
     }
 
     bool GetHatDirection(int hat, Uint8 direction) const {
-        std::lock_guard lock{mutex};
-        return (state.hats.at(hat) & direction) != 0;
+        if (hat < 0 || hat >= static_cast<int>(state.hats.size())) {
+            return false;
+        }
+        return (state.hats[hat].load(std::memory_order_relaxed) & direction) != 0;
     }
     /**
      * The guid of the joystick
@@ -152,16 +165,18 @@ public:
     }
 
 private:
+    // Events written by the SDL event watcher and read by the HID service every frame. Each
+    // element is an independent relaxed atomic, so neither side takes a lock; indices past the
+    // fixed capacities are ignored, where the old maps would have thrown on unseen lookups.
     struct State {
-        std::unordered_map<int, bool> buttons;
-        std::unordered_map<int, Sint16> axes;
-        std::unordered_map<int, Uint8> hats;
+        std::array<std::atomic<bool>, 64> buttons{};
+        std::array<std::atomic<Sint16>, 16> axes{};
+        std::array<std::atomic<Uint8>, 8> hats{};
     } state;
     std::string guid;
     int port;
     std::unique_ptr<SDL_Joystick, decltype(&SDL_JoystickClose)> sdl_joystick;
     std::unique_ptr<SDL_GameController, decltype(&SDL_GameControllerClose)> sdl_controller;
-    mutable std::mutex mutex;
 
     // Motion is initialized without PID values as motion input is not aviable for SDL2
     MotionInput motion{0.0f, 0.0f, 0.0f};
@@ -0,0 +1,324 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include <dynarmic/A64/a64.h>
+#include <dynarmic/A64/config.h>
+#include <dynarmic/exclusive_monitor.h>
+#include <fmt/format.h>
+
+#include "common/common_types.h"
+#include "common/file_util.h"
+#include "common/lz4_compression.h"
+#include "core/arm/cpu_trace.h"
+#include "core/hardware_properties.h"
+
+// Replays CPU execution windows captured with YUZU_CPU_TRACE (see core/arm/cpu_trace.h) against
+// a standalone dynarmic instance and reports guest MIPS as JSON, so JIT and memory subsystem
+// changes can be quantified on real game workloads instead of microbenchmarks only:
+//
+//     {"windows": N, "instructions": X, "cold_mips": A, "warm_mips": B, ...}
+//
+// Each window is run twice from its captured state: the cold pass includes translation, the warm
+// pass measures steady-state execution and is the headline number.
+
+namespace {
+
+using Vector = Dynarmic::A64::Vector;
+
+constexpr u64 PAGE_MASK = Core::CpuTrace::TRACE_PAGE_SIZE - 1;
+
+/// Serves guest memory accesses from the page images captured with a window. Pages the capture
+/// missed read as zeroes and are counted, so divergent replays are visible in the report.
+class ReplayCallbacks final : public Dynarmic::A64::UserCallbacks {
+public:
+    u8* PagePointer(u64 vaddr, bool allocate) {
+        const u64 base = vaddr & ~PAGE_MASK;
+        const auto it = pages.find(base);
+        if (it != pages.end()) {
+            return it->second.data() + (vaddr & PAGE_MASK);
+        }
+        if (!allocate) {
+            ++missing_accesses;
+            return nullptr;
+        }
+        auto& page =
+            pages.emplace(base, std::vector<u8>(Core::CpuTrace::TRACE_PAGE_SIZE)).first->second;
+        return page.data() + (vaddr & PAGE_MASK);
+    }
+
+    void ReadBytes(u64 vaddr, void* dest, std::size_t size) {
+        // Accesses can straddle a page boundary
+        u8* out = static_cast<u8*>(dest);
+        while (size > 0) {
+            const std::size_t chunk = std::min<std::size_t>(
+                size, Core::CpuTrace::TRACE_PAGE_SIZE - (vaddr & PAGE_MASK));
+            if (const u8* const src = PagePointer(vaddr, false)) {
+                std::memcpy(out, src, chunk);
+            } else {
+                std::memset(out, 0, chunk);
+            }
+            vaddr += chunk;
+            out += chunk;
+            size -= chunk;
+        }
+    }
+
+    void WriteBytes(u64 vaddr, const void* src, std::size_t size) {
+        const u8* in = static_cast<const u8*>(src);
+        while (size > 0) {
+            const std::size_t chunk = std::min<std::size_t>(
+                size, Core::CpuTrace::TRACE_PAGE_SIZE - (vaddr & PAGE_MASK));
+            std::memcpy(PagePointer(vaddr, true), in, chunk);
+            vaddr += chunk;
+            in += chunk;
+            size -= chunk;
+        }
+    }
+
+    template <typename T>
+    T Read(u64 vaddr) {
+        T value{};
+        ReadBytes(vaddr, &value, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void Write(u64 vaddr, const T& value) {
+        WriteBytes(vaddr, &value, sizeof(T));
+    }
+
+    u8 MemoryRead8(u64 vaddr) override {
+        return Read<u8>(vaddr);
+    }
+    u16 MemoryRead16(u64 vaddr) override {
+        return Read<u16>(vaddr);
+    }
+    u32 MemoryRead32(u64 vaddr) override {
+        return Read<u32>(vaddr);
+    }
+    u64 MemoryRead64(u64 vaddr) override {
+        return Read<u64>(vaddr);
+    }
+    Vector MemoryRead128(u64 vaddr) override {
+        return {Read<u64>(vaddr), Read<u64>(vaddr + 8)};
+    }
+    u32 MemoryReadCode(u64 vaddr) override {
+        return Read<u32>(vaddr);
+    }
+
+    void MemoryWrite8(u64 vaddr, u8 value) override {
+        Write(vaddr, value);
+    }
+    void MemoryWrite16(u64 vaddr, u16 value) override {
+        Write(vaddr, value);
+    }
+    void MemoryWrite32(u64 vaddr, u32 value) override {
+        Write(vaddr, value);
+    }
+    void MemoryWrite64(u64 vaddr, u64 value) override {
+        Write(vaddr, value);
+    }
+    void MemoryWrite128(u64 vaddr, Vector value) override {
+        Write(vaddr, value[0]);
+        Write(vaddr + 8, value[1]);
+    }
+
+    // The replay is single threaded, so exclusive stores always succeed
+    bool MemoryWriteExclusive8(u64 vaddr, std::uint8_t value, std::uint8_t) override {
+        Write(vaddr, value);
+        return true;
+    }
+    bool MemoryWriteExclusive16(u64 vaddr, std::uint16_t value, std::uint16_t) override {
+        Write(vaddr, value);
+        return true;
+    }
+    bool MemoryWriteExclusive32(u64 vaddr, std::uint32_t value, std::uint32_t) override {
+        Write(vaddr, value);
+        return true;
+    }
+    bool MemoryWriteExclusive64(u64 vaddr, std::uint64_t value, std::uint64_t) override {
+        Write(vaddr, value);
+        return true;
+    }
+    bool MemoryWriteExclusive128(u64 vaddr, Vector value, Vector) override {
+        Write(vaddr, value[0]);
+        Write(vaddr + 8, value[1]);
+        return true;
+    }
+
+    void InterpreterFallback(u64 pc, std::size_t) override {
+        std::fprintf(stderr, "replay: interpreter fallback at 0x%llx\n",
+                     static_cast<unsigned long long>(pc));
+        ++fallback_exits;
+        jit->HaltExecution();
+    }
+
+    void ExceptionRaised(u64, Dynarmic::A64::Exception) override {
+        jit->HaltExecution();
+    }
+
+    // Windows end at supervisor calls during capture, so reaching one here means the replay
+    // diverged from the recorded execution. Stop the window and count it.
+    void CallSVC(u32) override {
+        ++svc_exits;
+        jit->HaltExecution();
+    }
+
+    void AddTicks(u64 ticks) override {
+        executed += ticks;
+        ticks_left -= std::min(ticks, ticks_left);
+    }
+
+    u64 GetTicksRemaining() override {
+        return ticks_left;
+    }
+
+    u64 GetCNTPCT() override {
+        return executed;
+    }
+
+    std::unordered_map<u64, std::vector<u8>> pages;
+    Dynarmic::A64::Jit* jit = nullptr;
+    u64 ticks_left = 0;
+    u64 executed = 0;
+    u64 tpidr = 0;
+    u64 tpidrro = 0;
+    u64 missing_accesses = 0;
+    u64 svc_exits = 0;
+    u64 fallback_exits = 0;
+};
+
+/// Decodes the compressed page payload of a window into a page address -> contents map.
+std::unordered_map<u64, std::vector<u8>> DecodePages(const Core::CpuTrace::WindowHeader& header,
+                                                     const std::vector<u8>& compressed) {
+    const std::vector<u8> payload =
+        Common::Compression::DecompressDataLZ4(compressed, header.uncompressed_size);
+    std::unordered_map<u64, std::vector<u8>> pages;
+    pages.reserve(header.num_pages);
+    std::size_t offset = 0;
+    for (u32 i = 0; i < header.num_pages; ++i) {
+        u64 base{};
+        std::memcpy(&base, payload.data() + offset, sizeof(u64));
+        offset += sizeof(u64);
+        pages.emplace(base, std::vector<u8>(payload.begin() + offset,
+                                            payload.begin() + offset +
+                                                Core::CpuTrace::TRACE_PAGE_SIZE));
+        offset += Core::CpuTrace::TRACE_PAGE_SIZE;
+    }
+    return pages;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: %s <trace file captured with YUZU_CPU_TRACE>\n", argv[0]);
+        return 1;
+    }
+    Common::FS::IOFile file(argv[1], "rb");
+    if (!file.IsOpen()) {
+        std::fprintf(stderr, "replay: failed to open '%s'\n", argv[1]);
+        return 1;
+    }
+    u32 magic{};
+    u32 version{};
+    if (file.ReadArray(&magic, 1) != 1 || file.ReadArray(&version, 1) != 1 ||
+        magic != Core::CpuTrace::TRACE_MAGIC || version != Core::CpuTrace::TRACE_VERSION) {
+        std::fprintf(stderr, "replay: '%s' is not a version %u CPU trace\n", argv[1],
+                     Core::CpuTrace::TRACE_VERSION);
+        return 1;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    u64 num_windows = 0;
+    u64 total_instructions = 0;
+    u64 cold_executed = 0;
+    u64 warm_executed = 0;
+    u64 missing_accesses = 0;
+    u64 svc_exits = 0;
+    u64 fallback_exits = 0;
+    Clock::duration cold_time{};
+    Clock::duration warm_time{};
+
+    Core::CpuTrace::WindowHeader header{};
+    while (file.ReadArray(&header, 1) == 1) {
+        std::vector<u8> compressed(header.compressed_size);
+        if (file.ReadArray(compressed.data(), compressed.size()) != compressed.size()) {
+            std::fprintf(stderr, "replay: truncated window payload\n");
+            return 1;
+        }
+        const auto pages = DecodePages(header, compressed);
+
+        ReplayCallbacks callbacks;
+        Dynarmic::ExclusiveMonitor monitor{1};
+        Dynarmic::A64::UserConfig config;
+        config.callbacks = &callbacks;
+        config.processor_id = 0;
+        config.global_monitor = &monitor;
+        config.tpidrro_el0 = &callbacks.tpidrro;
+        config.tpidr_el0 = &callbacks.tpidr;
+        config.dczid_el0 = 4;
+        config.ctr_el0 = 0x8444c004;
+        config.cntfrq_el0 = Core::Hardware::CNTFREQ;
+        config.define_unpredictable_behaviour = true;
+        Dynarmic::A64::Jit jit{config};
+        callbacks.jit = &jit;
+
+        // Cold pass translates, warm pass reuses the block cache; both start from the captured
+        // state with a fresh copy of the page images
+        for (const bool warm : {false, true}) {
+            callbacks.pages = pages;
+            callbacks.tpidr = header.context.tpidr;
+            callbacks.tpidrro = header.tpidrro;
+            callbacks.ticks_left = header.instructions;
+            callbacks.executed = 0;
+            jit.SetRegisters(header.context.cpu_registers);
+            jit.SetSP(header.context.sp);
+            jit.SetPC(header.context.pc);
+            jit.SetPstate(header.context.pstate);
+            jit.SetVectors(header.context.vector_registers);
+            jit.SetFpcr(header.context.fpcr);
+            jit.SetFpsr(header.context.fpsr);
+            jit.ClearExclusiveState();
+
+            const auto start = Clock::now();
+            jit.Run();
+            const auto elapsed = Clock::now() - start;
+            if (warm) {
+                warm_time += elapsed;
+                warm_executed += callbacks.executed;
+            } else {
+                cold_time += elapsed;
+                cold_executed += callbacks.executed;
+            }
+        }
+        ++num_windows;
+        total_instructions += header.instructions;
+        missing_accesses += callbacks.missing_accesses;
+        svc_exits += callbacks.svc_exits;
+        fallback_exits += callbacks.fallback_exits;
+    }
+
+    const auto to_seconds = [](Clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+    };
+    const auto mips = [&](u64 instructions, Clock::duration duration) {
+        const double seconds = to_seconds(duration);
+        return seconds > 0.0 ? static_cast<double>(instructions) / seconds / 1e6 : 0.0;
+    };
+    fmt::print("{{\"windows\": {}, \"instructions\": {}, \"cold_seconds\": {:.3f}, "
+               "\"cold_mips\": {:.1f}, \"warm_seconds\": {:.3f}, \"warm_mips\": {:.1f}, "
+               "\"missing_page_accesses\": {}, \"svc_exits\": {}, \"fallback_exits\": {}}}\n",
+               num_windows, total_instructions, to_seconds(cold_time),
+               mips(cold_executed, cold_time), to_seconds(warm_time),
+               mips(warm_executed, warm_time), missing_accesses, svc_exits, fallback_exits);
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/common_types.h"
+#include "common/threadsafe_queue.h"
+#include "video_core/textures/astc.h"
+#include "video_core/textures/decoders.h"
+
+// Microbenchmarks for the emulator's proven hot kernels. Each benchmark is timed standalone and
+// the results are printed as a JSON array so CI can diff throughput between revisions and gate
+// merges on regressions:
+//
+//     [{"name": "...", "iterations": N, "ns_per_iter": X, "bytes_per_iter": B, "mib_per_s": T}]
+//
+// Keep the workload sizes fixed; they are part of the benchmark contract.
+
+namespace {
+
+struct BenchResult {
+    std::string name;
+    u64 iterations;
+    double ns_per_iter;
+    u64 bytes_per_iter;
+};
+
+/// Runs a benchmark body repeatedly and keeps the fastest sample to reject scheduling noise
+template <typename Func>
+BenchResult RunBenchmark(std::string name, u64 bytes_per_iter, Func&& func) {
+    using Clock = std::chrono::steady_clock;
+
+    // Warm caches and let the CPU settle before taking samples
+    func();
+
+    // Size the iteration batch so one sample runs for roughly 50 ms
+    const auto calibration_start = Clock::now();
+    func();
+    const auto single_run = Clock::now() - calibration_start;
+    const u64 iterations = std::max<u64>(
+        1, std::chrono::milliseconds(50) / std::max(single_run, Clock::duration{1}));
+
+    constexpr int NumSamples = 5;
+    auto best = Clock::duration::max();
+    for (int sample = 0; sample < NumSamples; ++sample) {
+        const auto start = Clock::now();
+        for (u64 i = 0; i < iterations; ++i) {
+            func();
+        }
+        best = std::min(best, Clock::now() - start);
+    }
+
+    const double ns_per_iter =
+        std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(best).count() /
+        static_cast<double>(iterations);
+    return BenchResult{std::move(name), iterations, ns_per_iter, bytes_per_iter};
+}
+
+std::vector<u8> MakeRandomBuffer(std::size_t size) {
+    // Fixed seed: benchmark inputs must be identical across runs and revisions
+    std::mt19937_64 rng(0x6575'7a75'6265'6e63ULL);
+    std::vector<u8> buffer(size);
+    for (std::size_t i = 0; i < size; i += sizeof(u64)) {
+        const u64 value = rng();
+        std::memcpy(buffer.data() + i, &value, std::min(sizeof(u64), size - i));
+    }
+    return buffer;
+}
+
+BenchResult BenchUnswizzle() {
+    constexpr u32 width = 1024;
+    constexpr u32 height = 1024;
+    constexpr u32 bytes_per_pixel = 4;
+    constexpr u32 block_height = 4;
+    const std::vector<u8> input = MakeRandomBuffer(width * height * bytes_per_pixel);
+    std::vector<u8> output(input.size());
+    return RunBenchmark("unswizzle_1024x1024_bpp4", input.size(), [&] {
+        Tegra::Texture::UnswizzleTexture(output, input, bytes_per_pixel, width, height, 1,
+                                         block_height, 0);
+    });
+}
+
+BenchResult BenchSwizzle() {
+    constexpr u32 width = 1024;
+    constexpr u32 height = 1024;
+    constexpr u32 bytes_per_pixel = 4;
+    constexpr u32 block_height = 4;
+    const std::vector<u8> input = MakeRandomBuffer(width * height * bytes_per_pixel);
+    std::vector<u8> output(input.size());
+    return RunBenchmark("swizzle_1024x1024_bpp4", input.size(), [&] {
+        Tegra::Texture::SwizzleTexture(output, input, bytes_per_pixel, width, height, 1,
+                                       block_height, 0);
+    });
+}
+
+BenchResult BenchAstcDecompress() {
+    constexpr u32 width = 256;
+    constexpr u32 height = 256;
+    constexpr u32 block_width = 8;
+    constexpr u32 block_height = 8;
+    // 128 bits per block; random blocks exercise the generic decode paths, invalid encodings
+    // take the error-color path which is also a real workload for damaged textures
+    const std::vector<u8> input =
+        MakeRandomBuffer((width / block_width) * (height / block_height) * 16);
+    std::vector<u8> output(width * height * 4);
+    return RunBenchmark("astc_decompress_256x256_8x8", output.size(), [&] {
+        Tegra::Texture::ASTC::Decompress(input, width, height, 1, block_width, block_height,
+                                         output);
+    });
+}
+
+BenchResult BenchCityHash() {
+    const std::vector<u8> input = MakeRandomBuffer(64 * 1024);
+    volatile u64 sink = 0;
+    return RunBenchmark("cityhash64_64k", input.size(), [&] {
+        sink = Common::CityHash64(reinterpret_cast<const char*>(input.data()), input.size());
+    });
+}
+
+BenchResult BenchSpscQueue() {
+    constexpr u64 num_elements = 4096;
+    Common::SPSCQueue<u64> queue;
+    return RunBenchmark("spsc_queue_push_pop_4096", num_elements * sizeof(u64), [&] {
+        for (u64 i = 0; i < num_elements; ++i) {
+            queue.Push(i);
+        }
+        u64 value;
+        while (queue.Pop(value)) {
+        }
+    });
+}
+
+} // Anonymous namespace
+
+int main() {
+    const std::vector<BenchResult> results{
+        BenchUnswizzle(),      BenchSwizzle(),  BenchAstcDecompress(),
+        BenchCityHash(),       BenchSpscQueue(),
+    };
+
+    std::string json{"[\n"};
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& result = results[i];
+        const double mib_per_s = static_cast<double>(result.bytes_per_iter) /
+                                 (result.ns_per_iter / 1e9) / (1024.0 * 1024.0);
+        json += fmt::format("  {{\"name\": \"{}\", \"iterations\": {}, \"ns_per_iter\": {:.1f}, "
+                            "\"bytes_per_iter\": {}, \"mib_per_s\": {:.1f}}}{}\n",
+                            result.name, result.iterations, result.ns_per_iter,
+                            result.bytes_per_iter, mib_per_s, i + 1 < results.size() ? "," : "");
+    }
+    json += "]\n";
+    std::fputs(json.c_str(), stdout);
+    return 0;
+}
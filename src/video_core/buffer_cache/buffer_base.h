@@ -38,6 +38,10 @@ class BufferBase {
     static constexpr u64 PAGES_PER_WORD = 64;
     static constexpr u64 BYTES_PER_PAGE = Core::Memory::PAGE_SIZE;
     static constexpr u64 BYTES_PER_WORD = PAGES_PER_WORD * BYTES_PER_PAGE;
+    /// Number of tracking words covered by each word of the summary bitmap. Each summary bit is
+    /// set exactly when its tracking word has any page bit set, letting scans skip clean regions
+    /// in chunks instead of walking every word of large buffers.
+    static constexpr u64 WORDS_PER_SUMMARY = 64;
 
     /// Vector tracking modified pages tightly packed with small vector optimization
     union WrittenWords {
@@ -61,14 +65,28 @@ class BufferBase {
             if (IsShort()) {
                 cpu.stack = ~u64{0};
                 gpu.stack = 0;
+                cpu_summary.stack = 1;
+                gpu_summary.stack = 0;
             } else {
-                // Share allocation between CPU and GPU pages and set their default values
+                // Share allocation between CPU and GPU pages plus their summaries and set their
+                // default values
                 const size_t num_words = NumWords();
-                u64* const alloc = new u64[num_words * 2];
+                const size_t num_summary = NumSummaryWords();
+                u64* const alloc = new u64[(num_words + num_summary) * 2];
                 cpu.heap = alloc;
                 gpu.heap = alloc + num_words;
+                cpu_summary.heap = gpu.heap + num_words;
+                gpu_summary.heap = cpu_summary.heap + num_summary;
                 std::fill_n(cpu.heap, num_words, ~u64{0});
                 std::fill_n(gpu.heap, num_words, 0);
+                std::fill_n(cpu_summary.heap, num_summary, ~u64{0});
+                std::fill_n(gpu_summary.heap, num_summary, 0);
+                // Clean up summary bits past the last word
+                const u64 last_summary_bits = num_words % WORDS_PER_SUMMARY;
+                if (last_summary_bits != 0) {
+                    cpu_summary.heap[num_summary - 1] =
+                        ~u64{0} >> (WORDS_PER_SUMMARY - last_summary_bits);
+                }
             }
             // Clean up tailing bits
             const u64 last_local_page =
@@ -87,12 +105,15 @@ class BufferBase {
             size_bytes = rhs.size_bytes;
             cpu = rhs.cpu;
             gpu = rhs.gpu;
+            cpu_summary = rhs.cpu_summary;
+            gpu_summary = rhs.gpu_summary;
             rhs.cpu.heap = nullptr;
             return *this;
         }
 
         GpuCpuWords(GpuCpuWords&& rhs) noexcept
-            : size_bytes{rhs.size_bytes}, cpu{rhs.cpu}, gpu{rhs.gpu} {
+            : size_bytes{rhs.size_bytes}, cpu{rhs.cpu}, gpu{rhs.gpu},
+              cpu_summary{rhs.cpu_summary}, gpu_summary{rhs.gpu_summary} {
             rhs.cpu.heap = nullptr;
         }
 
@@ -109,6 +130,11 @@ class BufferBase {
             return Common::DivCeil(size_bytes, BYTES_PER_WORD);
         }
 
+        /// Returns the number of summary words of the buffer
+        [[nodiscard]] size_t NumSummaryWords() const noexcept {
+            return Common::DivCeil(NumWords(), WORDS_PER_SUMMARY);
+        }
+
         /// Release buffer resources
         void Release() {
             if (!IsShort()) {
@@ -120,6 +146,8 @@ class BufferBase {
         u64 size_bytes = 0;
         WrittenWords cpu;
         WrittenWords gpu;
+        WrittenWords cpu_summary;
+        WrittenWords gpu_summary;
     };
 
 public:
@@ -160,22 +188,22 @@ public:
 
     /// Mark region as CPU modified, notifying the rasterizer about this change
     void MarkRegionAsCpuModified(VAddr dirty_cpu_addr, u64 size) {
-        ChangeRegionState<true, true>(words.cpu, dirty_cpu_addr, size);
+        ChangeRegionState<true, true>(words.cpu, words.cpu_summary, dirty_cpu_addr, size);
     }
 
     /// Unmark region as CPU modified, notifying the rasterizer about this change
     void UnmarkRegionAsCpuModified(VAddr dirty_cpu_addr, u64 size) {
-        ChangeRegionState<false, true>(words.cpu, dirty_cpu_addr, size);
+        ChangeRegionState<false, true>(words.cpu, words.cpu_summary, dirty_cpu_addr, size);
     }
 
     /// Mark region as modified from the host GPU
     void MarkRegionAsGpuModified(VAddr dirty_cpu_addr, u64 size) noexcept {
-        ChangeRegionState<true, false>(words.gpu, dirty_cpu_addr, size);
+        ChangeRegionState<true, false>(words.gpu, words.gpu_summary, dirty_cpu_addr, size);
     }
 
     /// Unmark region as modified from the host GPU
     void UnmarkRegionAsGpuModified(VAddr dirty_cpu_addr, u64 size) noexcept {
-        ChangeRegionState<false, false>(words.gpu, dirty_cpu_addr, size);
+        ChangeRegionState<false, false>(words.gpu, words.gpu_summary, dirty_cpu_addr, size);
     }
 
     /// Call 'func' for each CPU modified range and unmark those pages as CPU modified
@@ -237,6 +265,7 @@ private:
      * Change the state of a range of pages
      *
      * @param written_words Pages to be marked or unmarked as modified
+     * @param summary       Summary bitmap tracking which words have any page set
      * @param dirty_addr    Base address to mark or unmark as modified
      * @param size          Size in bytes to mark or unmark as modified
      *
@@ -244,7 +273,7 @@ private:
      * @tparam notify_rasterizer True when the rasterizer has to be notified about the changes
      */
     template <bool enable, bool notify_rasterizer>
-    void ChangeRegionState(WrittenWords& written_words, u64 dirty_addr,
+    void ChangeRegionState(WrittenWords& written_words, WrittenWords& summary, u64 dirty_addr,
                            s64 size) noexcept(!notify_rasterizer) {
         const s64 difference = dirty_addr - cpu_addr;
         const u64 offset = std::max<s64>(difference, 0);
@@ -253,6 +282,7 @@ private:
             return;
         }
         u64* const state_words = written_words.Pointer(IsShort());
+        u64* const summary_words = summary.Pointer(IsShort());
         const u64 offset_end = std::min(offset + size, SizeBytes());
         const u64 begin_page_index = offset / BYTES_PER_PAGE;
         const u64 begin_word_index = begin_page_index / PAGES_PER_WORD;
@@ -271,10 +301,15 @@ private:
             if constexpr (notify_rasterizer) {
                 NotifyRasterizer<!enable>(word_index, state_words[word_index], bits);
             }
+            const u64 summary_bit = u64{1} << (word_index % WORDS_PER_SUMMARY);
             if constexpr (enable) {
                 state_words[word_index] |= bits;
+                summary_words[word_index / WORDS_PER_SUMMARY] |= summary_bit;
             } else {
                 state_words[word_index] &= ~bits;
+                if (state_words[word_index] == 0) {
+                    summary_words[word_index / WORDS_PER_SUMMARY] &= ~summary_bit;
+                }
             }
             page_index = 0;
             ++word_index;
@@ -330,22 +365,20 @@ private:
         const u64* const cpu_words = words.cpu.Pointer(IsShort());
         const u64 query_end = query_begin + std::min(static_cast<u64>(size), SizeBytes());
         u64* const state_words = (gpu ? words.gpu : words.cpu).Pointer(IsShort());
-        u64* const words_begin = state_words + query_begin / BYTES_PER_WORD;
-        u64* const words_end = state_words + Common::DivCeil(query_end, BYTES_PER_WORD);
+        u64* const summary_words = (gpu ? words.gpu_summary : words.cpu_summary).Pointer(IsShort());
+        const u64 word_begin = query_begin / BYTES_PER_WORD;
+        const u64 word_end = Common::DivCeil(query_end, BYTES_PER_WORD);
 
-        const auto modified = [](u64 word) { return word != 0; };
-        const auto first_modified_word = std::find_if(words_begin, words_end, modified);
-        if (first_modified_word == words_end) {
+        const u64 word_index_begin = FindModifiedWord(summary_words, word_begin, word_end);
+        if (word_index_begin == word_end) {
             // Exit early when the buffer is not modified
             return;
         }
-        const auto last_modified_word = std::find_if_not(first_modified_word, words_end, modified);
-
-        const u64 word_index_begin = std::distance(state_words, first_modified_word);
-        const u64 word_index_end = std::distance(state_words, last_modified_word);
+        const u64 word_index_end = FindCleanWord(summary_words, word_index_begin, word_end);
 
-        const unsigned local_page_begin = std::countr_zero(*first_modified_word);
-        const unsigned local_page_end = PAGES_PER_WORD - std::countl_zero(last_modified_word[-1]);
+        const unsigned local_page_begin = std::countr_zero(state_words[word_index_begin]);
+        const unsigned local_page_end =
+            PAGES_PER_WORD - std::countl_zero(state_words[word_index_end - 1]);
         const u64 word_page_begin = word_index_begin * PAGES_PER_WORD;
         const u64 word_page_end = (word_index_end - 1) * PAGES_PER_WORD;
         const u64 query_page_begin = query_begin / BYTES_PER_PAGE;
@@ -370,6 +403,10 @@ private:
 
             const u64 current_word = state_words[word_index] & bits;
             state_words[word_index] &= ~bits;
+            if (state_words[word_index] == 0) {
+                summary_words[word_index / WORDS_PER_SUMMARY] &=
+                    ~(u64{1} << (word_index % WORDS_PER_SUMMARY));
+            }
 
             // Exclude CPU modified pages when visiting GPU pages
             const u64 word = current_word & ~(gpu ? cpu_words[word_index] : 0);
@@ -402,6 +439,35 @@ private:
         }
     }
 
+    /// Returns the index of the first word in [begin, end) whose summary bit is set, or 'end'
+    [[nodiscard]] static u64 FindModifiedWord(const u64* summary_words, u64 begin,
+                                              u64 end) noexcept {
+        u64 index = begin;
+        while (index < end) {
+            const u64 bits = summary_words[index / WORDS_PER_SUMMARY] >>
+                             (index % WORDS_PER_SUMMARY);
+            if (bits != 0) {
+                return std::min<u64>(index + std::countr_zero(bits), end);
+            }
+            index = (index / WORDS_PER_SUMMARY + 1) * WORDS_PER_SUMMARY;
+        }
+        return end;
+    }
+
+    /// Returns the index of the first word in [begin, end) whose summary bit is clear, or 'end'
+    [[nodiscard]] static u64 FindCleanWord(const u64* summary_words, u64 begin, u64 end) noexcept {
+        u64 index = begin;
+        while (index < end) {
+            const u64 bits = ~summary_words[index / WORDS_PER_SUMMARY] >>
+                             (index % WORDS_PER_SUMMARY);
+            if (bits != 0) {
+                return std::min<u64>(index + std::countr_zero(bits), end);
+            }
+            index = (index / WORDS_PER_SUMMARY + 1) * WORDS_PER_SUMMARY;
+        }
+        return end;
+    }
+
     template <typename Func>
     void InvokeModifiedRange(Func&& func, u64 current_size, u64 current_base) {
         const u64 current_size_bytes = current_size * BYTES_PER_PAGE;
@@ -420,12 +486,19 @@ private:
     [[nodiscard]] bool IsRegionModified(u64 offset, u64 size) const noexcept {
         const u64* const cpu_words = words.cpu.Pointer(IsShort());
         const u64* const state_words = (gpu ? words.gpu : words.cpu).Pointer(IsShort());
+        const u64* const summary_words =
+            (gpu ? words.gpu_summary : words.cpu_summary).Pointer(IsShort());
         const u64 num_query_words = size / BYTES_PER_WORD + 1;
         const u64 word_begin = offset / BYTES_PER_WORD;
         const u64 word_end = std::min(word_begin + num_query_words, NumWords());
         const u64 page_limit = Common::DivCeil(offset + size, BYTES_PER_PAGE);
         u64 page_index = (offset / BYTES_PER_PAGE) % PAGES_PER_WORD;
         for (u64 word_index = word_begin; word_index < word_end; ++word_index, page_index = 0) {
+            if (summary_words[word_index / WORDS_PER_SUMMARY] == 0) {
+                // Skip the whole chunk of clean words
+                word_index = (word_index / WORDS_PER_SUMMARY + 1) * WORDS_PER_SUMMARY - 1;
+                continue;
+            }
             const u64 word = state_words[word_index] & ~(gpu ? cpu_words[word_index] : 0);
             if (word == 0) {
                 continue;
@@ -452,6 +525,8 @@ private:
     [[nodiscard]] std::pair<u64, u64> ModifiedRegion(u64 offset, u64 size) const noexcept {
         const u64* const cpu_words = words.cpu.Pointer(IsShort());
         const u64* const state_words = (gpu ? words.gpu : words.cpu).Pointer(IsShort());
+        const u64* const summary_words =
+            (gpu ? words.gpu_summary : words.cpu_summary).Pointer(IsShort());
         const u64 num_query_words = size / BYTES_PER_WORD + 1;
         const u64 word_begin = offset / BYTES_PER_WORD;
         const u64 word_end = std::min(word_begin + num_query_words, NumWords());
@@ -460,6 +535,11 @@ private:
         u64 begin = std::numeric_limits<u64>::max();
         u64 end = 0;
         for (u64 word_index = word_begin; word_index < word_end; ++word_index) {
+            if (summary_words[word_index / WORDS_PER_SUMMARY] == 0) {
+                // Skip the whole chunk of clean words
+                word_index = (word_index / WORDS_PER_SUMMARY + 1) * WORDS_PER_SUMMARY - 1;
+                continue;
+            }
             const u64 word = state_words[word_index] & ~(gpu ? cpu_words[word_index] : 0);
             if (word == 0) {
                 continue;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -20,6 +21,7 @@
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/logging/log.h"
+#include "common/perf_counters.h"
 #include "core/core.h"
 #include "core/memory.h"
 #include "core/settings.h"
@@ -37,6 +39,7 @@ class BufferCache {
     using VectorMapInterval = boost::container::small_vector<MapInterval*, 1>;
 
     static constexpr u64 WRITE_PAGE_BIT = 11;
+    static constexpr u64 PAGES_PER_WORD = 64;
     static constexpr u64 BLOCK_PAGE_BITS = 21;
     static constexpr u64 BLOCK_PAGE_SIZE = 1ULL << BLOCK_PAGE_BITS;
 
@@ -86,12 +89,33 @@ public:
             }
         }
 
+        // Buffer bindings repeat across frames, so before walking the block and interval
+        // machinery check whether this address resolved to the same map the last time it was
+        // bound. The prediction is allocation and tree free; any event that could invalidate a
+        // resolved binding bumps prediction_epoch and turns hits back into misses.
+        BindingPrediction& prediction = binding_predictions[PredictionIndex(gpu_addr)];
+        if (prediction.epoch == prediction_epoch && prediction.gpu_addr == gpu_addr &&
+            prediction.cpu_addr == *cpu_addr && prediction.size == size &&
+            prediction.is_written == is_written) {
+            if (is_written) {
+                prediction.map->MarkAsModified(true, GetModifiedTicks());
+                if (Settings::IsGPULevelHigh() &&
+                    Settings::values.use_asynchronous_gpu_emulation.GetValue()) {
+                    MarkForAsyncFlush(prediction.map);
+                }
+            }
+            return prediction.info;
+        }
+
         Buffer* const block = GetBlock(*cpu_addr, size);
         MapInterval* const map = MapAddress(block, gpu_addr, *cpu_addr, size);
         if (!map) {
             return GetEmptyBuffer(size);
         }
         if (is_written) {
+            // A written map can be flushed back to guest memory as a whole, so any never-bound
+            // gap inside it has to hold valid data before the GPU writes to the buffer.
+            PopulateRegion(block, map->start, map->end);
             map->MarkAsModified(true, GetModifiedTicks());
             if (Settings::IsGPULevelHigh() &&
                 Settings::values.use_asynchronous_gpu_emulation.GetValue()) {
@@ -101,9 +125,82 @@ public:
                 map->is_written = true;
                 MarkRegionAsWritten(map->start, map->end - 1);
             }
+        } else {
+            // Hits on a map containing never-bound gaps populate the requested range on first use
+            PopulateRegion(block, *cpu_addr, *cpu_addr + size);
+        }
+
+        const BufferInfo info{block->Handle(), block->Offset(*cpu_addr), block->Address()};
+        prediction = BindingPrediction{
+            .gpu_addr = gpu_addr,
+            .cpu_addr = *cpu_addr,
+            .size = size,
+            .is_written = is_written,
+            .epoch = prediction_epoch,
+            .map = map,
+            .info = info,
+        };
+        return info;
+    }
+
+    /// Copies a linear range between two cached buffers on the GPU. Returns false when either
+    /// range is not resident in the cache and the copy has to be performed on the CPU.
+    bool DMACopy(GPUVAddr src_gpu_addr, GPUVAddr dst_gpu_addr, std::size_t size) {
+        std::lock_guard lock{mutex};
+
+        if (size == 0) {
+            return true;
         }
+        const std::optional<VAddr> src_cpu_addr = gpu_memory.GpuToCpuAddress(src_gpu_addr);
+        const std::optional<VAddr> dst_cpu_addr = gpu_memory.GpuToCpuAddress(dst_gpu_addr);
+        if (!src_cpu_addr || !dst_cpu_addr) {
+            return false;
+        }
+        // Overlapping copies would invalidate the source mapping while mapping the destination.
+        if (*src_cpu_addr < *dst_cpu_addr + size && *dst_cpu_addr < *src_cpu_addr + size) {
+            return false;
+        }
+        // Only accelerate when both ends are already resident; uploading data just to copy it
+        // would be slower than the CPU path. Ranges with a guest write pending synchronization
+        // are stale on the GPU and have to take the CPU path as well.
+        const VectorMapInterval src_maps = GetMapsInRange(*src_cpu_addr, size);
+        if (src_maps.size() != 1 || src_maps[0]->is_sync_pending ||
+            !src_maps[0]->IsInside(*src_cpu_addr, *src_cpu_addr + size)) {
+            return false;
+        }
+        const VectorMapInterval dst_maps = GetMapsInRange(*dst_cpu_addr, size);
+        if (dst_maps.empty() ||
+            std::any_of(dst_maps.begin(), dst_maps.end(),
+                        [](const MapInterval* map) { return map->is_sync_pending; })) {
+            return false;
+        }
+
+        Buffer* dst_block = GetBlock(*dst_cpu_addr, size);
+        MapInterval* const dst_map = MapAddress(dst_block, dst_gpu_addr, *dst_cpu_addr, size);
+        if (!dst_map) {
+            return false;
+        }
+        Buffer* const src_block = GetBlock(*src_cpu_addr, size);
+        // Resolving the source block may have merged the destination's into it.
+        dst_block = GetBlock(*dst_cpu_addr, size);
+
+        // The destination map is marked as GPU modified below and can be flushed back to guest
+        // memory as a whole, so it has to be fully populated before the copy.
+        PopulateRegion(dst_block, dst_map->start, dst_map->end);
+
+        dst_block->CopyFrom(*src_block, src_block->Offset(*src_cpu_addr),
+                            dst_block->Offset(*dst_cpu_addr), size);
 
-        return BufferInfo{block->Handle(), block->Offset(*cpu_addr), block->Address()};
+        dst_map->MarkAsModified(true, GetModifiedTicks());
+        if (Settings::IsGPULevelHigh() &&
+            Settings::values.use_asynchronous_gpu_emulation.GetValue()) {
+            MarkForAsyncFlush(dst_map);
+        }
+        if (!dst_map->is_written) {
+            dst_map->is_written = true;
+            MarkRegionAsWritten(dst_map->start, dst_map->end - 1);
+        }
+        return true;
     }
 
     /// Uploads from a host memory. Returns the OpenGL buffer where it's located and its offset.
@@ -151,14 +248,33 @@ public:
         std::lock_guard lock{mutex};
 
         VectorMapInterval objects = GetMapsInRange(addr, size);
+        // Registered maps are disjoint, so their downloads commute; sort by address and coalesce
+        // runs of contiguous modified maps into a single download each.
         std::sort(objects.begin(), objects.end(),
-                  [](MapInterval* lhs, MapInterval* rhs) { return lhs->ticks < rhs->ticks; });
-        for (MapInterval* object : objects) {
-            if (object->is_modified && object->is_registered) {
-                mutex.unlock();
-                FlushMap(object);
-                mutex.lock();
+                  [](MapInterval* lhs, MapInterval* rhs) { return lhs->start < rhs->start; });
+        std::size_t index = 0;
+        while (index < objects.size()) {
+            MapInterval* const first = objects[index++];
+            if (!first->is_modified || !first->is_registered) {
+                continue;
+            }
+            const auto block_it = blocks.find(first->start >> BLOCK_PAGE_BITS);
+            ASSERT_OR_EXECUTE(block_it != blocks.end(), continue;);
+            const std::shared_ptr<Buffer> block = block_it->second;
+
+            VectorMapInterval run{first};
+            while (index < objects.size()) {
+                MapInterval* const next = objects[index];
+                if (!next->is_modified || !next->is_registered ||
+                    next->start != run.back()->end || next->end > block->CpuAddrEnd()) {
+                    break;
+                }
+                run.push_back(next);
+                ++index;
             }
+            mutex.unlock();
+            FlushMaps(*block, run);
+            mutex.lock();
         }
     }
 
@@ -299,6 +415,11 @@ protected:
         const std::size_t size = map->end - map->start;
         rasterizer.UpdatePagesCachedCount(map->start, size, -1);
         map->is_memory_marked = false;
+        // Guest writes to the range are no longer tracked from here on, so its contents on the
+        // block can go stale without notice and have to be uploaded again on the next use.
+        resident_ranges.subtract(IntervalType{map->start, map->end});
+        // Predicted bindings may point at this map; force them back through the full path
+        ++prediction_epoch;
     }
 
     /// Unregisters an object from the cache
@@ -318,10 +439,45 @@ protected:
         mapped_addresses_allocator.Release(map);
     }
 
+    /// Copies data into the stream buffer with a simple offset bump, for backend upload paths.
+    template <typename Callable>
+    BufferInfo StreamBufferUpload(std::size_t size, std::size_t alignment, Callable&& callable) {
+        AlignBuffer(alignment);
+        const std::size_t uploaded_offset = buffer_offset;
+        callable(buffer_ptr);
+
+        buffer_ptr += size;
+        buffer_offset += size;
+        return BufferInfo{stream_buffer.Handle(), uploaded_offset, stream_buffer.Address()};
+    }
+
 private:
+    /// Last resolution of a buffer binding, reused while prediction_epoch matches
+    struct BindingPrediction {
+        GPUVAddr gpu_addr = 0;
+        VAddr cpu_addr = 0;
+        std::size_t size = 0;
+        bool is_written = false;
+        u64 epoch = 0;
+        MapInterval* map = nullptr;
+        BufferInfo info{};
+    };
+
+    static constexpr std::size_t NUM_PREDICTION_ENTRIES = 512;
+    static_assert((NUM_PREDICTION_ENTRIES & (NUM_PREDICTION_ENTRIES - 1)) == 0,
+                  "Prediction table size must be a power of two");
+
+    static std::size_t PredictionIndex(GPUVAddr gpu_addr) {
+        // Bindings are at least word aligned; fold the high bits in so addresses that only
+        // differ above the table size do not all collide on one slot
+        const u64 page = gpu_addr >> 5;
+        return static_cast<std::size_t>(page ^ (page >> 16)) & (NUM_PREDICTION_ENTRIES - 1);
+    }
+
     MapInterval* MapAddress(Buffer* block, GPUVAddr gpu_addr, VAddr cpu_addr, std::size_t size) {
         const VectorMapInterval overlaps = GetMapsInRange(cpu_addr, size);
         if (overlaps.empty()) {
+            Common::AddPerfCounter(Common::PerfCounter::BufferCacheMisses);
             const VAddr cpu_addr_end = cpu_addr + size;
             if (gpu_memory.IsGranularRange(gpu_addr, size)) {
                 u8* const host_ptr = gpu_memory.GetPointer(gpu_addr);
@@ -331,6 +487,8 @@ private:
                 gpu_memory.ReadBlockUnsafe(gpu_addr, staging_buffer.data(), size);
                 block->Upload(block->Offset(cpu_addr), size, staging_buffer.data());
             }
+            Common::AddPerfCounter(Common::PerfCounter::BufferUploadBytes, size);
+            resident_ranges.add(IntervalType{cpu_addr, cpu_addr_end});
             return Register(MapInterval(cpu_addr, cpu_addr_end, gpu_addr));
         }
 
@@ -338,9 +496,11 @@ private:
         if (overlaps.size() == 1) {
             MapInterval* const current_map = overlaps[0];
             if (current_map->IsInside(cpu_addr, cpu_addr_end)) {
+                Common::AddPerfCounter(Common::PerfCounter::BufferCacheHits);
                 return current_map;
             }
         }
+        Common::AddPerfCounter(Common::PerfCounter::BufferCacheMisses);
         VAddr new_start = cpu_addr;
         VAddr new_end = cpu_addr_end;
         bool write_inheritance = false;
@@ -353,17 +513,30 @@ private:
             modified_inheritance |= overlap->is_modified;
         }
         GPUVAddr new_gpu_addr = gpu_addr + new_start - cpu_addr;
+        // The merged overlaps still hold valid data on the block, so their residency survives the
+        // unregister below; the union map resumes tracking them right away.
+        IntervalSet merged_ranges;
+        for (const MapInterval* overlap : overlaps) {
+            merged_ranges.add(IntervalType{overlap->start, overlap->end});
+        }
+        const IntervalSet still_resident = resident_ranges & merged_ranges;
         for (auto& overlap : overlaps) {
             Unregister(overlap);
         }
-        UpdateBlock(block, new_start, new_end, overlaps);
 
         const MapInterval new_map{new_start, new_end, new_gpu_addr};
         MapInterval* const map = Register(new_map, write_inheritance);
         if (!map) {
             return nullptr;
         }
+        resident_ranges += still_resident;
+        // Populate only the requested range; never-bound gaps between the merged maps stay
+        // unpopulated until a binding actually covers them.
+        PopulateRegion(block, cpu_addr, cpu_addr_end);
         if (modified_inheritance) {
+            // The union map may be flushed back to guest memory as a whole, so it has to be
+            // fully valid on the block.
+            PopulateRegion(block, new_start, new_end);
             map->MarkAsModified(true, GetModifiedTicks());
             if (Settings::IsGPULevelHigh() &&
                 Settings::values.use_asynchronous_gpu_emulation.GetValue()) {
@@ -373,23 +546,35 @@ private:
         return map;
     }
 
-    void UpdateBlock(Buffer* block, VAddr start, VAddr end, const VectorMapInterval& overlaps) {
+    /// Uploads the parts of the given range that are not resident on the block and marks the
+    /// whole range as resident. Ranges a binding already covered are skipped, so repopulating an
+    /// interval after a partial guest write only uploads what actually went stale.
+    void PopulateRegion(Buffer* block, VAddr start, VAddr end) {
         const IntervalType base_interval{start, end};
-        IntervalSet interval_set{};
-        interval_set.add(base_interval);
-        for (auto& overlap : overlaps) {
-            const IntervalType subtract{overlap->start, overlap->end};
-            interval_set.subtract(subtract);
+        if (boost::icl::contains(resident_ranges, base_interval)) {
+            return;
         }
-        for (auto& interval : interval_set) {
-            const std::size_t size = interval.upper() - interval.lower();
-            if (size == 0) {
+        IntervalSet missing;
+        missing.add(base_interval);
+        missing -= resident_ranges;
+
+        u64 uploaded = 0;
+        for (const auto& interval : missing) {
+            const std::size_t interval_size = interval.upper() - interval.lower();
+            if (interval_size == 0) {
                 continue;
             }
-            staging_buffer.resize(size);
-            cpu_memory.ReadBlockUnsafe(interval.lower(), staging_buffer.data(), size);
-            block->Upload(block->Offset(interval.lower()), size, staging_buffer.data());
+            staging_buffer.resize(interval_size);
+            cpu_memory.ReadBlockUnsafe(interval.lower(), staging_buffer.data(), interval_size);
+            block->Upload(block->Offset(interval.lower()), interval_size, staging_buffer.data());
+            uploaded += interval_size;
+        }
+        Common::AddPerfCounter(Common::PerfCounter::BufferUploadBytes, uploaded);
+        if (const u64 total = end - start; uploaded < total) {
+            Common::AddPerfCounter(Common::PerfCounter::BufferUploadSkippedBytes,
+                                   total - uploaded);
         }
+        resident_ranges.add(base_interval);
     }
 
     VectorMapInterval GetMapsInRange(VAddr addr, std::size_t size) {
@@ -421,24 +606,19 @@ private:
         const auto it = blocks.find(map->start >> BLOCK_PAGE_BITS);
         ASSERT_OR_EXECUTE(it != blocks.end(), return;);
 
-        std::shared_ptr<Buffer> block = it->second;
-
-        const std::size_t size = map->end - map->start;
-        staging_buffer.resize(size);
-        block->Download(block->Offset(map->start), size, staging_buffer.data());
-        cpu_memory.WriteBlockUnsafe(map->start, staging_buffer.data(), size);
-        map->MarkAsModified(false, 0);
+        FlushMaps(*it->second, VectorMapInterval{map});
     }
 
-    template <typename Callable>
-    BufferInfo StreamBufferUpload(std::size_t size, std::size_t alignment, Callable&& callable) {
-        AlignBuffer(alignment);
-        const std::size_t uploaded_offset = buffer_offset;
-        callable(buffer_ptr);
-
-        buffer_ptr += size;
-        buffer_offset += size;
-        return BufferInfo{stream_buffer.Handle(), uploaded_offset, stream_buffer.Address()};
+    /// Writes a run of contiguous maps inside one block back to memory with a single download.
+    void FlushMaps(Buffer& block, const VectorMapInterval& maps) {
+        const VAddr start = maps.front()->start;
+        const std::size_t size = maps.back()->end - start;
+        staging_buffer.resize(size);
+        block.Download(block.Offset(start), size, staging_buffer.data());
+        cpu_memory.WriteBlockUnsafe(start, staging_buffer.data(), size);
+        for (MapInterval* map : maps) {
+            map->MarkAsModified(false, 0);
+        }
     }
 
     void AlignBuffer(std::size_t alignment) {
@@ -522,6 +702,7 @@ private:
             if (const auto [it, inserted] = written_pages.emplace(page_start, 1); !inserted) {
                 ++it->second;
             }
+            written_words[page_start / PAGES_PER_WORD] |= u64{1} << (page_start % PAGES_PER_WORD);
         }
     }
 
@@ -534,15 +715,37 @@ private:
                     --it->second;
                 } else {
                     written_pages.erase(it);
+                    const auto word_it = written_words.find(page_start / PAGES_PER_WORD);
+                    if (word_it != written_words.end()) {
+                        word_it->second &= ~(u64{1} << (page_start % PAGES_PER_WORD));
+                        if (word_it->second == 0) {
+                            written_words.erase(word_it);
+                        }
+                    }
                 }
             }
         }
     }
 
     bool IsRegionWritten(VAddr start, VAddr end) const {
+        // Probe one bitmap word per 64 pages instead of one hash lookup per page; this runs on
+        // every small upload, so it has to reject unwritten ranges as cheaply as possible.
+        const u64 page_start = start >> WRITE_PAGE_BIT;
         const u64 page_end = end >> WRITE_PAGE_BIT;
-        for (u64 page_start = start >> WRITE_PAGE_BIT; page_start <= page_end; ++page_start) {
-            if (written_pages.contains(page_start)) {
+        for (u64 word_index = page_start / PAGES_PER_WORD; word_index <= page_end / PAGES_PER_WORD;
+             ++word_index) {
+            const auto it = written_words.find(word_index);
+            if (it == written_words.end()) {
+                continue;
+            }
+            u64 mask = ~u64{0};
+            if (word_index == page_start / PAGES_PER_WORD) {
+                mask &= mask << (page_start % PAGES_PER_WORD);
+            }
+            if (word_index == page_end / PAGES_PER_WORD) {
+                mask &= mask >> (PAGES_PER_WORD - 1 - page_end % PAGES_PER_WORD);
+            }
+            if ((it->second & mask) != 0) {
                 return true;
             }
         }
@@ -552,6 +755,8 @@ private:
     void QueueDestruction(std::shared_ptr<Buffer> buffer) {
         buffer->SetEpoch(epoch);
         pending_destruction.push(std::move(buffer));
+        // Predicted bindings may hold the replaced block's handle and offsets
+        ++prediction_epoch;
     }
 
     void MarkForAsyncFlush(MapInterval* map) {
@@ -574,13 +779,25 @@ private:
     boost::intrusive::set<MapInterval, boost::intrusive::compare<MapIntervalCompare>>
         mapped_addresses;
 
+    /// Byte ranges whose contents are valid on their block and still tracked for guest writes.
+    /// Ranges fall out of the set when their map stops being tracked, and never-bound gaps
+    /// between merged maps never enter it until a binding covers them.
+    IntervalSet resident_ranges;
+
     std::unordered_map<u64, u32> written_pages;
+    /// Word-granular bitmap over written_pages, probed on the upload path.
+    std::unordered_map<u64, u64> written_words;
     std::unordered_map<u64, std::shared_ptr<Buffer>> blocks;
 
     std::queue<std::shared_ptr<Buffer>> pending_destruction;
     u64 epoch = 0;
     u64 modified_ticks = 0;
 
+    /// Direct-mapped table of the last resolved bindings, indexed by GPU address
+    std::array<BindingPrediction, NUM_PREDICTION_ENTRIES> binding_predictions{};
+    /// Bumped whenever map residency or block handles change, invalidating all predictions
+    u64 prediction_epoch = 1;
+
     std::vector<u8> staging_buffer;
 
     std::list<MapInterval*> marked_for_unregister;
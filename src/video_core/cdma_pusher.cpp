@@ -18,7 +18,9 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //
 
+#include <algorithm>
 #include <bit>
+#include "common/cityhash.h"
 #include "command_classes/host1x.h"
 #include "command_classes/nvdec.h"
 #include "command_classes/vic.h"
@@ -48,24 +50,69 @@ void CDmaPusher::DispatchCalls() {
 }
 
 void CDmaPusher::Step() {
-    const auto entries{cdma_queue.front()};
+    const ChCommandHeaderList entries{std::move(cdma_queue.front())};
     cdma_queue.pop();
+    if (entries.empty()) {
+        return;
+    }
+
+    // Parsing only depends on the header words and the parser state, never on what the commands
+    // do, so identical submissions starting from the same state decode to the same method writes
+    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(entries.data()),
+                                        entries.size() * sizeof(u32));
+    const auto it = parsed_cache.find(hash);
+    if (it != parsed_cache.end() && it->second.num_words == entries.size() &&
+        it->second.initial_state == GetState()) {
+        ExecuteParsed(it->second.commands);
+        SetState(it->second.final_state);
+        return;
+    }
 
-    std::vector<u32> values(entries.size());
-    std::memcpy(values.data(), entries.data(), entries.size() * sizeof(u32));
+    const PusherState initial_state = GetState();
+    std::vector<ParsedCommand> commands = ParseEntries(entries);
+    // Executing restates current_class per command, so capture the parser state first
+    const PusherState final_state = GetState();
+    ExecuteParsed(commands);
+    SetState(final_state);
+
+    if (parsed_cache.size() >= PARSED_CACHE_LIMIT) {
+        parsed_cache.clear();
+    }
+    parsed_cache.insert_or_assign(hash, ParsedSubmission{
+                                            .initial_state = initial_state,
+                                            .final_state = final_state,
+                                            .num_words = entries.size(),
+                                            .commands = std::move(commands),
+                                        });
+}
 
-    for (const u32 value : values) {
+std::vector<ParsedCommand> CDmaPusher::ParseEntries(const ChCommandHeaderList& entries) {
+    std::vector<ParsedCommand> commands;
+    commands.reserve(entries.size());
+
+    const std::size_t num_words = entries.size();
+    std::size_t index = 0;
+    while (index < num_words) {
+        const u32 value = entries[index].raw;
         if (mask != 0) {
             const auto lbs = static_cast<u32>(std::countr_zero(mask));
             mask &= ~(1U << lbs);
-            ExecuteCommand(static_cast<u32>(offset + lbs), value);
+            commands.push_back({current_class, static_cast<u32>(offset + lbs), value});
+            ++index;
             continue;
-        } else if (count != 0) {
-            --count;
-            ExecuteCommand(static_cast<u32>(offset), value);
-            if (incrementing) {
-                ++offset;
+        }
+        if (count != 0) {
+            // Decode the whole method-payload run without re-entering the mode state machine
+            const std::size_t run = std::min(static_cast<std::size_t>(count), num_words - index);
+            for (std::size_t i = 0; i < run; ++i) {
+                commands.push_back({current_class, static_cast<u32>(offset),
+                                    entries[index + i].raw});
+                if (incrementing) {
+                    ++offset;
+                }
             }
+            count -= static_cast<s32>(run);
+            index += run;
             continue;
         }
         const auto mode = static_cast<ChSubmissionMode>((value >> 28) & 0xf);
@@ -89,13 +136,22 @@ void CDmaPusher::Step() {
         case ChSubmissionMode::Immediate: {
             const u32 data = value & 0xfff;
             offset = (value >> 16) & 0xfff;
-            ExecuteCommand(static_cast<u32>(offset), data);
+            commands.push_back({current_class, static_cast<u32>(offset), data});
             break;
         }
         default:
             UNIMPLEMENTED_MSG("ChSubmission mode {} is not implemented!", static_cast<u32>(mode));
             break;
         }
+        ++index;
+    }
+    return commands;
+}
+
+void CDmaPusher::ExecuteParsed(const std::vector<ParsedCommand>& commands) {
+    for (const ParsedCommand& command : commands) {
+        current_class = command.class_id;
+        ExecuteCommand(command.offset, command.data);
     }
 }
 
@@ -71,6 +71,13 @@ struct ChCommand {
 using ChCommandHeaderList = std::vector<ChCommandHeader>;
 using ChCommandList = std::vector<ChCommand>;
 
+/// One method write with the submission state machine already resolved
+struct ParsedCommand {
+    ChClassId class_id{};
+    u32 offset{};
+    u32 data{};
+};
+
 struct ThiRegisters {
     u32_le increment_syncpt{};
     INSERT_PADDING_WORDS(1);
@@ -112,9 +119,49 @@ public:
     void ExecuteCommand(u32 state_offset, u32 data);
 
 private:
+    /// Submission parser state, carried across submissions
+    struct PusherState {
+        s32 count{};
+        s32 offset{};
+        u32 mask{};
+        bool incrementing{};
+        ChClassId class_id{};
+
+        bool operator==(const PusherState&) const = default;
+    };
+
+    /// Decoded submission kept for replay when an identical list is pushed again
+    struct ParsedSubmission {
+        PusherState initial_state;
+        PusherState final_state;
+        std::size_t num_words{};
+        std::vector<ParsedCommand> commands;
+    };
+
+    /// Maximum number of cached submissions before the cache is dropped wholesale
+    static constexpr std::size_t PARSED_CACHE_LIMIT = 128;
+
     /// Write arguments value to the ThiRegisters member at the specified offset
     void ThiStateWrite(ThiRegisters& state, u32 state_offset, const std::vector<u32>& arguments);
 
+    /// Decodes a whole submission into method writes, advancing the parser state
+    std::vector<ParsedCommand> ParseEntries(const ChCommandHeaderList& entries);
+
+    /// Executes previously parsed method writes in order
+    void ExecuteParsed(const std::vector<ParsedCommand>& commands);
+
+    PusherState GetState() const {
+        return PusherState{count, offset, mask, incrementing, current_class};
+    }
+
+    void SetState(const PusherState& state) {
+        count = state.count;
+        offset = state.offset;
+        mask = state.mask;
+        incrementing = state.incrementing;
+        current_class = state.class_id;
+    }
+
     GPU& gpu;
     std::shared_ptr<Tegra::Nvdec> nvdec_processor;
     std::unique_ptr<Tegra::Vic> vic_processor;
@@ -131,6 +178,10 @@ private:
 
     // Queue of command lists to be processed
     std::queue<ChCommandHeaderList> cdma_queue;
+
+    // Parsed submissions keyed by a hash of their raw words; video playback pushes
+    // near-identical lists every frame
+    std::unordered_map<u64, ParsedSubmission> parsed_cache;
 };
 
 } // namespace Tegra
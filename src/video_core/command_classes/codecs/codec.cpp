@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <cstring>
 #include <fstream>
 #include <vector>
@@ -13,10 +14,28 @@
 #include "video_core/memory_manager.h"
 
 extern "C" {
+#include <libavutil/hwcontext.h>
 #include <libavutil/opt.h>
 }
 
 namespace Tegra {
+namespace {
+
+constexpr AVPixelFormat PREFERRED_CPU_FORMAT = AV_PIX_FMT_YUV420P;
+
+AVPixelFormat GetGpuFormat(AVCodecContext* av_codec_ctx, const AVPixelFormat* pix_fmts) {
+    for (const AVPixelFormat* p = pix_fmts; *p != AV_PIX_FMT_NONE; ++p) {
+        if (*p == av_codec_ctx->pix_fmt) {
+            return *p;
+        }
+    }
+    LOG_INFO(Service_NVDRV, "Could not find compatible GPU AV format, falling back to CPU");
+    av_buffer_unref(&av_codec_ctx->hw_device_ctx);
+    av_codec_ctx->pix_fmt = PREFERRED_CPU_FORMAT;
+    return PREFERRED_CPU_FORMAT;
+}
+
+} // Anonymous namespace
 
 void AVFrameDeleter(AVFrame* ptr) {
     av_frame_unref(ptr);
@@ -41,6 +60,47 @@ Codec::~Codec() {
     av_frame_unref(av_frame);
     av_free(av_frame);
     avcodec_close(av_codec_ctx);
+    av_buffer_unref(&av_gpu_decoder);
+}
+
+bool Codec::CreateGpuAvDevice() {
+    static constexpr auto HW_CONFIG_METHOD = AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX;
+    static constexpr std::array PREFERRED_GPU_DECODERS = {
+        AV_HWDEVICE_TYPE_CUDA,
+#ifdef _WIN32
+        AV_HWDEVICE_TYPE_D3D11VA,
+        AV_HWDEVICE_TYPE_DXVA2,
+#else
+        AV_HWDEVICE_TYPE_VAAPI,
+        AV_HWDEVICE_TYPE_VDPAU,
+#endif
+    };
+    for (const auto device_type : PREFERRED_GPU_DECODERS) {
+        const int hwdevice_res =
+            av_hwdevice_ctx_create(&av_gpu_decoder, device_type, nullptr, nullptr, 0);
+        if (hwdevice_res < 0) {
+            LOG_DEBUG(Service_NVDRV, "{} av_hwdevice_ctx_create failed {}",
+                      av_hwdevice_get_type_name(device_type), hwdevice_res);
+            continue;
+        }
+        for (int i = 0;; ++i) {
+            const AVCodecHWConfig* const config = avcodec_get_hw_config(av_codec, i);
+            if (!config) {
+                LOG_DEBUG(Service_NVDRV, "{} decoder does not support device type {}",
+                          av_codec->name, av_hwdevice_get_type_name(device_type));
+                break;
+            }
+            if ((config->methods & HW_CONFIG_METHOD) != 0 &&
+                config->device_type == device_type) {
+                av_codec_ctx->pix_fmt = config->pix_fmt;
+                LOG_INFO(Service_NVDRV, "Using {} GPU decoder",
+                         av_hwdevice_get_type_name(device_type));
+                return true;
+            }
+        }
+        av_buffer_unref(&av_gpu_decoder);
+    }
+    return false;
 }
 
 void Codec::SetTargetCodec(NvdecCommon::VideoCodec codec) {
@@ -69,7 +129,16 @@ void Codec::Decode() {
         av_codec_ctx = avcodec_alloc_context3(av_codec);
         av_opt_set(av_codec_ctx->priv_data, "tune", "zerolatency", 0);
 
-        // TODO(ameerj): libavcodec gpu hw acceleration
+        // Decode frames in parallel. Several submissions are in flight at any time, filling
+        // the lookahead queue VIC consumes from and hiding decode latency behind it
+        av_codec_ctx->thread_count = 0;
+        av_codec_ctx->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
+        // Decode on the GPU when a hardware device is available, falling back to the CPU
+        if (CreateGpuAvDevice()) {
+            av_codec_ctx->hw_device_ctx = av_buffer_ref(av_gpu_decoder);
+            av_codec_ctx->get_format = GetGpuFormat;
+        }
 
         const auto av_error = avcodec_open2(av_codec_ctx, av_codec, nullptr);
         if (av_error < 0) {
@@ -80,8 +149,6 @@ void Codec::Decode() {
         initialized = true;
         is_first_frame = true;
     }
-    bool vp9_hidden_frame = false;
-
     AVPacket packet{};
     av_init_packet(&packet);
     std::vector<u8> frame_data;
@@ -90,7 +157,6 @@ void Codec::Decode() {
         frame_data = h264_decoder->ComposeFrameHeader(state, is_first_frame);
     } else if (current_codec == NvdecCommon::VideoCodec::Vp9) {
         frame_data = vp9_decoder->ComposeFrameHeader(state);
-        vp9_hidden_frame = vp9_decoder->WasFrameHidden();
     }
 
     packet.data = frame_data.data();
@@ -98,15 +164,29 @@ void Codec::Decode() {
 
     avcodec_send_packet(av_codec_ctx, &packet);
 
-    if (!vp9_hidden_frame) {
-        // Only receive/store visible frames
+    // Pull every frame the decoder has finished. Hidden VP9 frames produce no output, and with
+    // frame threading the decoder lags a few submissions behind, keeping the queue as lookahead
+    while (true) {
         AVFramePtr frame = AVFramePtr{av_frame_alloc(), AVFrameDeleter};
-        avcodec_receive_frame(av_codec_ctx, frame.get());
-        av_frames.push(std::move(frame));
-        // Limit queue to 10 frames. Workaround for ZLA decode and queue spam
-        if (av_frames.size() > 10) {
-            av_frames.pop();
+        if (avcodec_receive_frame(av_codec_ctx, frame.get()) != 0) {
+            break;
+        }
+        if (frame->hw_frames_ctx != nullptr) {
+            // The frame lives in GPU memory, transfer it to a software frame for VIC to consume
+            AVFramePtr sw_frame{av_frame_alloc(), AVFrameDeleter};
+            if (av_hwframe_transfer_data(sw_frame.get(), frame.get(), 0) < 0) {
+                LOG_ERROR(Service_NVDRV, "av_hwframe_transfer_data failed");
+                continue;
+            }
+            sw_frame->width = frame->width;
+            sw_frame->height = frame->height;
+            frame = std::move(sw_frame);
         }
+        av_frames.push(std::move(frame));
+    }
+    // Limit queue to 10 frames. Workaround for ZLA decode and queue spam
+    while (av_frames.size() > 10) {
+        av_frames.pop();
     }
 }
 
@@ -53,11 +53,15 @@ public:
     [[nodiscard]] NvdecCommon::VideoCodec GetCurrentCodec() const;
 
 private:
+    /// Attempts to create a GPU decoding device for the current codec, returns true on success
+    bool CreateGpuAvDevice();
+
     bool initialized{};
     NvdecCommon::VideoCodec current_codec{NvdecCommon::VideoCodec::None};
 
     AVCodec* av_codec{nullptr};
     AVCodecContext* av_codec_ctx{nullptr};
+    AVBufferRef* av_gpu_decoder{nullptr};
 
     GPU& gpu;
     std::unique_ptr<Decoder::H264> h264_decoder;
@@ -18,7 +18,6 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //
 
-#include <algorithm>
 #include "sync_manager.h"
 #include "video_core/gpu.h"
 
@@ -33,28 +32,27 @@ void SyncptIncrManager::Increment(u32 id) {
 
 u32 SyncptIncrManager::IncrementWhenDone(u32 class_id, u32 id) {
     const u32 handle = current_id++;
+    handle_indices.emplace(handle, base_index + increments.size());
     increments.emplace_back(handle, class_id, id);
     return handle;
 }
 
 void SyncptIncrManager::SignalDone(u32 handle) {
-    const auto done_incr =
-        std::find_if(increments.begin(), increments.end(),
-                     [handle](const SyncptIncr& incr) { return incr.id == handle; });
-    if (done_incr != increments.cend()) {
-        done_incr->complete = true;
+    const auto it = handle_indices.find(handle);
+    if (it != handle_indices.end()) {
+        increments[static_cast<std::size_t>(it->second - base_index)].complete = true;
+        handle_indices.erase(it);
     }
     IncrementAllDone();
 }
 
 void SyncptIncrManager::IncrementAllDone() {
-    std::size_t done_count = 0;
-    for (; done_count < increments.size(); ++done_count) {
-        if (!increments[done_count].complete) {
-            break;
-        }
-        gpu.IncrementSyncPoint(increments[done_count].syncpt_id);
+    // Pop the completed prefix in one batch; increments behind an outstanding one stay queued
+    // to preserve submission order
+    while (!increments.empty() && increments.front().complete) {
+        gpu.IncrementSyncPoint(increments.front().syncpt_id);
+        increments.pop_front();
+        ++base_index;
     }
-    increments.erase(increments.begin(), increments.begin() + done_count);
 }
 } // namespace Tegra
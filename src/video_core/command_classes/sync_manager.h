@@ -20,8 +20,9 @@
 
 #pragma once
 
+#include <deque>
 #include <mutex>
-#include <vector>
+#include <unordered_map>
 #include "common/common_types.h"
 
 namespace Tegra {
@@ -54,7 +55,13 @@ public:
     void IncrementAllDone();
 
 private:
-    std::vector<SyncptIncr> increments;
+    /// Pending increments in submission order. Handles are looked up through handle_indices
+    /// instead of scanning, so completion marking is O(1).
+    std::deque<SyncptIncr> increments;
+    /// Absolute index of the front of the ring, bumped when completed increments are popped
+    u64 base_index{};
+    /// Maps an outstanding handle to the absolute ring index of its increment
+    std::unordered_map<u32, u64> handle_indices;
     std::mutex increment_lock;
     u32 current_id{};
 
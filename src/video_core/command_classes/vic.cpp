@@ -3,12 +3,16 @@
 // Refer to the license.txt file included.
 
 #include <array>
+#include <span>
 #include "common/assert.h"
 #include "video_core/command_classes/nvdec.h"
 #include "video_core/command_classes/vic.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/gpu.h"
 #include "video_core/memory_manager.h"
+#include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_base.h"
+#include "video_core/texture_cache/image_info.h"
 #include "video_core/textures/decoders.h"
 
 extern "C" {
@@ -71,20 +75,21 @@ void Vic::Execute() {
         LOG_TRACE(Service_NVDRV, "Writing RGB Frame");
 
         if (scaler_ctx == nullptr || frame->width != scaler_width ||
-            frame->height != scaler_height) {
+            frame->height != scaler_height || frame->format != scaler_format) {
             const AVPixelFormat target_format =
                 (pixel_format == VideoPixelFormat::RGBA8) ? AV_PIX_FMT_RGBA : AV_PIX_FMT_BGRA;
 
             sws_freeContext(scaler_ctx);
             scaler_ctx = nullptr;
 
-            // FFmpeg returns all frames in YUV420, convert it into expected format
-            scaler_ctx =
-                sws_getContext(frame->width, frame->height, AV_PIX_FMT_YUV420P, frame->width,
-                               frame->height, target_format, 0, nullptr, nullptr, nullptr);
+            // Frames are decoded as YUV420 or NV12, convert them into the expected format
+            scaler_ctx = sws_getContext(frame->width, frame->height,
+                                        static_cast<AVPixelFormat>(frame->format), frame->width,
+                                        frame->height, target_format, 0, nullptr, nullptr, nullptr);
 
             scaler_width = frame->width;
             scaler_height = frame->height;
+            scaler_format = frame->format;
         }
         // Get Converted frame
         const std::size_t linear_size = frame->width * frame->height * 4;
@@ -98,6 +103,15 @@ void Vic::Execute() {
         sws_scale(scaler_ctx, frame->data, frame->linesize, 0, frame->height,
                   &converted_frame_buf_addr, &converted_stride);
 
+        // Hand the converted frame directly to the texture cache, skipping the CPU swizzle,
+        // the guest memory write and the later re-upload when the rasterizer accepts it
+        const VideoCommon::ImageInfo image_info(config, frame->width, frame->height);
+        const std::span<const u8> frame_span{converted_frame_buf_addr, linear_size};
+        if (gpu.Renderer().Rasterizer().AccelerateVideoFrame(image_info, output_surface_luma_address,
+                                                             frame_span)) {
+            break;
+        }
+
         const u32 blk_kind = static_cast<u32>(config.block_linear_kind);
         if (blk_kind != 0) {
             // swizzle pitch linear to block linear
@@ -151,14 +165,24 @@ void Vic::Execute() {
         gpu.MemoryManager().WriteBlock(output_surface_luma_address, luma_buffer.data(),
                                        luma_buffer.size());
 
-        // Populate chroma buffer from both channels with interleaving.
-        for (std::size_t y = 0; y < half_height; ++y) {
-            std::size_t src = y * half_stride;
-            std::size_t dst = y * aligned_width;
-
-            for (std::size_t x = 0; x < half_width; ++x) {
-                chroma_buffer[dst + x * 2] = chroma_b_ptr[src + x];
-                chroma_buffer[dst + x * 2 + 1] = chroma_r_ptr[src + x];
+        if (frame->format == AV_PIX_FMT_NV12) {
+            // GPU decoded frames are transferred back as NV12, with the chroma channels
+            // already interleaved
+            for (std::size_t y = 0; y < half_height; ++y) {
+                const std::size_t src = y * half_stride;
+                const std::size_t dst = y * aligned_width;
+                std::memcpy(chroma_buffer.data() + dst, chroma_b_ptr + src, surface_width);
+            }
+        } else {
+            // Populate chroma buffer from both channels with interleaving.
+            for (std::size_t y = 0; y < half_height; ++y) {
+                const std::size_t src = y * half_stride;
+                const std::size_t dst = y * aligned_width;
+
+                for (std::size_t x = 0; x < half_width; ++x) {
+                    chroma_buffer[dst + x * 2] = chroma_b_ptr[src + x];
+                    chroma_buffer[dst + x * 2 + 1] = chroma_r_ptr[src + x];
+                }
             }
         }
         gpu.MemoryManager().WriteBlock(output_surface_chroma_u_address, chroma_buffer.data(),
@@ -21,6 +21,25 @@ struct PlaneOffsets {
     u32 chroma_v_offset{};
 };
 
+enum class VideoPixelFormat : u64_le {
+    RGBA8 = 0x1f,
+    BGRA8 = 0x20,
+    Yuv420 = 0x44,
+};
+
+union VicConfig {
+    u64_le raw{};
+    BitField<0, 7, u64_le> pixel_format;
+    BitField<7, 2, u64_le> chroma_loc_horiz;
+    BitField<9, 2, u64_le> chroma_loc_vert;
+    BitField<11, 4, u64_le> block_linear_kind;
+    BitField<15, 4, u64_le> block_linear_height_log2;
+    BitField<19, 3, u64_le> reserved0;
+    BitField<22, 10, u64_le> reserved1;
+    BitField<32, 14, u64_le> surface_width_minus1;
+    BitField<46, 14, u64_le> surface_height_minus1;
+};
+
 struct VicRegisters {
     INSERT_PADDING_WORDS(64);
     u32 nop{};
@@ -75,25 +94,6 @@ private:
     void VicStateWrite(u32 offset, u32 arguments);
     VicRegisters vic_state{};
 
-    enum class VideoPixelFormat : u64_le {
-        RGBA8 = 0x1f,
-        BGRA8 = 0x20,
-        Yuv420 = 0x44,
-    };
-
-    union VicConfig {
-        u64_le raw{};
-        BitField<0, 7, u64_le> pixel_format;
-        BitField<7, 2, u64_le> chroma_loc_horiz;
-        BitField<9, 2, u64_le> chroma_loc_vert;
-        BitField<11, 4, u64_le> block_linear_kind;
-        BitField<15, 4, u64_le> block_linear_height_log2;
-        BitField<19, 3, u64_le> reserved0;
-        BitField<22, 10, u64_le> reserved1;
-        BitField<32, 14, u64_le> surface_width_minus1;
-        BitField<46, 14, u64_le> surface_height_minus1;
-    };
-
     GPU& gpu;
     std::shared_ptr<Tegra::Nvdec> nvdec_processor;
 
@@ -105,6 +105,7 @@ private:
     SwsContext* scaler_ctx{};
     s32 scaler_width{};
     s32 scaler_height{};
+    s32 scaler_format{};
 };
 
 } // namespace Tegra
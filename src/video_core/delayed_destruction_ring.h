@@ -4,20 +4,40 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <iterator>
 #include <utility>
 #include <vector>
 
 namespace VideoCommon {
 
 /// Container to push objects to be destroyed a few ticks in the future
+///
+/// Destruction is amortized: expired objects are moved to a pending queue and freed in budgeted
+/// batches, so an eviction burst (e.g. a scene change retiring thousands of images) spreads its
+/// teardown cost over the following ticks instead of landing on a single frame.
 template <typename T, size_t TICKS_TO_DESTROY>
 class DelayedDestructionRing {
 public:
     void Tick() {
         index = (index + 1) % TICKS_TO_DESTROY;
-        elements[index].clear();
+
+        auto& expired = elements[index];
+        if (!expired.empty()) {
+            pending.insert(pending.end(), std::make_move_iterator(expired.begin()),
+                           std::make_move_iterator(expired.end()));
+            expired.clear();
+        }
+        if (pending.empty()) {
+            return;
+        }
+        // Free a fixed minimum plus a fraction of the backlog, keeping the pending queue bounded
+        // to a small multiple of the per-tick arrival rate under sustained churn.
+        const size_t count =
+            std::min(pending.size(), std::max(BATCH_SIZE, pending.size() / TICKS_TO_DESTROY));
+        pending.erase(pending.begin(), pending.begin() + static_cast<ptrdiff_t>(count));
     }
 
     void Push(T&& object) {
@@ -25,8 +45,11 @@ public:
     }
 
 private:
+    static constexpr size_t BATCH_SIZE = 64;
+
     size_t index = 0;
     std::array<std::vector<T>, TICKS_TO_DESTROY> elements;
+    std::vector<T> pending;
 };
 
 } // namespace VideoCommon
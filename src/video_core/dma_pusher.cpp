@@ -65,6 +65,19 @@ bool DmaPusher::Step() {
         const CommandListHeader command_list_header{
             command_list.command_lists[dma_pushbuffer_subindex++]};
         const GPUVAddr dma_get = command_list_header.addr;
+        u64 fetch_size = command_list_header.size;
+
+        // Batch the following entries into the same fetch while their payloads are contiguous
+        // in GPU memory, so one read covers several GPFIFO entries
+        while (dma_pushbuffer_subindex < command_list.command_lists.size()) {
+            const CommandListHeader next_header{
+                command_list.command_lists[dma_pushbuffer_subindex]};
+            if (next_header.addr != dma_get + fetch_size * sizeof(u32)) {
+                break;
+            }
+            fetch_size += next_header.size;
+            ++dma_pushbuffer_subindex;
+        }
 
         if (dma_pushbuffer_subindex >= command_list.command_lists.size()) {
             // We've gone through the current list, remove it from the queue
@@ -72,14 +85,14 @@ bool DmaPusher::Step() {
             dma_pushbuffer_subindex = 0;
         }
 
-        if (command_list_header.size == 0) {
+        if (fetch_size == 0) {
             return true;
         }
 
         // Push buffer non-empty, read a word
-        command_headers.resize(command_list_header.size);
+        command_headers.resize(fetch_size);
         gpu.MemoryManager().ReadBlockUnsafe(dma_get, command_headers.data(),
-                                            command_list_header.size * sizeof(u32));
+                                            fetch_size * sizeof(u32));
     }
     for (std::size_t index = 0; index < command_headers.size();) {
         const CommandHeader& command_header = command_headers[index];
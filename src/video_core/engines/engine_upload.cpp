@@ -27,9 +27,22 @@ void State::ProcessData(const u32 data, const bool is_last_call) {
     const u32 sub_copy_size = std::min(4U, copy_size - write_offset);
     std::memcpy(&inner_buffer[write_offset], &data, sub_copy_size);
     write_offset += sub_copy_size;
-    if (!is_last_call) {
-        return;
+    if (is_last_call) {
+        Finish();
     }
+}
+
+void State::ProcessData(const u32* data, const std::size_t num_data, const bool is_last_call) {
+    const std::size_t sub_copy_size =
+        std::min(num_data * sizeof(u32), static_cast<std::size_t>(copy_size - write_offset));
+    std::memcpy(&inner_buffer[write_offset], data, sub_copy_size);
+    write_offset += static_cast<u32>(sub_copy_size);
+    if (is_last_call) {
+        Finish();
+    }
+}
+
+void State::Finish() {
     const GPUVAddr address{regs.dest.Address()};
     if (is_linear) {
         memory_manager.WriteBlock(address, inner_buffer.data(), copy_size);
@@ -41,7 +54,12 @@ void State::ProcessData(const u32 data, const bool is_last_call) {
         const std::size_t dst_size = Tegra::Texture::CalculateSize(
             true, 1, regs.dest.width, regs.dest.height, 1, regs.dest.BlockHeight(), 0);
         tmp_buffer.resize(dst_size);
-        memory_manager.ReadBlock(address, tmp_buffer.data(), dst_size);
+        // A copy starting at the origin with as many bytes as the swizzled destination writes
+        // every byte of it, so the read-modify-write cycle (and the host cache flush that comes
+        // with reading the destination) is only needed for partial updates.
+        if (regs.dest.x != 0 || regs.dest.y != 0 || copy_size != dst_size) {
+            memory_manager.ReadBlock(address, tmp_buffer.data(), dst_size);
+        }
         Tegra::Texture::SwizzleKepler(regs.dest.width, regs.dest.height, regs.dest.x, regs.dest.y,
                                       regs.dest.BlockHeight(), copy_size, inner_buffer.data(),
                                       tmp_buffer.data());
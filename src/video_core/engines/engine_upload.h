@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include "common/bit_field.h"
 #include "common/common_types.h"
@@ -59,8 +60,12 @@ public:
 
     void ProcessExec(bool is_linear_);
     void ProcessData(u32 data, bool is_last_call);
+    void ProcessData(const u32* data, std::size_t num_data, bool is_last_call);
 
 private:
+    /// Writes the staged upload to its destination
+    void Finish();
+
     u32 write_offset = 0;
     u32 copy_size = 0;
     std::vector<u8> inner_buffer;
@@ -121,6 +121,31 @@ void Maxwell3D::InitializeRegisterDefaults() {
     mme_inline[MAXWELL3D_REG_INDEX(draw.vertex_begin_gl)] = true;
     mme_inline[MAXWELL3D_REG_INDEX(vertex_buffer.count)] = true;
     mme_inline[MAXWELL3D_REG_INDEX(index_array.count)] = true;
+
+    // Mark the methods handled by ProcessMethodCall, so plain register writes can skip it
+    trigger_methods[MAXWELL3D_REG_INDEX(wait_for_idle)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(shadow_ram_control)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(macros.data)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(macros.bind)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(firmware[4])] = true;
+    for (size_t i = 0; i < Regs::NumCBData; ++i) {
+        trigger_methods[MAXWELL3D_REG_INDEX(const_buffer.cb_data) + i] = true;
+    }
+    trigger_methods[MAXWELL3D_REG_INDEX(cb_bind[0])] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(cb_bind[1])] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(cb_bind[2])] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(cb_bind[3])] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(cb_bind[4])] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(draw.vertex_end_gl)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(clear_buffers)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(query.query_get)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(condition.mode)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(counter_reset)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(sync_info)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(exec_upload)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(data_upload)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(fragment_barrier)] = true;
+    trigger_methods[MAXWELL3D_REG_INDEX(tiled_cache_barrier)] = true;
 }
 
 void Maxwell3D::ProcessMacro(u32 method, const u32* base_start, u32 amount, bool is_last_call) {
@@ -275,7 +300,9 @@ void Maxwell3D::CallMethod(u32 method, u32 method_argument, bool is_last_call) {
 
     const u32 argument = ProcessShadowRam(method, method_argument);
     ProcessDirtyRegisters(method, argument);
-    ProcessMethodCall(method, argument, method_argument, is_last_call);
+    if (trigger_methods[method]) {
+        ProcessMethodCall(method, argument, method_argument, is_last_call);
+    }
 }
 
 void Maxwell3D::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
@@ -305,12 +332,33 @@ void Maxwell3D::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
     case MAXWELL3D_REG_INDEX(const_buffer.cb_data) + 15:
         ProcessCBMultiData(method, base_start, amount);
         break;
-    default:
+    case MAXWELL3D_REG_INDEX(data_upload): {
+        const bool is_last_call = methods_pending <= amount;
+        upload_state.ProcessData(base_start, amount, is_last_call);
+        if (is_last_call) {
+            OnMemoryWrite();
+        }
+        break;
+    }
+    default: {
+        ASSERT_MSG(method < Regs::NUM_REGS,
+                   "Invalid Maxwell3D register, increase the size of the Regs structure");
+        if (!trigger_methods[method] && executing_macro == 0) {
+            if (cb_data_state.current != null_cb_data) {
+                FinishCBData();
+            }
+            // A non-incrementing burst writes the same plain register over and over, so only
+            // the last write is observable
+            const u32 argument = ProcessShadowRam(method, base_start[amount - 1]);
+            ProcessDirtyRegisters(method, argument);
+            break;
+        }
         for (std::size_t i = 0; i < amount; i++) {
             CallMethod(method, base_start[i], methods_pending - static_cast<u32>(i) <= 1);
         }
         break;
     }
+    }
 }
 
 void Maxwell3D::StepInstance(const MMEDrawMode expected_mode, const u32 count) {
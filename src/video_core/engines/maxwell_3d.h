@@ -1562,6 +1562,9 @@ private:
 
     std::array<bool, Regs::NUM_REGS> mme_inline{};
 
+    /// Methods that need a handler to run besides the register write
+    std::array<bool, Regs::NUM_REGS> trigger_methods{};
+
     /// Macro method that is currently being executed / being fed parameters.
     u32 executing_macro = 0;
     /// Parameters that have been submitted to the macro call so far.
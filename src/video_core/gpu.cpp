@@ -22,6 +22,7 @@
 #include "video_core/memory_manager.h"
 #include "video_core/renderer_base.h"
 #include "video_core/shader_notify.h"
+#include "video_core/trace_recorder.h"
 #include "video_core/video_core.h"
 
 namespace Tegra {
@@ -37,7 +38,8 @@ GPU::GPU(Core::System& system_, bool is_async_, bool use_nvdec_)
       kepler_compute{std::make_unique<Engines::KeplerCompute>(system, *memory_manager)},
       maxwell_dma{std::make_unique<Engines::MaxwellDMA>(system, *memory_manager)},
       kepler_memory{std::make_unique<Engines::KeplerMemory>(system, *memory_manager)},
-      shader_notify{std::make_unique<VideoCore::ShaderNotify>()}, is_async{is_async_},
+      shader_notify{std::make_unique<VideoCore::ShaderNotify>()},
+      trace_recorder{TraceRecorder::CreateFromEnvironment()}, is_async{is_async_},
       gpu_thread{system_, is_async_} {}
 
 GPU::~GPU() = default;
@@ -50,6 +52,7 @@ void GPU::BindRenderer(std::unique_ptr<VideoCore::RendererBase> renderer_) {
     maxwell_3d->BindRasterizer(rasterizer);
     fermi_2d->BindRasterizer(rasterizer);
     kepler_compute->BindRasterizer(rasterizer);
+    maxwell_dma->BindRasterizer(rasterizer);
 }
 
 Engines::Maxwell3D& GPU::Maxwell3D() {
@@ -103,23 +106,32 @@ void GPU::WaitFence(u32 syncpoint_id, u32 value) {
         return;
     }
     MICROPROFILE_SCOPE(GPU_wait);
-    std::unique_lock lock{sync_mutex};
-    sync_cv.wait(lock, [=, this] { return syncpoints.at(syncpoint_id).load() >= value; });
+    auto& syncpoint = syncpoints.at(syncpoint_id);
+    std::unique_lock lock{syncpoint.mutex};
+    syncpoint.num_waiters++;
+    syncpoint.cv.wait(lock, [&syncpoint, value] { return syncpoint.value.load() >= value; });
+    syncpoint.num_waiters--;
 }
 
 void GPU::IncrementSyncPoint(const u32 syncpoint_id) {
     auto& syncpoint = syncpoints.at(syncpoint_id);
-    syncpoint++;
-    std::lock_guard lock{sync_mutex};
-    sync_cv.notify_all();
-    auto& interrupt = syncpt_interrupts.at(syncpoint_id);
+    syncpoint.value++;
+    if (syncpoint.num_waiters.load() == 0) {
+        // Fast path: fences increment sync points far more often than anything waits on them.
+        // Waiters re-check the value after publishing themselves, so this cannot lose a wakeup.
+        return;
+    }
+    std::lock_guard lock{syncpoint.mutex};
+    syncpoint.cv.notify_all();
+    auto& interrupt = syncpoint.interrupts;
     if (!interrupt.empty()) {
-        u32 value = syncpoint.load();
+        u32 value = syncpoint.value.load();
         auto it = interrupt.begin();
         while (it != interrupt.end()) {
             if (value >= *it) {
                 TriggerCpuInterrupt(syncpoint_id, *it);
                 it = interrupt.erase(it);
+                syncpoint.num_waiters--;
                 continue;
             }
             it++;
@@ -128,22 +140,32 @@ void GPU::IncrementSyncPoint(const u32 syncpoint_id) {
 }
 
 u32 GPU::GetSyncpointValue(const u32 syncpoint_id) const {
-    return syncpoints.at(syncpoint_id).load();
+    return syncpoints.at(syncpoint_id).value.load();
 }
 
 void GPU::RegisterSyncptInterrupt(const u32 syncpoint_id, const u32 value) {
-    auto& interrupt = syncpt_interrupts.at(syncpoint_id);
+    auto& syncpoint = syncpoints.at(syncpoint_id);
+    auto& interrupt = syncpoint.interrupts;
     bool contains = std::any_of(interrupt.begin(), interrupt.end(),
                                 [value](u32 in_value) { return in_value == value; });
     if (contains) {
         return;
     }
+    syncpoint.num_waiters++;
     interrupt.emplace_back(value);
+    // An increment that raced with this registration may have taken the fast path before the
+    // threshold was published. Re-check so the interrupt is not lost.
+    if (syncpoint.value.load() >= value) {
+        TriggerCpuInterrupt(syncpoint_id, value);
+        interrupt.pop_back();
+        syncpoint.num_waiters--;
+    }
 }
 
 bool GPU::CancelSyncptInterrupt(const u32 syncpoint_id, const u32 value) {
-    std::lock_guard lock{sync_mutex};
-    auto& interrupt = syncpt_interrupts.at(syncpoint_id);
+    auto& syncpoint = syncpoints.at(syncpoint_id);
+    std::lock_guard lock{syncpoint.mutex};
+    auto& interrupt = syncpoint.interrupts;
     const auto iter =
         std::find_if(interrupt.begin(), interrupt.end(),
                      [value](u32 interrupt_value) { return value == interrupt_value; });
@@ -152,6 +174,7 @@ bool GPU::CancelSyncptInterrupt(const u32 syncpoint_id, const u32 value) {
         return false;
     }
     interrupt.erase(iter);
+    syncpoint.num_waiters--;
     return true;
 }
 
@@ -184,7 +207,7 @@ u64 GPU::GetTicks() const {
     constexpr u64 gpu_ticks_den = 625;
 
     u64 nanoseconds = system.CoreTiming().GetGlobalTimeNs().count();
-    if (Settings::values.use_fast_gpu_time.GetValue()) {
+    if (Settings::IsFastGpuTimeEnabled()) {
         nanoseconds /= 256;
     }
     const u64 nanoseconds_num = nanoseconds / gpu_ticks_den;
@@ -474,6 +497,9 @@ void GPU::ReleaseContext() {
 }
 
 void GPU::PushGPUEntries(Tegra::CommandList&& entries) {
+    if (trace_recorder) {
+        trace_recorder->RecordSubmission(*memory_manager, entries);
+    }
     gpu_thread.SubmitList(std::move(entries));
 }
 
@@ -519,7 +545,7 @@ void GPU::TriggerCpuInterrupt(const u32 syncpoint_id, const u32 value) const {
     interrupt_manager.GPUInterruptSyncpt(syncpoint_id, value);
 }
 
-void GPU::WaitIdle() const {
+void GPU::WaitIdle() {
     gpu_thread.WaitIdle();
 }
 
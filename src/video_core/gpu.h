@@ -102,6 +102,7 @@ enum class DepthFormat : u32 {
 
 struct CommandListHeader;
 class DebugContext;
+class TraceRecorder;
 
 namespace Engines {
 class Fermi2D;
@@ -220,7 +221,7 @@ public:
     }
 
     // Waits for the GPU to finish working
-    void WaitIdle() const;
+    void WaitIdle();
 
     /// Allows the CPU/NvFlinger to wait on the GPU before presenting a frame.
     void WaitFence(u32 syncpoint_id, u32 value);
@@ -235,8 +236,8 @@ public:
 
     [[nodiscard]] u64 GetTicks() const;
 
-    [[nodiscard]] std::unique_lock<std::mutex> LockSync() {
-        return std::unique_lock{sync_mutex};
+    [[nodiscard]] std::unique_lock<std::mutex> LockSync(u32 syncpoint_id) {
+        return std::unique_lock{syncpoints.at(syncpoint_id).mutex};
     }
 
     [[nodiscard]] bool IsAsync() const {
@@ -383,16 +384,24 @@ private:
     std::unique_ptr<Engines::KeplerMemory> kepler_memory;
     /// Shader build notifier
     std::unique_ptr<VideoCore::ShaderNotify> shader_notify;
+    /// GPFIFO trace recorder. Only allocated when trace recording is requested
+    std::unique_ptr<Tegra::TraceRecorder> trace_recorder;
+
+    /// Synchronization state is sharded per syncpoint so incrementing one point never contends
+    /// with waiters or interrupt registration on another.
+    struct Syncpoint {
+        std::atomic<u32> value{};
+        /// Number of condition variable waiters plus registered interrupt thresholds. Checked
+        /// lock-free by IncrementSyncPoint to skip notification when nothing is waiting.
+        std::atomic<u32> num_waiters{};
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::list<u32> interrupts;
+    };
+    std::array<Syncpoint, Service::Nvidia::MaxSyncPoints> syncpoints;
 
-    std::array<std::atomic<u32>, Service::Nvidia::MaxSyncPoints> syncpoints{};
-
-    std::array<std::list<u32>, Service::Nvidia::MaxSyncPoints> syncpt_interrupts;
-
-    std::mutex sync_mutex;
     std::mutex device_mutex;
 
-    std::condition_variable sync_cv;
-
     struct FlushRequest {
         explicit FlushRequest(u64 fence_, VAddr addr_, std::size_t size_)
             : fence{fence_}, addr{addr_}, size{size_} {}
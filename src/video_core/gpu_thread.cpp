@@ -3,11 +3,14 @@
 // Refer to the license.txt file included.
 
 #include "common/assert.h"
+#include "common/cpu_topology.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/scope_exit.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/frontend/emu_window.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "video_core/dma_pusher.h"
 #include "video_core/gpu.h"
@@ -26,6 +29,15 @@ static void RunThread(Core::System& system, VideoCore::RendererBase& renderer,
 
     Common::SetCurrentThreadName(name.c_str());
     Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
+    if (Settings::values.use_performance_core_affinity.GetValue()) {
+        const auto& topology = Common::GetCpuTopology();
+        if (topology.is_hybrid) {
+            // The emulation threads leave the last performance CPU free when there are enough to
+            // go around; claim it so the GPU thread never migrates onto an efficiency core
+            const u32 gpu_cpu = topology.performance_cpus.back();
+            Common::SetCurrentThreadAffinity({&gpu_cpu, 1});
+        }
+    }
     system.RegisterHostThread();
 
     // Wait for first GPU command before acquiring the window context
@@ -43,13 +55,16 @@ static void RunThread(Core::System& system, VideoCore::RendererBase& renderer,
     while (state.is_running) {
         next = state.queue.PopWait();
         if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
-            dma_pusher.Push(std::move(submit_list->entries));
+            for (auto& entries : submit_list->entries) {
+                dma_pusher.Push(std::move(entries));
+            }
             dma_pusher.DispatchCalls();
         } else if (auto* command_list = std::get_if<SubmitChCommandEntries>(&next.data)) {
             // NVDEC
             cdma_pusher.Push(std::move(command_list->entries));
             cdma_pusher.DispatchCalls();
         } else if (const auto* data = std::get_if<SwapBuffersCommand>(&next.data)) {
+            system.FramePacer().PaceFrame();
             renderer.SwapBuffers(data->framebuffer ? &*data->framebuffer : nullptr);
         } else if (std::holds_alternative<OnCommandListEndCommand>(next.data)) {
             renderer.Rasterizer().ReleaseFences();
@@ -89,7 +104,16 @@ void ThreadManager::StartThread(VideoCore::RendererBase& renderer,
 }
 
 void ThreadManager::SubmitList(Tegra::CommandList&& entries) {
-    PushCommand(SubmitListCommand(std::move(entries)));
+    // Prefetched command lists carry the driver's syncpoint fence commands, which make GPU
+    // progress visible to the CPU. Those have to reach the GPU thread immediately, but regular
+    // GPFIFO lists in between can be coalesced into a single queue entry so that queue traffic
+    // scales with frames rather than with the number of submissions.
+    const bool has_sync_commands = !entries.prefetch_command_list.empty();
+    pending_lists.push_back(std::move(entries));
+    if (!is_async || has_sync_commands ||
+        pending_lists.size() >= SubmitListCommand::NUM_INLINE_LISTS) {
+        FlushPendingLists();
+    }
 }
 
 void ThreadManager::SubmitCommandBuffer(Tegra::ChCommandHeaderList&& entries) {
@@ -137,7 +161,8 @@ void ThreadManager::FlushAndInvalidateRegion(VAddr addr, u64 size) {
     system.Renderer().Rasterizer().OnCPUWrite(addr, size);
 }
 
-void ThreadManager::WaitIdle() const {
+void ThreadManager::WaitIdle() {
+    FlushPendingLists();
     while (state.last_fence > state.signaled_fence.load(std::memory_order_relaxed) &&
            system.IsPoweredOn()) {
     }
@@ -147,9 +172,22 @@ void ThreadManager::OnCommandListEnd() {
     PushCommand(OnCommandListEndCommand());
 }
 
+void ThreadManager::FlushPendingLists() {
+    if (pending_lists.empty()) {
+        return;
+    }
+    PushCommand(SubmitListCommand(std::move(pending_lists)));
+    pending_lists.clear();
+}
+
 u64 ThreadManager::PushCommand(CommandData&& command_data) {
+    // Batched command lists have to be submitted before anything that could depend on them
+    if (!std::holds_alternative<SubmitListCommand>(command_data)) {
+        FlushPendingLists();
+    }
     const u64 fence{++state.last_fence};
     state.queue.Push(CommandDataContainer(std::move(command_data), fence));
+    Common::AddPerfCounter(Common::PerfCounter::GpuCommands);
 
     if (!is_async) {
         // In synchronous GPU mode, block the caller until the command has executed
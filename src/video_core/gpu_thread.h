@@ -11,7 +11,9 @@
 #include <thread>
 #include <variant>
 
-#include "common/threadsafe_queue.h"
+#include <boost/container/small_vector.hpp>
+
+#include "common/bounded_threadsafe_queue.h"
 #include "video_core/framebuffer_config.h"
 
 namespace Tegra {
@@ -35,11 +37,16 @@ namespace VideoCommon::GPUThread {
 /// Command to signal to the GPU thread that processing has ended
 struct EndProcessingCommand final {};
 
-/// Command to signal to the GPU thread that a command list is ready for processing
+/// Command to signal to the GPU thread that a batch of command lists is ready for processing
 struct SubmitListCommand final {
-    explicit SubmitListCommand(Tegra::CommandList&& entries_) : entries{std::move(entries_)} {}
+    /// Number of command lists that can be batched without allocating heap storage
+    static constexpr std::size_t NUM_INLINE_LISTS = 8;
+
+    using CommandLists = boost::container::small_vector<Tegra::CommandList, NUM_INLINE_LISTS>;
 
-    Tegra::CommandList entries;
+    explicit SubmitListCommand(CommandLists&& entries_) : entries{std::move(entries_)} {}
+
+    CommandLists entries;
 };
 
 /// Command to signal to the GPU thread that a cdma command list is ready for processing
@@ -108,7 +115,7 @@ struct CommandDataContainer {
 struct SynchState final {
     std::atomic_bool is_running{true};
 
-    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
+    using CommandQueue = Common::BoundedMPSCQueue<CommandDataContainer>;
     CommandQueue queue;
     u64 last_fence{};
     std::atomic<u64> signaled_fence{};
@@ -143,7 +150,7 @@ public:
     void FlushAndInvalidateRegion(VAddr addr, u64 size);
 
     // Wait until the gpu thread is idle.
-    void WaitIdle() const;
+    void WaitIdle();
 
     void OnCommandListEnd();
 
@@ -151,6 +158,10 @@ private:
     /// Pushes a command to be executed by the GPU thread
     u64 PushCommand(CommandData&& command_data);
 
+    /// Submits any batched command lists to the GPU thread
+    void FlushPendingLists();
+
+    SubmitListCommand::CommandLists pending_lists;
     SynchState state;
     Core::System& system;
     std::thread thread;
@@ -2,23 +2,45 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <optional>
+#include <utility>
 #include <boost/container_hash/hash.hpp>
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/perf_counters.h"
 #include "core/settings.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/macro/macro.h"
 #include "video_core/macro/macro_hle.h"
 #include "video_core/macro/macro_interpreter.h"
+#ifdef ARCHITECTURE_x86_64
 #include "video_core/macro/macro_jit_x64.h"
+#elif defined(ARCHITECTURE_ARM64)
+#include "video_core/macro/macro_jit_a64.h"
+#endif
 
 namespace Tegra {
 
 MacroEngine::MacroEngine(Engines::Maxwell3D& maxwell3d)
     : hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d)} {}
 
-MacroEngine::~MacroEngine() = default;
+MacroEngine::~MacroEngine() {
+    // Report the hottest macros that still run through the JIT or interpreter; these hashes are
+    // the candidates for new HLE replacements in macro_hle.cpp
+    std::vector<std::pair<u64, u64>> lle_counts;
+    for (const auto& [method, cache_info] : macro_cache) {
+        if (!cache_info.has_hle_program && cache_info.execution_count > 0) {
+            lle_counts.emplace_back(cache_info.hash, cache_info.execution_count);
+        }
+    }
+    std::sort(lle_counts.begin(), lle_counts.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+    for (const auto& [hash, count] : lle_counts) {
+        LOG_DEBUG(HW_GPU, "Macro {:016X} executed {} times without an HLE replacement", hash,
+                  count);
+    }
+}
 
 void MacroEngine::AddCode(u32 method, u32 data) {
     uploaded_macro_code[method].push_back(data);
@@ -28,10 +50,13 @@ void MacroEngine::Execute(Engines::Maxwell3D& maxwell3d, u32 method,
                           const std::vector<u32>& parameters) {
     auto compiled_macro = macro_cache.find(method);
     if (compiled_macro != macro_cache.end()) {
-        const auto& cache_info = compiled_macro->second;
+        auto& cache_info = compiled_macro->second;
+        ++cache_info.execution_count;
         if (cache_info.has_hle_program) {
+            Common::AddPerfCounter(Common::PerfCounter::MacroHleCalls);
             cache_info.hle_program->Execute(parameters, method);
         } else {
+            Common::AddPerfCounter(Common::PerfCounter::MacroLleCalls);
             cache_info.lle_program->Execute(parameters, method);
         }
     } else {
@@ -67,11 +92,14 @@ void MacroEngine::Execute(Engines::Maxwell3D& maxwell3d, u32 method,
         }
 
         auto hle_program = hle_macros->GetHLEProgram(cache_info.hash);
+        ++cache_info.execution_count;
         if (hle_program.has_value()) {
             cache_info.has_hle_program = true;
             cache_info.hle_program = std::move(hle_program.value());
+            Common::AddPerfCounter(Common::PerfCounter::MacroHleCalls);
             cache_info.hle_program->Execute(parameters, method);
         } else {
+            Common::AddPerfCounter(Common::PerfCounter::MacroLleCalls);
             cache_info.lle_program->Execute(parameters, method);
         }
     }
@@ -81,8 +109,10 @@ std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d) {
     if (Settings::values.disable_macro_jit) {
         return std::make_unique<MacroInterpreter>(maxwell3d);
     }
-#ifdef ARCHITECTURE_x86_64
+#if defined(ARCHITECTURE_x86_64)
     return std::make_unique<MacroJITx64>(maxwell3d);
+#elif defined(ARCHITECTURE_ARM64)
+    return std::make_unique<MacroJITA64>(maxwell3d);
 #else
     return std::make_unique<MacroInterpreter>(maxwell3d);
 #endif
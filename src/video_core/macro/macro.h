@@ -129,6 +129,7 @@ private:
         std::unique_ptr<CachedMacro> lle_program{};
         std::unique_ptr<CachedMacro> hle_program{};
         u64 hash{};
+        u64 execution_count{};
         bool has_hle_program{};
     };
 
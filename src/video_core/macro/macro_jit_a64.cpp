@@ -0,0 +1,509 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/macro/macro_interpreter.h"
+#include "video_core/macro/macro_jit_a64.h"
+
+MICROPROFILE_DEFINE(MacroJitA64Compile, "GPU", "Compile macro JIT", MP_RGB(173, 255, 47));
+MICROPROFILE_DEFINE(MacroJitA64Execute, "GPU", "Execute macro JIT", MP_RGB(255, 255, 0));
+
+namespace Tegra {
+
+using namespace oaknut::util;
+
+constexpr oaknut::XReg STATE = X19;
+constexpr oaknut::XReg PARAMETERS = X20;
+constexpr oaknut::WReg RESULT = W21;
+constexpr oaknut::WReg METHOD_ADDRESS = W22;
+constexpr oaknut::XReg BRANCH_HOLDER = X23;
+// The guest carry flag is kept permanently in a register instead of the JIT state. Unlike x86,
+// AArch64 stores "no borrow" in the host carry on subtractions, which is exactly the convention
+// the macro ISA uses, so the flag always holds a copy of PSTATE.C.
+constexpr oaknut::WReg CARRY_FLAG = W24;
+
+// Caller saved scratch registers, not live across Compile_Send calls
+constexpr oaknut::WReg SCRATCH0 = W9;
+constexpr oaknut::WReg SCRATCH1 = W10;
+
+MacroJITA64::MacroJITA64(Engines::Maxwell3D& maxwell3d_)
+    : MacroEngine{maxwell3d_}, maxwell3d{maxwell3d_} {}
+
+std::unique_ptr<CachedMacro> MacroJITA64::Compile(const std::vector<u32>& code) {
+    return std::make_unique<MacroJITA64Impl>(maxwell3d, code);
+}
+
+MacroJITA64Impl::MacroJITA64Impl(Engines::Maxwell3D& maxwell3d_, const std::vector<u32>& code_)
+    : CodeBlock{MAX_CODE_SIZE}, CodeGenerator{CodeBlock::ptr()}, labels(code_.size() + 1),
+      delay_skip(code_.size() + 1), code{code_}, maxwell3d{maxwell3d_} {
+    Compile();
+}
+
+MacroJITA64Impl::~MacroJITA64Impl() = default;
+
+void MacroJITA64Impl::Execute(const std::vector<u32>& parameters, u32 method) {
+    MICROPROFILE_SCOPE(MacroJitA64Execute);
+    ASSERT_OR_EXECUTE(program != nullptr, { return; });
+    JITState state{};
+    state.maxwell3d = &maxwell3d;
+    state.registers = {};
+    program(&state, parameters.data());
+}
+
+void MacroJITA64Impl::Compile_ALU(Macro::Opcode opcode) {
+    const auto src_a = Compile_GetRegister(opcode.src_a, SCRATCH0);
+    const auto src_b = Compile_GetRegister(opcode.src_b, SCRATCH1);
+
+    switch (opcode.alu_operation) {
+    case Macro::ALUOperation::Add:
+        if (optimizer.can_skip_carry) {
+            ADD(RESULT, src_a, src_b);
+        } else {
+            ADDS(RESULT, src_a, src_b);
+            CSET(CARRY_FLAG, oaknut::Cond::CS);
+        }
+        break;
+    case Macro::ALUOperation::AddWithCarry:
+        // Set the host carry to the guest carry before consuming it
+        CMP(CARRY_FLAG, 1);
+        ADCS(RESULT, src_a, src_b);
+        CSET(CARRY_FLAG, oaknut::Cond::CS);
+        break;
+    case Macro::ALUOperation::Subtract:
+        if (optimizer.can_skip_carry) {
+            SUB(RESULT, src_a, src_b);
+        } else {
+            SUBS(RESULT, src_a, src_b);
+            CSET(CARRY_FLAG, oaknut::Cond::CS);
+        }
+        break;
+    case Macro::ALUOperation::SubtractWithBorrow:
+        CMP(CARRY_FLAG, 1);
+        SBCS(RESULT, src_a, src_b);
+        CSET(CARRY_FLAG, oaknut::Cond::CS);
+        break;
+    case Macro::ALUOperation::Xor:
+        EOR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Or:
+        ORR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::And:
+        AND(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::AndNot:
+        BIC(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Nand:
+        AND(RESULT, src_a, src_b);
+        MVN(RESULT, RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented ALU operation {}", opcode.alu_operation.Value());
+        break;
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITA64Impl::Compile_AddImmediate(Macro::Opcode opcode) {
+    if (optimizer.skip_dummy_addimmediate) {
+        // Games tend to use this as an exit instruction placeholder. It's to encode an instruction
+        // without doing anything. In our case we can just not emit anything.
+        if (opcode.result_operation == Macro::ResultOperation::Move && opcode.dst == 0) {
+            return;
+        }
+    }
+    // Check for redundant moves
+    if (optimizer.optimize_for_method_move &&
+        opcode.result_operation == Macro::ResultOperation::MoveAndSetMethod) {
+        if (next_opcode.has_value()) {
+            const auto next = *next_opcode;
+            if (next.result_operation == Macro::ResultOperation::MoveAndSetMethod &&
+                opcode.dst == next.dst) {
+                return;
+            }
+        }
+    }
+    Compile_GetRegister(opcode.src_a, RESULT);
+    Compile_AddImmediateToRegister(RESULT, opcode.immediate);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITA64Impl::Compile_ExtractInsert(Macro::Opcode opcode) {
+    const auto dst = Compile_GetRegister(opcode.src_a, RESULT);
+    const auto src = Compile_GetRegister(opcode.src_b, SCRATCH0);
+
+    if (opcode.bf_src_bit != 0) {
+        LSR(src, src, opcode.bf_src_bit);
+    }
+    if (opcode.bf_size != 0) {
+        AND(src, src, opcode.GetBitfieldMask());
+    } else {
+        MOV(src, WZR);
+    }
+    const u32 inverted_mask = ~(opcode.GetBitfieldMask() << opcode.bf_dst_bit);
+    if (inverted_mask != 0xffffffff) {
+        AND(dst, dst, inverted_mask);
+    }
+    ORR(RESULT, dst, src, oaknut::LogShift::LSL, static_cast<int>(opcode.bf_dst_bit));
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITA64Impl::Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode) {
+    const auto shift = Compile_GetRegister(opcode.src_a, SCRATCH0);
+    const auto src = Compile_GetRegister(opcode.src_b, RESULT);
+
+    LSR(src, src, shift);
+    if (opcode.bf_size != 0) {
+        AND(src, src, opcode.GetBitfieldMask());
+    } else {
+        MOV(src, WZR);
+    }
+    if (opcode.bf_dst_bit != 0) {
+        LSL(RESULT, src, opcode.bf_dst_bit);
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITA64Impl::Compile_ExtractShiftLeftRegister(Macro::Opcode opcode) {
+    const auto shift = Compile_GetRegister(opcode.src_a, SCRATCH0);
+    const auto src = Compile_GetRegister(opcode.src_b, RESULT);
+
+    if (opcode.bf_src_bit != 0) {
+        LSR(src, src, opcode.bf_src_bit);
+    }
+    if (opcode.bf_size != 0) {
+        AND(src, src, opcode.GetBitfieldMask());
+    } else {
+        MOV(src, WZR);
+    }
+    LSL(RESULT, src, shift);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITA64Impl::Compile_Read(Macro::Opcode opcode) {
+    Compile_GetRegister(opcode.src_a, RESULT);
+    Compile_AddImmediateToRegister(RESULT, opcode.immediate);
+
+    // Equivalent to Engines::Maxwell3D::GetRegisterValue
+    constexpr u32 reg_array_offset = static_cast<u32>(
+        offsetof(Engines::Maxwell3D, regs) + offsetof(Engines::Maxwell3D::Regs, reg_array));
+    LDR(X8, STATE, 0);
+    MOV(SCRATCH0, reg_array_offset);
+    ADD(X8, X8, SCRATCH0.toX());
+    LDR(RESULT, X8, RESULT, oaknut::IndexExt::UXTW, 2);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+static void Send(Engines::Maxwell3D* maxwell3d, Macro::MethodAddress method_address, u32 value) {
+    maxwell3d->CallMethodFromMME(method_address.address, value);
+}
+
+void MacroJITA64Impl::Compile_Send(oaknut::WReg value) {
+    // Everything live across the call is kept in callee saved registers
+    MOV(W2, value);
+    MOV(W1, METHOD_ADDRESS);
+    LDR(X0, STATE, 0);
+    MOVP2R(X8, &Send);
+    BLR(X8);
+
+    // Increment the method address by the method increment
+    UBFX(SCRATCH0, METHOD_ADDRESS, 12, 6);
+    ADD(SCRATCH0, SCRATCH0, METHOD_ADDRESS);
+    BFXIL(METHOD_ADDRESS, SCRATCH0, 0, 12);
+}
+
+void MacroJITA64Impl::Compile_Branch(Macro::Opcode opcode) {
+    ASSERT_MSG(!is_delay_slot, "Executing a branch in a delay slot is not valid");
+    const s32 jump_address =
+        static_cast<s32>(pc) + static_cast<s32>(opcode.GetBranchTarget() / sizeof(s32));
+
+    oaknut::Label end;
+    const auto value = Compile_GetRegister(opcode.src_a, SCRATCH0);
+    if (optimizer.has_delayed_pc) {
+        switch (opcode.branch_condition) {
+        case Macro::BranchCondition::Zero:
+            CBNZ(value, end);
+            break;
+        case Macro::BranchCondition::NotZero:
+            CBZ(value, end);
+            break;
+        }
+
+        if (opcode.branch_annul) {
+            MOV(BRANCH_HOLDER, XZR);
+            B(labels[jump_address]);
+        } else {
+            oaknut::Label handle_post_exit;
+            oaknut::Label skip;
+            B(skip);
+            if (opcode.is_exit) {
+                l(handle_post_exit);
+                // Execute 1 instruction
+                ADR(BRANCH_HOLDER, end_of_code);
+                // Jump to next instruction to skip delay slot check
+                B(labels[jump_address]);
+            } else {
+                l(handle_post_exit);
+                MOV(BRANCH_HOLDER, XZR);
+                B(labels[jump_address]);
+            }
+            l(skip);
+            ADR(BRANCH_HOLDER, handle_post_exit);
+            B(delay_skip[pc]);
+        }
+    } else {
+        switch (opcode.branch_condition) {
+        case Macro::BranchCondition::Zero:
+            CBZ(value, labels[jump_address]);
+            break;
+        case Macro::BranchCondition::NotZero:
+            CBNZ(value, labels[jump_address]);
+            break;
+        }
+    }
+
+    l(end);
+}
+
+void MacroJITA64Impl::Optimizer_ScanFlags() {
+    optimizer.can_skip_carry = true;
+    optimizer.has_delayed_pc = false;
+    for (auto raw_op : code) {
+        Macro::Opcode op{};
+        op.raw = raw_op;
+
+        if (op.operation == Macro::Operation::ALU) {
+            // Scan for any ALU operations which actually use the carry flag, if they don't exist in
+            // our current code we can skip emitting the carry flag handling operations
+            if (op.alu_operation == Macro::ALUOperation::AddWithCarry ||
+                op.alu_operation == Macro::ALUOperation::SubtractWithBorrow) {
+                optimizer.can_skip_carry = false;
+            }
+        }
+
+        if (op.operation == Macro::Operation::Branch) {
+            if (!op.branch_annul) {
+                optimizer.has_delayed_pc = true;
+            }
+        }
+    }
+}
+
+void MacroJITA64Impl::Compile() {
+    MICROPROFILE_SCOPE(MacroJitA64Compile);
+
+    SUB(SP, SP, 0x40);
+    STP(X19, X20, SP, 0);
+    STP(X21, X22, SP, 16);
+    STP(X23, X24, SP, 32);
+    STR(X30, SP, 48);
+
+    // JIT state
+    MOV(STATE, X0);
+    MOV(PARAMETERS, X1);
+    MOV(RESULT, WZR);
+    MOV(METHOD_ADDRESS, WZR);
+    MOV(BRANCH_HOLDER, XZR);
+    MOV(CARRY_FLAG, WZR);
+
+    STR(Compile_FetchParameter(), STATE, offsetof(JITState, registers) + sizeof(u32));
+
+    // AddImmediate tends to be used as a NOP instruction, if we detect this we can
+    // completely skip the entire code path and no emit anything
+    optimizer.skip_dummy_addimmediate = true;
+
+    // SMO tends to emit a lot of unnecessary method moves, we can mitigate this by only emitting
+    // one if our register isn't "dirty"
+    optimizer.optimize_for_method_move = true;
+
+    // Check to see if we can skip emitting certain instructions
+    Optimizer_ScanFlags();
+
+    const u32 op_count = static_cast<u32>(code.size());
+    for (u32 i = 0; i < op_count; i++) {
+        if (i < op_count - 1) {
+            pc = i + 1;
+            next_opcode = GetOpCode();
+        } else {
+            next_opcode = {};
+        }
+        pc = i;
+        Compile_NextInstruction();
+    }
+
+    // An exit as the last instruction references the label after it
+    l(labels[op_count]);
+    l(end_of_code);
+
+    LDR(X30, SP, 48);
+    LDP(X23, X24, SP, 32);
+    LDP(X21, X22, SP, 16);
+    LDP(X19, X20, SP, 0);
+    ADD(SP, SP, 0x40);
+    RET();
+
+    CodeBlock::protect();
+    CodeBlock::invalidate_all();
+    program = reinterpret_cast<ProgramType>(CodeBlock::ptr());
+}
+
+bool MacroJITA64Impl::Compile_NextInstruction() {
+    const auto opcode = GetOpCode();
+
+    l(labels[pc]);
+
+    switch (opcode.operation) {
+    case Macro::Operation::ALU:
+        Compile_ALU(opcode);
+        break;
+    case Macro::Operation::AddImmediate:
+        Compile_AddImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractInsert:
+        Compile_ExtractInsert(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftImmediate:
+        Compile_ExtractShiftLeftImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftRegister:
+        Compile_ExtractShiftLeftRegister(opcode);
+        break;
+    case Macro::Operation::Read:
+        Compile_Read(opcode);
+        break;
+    case Macro::Operation::Branch:
+        Compile_Branch(opcode);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented opcode {}", opcode.operation.Value());
+        break;
+    }
+
+    if (optimizer.has_delayed_pc) {
+        if (opcode.is_exit) {
+            ADR(X8, end_of_code);
+            CMP(BRANCH_HOLDER, 0);
+            CSEL(BRANCH_HOLDER, X8, BRANCH_HOLDER, oaknut::Cond::EQ);
+            // Jump to next instruction to skip delay slot check
+            B(oaknut::Cond::EQ, labels[pc + 1]);
+        } else {
+            // TODO(ogniK): Optimize delay slot branching
+            oaknut::Label no_delay_slot;
+            CBZ(BRANCH_HOLDER, no_delay_slot);
+            MOV(X8, BRANCH_HOLDER);
+            MOV(BRANCH_HOLDER, XZR);
+            BR(X8);
+            l(no_delay_slot);
+        }
+        l(delay_skip[pc]);
+        if (opcode.is_exit) {
+            return false;
+        }
+    } else {
+        CBNZ(BRANCH_HOLDER, end_of_code);
+        if (opcode.is_exit) {
+            ADD(BRANCH_HOLDER, BRANCH_HOLDER, 1);
+            return false;
+        }
+    }
+    return true;
+}
+
+oaknut::WReg MacroJITA64Impl::Compile_FetchParameter() {
+    LDR(W8, PARAMETERS, 0);
+    ADD(PARAMETERS, PARAMETERS, sizeof(u32));
+    return W8;
+}
+
+oaknut::WReg MacroJITA64Impl::Compile_GetRegister(u32 index, oaknut::WReg dst) {
+    if (index == 0) {
+        // Register 0 is always zero
+        MOV(dst, WZR);
+    } else {
+        LDR(dst, STATE, offsetof(JITState, registers) + index * sizeof(u32));
+    }
+
+    return dst;
+}
+
+void MacroJITA64Impl::Compile_AddImmediateToRegister(oaknut::WReg dst, s32 immediate) {
+    if (immediate == 0) {
+        return;
+    }
+    if (immediate > 0 && immediate < 0x1000) {
+        ADD(dst, dst, immediate);
+    } else if (immediate < 0 && immediate > -0x1000) {
+        SUB(dst, dst, -immediate);
+    } else {
+        MOV(SCRATCH1, static_cast<u32>(immediate));
+        ADD(dst, dst, SCRATCH1);
+    }
+}
+
+void MacroJITA64Impl::Compile_ProcessResult(Macro::ResultOperation operation, u32 reg) {
+    const auto SetRegister = [this](u32 reg_index, oaknut::WReg result) {
+        // Register 0 is supposed to always return 0. NOP is implemented as a store to the zero
+        // register.
+        if (reg_index == 0) {
+            return;
+        }
+        STR(result, STATE, offsetof(JITState, registers) + reg_index * sizeof(u32));
+    };
+    const auto SetMethodAddress = [this](oaknut::WReg reg32) { MOV(METHOD_ADDRESS, reg32); };
+
+    switch (operation) {
+    case Macro::ResultOperation::IgnoreAndFetch:
+        SetRegister(reg, Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::Move:
+        SetRegister(reg, RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethod:
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSend:
+        // Fetch parameter and send result.
+        SetRegister(reg, Compile_FetchParameter());
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSend:
+        // Move and send result.
+        SetRegister(reg, RESULT);
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSetMethod:
+        // Fetch parameter and use result as Method Address.
+        SetRegister(reg, Compile_FetchParameter());
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodFetchAndSend:
+        // Move result and use as Method Address, then fetch and send parameter.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        Compile_Send(Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodSend:
+        // Move result and use as Method Address, then send bits 12:17 of result.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        UBFX(SCRATCH0, RESULT, 12, 6);
+        Compile_Send(SCRATCH0);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", operation);
+    }
+}
+
+Macro::Opcode MacroJITA64Impl::GetOpCode() const {
+    ASSERT(pc < code.size());
+    return {code[pc]};
+}
+
+} // namespace Tegra
@@ -26,6 +26,7 @@ void MemoryManager::BindRasterizer(VideoCore::RasterizerInterface& rasterizer_)
 }
 
 GPUVAddr MemoryManager::UpdateRange(GPUVAddr gpu_addr, PageEntry page_entry, std::size_t size) {
+    cached_run = HostRun{};
     u64 remaining_size{size};
     for (u64 offset{}; offset < size; offset += page_size) {
         if (remaining_size < page_size) {
@@ -205,30 +206,45 @@ template void MemoryManager::Write<u16>(GPUVAddr addr, u16 data);
 template void MemoryManager::Write<u32>(GPUVAddr addr, u32 data);
 template void MemoryManager::Write<u64>(GPUVAddr addr, u64 data);
 
-u8* MemoryManager::GetPointer(GPUVAddr gpu_addr) {
-    if (!GetPageEntry(gpu_addr).IsValid()) {
-        return {};
+u8* MemoryManager::GetPointerImpl(GPUVAddr gpu_addr) const {
+    if (const size_t run_offset{gpu_addr - cached_run.gpu_addr}; run_offset < cached_run.size) {
+        return cached_run.pointer + run_offset;
     }
+    return CacheHostRun(gpu_addr);
+}
 
-    const auto address{GpuToCpuAddress(gpu_addr)};
-    if (!address) {
-        return {};
+u8* MemoryManager::CacheHostRun(GPUVAddr gpu_addr) const {
+    const auto page_entry{GetPageEntry(gpu_addr)};
+    if (!page_entry.IsValid()) {
+        return nullptr;
+    }
+    const VAddr cpu_addr{page_entry.ToAddress() + (gpu_addr & page_mask)};
+    u8* const pointer{system.Memory().GetPointer(cpu_addr)};
+    if (!pointer) {
+        return nullptr;
     }
+    // Merge host pages into the run while their backing memory stays contiguous, stopping at the
+    // end of the GPU page to keep a single translation valid for the whole run
+    const size_t max_size{page_size - (gpu_addr & page_mask)};
+    size_t run_size{Core::Memory::PAGE_SIZE - (cpu_addr & Core::Memory::PAGE_MASK)};
+    while (run_size < max_size &&
+           system.Memory().GetPointer(cpu_addr + run_size) == pointer + run_size) {
+        run_size += Core::Memory::PAGE_SIZE;
+    }
+    cached_run = HostRun{
+        .gpu_addr = gpu_addr,
+        .size = std::min(run_size, max_size),
+        .pointer = pointer,
+    };
+    return pointer;
+}
 
-    return system.Memory().GetPointer(*address);
+u8* MemoryManager::GetPointer(GPUVAddr gpu_addr) {
+    return GetPointerImpl(gpu_addr);
 }
 
 const u8* MemoryManager::GetPointer(GPUVAddr gpu_addr) const {
-    if (!GetPageEntry(gpu_addr).IsValid()) {
-        return {};
-    }
-
-    const auto address{GpuToCpuAddress(gpu_addr)};
-    if (!address) {
-        return {};
-    }
-
-    return system.Memory().GetPointer(*address);
+    return GetPointerImpl(gpu_addr);
 }
 
 size_t MemoryManager::BytesToMapEnd(GPUVAddr gpu_addr) const noexcept {
@@ -265,22 +281,22 @@ void MemoryManager::ReadBlock(GPUVAddr gpu_src_addr, void* dest_buffer, std::siz
 void MemoryManager::ReadBlockUnsafe(GPUVAddr gpu_src_addr, void* dest_buffer,
                                     const std::size_t size) const {
     std::size_t remaining_size{size};
-    std::size_t page_index{gpu_src_addr >> page_bits};
-    std::size_t page_offset{gpu_src_addr & page_mask};
+    GPUVAddr gpu_addr{gpu_src_addr};
 
     while (remaining_size > 0) {
-        const std::size_t copy_amount{
-            std::min(static_cast<std::size_t>(page_size) - page_offset, remaining_size)};
-
-        if (const auto page_addr{GpuToCpuAddress(page_index << page_bits)}; page_addr) {
-            const auto src_addr{*page_addr + page_offset};
-            system.Memory().ReadBlockUnsafe(src_addr, dest_buffer, copy_amount);
+        std::size_t copy_amount;
+        if (const u8* const src_pointer{GetPointerImpl(gpu_addr)}; src_pointer) {
+            copy_amount = std::min(cached_run.size - (gpu_addr - cached_run.gpu_addr),
+                                   remaining_size);
+            std::memcpy(dest_buffer, src_pointer, copy_amount);
         } else {
+            copy_amount =
+                std::min(static_cast<std::size_t>(page_size) - (gpu_addr & page_mask),
+                         remaining_size);
             std::memset(dest_buffer, 0, copy_amount);
         }
 
-        page_index++;
-        page_offset = 0;
+        gpu_addr += copy_amount;
         dest_buffer = static_cast<u8*>(dest_buffer) + copy_amount;
         remaining_size -= copy_amount;
     }
@@ -314,20 +330,21 @@ void MemoryManager::WriteBlock(GPUVAddr gpu_dest_addr, const void* src_buffer, s
 void MemoryManager::WriteBlockUnsafe(GPUVAddr gpu_dest_addr, const void* src_buffer,
                                      std::size_t size) {
     std::size_t remaining_size{size};
-    std::size_t page_index{gpu_dest_addr >> page_bits};
-    std::size_t page_offset{gpu_dest_addr & page_mask};
+    GPUVAddr gpu_addr{gpu_dest_addr};
 
     while (remaining_size > 0) {
-        const std::size_t copy_amount{
-            std::min(static_cast<std::size_t>(page_size) - page_offset, remaining_size)};
-
-        if (const auto page_addr{GpuToCpuAddress(page_index << page_bits)}; page_addr) {
-            const auto dest_addr{*page_addr + page_offset};
-            system.Memory().WriteBlockUnsafe(dest_addr, src_buffer, copy_amount);
+        std::size_t copy_amount;
+        if (u8* const dest_pointer{GetPointerImpl(gpu_addr)}; dest_pointer) {
+            copy_amount = std::min(cached_run.size - (gpu_addr - cached_run.gpu_addr),
+                                   remaining_size);
+            std::memcpy(dest_pointer, src_buffer, copy_amount);
+        } else {
+            copy_amount =
+                std::min(static_cast<std::size_t>(page_size) - (gpu_addr & page_mask),
+                         remaining_size);
         }
 
-        page_index++;
-        page_offset = 0;
+        gpu_addr += copy_amount;
         src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
         remaining_size -= copy_amount;
     }
@@ -349,13 +366,21 @@ void MemoryManager::FlushRegion(GPUVAddr gpu_addr, size_t size) const {
 }
 
 void MemoryManager::CopyBlock(GPUVAddr gpu_dest_addr, GPUVAddr gpu_src_addr, std::size_t size) {
-    std::vector<u8> tmp_buffer(size);
-    ReadBlock(gpu_src_addr, tmp_buffer.data(), size);
-
-    // The output block must be flushed in case it has data modified from the GPU.
-    // Fixes NPC geometry in Zombie Panic in Wonderland DX
-    FlushRegion(gpu_dest_addr, size);
-    WriteBlock(gpu_dest_addr, tmp_buffer.data(), size);
+    // Copy in bounded chunks so one large DMA transfer (64 MiB texture copies in particular)
+    // does not allocate and touch the whole span at once; each chunk resolves its source and
+    // destination spans separately and the staging buffer stays cache-sized.
+    static constexpr std::size_t copy_chunk_size = 1ULL << 20;
+
+    std::vector<u8> tmp_buffer(std::min(size, copy_chunk_size));
+    for (std::size_t offset = 0; offset < size; offset += copy_chunk_size) {
+        const std::size_t copy_size = std::min(size - offset, copy_chunk_size);
+        ReadBlock(gpu_src_addr + offset, tmp_buffer.data(), copy_size);
+
+        // The output block must be flushed in case it has data modified from the GPU.
+        // Fixes NPC geometry in Zombie Panic in Wonderland DX
+        FlushRegion(gpu_dest_addr + offset, copy_size);
+        WriteBlock(gpu_dest_addr + offset, tmp_buffer.data(), copy_size);
+    }
 }
 
 bool MemoryManager::IsGranularRange(GPUVAddr gpu_addr, std::size_t size) const {
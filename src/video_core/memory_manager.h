@@ -125,6 +125,8 @@ public:
 
 private:
     [[nodiscard]] PageEntry GetPageEntry(GPUVAddr gpu_addr) const;
+    [[nodiscard]] u8* GetPointerImpl(GPUVAddr gpu_addr) const;
+    [[nodiscard]] u8* CacheHostRun(GPUVAddr gpu_addr) const;
     void SetPageEntry(GPUVAddr gpu_addr, PageEntry page_entry, std::size_t size = page_size);
     GPUVAddr UpdateRange(GPUVAddr gpu_addr, PageEntry page_entry, std::size_t size);
     [[nodiscard]] std::optional<GPUVAddr> FindFreeRange(std::size_t size, std::size_t align,
@@ -157,6 +159,14 @@ private:
 
     using MapRange = std::pair<GPUVAddr, size_t>;
     std::vector<MapRange> map_ranges;
+
+    /// Last translated run of GPU memory that is contiguous in host memory
+    struct HostRun {
+        GPUVAddr gpu_addr{};
+        size_t size{};
+        u8* pointer{};
+    };
+    mutable HostRun cached_run;
 };
 
 } // namespace Tegra
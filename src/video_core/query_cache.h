@@ -9,7 +9,6 @@
 #include <cstring>
 #include <iterator>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -22,6 +21,7 @@
 #include "video_core/gpu.h"
 #include "video_core/memory_manager.h"
 #include "video_core/rasterizer_interface.h"
+#include "video_core/texture_cache/slot_vector.h"
 
 namespace VideoCommon {
 
@@ -91,6 +91,14 @@ private:
     std::shared_ptr<HostCounter> last;
 };
 
+/**
+ * Tracks queries and their host counters.
+ *
+ * All entry points are serialized on the GPU thread: counter updates come from draws, clears and
+ * dispatches, reports from semaphore releases, and flushes from queued flush commands, DMA copies
+ * and popped async flush lists. No locking is performed, keeping counter begin/end free of
+ * contention on the hot path.
+ */
 template <class QueryCache, class CachedQuery, class CounterStream, class HostCounter>
 class QueryCacheBase {
 public:
@@ -102,12 +110,10 @@ public:
                                                           VideoCore::QueryType::SamplesPassed}}} {}
 
     void InvalidateRegion(VAddr addr, std::size_t size) {
-        std::unique_lock lock{mutex};
         FlushAndRemoveRegion(addr, size);
     }
 
     void FlushRegion(VAddr addr, std::size_t size) {
-        std::unique_lock lock{mutex};
         FlushAndRemoveRegion(addr, size);
     }
 
@@ -118,7 +124,6 @@ public:
      * @param timestamp Timestamp, when empty the flushed query is assumed to be short.
      */
     void Query(GPUVAddr gpu_addr, VideoCore::QueryType type, std::optional<u64> timestamp) {
-        std::unique_lock lock{mutex};
         const std::optional<VAddr> cpu_addr = gpu_memory.GpuToCpuAddress(gpu_addr);
         ASSERT(cpu_addr);
 
@@ -138,20 +143,17 @@ public:
 
     /// Updates counters from GPU state. Expected to be called once per draw, clear or dispatch.
     void UpdateCounters() {
-        std::unique_lock lock{mutex};
         const auto& regs = maxwell3d.regs;
         Stream(VideoCore::QueryType::SamplesPassed).Update(regs.samplecnt_enable);
     }
 
     /// Resets a counter to zero. It doesn't disable the query after resetting.
     void ResetCounter(VideoCore::QueryType type) {
-        std::unique_lock lock{mutex};
         Stream(type).Reset();
     }
 
     /// Disable all active streams. Expected to be called at the end of a command buffer.
     void DisableStreams() {
-        std::unique_lock lock{mutex};
         for (auto& stream : streams) {
             stream.Update(false);
         }
@@ -223,15 +225,17 @@ private:
                 continue;
             }
             auto& contents = it->second;
-            for (auto& query : contents) {
+            for (auto id_it = std::begin(contents); id_it != std::end(contents);) {
+                CachedQuery& query = slot_queries[*id_it];
                 if (!in_range(query)) {
+                    ++id_it;
                     continue;
                 }
                 rasterizer.UpdatePagesCachedCount(query.GetCpuAddr(), query.SizeInBytes(), -1);
                 query.Flush();
+                slot_queries.erase(*id_it);
+                id_it = contents.erase(id_it);
             }
-            contents.erase(std::remove_if(std::begin(contents), std::end(contents), in_range),
-                           std::end(contents));
         }
     }
 
@@ -239,8 +243,10 @@ private:
     CachedQuery* Register(VideoCore::QueryType type, VAddr cpu_addr, u8* host_ptr, bool timestamp) {
         rasterizer.UpdatePagesCachedCount(cpu_addr, CachedQuery::SizeInBytes(timestamp), 1);
         const u64 page = static_cast<u64>(cpu_addr) >> PAGE_BITS;
-        return &cached_queries[page].emplace_back(static_cast<QueryCache&>(*this), type, cpu_addr,
-                                                  host_ptr);
+        const SlotId id =
+            slot_queries.insert(static_cast<QueryCache&>(*this), type, cpu_addr, host_ptr);
+        cached_queries[page].push_back(id);
+        return &slot_queries[id];
     }
 
     /// Tries to a get a cached query. Returns nullptr on failure.
@@ -250,10 +256,11 @@ private:
         if (it == std::end(cached_queries)) {
             return nullptr;
         }
-        auto& contents = it->second;
-        const auto found = std::find_if(std::begin(contents), std::end(contents),
-                                        [addr](auto& query) { return query.GetCpuAddr() == addr; });
-        return found != std::end(contents) ? &*found : nullptr;
+        const auto& contents = it->second;
+        const auto found =
+            std::find_if(std::begin(contents), std::end(contents),
+                         [this, addr](SlotId id) { return slot_queries[id].GetCpuAddr() == addr; });
+        return found != std::end(contents) ? &slot_queries[*found] : nullptr;
     }
 
     void AsyncFlushQuery(VAddr addr) {
@@ -270,9 +277,8 @@ private:
     Tegra::Engines::Maxwell3D& maxwell3d;
     Tegra::MemoryManager& gpu_memory;
 
-    std::recursive_mutex mutex;
-
-    std::unordered_map<u64, std::vector<CachedQuery>> cached_queries;
+    SlotVector<CachedQuery> slot_queries;
+    std::unordered_map<u64, std::vector<SlotId>> cached_queries;
 
     std::array<CounterStream, VideoCore::NumQueryTypes> streams;
 
@@ -2,11 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <iterator>
 #include <mutex>
 
-#include <boost/icl/interval_map.hpp>
-#include <boost/range/iterator_range.hpp>
-
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "core/memory.h"
@@ -14,15 +12,6 @@
 
 namespace VideoCore {
 
-namespace {
-
-template <typename Map, typename Interval>
-constexpr auto RangeFromInterval(Map& map, const Interval& interval) {
-    return boost::make_iterator_range(map.equal_range(interval));
-}
-
-} // Anonymous namespace
-
 RasterizerAccelerated::RasterizerAccelerated(Core::Memory::Memory& cpu_memory_)
     : cpu_memory{cpu_memory_} {}
 
@@ -33,33 +22,60 @@ void RasterizerAccelerated::UpdatePagesCachedCount(VAddr addr, u64 size, int del
     const u64 page_start{addr >> Core::Memory::PAGE_BITS};
     const u64 page_end{(addr + size + Core::Memory::PAGE_SIZE - 1) >> Core::Memory::PAGE_BITS};
 
-    // Interval maps will erase segments if count reaches 0, so if delta is negative we have to
-    // subtract after iterating
-    const auto pages_interval = CachedPageMap::interval_type::right_open(page_start, page_end);
-    if (delta > 0) {
-        cached_pages.add({pages_interval, delta});
-    }
-
-    for (const auto& pair : RangeFromInterval(cached_pages, pages_interval)) {
-        const auto interval = pair.first & pages_interval;
-        const int count = pair.second;
+    // Make sure the range is bounded by split points, so only whole segments are updated
+    const auto end = SplitSegment(page_end);
+    auto it = SplitSegment(page_start);
 
-        const VAddr interval_start_addr = boost::icl::first(interval) << Core::Memory::PAGE_BITS;
-        const VAddr interval_end_addr = boost::icl::last_next(interval) << Core::Memory::PAGE_BITS;
-        const u64 interval_size = interval_end_addr - interval_start_addr;
-
-        if (delta > 0 && count == delta) {
-            cpu_memory.RasterizerMarkRegionCached(interval_start_addr, interval_size, true);
-        } else if (delta < 0 && count == -delta) {
-            cpu_memory.RasterizerMarkRegionCached(interval_start_addr, interval_size, false);
+    // Pages that transition between cached and uncached are protected in contiguous runs
+    u64 run_begin{};
+    bool in_run = false;
+    const auto flush_run = [&](u64 run_end) {
+        if (!in_run) {
+            return;
+        }
+        in_run = false;
+        const VAddr run_start_addr = run_begin << Core::Memory::PAGE_BITS;
+        const VAddr run_end_addr = run_end << Core::Memory::PAGE_BITS;
+        cpu_memory.RasterizerMarkRegionCached(run_start_addr, run_end_addr - run_start_addr,
+                                              delta > 0);
+    };
+    for (; it != end; ++it) {
+        const int count = it->second + delta;
+        it->second = count;
+        ASSERT(count >= 0);
+
+        const bool transitions = delta > 0 ? count == delta : count == 0;
+        if (transitions) {
+            if (!in_run) {
+                run_begin = it->first;
+                in_run = true;
+            }
+        } else {
+            flush_run(it->first);
+        }
+    }
+    flush_run(page_end);
+
+    // Erase boundaries that no longer split distinct counts to keep the map small
+    auto merge_it = cached_pages.lower_bound(page_start);
+    while (merge_it != cached_pages.end() && merge_it->first <= page_end) {
+        const int previous_count =
+            merge_it == cached_pages.begin() ? 0 : std::prev(merge_it)->second;
+        if (merge_it->second == previous_count) {
+            merge_it = cached_pages.erase(merge_it);
         } else {
-            ASSERT(count >= 0);
+            ++merge_it;
         }
     }
+}
 
-    if (delta < 0) {
-        cached_pages.add({pages_interval, delta});
+RasterizerAccelerated::CachedPageMap::iterator RasterizerAccelerated::SplitSegment(u64 page) {
+    const auto it = cached_pages.lower_bound(page);
+    if (it != cached_pages.end() && it->first == page) {
+        return it;
     }
+    const int count = it == cached_pages.begin() ? 0 : std::prev(it)->second;
+    return cached_pages.emplace_hint(it, page, count);
 }
 
 } // namespace VideoCore
@@ -4,10 +4,9 @@
 
 #pragma once
 
+#include <map>
 #include <mutex>
 
-#include <boost/icl/interval_map.hpp>
-
 #include "common/common_types.h"
 #include "video_core/rasterizer_interface.h"
 
@@ -26,7 +25,16 @@ public:
     void UpdatePagesCachedCount(VAddr addr, u64 size, int delta) override;
 
 private:
-    using CachedPageMap = boost::icl::interval_map<u64, int>;
+    /// Cached page counts, stored as segments. An entry maps the first page of a segment to the
+    /// count shared by every page until the next entry, so updating an N-page range only touches
+    /// its split boundaries instead of each page. Pages before the first entry have a count of
+    /// zero.
+    using CachedPageMap = std::map<u64, int>;
+
+    /// Returns an iterator to the segment starting at the given page, splitting an existing
+    /// segment when the page falls inside of one.
+    CachedPageMap::iterator SplitSegment(u64 page);
+
     CachedPageMap cached_pages;
     std::mutex pages_mutex;
 
@@ -7,6 +7,7 @@
 #include <atomic>
 #include <functional>
 #include <optional>
+#include <span>
 #include "common/common_types.h"
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/gpu.h"
@@ -16,6 +17,10 @@ namespace Tegra {
 class MemoryManager;
 }
 
+namespace VideoCommon {
+struct ImageInfo;
+}
+
 namespace VideoCore {
 
 enum class QueryType {
@@ -105,6 +110,20 @@ public:
         return false;
     }
 
+    /// Attempt to execute a linear DMA copy between two cached buffers on the GPU
+    [[nodiscard]] virtual bool AccelerateBufferCopy(GPUVAddr src_address, GPUVAddr dst_address,
+                                                    std::size_t size) {
+        return false;
+    }
+
+    /// Attempt to upload a decoded video frame directly into the texture cache, returns false
+    /// when the frame has to be written back to guest memory instead
+    [[nodiscard]] virtual bool AccelerateVideoFrame(const VideoCommon::ImageInfo& info,
+                                                    GPUVAddr gpu_addr,
+                                                    std::span<const u8> frame_data) {
+        return false;
+    }
+
     /// Attempt to use a faster method to display the framebuffer to screen
     [[nodiscard]] virtual bool AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                                  VAddr framebuffer_addr, u32 pixel_stride) {
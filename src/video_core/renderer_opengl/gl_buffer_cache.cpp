@@ -2,10 +2,12 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <memory>
 
 #include <glad/glad.h>
 
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/microprofile.h"
 #include "video_core/buffer_cache/buffer_cache.h"
@@ -22,8 +24,29 @@ using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
 MICROPROFILE_DEFINE(OpenGL_Buffer_Download, "OpenGL", "Buffer Download", MP_RGB(192, 192, 128));
 
-Buffer::Buffer(const Device& device_, VAddr cpu_addr_, std::size_t size_)
-    : BufferBlock{cpu_addr_, size_} {
+std::pair<u8*, GLintptr> ReadbackRing::Reserve(std::size_t size) {
+    if (gl_buffer.handle == 0) {
+        static constexpr GLbitfield flags =
+            GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        gl_buffer.Create();
+        glNamedBufferStorage(gl_buffer.handle, static_cast<GLsizeiptr>(BUFFER_SIZE), nullptr,
+                             flags);
+        mapped_ptr = static_cast<u8*>(
+            glMapNamedBufferRange(gl_buffer.handle, 0, static_cast<GLsizeiptr>(BUFFER_SIZE),
+                                  flags));
+    }
+    buffer_pos = Common::AlignUp(buffer_pos, 4);
+    if (buffer_pos + size > BUFFER_SIZE) {
+        buffer_pos = 0;
+    }
+    const GLintptr offset = static_cast<GLintptr>(buffer_pos);
+    buffer_pos += size;
+    return {mapped_ptr + offset, offset};
+}
+
+Buffer::Buffer(const Device& device_, ReadbackRing& readback_ring_, VAddr cpu_addr_,
+               std::size_t size_)
+    : BufferBlock{cpu_addr_, size_}, readback_ring{readback_ring_} {
     gl_buffer.Create();
     glNamedBufferData(gl_buffer.handle, static_cast<GLsizeiptr>(size_), nullptr, GL_DYNAMIC_DRAW);
     if (device_.UseAssemblyShaders() || device_.HasVertexBufferUnifiedMemory()) {
@@ -43,14 +66,21 @@ void Buffer::Download(std::size_t offset, std::size_t data_size, u8* data) {
     MICROPROFILE_SCOPE(OpenGL_Buffer_Download);
     const GLsizeiptr gl_size = static_cast<GLsizeiptr>(data_size);
     const GLintptr gl_offset = static_cast<GLintptr>(offset);
-    if (read_buffer.handle == 0) {
-        read_buffer.Create();
-        glNamedBufferData(read_buffer.handle, static_cast<GLsizeiptr>(Size()), nullptr,
-                          GL_STREAM_READ);
-    }
     glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
-    glCopyNamedBufferSubData(gl_buffer.handle, read_buffer.handle, gl_offset, gl_offset, gl_size);
-    glGetNamedBufferSubData(read_buffer.handle, gl_offset, gl_size, data);
+    if (!readback_ring.Fits(data_size)) {
+        // Downloads larger than the ring are rare enough to take the blocking path
+        glGetNamedBufferSubData(gl_buffer.handle, gl_offset, gl_size, data);
+        return;
+    }
+    const auto [mapped_ptr, ring_offset] = readback_ring.Reserve(data_size);
+    glCopyNamedBufferSubData(gl_buffer.handle, readback_ring.Handle(), gl_offset, ring_offset,
+                             gl_size);
+    // Wait for the copy alone instead of draining the whole pipeline the way a
+    // glGetNamedBufferSubData on the block would
+    OGLSync fence;
+    fence.Create();
+    glClientWaitSync(fence.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    std::memcpy(data, mapped_ptr, data_size);
 }
 
 void Buffer::CopyFrom(const Buffer& src, std::size_t src_offset, std::size_t dst_offset,
@@ -80,7 +110,7 @@ OGLBufferCache::~OGLBufferCache() {
 }
 
 std::shared_ptr<Buffer> OGLBufferCache::CreateBlock(VAddr cpu_addr, std::size_t size) {
-    return std::make_shared<Buffer>(device, cpu_addr, size);
+    return std::make_shared<Buffer>(device, readback_ring, cpu_addr, size);
 }
 
 OGLBufferCache::BufferInfo OGLBufferCache::GetEmptyBuffer(std::size_t) {
@@ -6,6 +6,7 @@
 
 #include <array>
 #include <memory>
+#include <utility>
 
 #include "common/common_types.h"
 #include "video_core/buffer_cache/buffer_cache.h"
@@ -24,9 +25,35 @@ class OGLStreamBuffer;
 class RasterizerOpenGL;
 class StateTracker;
 
+/// Persistently mapped ring buffer where GPU copies land for CPU readback. Every download is
+/// drained synchronously before the next one is reserved, so wrapping needs no fence tracking.
+class ReadbackRing {
+public:
+    /// Returns the persistently mapped pointer and buffer offset for a download of "size" bytes,
+    /// creating the ring on first use
+    std::pair<u8*, GLintptr> Reserve(std::size_t size);
+
+    GLuint Handle() const noexcept {
+        return gl_buffer.handle;
+    }
+
+    /// Returns true when a download of "size" bytes can go through the ring
+    bool Fits(std::size_t size) const noexcept {
+        return size <= BUFFER_SIZE;
+    }
+
+private:
+    static constexpr std::size_t BUFFER_SIZE = 32 * 1024 * 1024;
+
+    OGLBuffer gl_buffer;
+    u8* mapped_ptr = nullptr;
+    std::size_t buffer_pos = 0;
+};
+
 class Buffer : public VideoCommon::BufferBlock {
 public:
-    explicit Buffer(const Device& device_, VAddr cpu_addr_, std::size_t size_);
+    explicit Buffer(const Device& device_, ReadbackRing& readback_ring_, VAddr cpu_addr_,
+                    std::size_t size_);
     ~Buffer();
 
     void Upload(std::size_t offset, std::size_t data_size, const u8* data);
@@ -46,7 +73,7 @@ public:
 
 private:
     OGLBuffer gl_buffer;
-    OGLBuffer read_buffer;
+    ReadbackRing& readback_ring;
     u64 gpu_address = 0;
 };
 
@@ -76,6 +103,8 @@ private:
 
     const Device& device;
 
+    ReadbackRing readback_ring;
+
     std::size_t cbuf_cursor = 0;
     std::array<GLuint, NUM_CBUFS> cbufs{};
 };
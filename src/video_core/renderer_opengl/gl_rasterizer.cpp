@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <bitset>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -16,6 +17,7 @@
 #include "common/logging/log.h"
 #include "common/math_util.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/hle/kernel/process.h"
@@ -28,6 +30,7 @@
 #include "video_core/renderer_opengl/gl_device.h"
 #include "video_core/renderer_opengl/gl_query_cache.h"
 #include "video_core/renderer_opengl/gl_rasterizer.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
 #include "video_core/renderer_opengl/gl_shader_cache.h"
 #include "video_core/renderer_opengl/gl_texture_cache.h"
 #include "video_core/renderer_opengl/maxwell_to_gl.h"
@@ -204,7 +207,7 @@ RasterizerOpenGL::RasterizerOpenGL(Core::Frontend::EmuWindow& emu_window_, Tegra
     : RasterizerAccelerated(cpu_memory_), gpu(gpu_), maxwell3d(gpu.Maxwell3D()),
       kepler_compute(gpu.KeplerCompute()), gpu_memory(gpu.MemoryManager()), device(device_),
       screen_info(screen_info_), program_manager(program_manager_), state_tracker(state_tracker_),
-      stream_buffer(device, state_tracker),
+      stream_buffer(device),
       texture_cache_runtime(device, program_manager, state_tracker),
       texture_cache(texture_cache_runtime, *this, maxwell3d, kepler_compute, gpu_memory),
       shader_cache(*this, emu_window_, gpu, maxwell3d, kepler_compute, gpu_memory, device),
@@ -346,13 +349,13 @@ void RasterizerOpenGL::SetupVertexInstances() {
     }
 }
 
-GLintptr RasterizerOpenGL::SetupIndexBuffer() {
+GenericBufferCache::BufferInfo RasterizerOpenGL::SetupIndexBuffer() {
     MICROPROFILE_SCOPE(OpenGL_Index);
     const auto& regs = maxwell3d.regs;
     const std::size_t size = CalculateIndexBufferSize();
     const auto info = buffer_cache.UploadMemory(regs.index_array.IndexStart(), size);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, info.handle);
-    return info.offset;
+    return info;
 }
 
 void RasterizerOpenGL::SetupShaders() {
@@ -481,6 +484,7 @@ void RasterizerOpenGL::Clear() {
     if (!maxwell3d.ShouldExecute()) {
         return;
     }
+    FlushPendingDraws();
 
     const auto& regs = maxwell3d.regs;
     bool use_color{};
@@ -548,8 +552,105 @@ void RasterizerOpenGL::Clear() {
     ++num_queued_commands;
 }
 
+bool RasterizerOpenGL::CanBatchDraw(bool is_indexed) const {
+    const auto& regs = maxwell3d.regs;
+    if (!is_indexed || regs.tfb_enabled != 0) {
+        return false;
+    }
+    // Samples from a held-back draw would be attributed to whatever query is active when the
+    // batch is finally emitted, so never hold draws back while a counter is in use.
+    if (regs.samplecnt_enable != 0 ||
+        query_cache.Stream(VideoCore::QueryType::SamplesPassed).IsEnabled()) {
+        return false;
+    }
+    if (pending_draws.empty()) {
+        return true;
+    }
+    // Any register write invalidates the state the pending commands were recorded under
+    if (maxwell3d.dirty.flags.any()) {
+        return false;
+    }
+    if (pending_primitive_mode != MaxwellToGL::PrimitiveTopology(regs.draw.topology) ||
+        pending_index_format != MaxwellToGL::IndexFormat(regs.index_array.format)) {
+        return false;
+    }
+    // Constant buffer binds and the descriptor pools have no dirty flags of their own, and
+    // guest memory writes from the CPU thread can change what the next setup uploads
+    if (batch_state.invalidation_ticks != invalidation_ticks.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (batch_state.tic_address != regs.tic.Address() || batch_state.tic_limit != regs.tic.limit ||
+        batch_state.tsc_address != regs.tsc.Address() || batch_state.tsc_limit != regs.tsc.limit ||
+        batch_state.tex_cb_index != regs.tex_cb_index) {
+        return false;
+    }
+    return std::memcmp(batch_state.shader_stages.data(), maxwell3d.state.shader_stages.data(),
+                       sizeof(batch_state.shader_stages)) == 0;
+}
+
+void RasterizerOpenGL::EmitIndexedDraw(GLenum primitive_mode, GLenum format, GLintptr offset,
+                                       const IndirectDrawCommand& cmd) {
+    const auto num_vertices = static_cast<GLsizei>(cmd.count);
+    const auto num_instances = static_cast<GLsizei>(cmd.num_instances);
+    const GLint base_vertex = cmd.base_vertex;
+    const GLuint base_instance = cmd.base_instance;
+    const GLvoid* const gl_offset = reinterpret_cast<const GLvoid*>(offset);
+    if (num_instances == 1 && base_instance == 0 && base_vertex == 0) {
+        glDrawElements(primitive_mode, num_vertices, format, gl_offset);
+    } else if (num_instances == 1 && base_instance == 0) {
+        glDrawElementsBaseVertex(primitive_mode, num_vertices, format, gl_offset, base_vertex);
+    } else if (base_vertex == 0 && base_instance == 0) {
+        glDrawElementsInstanced(primitive_mode, num_vertices, format, gl_offset, num_instances);
+    } else if (base_vertex == 0) {
+        glDrawElementsInstancedBaseInstance(primitive_mode, num_vertices, format, gl_offset,
+                                            num_instances, base_instance);
+    } else if (base_instance == 0) {
+        glDrawElementsInstancedBaseVertex(primitive_mode, num_vertices, format, gl_offset,
+                                          num_instances, base_vertex);
+    } else {
+        glDrawElementsInstancedBaseVertexBaseInstance(primitive_mode, num_vertices, format,
+                                                      gl_offset, num_instances, base_vertex,
+                                                      base_instance);
+    }
+}
+
+void RasterizerOpenGL::FlushPendingDraws() {
+    if (pending_draws.empty()) {
+        return;
+    }
+    // The batch may be emitted after the index buffer was rebound for the draw that broke it
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, pending_index_buffer);
+    if (pending_draws.size() == 1) {
+        // A single held-back draw does not pay for an indirect buffer upload
+        const IndirectDrawCommand& cmd = pending_draws.front();
+        const auto offset = static_cast<GLintptr>(cmd.first_index) * pending_index_size;
+        EmitIndexedDraw(pending_primitive_mode, pending_index_format, offset, cmd);
+    } else {
+        if (indirect_draw_buffer.handle == 0) {
+            indirect_draw_buffer.Create();
+        }
+        const auto upload_size =
+            static_cast<GLsizeiptr>(pending_draws.size() * sizeof(IndirectDrawCommand));
+        // Orphan the previous contents so the driver renames the storage instead of stalling
+        glNamedBufferData(indirect_draw_buffer.handle, upload_size, pending_draws.data(),
+                          GL_STREAM_DRAW);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect_draw_buffer.handle);
+        glMultiDrawElementsIndirect(pending_primitive_mode, pending_index_format, nullptr,
+                                    static_cast<GLsizei>(pending_draws.size()), 0);
+    }
+    pending_draws.clear();
+}
+
 void RasterizerOpenGL::Draw(bool is_indexed, bool is_instanced) {
     MICROPROFILE_SCOPE(OpenGL_Drawing);
+    Common::AddPerfCounter(Common::PerfCounter::DrawCalls);
+
+    // Held-back draws are only valid while the state they were recorded under is intact, so emit
+    // them before this draw syncs any register change or toggles the sample counter.
+    const bool join_batch = CanBatchDraw(is_indexed);
+    if (!join_batch) {
+        FlushPendingDraws();
+    }
 
     query_cache.UpdateCounters();
 
@@ -592,6 +693,13 @@ void RasterizerOpenGL::Draw(bool is_indexed, bool is_instanced) {
     buffer_size += Maxwell::MaxConstBuffers *
                    (Maxwell::MaxConstBufferSize + device.GetUniformBufferAlignment());
 
+    // Fences guarding stream buffer regions only cover draws that were already issued when they
+    // were created, so emit any held-back draws before this map can fence a region.
+    if (!pending_draws.empty() &&
+        stream_buffer.WouldCrossRegion(static_cast<GLsizeiptr>(buffer_size), 4)) {
+        FlushPendingDraws();
+    }
+
     // Prepare the vertex array.
     buffer_cache.Map(buffer_size);
 
@@ -602,8 +710,11 @@ void RasterizerOpenGL::Draw(bool is_indexed, bool is_instanced) {
     SetupVertexBuffer();
     SetupVertexInstances();
     GLintptr index_buffer_offset = 0;
+    GLuint index_buffer_handle = 0;
     if (is_indexed) {
-        index_buffer_offset = SetupIndexBuffer();
+        const auto info = SetupIndexBuffer();
+        index_buffer_offset = static_cast<GLintptr>(info.offset);
+        index_buffer_handle = info.handle;
     }
 
     // Setup emulation uniform buffer.
@@ -633,26 +744,41 @@ void RasterizerOpenGL::Draw(bool is_indexed, bool is_instanced) {
     const GLsizei num_instances =
         static_cast<GLsizei>(is_instanced ? maxwell3d.mme_draw.instance_count : 1);
     if (is_indexed) {
-        const GLint base_vertex = static_cast<GLint>(maxwell3d.regs.vb_element_base);
-        const GLsizei num_vertices = static_cast<GLsizei>(maxwell3d.regs.index_array.count);
-        const GLvoid* offset = reinterpret_cast<const GLvoid*>(index_buffer_offset);
         const GLenum format = MaxwellToGL::IndexFormat(maxwell3d.regs.index_array.format);
-        if (num_instances == 1 && base_instance == 0 && base_vertex == 0) {
-            glDrawElements(primitive_mode, num_vertices, format, offset);
-        } else if (num_instances == 1 && base_instance == 0) {
-            glDrawElementsBaseVertex(primitive_mode, num_vertices, format, offset, base_vertex);
-        } else if (base_vertex == 0 && base_instance == 0) {
-            glDrawElementsInstanced(primitive_mode, num_vertices, format, offset, num_instances);
-        } else if (base_vertex == 0) {
-            glDrawElementsInstancedBaseInstance(primitive_mode, num_vertices, format, offset,
-                                                num_instances, base_instance);
-        } else if (base_instance == 0) {
-            glDrawElementsInstancedBaseVertex(primitive_mode, num_vertices, format, offset,
-                                              num_instances, base_vertex);
+        const u32 index_size = maxwell3d.regs.index_array.FormatSizeInBytes();
+        const IndirectDrawCommand cmd{
+            .count = maxwell3d.regs.index_array.count,
+            .num_instances = static_cast<GLuint>(num_instances),
+            .first_index = static_cast<GLuint>(index_buffer_offset / index_size),
+            .base_vertex = static_cast<GLint>(maxwell3d.regs.vb_element_base),
+            .base_instance = base_instance,
+        };
+        if (join_batch && index_buffer_offset % index_size == 0) {
+            if (!pending_draws.empty() && pending_index_buffer != index_buffer_handle) {
+                // The index data landed in a different buffer block; the recorded first indices
+                // only make sense against the block they were uploaded to
+                FlushPendingDraws();
+            }
+            if (pending_draws.empty()) {
+                pending_primitive_mode = primitive_mode;
+                pending_index_format = format;
+                pending_index_buffer = index_buffer_handle;
+                pending_index_size = index_size;
+                batch_state.shader_stages = maxwell3d.state.shader_stages;
+                batch_state.tic_address = maxwell3d.regs.tic.Address();
+                batch_state.tic_limit = maxwell3d.regs.tic.limit;
+                batch_state.tsc_address = maxwell3d.regs.tsc.Address();
+                batch_state.tsc_limit = maxwell3d.regs.tsc.limit;
+                batch_state.tex_cb_index = maxwell3d.regs.tex_cb_index;
+                batch_state.invalidation_ticks =
+                    invalidation_ticks.load(std::memory_order_relaxed);
+            }
+            pending_draws.push_back(cmd);
+            if (pending_draws.size() >= MAX_PENDING_DRAWS) {
+                FlushPendingDraws();
+            }
         } else {
-            glDrawElementsInstancedBaseVertexBaseInstance(primitive_mode, num_vertices, format,
-                                                          offset, num_instances, base_vertex,
-                                                          base_instance);
+            EmitIndexedDraw(primitive_mode, format, index_buffer_offset, cmd);
         }
     } else {
         const GLint base_vertex = static_cast<GLint>(maxwell3d.regs.vertex_buffer.first);
@@ -675,6 +801,7 @@ void RasterizerOpenGL::Draw(bool is_indexed, bool is_instanced) {
 }
 
 void RasterizerOpenGL::DispatchCompute(GPUVAddr code_addr) {
+    FlushPendingDraws();
     buffer_cache.Acquire();
     current_cbuf = 0;
 
@@ -698,21 +825,26 @@ void RasterizerOpenGL::DispatchCompute(GPUVAddr code_addr) {
 }
 
 void RasterizerOpenGL::ResetCounter(VideoCore::QueryType type) {
+    FlushPendingDraws();
     query_cache.ResetCounter(type);
 }
 
 void RasterizerOpenGL::Query(GPUVAddr gpu_addr, VideoCore::QueryType type,
                              std::optional<u64> timestamp) {
+    FlushPendingDraws();
     query_cache.Query(gpu_addr, type, timestamp);
 }
 
-void RasterizerOpenGL::FlushAll() {}
+void RasterizerOpenGL::FlushAll() {
+    FlushPendingDraws();
+}
 
 void RasterizerOpenGL::FlushRegion(VAddr addr, u64 size) {
     MICROPROFILE_SCOPE(OpenGL_CacheManagement);
     if (addr == 0 || size == 0) {
         return;
     }
+    FlushPendingDraws();
     {
         auto lock = texture_cache.AcquireLock();
         texture_cache.DownloadMemory(addr, size);
@@ -734,6 +866,9 @@ void RasterizerOpenGL::InvalidateRegion(VAddr addr, u64 size) {
     if (addr == 0 || size == 0) {
         return;
     }
+    // Invalidation can release images and buffers the held-back draws still reference
+    FlushPendingDraws();
+    invalidation_ticks.fetch_add(1, std::memory_order_relaxed);
     {
         auto lock = texture_cache.AcquireLock();
         texture_cache.WriteMemory(addr, size);
@@ -748,6 +883,9 @@ void RasterizerOpenGL::OnCPUWrite(VAddr addr, u64 size) {
     if (addr == 0 || size == 0) {
         return;
     }
+    // This can be called from the CPU thread, so only mark the batch inputs as stale here; the
+    // GPU thread drops the pending batch on the next draw
+    invalidation_ticks.fetch_add(1, std::memory_order_relaxed);
     {
         auto lock = texture_cache.AcquireLock();
         texture_cache.WriteMemory(addr, size);
@@ -758,11 +896,13 @@ void RasterizerOpenGL::OnCPUWrite(VAddr addr, u64 size) {
 
 void RasterizerOpenGL::SyncGuestHost() {
     MICROPROFILE_SCOPE(OpenGL_CacheManagement);
+    invalidation_ticks.fetch_add(1, std::memory_order_relaxed);
     buffer_cache.SyncGuestHost();
     shader_cache.SyncGuestHost();
 }
 
 void RasterizerOpenGL::UnmapMemory(VAddr addr, u64 size) {
+    invalidation_ticks.fetch_add(1, std::memory_order_relaxed);
     {
         auto lock = texture_cache.AcquireLock();
         texture_cache.UnmapMemory(addr, size);
@@ -772,6 +912,7 @@ void RasterizerOpenGL::UnmapMemory(VAddr addr, u64 size) {
 }
 
 void RasterizerOpenGL::SignalSemaphore(GPUVAddr addr, u32 value) {
+    FlushPendingDraws();
     if (!gpu.IsAsync()) {
         gpu_memory.Write<u32>(addr, value);
         return;
@@ -780,6 +921,7 @@ void RasterizerOpenGL::SignalSemaphore(GPUVAddr addr, u32 value) {
 }
 
 void RasterizerOpenGL::SignalSyncPoint(u32 value) {
+    FlushPendingDraws();
     if (!gpu.IsAsync()) {
         gpu.IncrementSyncPoint(value);
         return;
@@ -802,6 +944,7 @@ void RasterizerOpenGL::FlushAndInvalidateRegion(VAddr addr, u64 size) {
 }
 
 void RasterizerOpenGL::WaitForIdle() {
+    FlushPendingDraws();
     // Place a barrier on everything that is not framebuffer related.
     // This is related to another flag that is not currently implemented.
     glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT |
@@ -813,14 +956,17 @@ void RasterizerOpenGL::WaitForIdle() {
 }
 
 void RasterizerOpenGL::FragmentBarrier() {
+    FlushPendingDraws();
     glMemoryBarrier(GL_FRAMEBUFFER_BARRIER_BIT);
 }
 
 void RasterizerOpenGL::TiledCacheBarrier() {
+    FlushPendingDraws();
     glTextureBarrier();
 }
 
 void RasterizerOpenGL::FlushCommands() {
+    FlushPendingDraws();
     // Only flush when we have commands queued to OpenGL.
     if (num_queued_commands == 0) {
         return;
@@ -830,32 +976,53 @@ void RasterizerOpenGL::FlushCommands() {
 }
 
 void RasterizerOpenGL::TickFrame() {
+    FlushPendingDraws();
     // Ticking a frame means that buffers will be swapped, calling glFlush implicitly.
     num_queued_commands = 0;
 
     fence_manager.TickFrame();
     buffer_cache.TickFrame();
+    shader_cache.TickFrame();
     {
         auto lock = texture_cache.AcquireLock();
         texture_cache.TickFrame();
     }
+    TickResourcePools();
+    // Sentenced image views are released above and OpenGL can hand their names to new objects,
+    // so the tracked texture unit state can no longer be trusted
+    state_tracker.InvalidateTextureBindings();
 }
 
 bool RasterizerOpenGL::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Surface& src,
                                              const Tegra::Engines::Fermi2D::Surface& dst,
                                              const Tegra::Engines::Fermi2D::Config& copy_config) {
     MICROPROFILE_SCOPE(OpenGL_Blits);
+    FlushPendingDraws();
     auto lock = texture_cache.AcquireLock();
     texture_cache.BlitImage(dst, src, copy_config);
     return true;
 }
 
+bool RasterizerOpenGL::AccelerateBufferCopy(GPUVAddr src_address, GPUVAddr dst_address,
+                                            std::size_t size) {
+    FlushPendingDraws();
+    return buffer_cache.DMACopy(src_address, dst_address, size);
+}
+
+bool RasterizerOpenGL::AccelerateVideoFrame(const VideoCommon::ImageInfo& info, GPUVAddr gpu_addr,
+                                            std::span<const u8> frame_data) {
+    FlushPendingDraws();
+    auto lock = texture_cache.AcquireLock();
+    return texture_cache.UploadVideoFrame(info, gpu_addr, frame_data);
+}
+
 bool RasterizerOpenGL::AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                          VAddr framebuffer_addr, u32 pixel_stride) {
     if (framebuffer_addr == 0) {
         return false;
     }
     MICROPROFILE_SCOPE(OpenGL_CacheManagement);
+    FlushPendingDraws();
 
     auto lock = texture_cache.AcquireLock();
     ImageView* const image_view{texture_cache.TryFindFramebufferImageView(framebuffer_addr)};
@@ -916,8 +1083,8 @@ void RasterizerOpenGL::BindTextures(const ShaderEntries& entries, GLuint base_te
         ++image_index;
     }
     if (num_samplers > 0) {
-        glBindSamplers(base_texture, static_cast<GLsizei>(num_samplers), samplers);
-        glBindTextures(base_texture, static_cast<GLsizei>(num_samplers), textures);
+        state_tracker.BindSamplers(base_texture, static_cast<GLsizei>(num_samplers), samplers);
+        state_tracker.BindTextures(base_texture, static_cast<GLsizei>(num_samplers), textures);
     }
     if (num_images > 0) {
         glBindImageTextures(base_image, static_cast<GLsizei>(num_images), images);
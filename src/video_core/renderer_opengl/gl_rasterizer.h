@@ -11,6 +11,7 @@
 #include <optional>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <boost/container/static_vector.hpp>
 
@@ -91,6 +92,10 @@ public:
     bool AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Surface& src,
                                const Tegra::Engines::Fermi2D::Surface& dst,
                                const Tegra::Engines::Fermi2D::Config& copy_config) override;
+    bool AccelerateBufferCopy(GPUVAddr src_address, GPUVAddr dst_address,
+                              std::size_t size) override;
+    bool AccelerateVideoFrame(const VideoCommon::ImageInfo& info, GPUVAddr gpu_addr,
+                              std::span<const u8> frame_data) override;
     bool AccelerateDisplay(const Tegra::FramebufferConfig& config, VAddr framebuffer_addr,
                            u32 pixel_stride) override;
     void LoadDiskResources(u64 title_id, const std::atomic_bool& stop_loading,
@@ -114,6 +119,20 @@ private:
     static constexpr size_t MAX_IMAGES = 48;
     static constexpr size_t MAX_IMAGE_VIEWS = MAX_TEXTURES + MAX_IMAGES;
 
+    /// Maximum number of indexed draws held back before the pending batch is forcibly emitted
+    static constexpr std::size_t MAX_PENDING_DRAWS = 64;
+
+    /// Layout OpenGL expects for each entry of GL_DRAW_INDIRECT_BUFFER when calling
+    /// glMultiDrawElementsIndirect
+    struct IndirectDrawCommand {
+        GLuint count;
+        GLuint num_instances;
+        GLuint first_index;
+        GLint base_vertex;
+        GLuint base_instance;
+    };
+    static_assert(sizeof(IndirectDrawCommand) == 20, "IndirectDrawCommand is incorrectly sized");
+
     void BindComputeTextures(Shader* kernel);
 
     void BindTextures(const ShaderEntries& entries, GLuint base_texture, GLuint base_image,
@@ -235,10 +254,21 @@ private:
     void SetupVertexBuffer();
     void SetupVertexInstances();
 
-    GLintptr SetupIndexBuffer();
+    GenericBufferCache::BufferInfo SetupIndexBuffer();
 
     void SetupShaders();
 
+    /// Returns true when the current draw can be appended to the pending indirect batch
+    bool CanBatchDraw(bool is_indexed) const;
+
+    /// Emits the held-back draws, using one glMultiDrawElementsIndirect call when there is more
+    /// than one pending command
+    void FlushPendingDraws();
+
+    /// Issues a single indexed draw with the variant matching its parameters
+    void EmitIndexedDraw(GLenum primitive_mode, GLenum format, GLintptr offset,
+                         const IndirectDrawCommand& cmd);
+
     Tegra::GPU& gpu;
     Tegra::Engines::Maxwell3D& maxwell3d;
     Tegra::Engines::KeplerCompute& kepler_compute;
@@ -280,6 +310,35 @@ private:
     /// Number of commands queued to the OpenGL driver. Resetted on flush.
     std::size_t num_queued_commands = 0;
 
+    /// Indexed draws held back to be emitted in a single multi-draw call. Only valid while the
+    /// state they were recorded under is intact; every entry point that emits or orders OpenGL
+    /// commands flushes them.
+    std::vector<IndirectDrawCommand> pending_draws;
+    GLenum pending_primitive_mode = GL_NONE;
+    GLenum pending_index_format = GL_NONE;
+    GLuint pending_index_buffer = 0;
+    u32 pending_index_size = 0;
+    OGLBuffer indirect_draw_buffer;
+
+    /// Engine state feeding per-draw resource setup that has no dirty flag coverage, captured
+    /// when the pending batch was started. A mismatch invalidates the batch.
+    struct BatchedDrawState {
+        std::array<Tegra::Engines::Maxwell3D::State::ShaderStageInfo,
+                   Tegra::Engines::Maxwell3D::Regs::MaxShaderStage>
+            shader_stages;
+        GPUVAddr tic_address = 0;
+        u32 tic_limit = 0;
+        GPUVAddr tsc_address = 0;
+        u32 tsc_limit = 0;
+        u32 tex_cb_index = 0;
+        u64 invalidation_ticks = 0;
+    };
+    BatchedDrawState batch_state{};
+
+    /// Incremented on guest memory invalidations that can arrive from the CPU thread; compared
+    /// against the value captured in batch_state to drop batches whose inputs may have changed
+    std::atomic<u64> invalidation_ticks{0};
+
     u32 last_clip_distance_mask = 0;
 };
 
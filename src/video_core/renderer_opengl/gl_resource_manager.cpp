@@ -2,8 +2,11 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <deque>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 #include <glad/glad.h>
 #include "common/common_types.h"
 #include "common/microprofile.h"
@@ -15,6 +18,143 @@ MICROPROFILE_DEFINE(OpenGL_ResourceDeletion, "OpenGL", "Resource Deletion", MP_R
 
 namespace OpenGL {
 
+namespace {
+
+/// Number of names created with one glCreateTextures/glGenTextures/glCreateBuffers call when a
+/// pool runs dry
+constexpr GLsizei POOL_BATCH_SIZE = 16;
+
+/// Recycling pools for the resource classes that churn during scene changes. yuzu allocates
+/// immutable storage, so a released name cannot be redefined and handed out again; instead
+/// creation is batched ahead of use, and released names are collected into a generation that is
+/// closed behind a fence each frame and deleted with one batched glDelete* call once the GPU has
+/// drained the work that may still reference them. Not thread safe: all access has to come from
+/// the thread owning the GL context, like every other call in this file.
+struct ResourcePools {
+    /// Names released while one frame's commands were recorded, deletable when its fence signals
+    struct Generation {
+        u64 tag = 0;
+        OGLSync fence;
+        std::vector<GLuint> dead_textures;
+        std::vector<GLuint> dead_buffers;
+    };
+
+    GLuint AllocateTexture(GLenum target) {
+        std::vector<GLuint>& pool = free_textures[target];
+        if (pool.empty()) {
+            pool.resize(POOL_BATCH_SIZE);
+            glCreateTextures(target, POOL_BATCH_SIZE, pool.data());
+        }
+        const GLuint handle = pool.back();
+        pool.pop_back();
+        return handle;
+    }
+
+    GLuint AllocateTextureView() {
+        // Texture views require names that have never been bound, so these never come from a
+        // target pool.
+        if (free_view_names.empty()) {
+            free_view_names.resize(POOL_BATCH_SIZE);
+            glGenTextures(POOL_BATCH_SIZE, free_view_names.data());
+        }
+        const GLuint handle = free_view_names.back();
+        free_view_names.pop_back();
+        return handle;
+    }
+
+    GLuint AllocateBuffer() {
+        if (free_buffers.empty()) {
+            free_buffers.resize(POOL_BATCH_SIZE);
+            glCreateBuffers(POOL_BATCH_SIZE, free_buffers.data());
+        }
+        const GLuint handle = free_buffers.back();
+        free_buffers.pop_back();
+        return handle;
+    }
+
+    void FreeTexture(GLuint handle) {
+        current.dead_textures.push_back(handle);
+    }
+
+    void FreeBuffer(GLuint handle) {
+        current.dead_buffers.push_back(handle);
+    }
+
+    void Tick() {
+        if (!current.dead_textures.empty() || !current.dead_buffers.empty()) {
+            current.tag = ++num_generations;
+            current.fence.Create();
+            generations.push_back(std::move(current));
+            current = Generation{};
+        }
+        while (!generations.empty()) {
+            Generation& gen = generations.front();
+            GLint sync_status = GL_UNSIGNALED;
+            glGetSynciv(gen.fence.handle, GL_SYNC_STATUS, sizeof(GLint), nullptr, &sync_status);
+            if (sync_status != GL_SIGNALED) {
+                break;
+            }
+            DeleteNames(gen);
+            generations.pop_front();
+        }
+    }
+
+    void ReleaseAll() {
+        for (auto& [target, pool] : free_textures) {
+            glDeleteTextures(static_cast<GLsizei>(pool.size()), pool.data());
+        }
+        free_textures.clear();
+        glDeleteTextures(static_cast<GLsizei>(free_view_names.size()), free_view_names.data());
+        free_view_names.clear();
+        glDeleteBuffers(static_cast<GLsizei>(free_buffers.size()), free_buffers.data());
+        free_buffers.clear();
+
+        DeleteNames(current);
+        current = Generation{};
+        for (Generation& gen : generations) {
+            DeleteNames(gen);
+        }
+        generations.clear();
+    }
+
+private:
+    static void DeleteNames(Generation& gen) {
+        glDeleteTextures(static_cast<GLsizei>(gen.dead_textures.size()), gen.dead_textures.data());
+        glDeleteBuffers(static_cast<GLsizei>(gen.dead_buffers.size()), gen.dead_buffers.data());
+        gen.fence.Release();
+    }
+
+    std::unordered_map<GLenum, std::vector<GLuint>> free_textures;
+    std::vector<GLuint> free_view_names;
+    std::vector<GLuint> free_buffers;
+    Generation current;
+    std::deque<Generation> generations;
+    u64 num_generations = 0;
+};
+
+ResourcePools pools;
+bool pools_enabled = false;
+
+} // Anonymous namespace
+
+void InitResourcePools() {
+    pools_enabled = true;
+}
+
+void TickResourcePools() {
+    if (pools_enabled) {
+        pools.Tick();
+    }
+}
+
+void ReleaseResourcePools() {
+    if (!pools_enabled) {
+        return;
+    }
+    pools.ReleaseAll();
+    pools_enabled = false;
+}
+
 void OGLRenderbuffer::Create() {
     if (handle != 0)
         return;
@@ -37,7 +177,11 @@ void OGLTexture::Create(GLenum target) {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceCreation);
-    glCreateTextures(target, 1, &handle);
+    if (pools_enabled) {
+        handle = pools.AllocateTexture(target);
+    } else {
+        glCreateTextures(target, 1, &handle);
+    }
 }
 
 void OGLTexture::Release() {
@@ -45,7 +189,11 @@ void OGLTexture::Release() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceDeletion);
-    glDeleteTextures(1, &handle);
+    if (pools_enabled) {
+        pools.FreeTexture(handle);
+    } else {
+        glDeleteTextures(1, &handle);
+    }
     handle = 0;
 }
 
@@ -54,7 +202,11 @@ void OGLTextureView::Create() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceCreation);
-    glGenTextures(1, &handle);
+    if (pools_enabled) {
+        handle = pools.AllocateTextureView();
+    } else {
+        glGenTextures(1, &handle);
+    }
 }
 
 void OGLTextureView::Release() {
@@ -62,7 +214,11 @@ void OGLTextureView::Release() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceDeletion);
-    glDeleteTextures(1, &handle);
+    if (pools_enabled) {
+        pools.FreeTexture(handle);
+    } else {
+        glDeleteTextures(1, &handle);
+    }
     handle = 0;
 }
 
@@ -159,7 +315,11 @@ void OGLBuffer::Create() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceCreation);
-    glCreateBuffers(1, &handle);
+    if (pools_enabled) {
+        handle = pools.AllocateBuffer();
+    } else {
+        glCreateBuffers(1, &handle);
+    }
 }
 
 void OGLBuffer::Release() {
@@ -167,7 +327,11 @@ void OGLBuffer::Release() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceDeletion);
-    glDeleteBuffers(1, &handle);
+    if (pools_enabled) {
+        pools.FreeBuffer(handle);
+    } else {
+        glDeleteBuffers(1, &handle);
+    }
     handle = 0;
 }
 
@@ -12,6 +12,20 @@
 
 namespace OpenGL {
 
+/// Enables the recycling pools backing OGLTexture, OGLTextureView and OGLBuffer. While enabled,
+/// names are created in batches ahead of use and released names are deleted in batches, deferred
+/// behind a fence until the GPU has drained the work that may still reference them. Until this is
+/// called the wrappers fall back to one-name-at-a-time creation and deletion.
+void InitResourcePools();
+
+/// Closes the current deletion generation behind a fence and retires the generations whose fences
+/// have signaled. Call once per frame from the thread owning the GL context.
+void TickResourcePools();
+
+/// Destroys every pooled name and disables the pools. Must be called while the context that
+/// created the names is still current.
+void ReleaseResourcePools();
+
 class OGLRenderbuffer : private NonCopyable {
 public:
     OGLRenderbuffer() = default;
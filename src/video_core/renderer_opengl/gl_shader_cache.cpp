@@ -169,8 +169,7 @@ ProgramSharedPtr BuildShader(const Device& device, ShaderType shader_type, u64 u
     auto program = std::make_shared<ProgramHandle>();
 
     if (device.UseAssemblyShaders()) {
-        const std::string arb =
-            DecompileAssemblyShader(device, ir, registry, shader_type, shader_id);
+        std::string arb = DecompileAssemblyShader(device, ir, registry, shader_type, shader_id);
 
         GLuint& arb_prog = program->assembly_program.handle;
 
@@ -190,6 +189,10 @@ ProgramSharedPtr BuildShader(const Device& device, ShaderType shader_type, u64 u
             LOG_CRITICAL(Render_OpenGL, "{}", err);
             LOG_INFO(Render_OpenGL, "\n{}", arb);
         }
+        if (hint_retrievable) {
+            // Keep the decompiled code around to dump it to the precompiled cache
+            program->assembly_code = std::move(arb);
+        }
     } else {
         const std::string glsl = DecompileShader(device, ir, registry, shader_type, shader_id);
         OGLShader shader;
@@ -340,8 +343,8 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
     }
 
     std::vector<ShaderDiskCachePrecompiled> gl_cache;
-    if (!device.UseAssemblyShaders() && !device.UseDriverCache()) {
-        // Only load precompiled cache when we are not using assembly shaders
+    if (device.UseAssemblyShaders() || !device.UseDriverCache()) {
+        // Load the precompiled cache unless the driver already caches GLSL programs for us
         gl_cache = disk_cache.LoadPrecompiled();
     }
     const auto supported_formats = GetSupportedFormats();
@@ -390,7 +393,7 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
                 }
             }
             if (!program) {
-                // Otherwise compile it from GLSL
+                // Otherwise compile it from the shader IR
                 program = BuildShader(device, entry.type, uid, ir, *registry, true);
             }
 
@@ -435,8 +438,8 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
         return;
     }
 
-    if (device.UseAssemblyShaders() || device.UseDriverCache()) {
-        // Don't store precompiled binaries for assembly shaders or when using the driver cache
+    if (!device.UseAssemblyShaders() && device.UseDriverCache()) {
+        // Don't store precompiled binaries when the driver already caches GLSL programs
         return;
     }
 
@@ -446,9 +449,19 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
     for (std::size_t i = 0; i < transferable->size(); ++i) {
         const u64 id = (*transferable)[i].unique_identifier;
         const auto it = find_precompiled(id);
-        if (it == gl_cache.end()) {
-            const GLuint program = runtime_cache.at(id).program->source_program.handle;
-            disk_cache.SavePrecompiled(id, program);
+        if (it != gl_cache.end()) {
+            continue;
+        }
+        ProgramHandle& program = *runtime_cache.at(id).program;
+        if (device.UseAssemblyShaders()) {
+            if (!program.assembly_code.empty()) {
+                disk_cache.SavePrecompiledAssembly(id, program.assembly_code);
+                program.assembly_code.clear();
+                program.assembly_code.shrink_to_fit();
+                precompiled_cache_altered = true;
+            }
+        } else {
+            disk_cache.SavePrecompiled(id, program.source_program.handle);
             precompiled_cache_altered = true;
         }
     }
@@ -461,6 +474,28 @@ void ShaderCacheOpenGL::LoadDiskCache(u64 title_id, const std::atomic_bool& stop
 ProgramSharedPtr ShaderCacheOpenGL::GeneratePrecompiledProgram(
     const ShaderDiskCacheEntry& entry, const ShaderDiskCachePrecompiled& precompiled_entry,
     const std::unordered_set<GLenum>& supported_formats) {
+    if (device.UseAssemblyShaders()) {
+        if (precompiled_entry.assembly.empty()) {
+            LOG_INFO(Render_OpenGL, "Precompiled cache entry is not an assembly program, removing");
+            return {};
+        }
+        auto program = std::make_shared<ProgramHandle>();
+        GLuint& handle = program->assembly_program.handle;
+        glGenProgramsARB(1, &handle);
+        glNamedProgramStringEXT(handle, AssemblyEnum(entry.type), GL_PROGRAM_FORMAT_ASCII_ARB,
+                                static_cast<GLsizei>(precompiled_entry.assembly.size()),
+                                precompiled_entry.assembly.data());
+        const auto err = reinterpret_cast<const char*>(glGetString(GL_PROGRAM_ERROR_STRING_NV));
+        if (err && *err) {
+            LOG_INFO(Render_OpenGL, "Cached assembly program rejected by the driver, removing");
+            return {};
+        }
+        return program;
+    }
+    if (!precompiled_entry.assembly.empty()) {
+        LOG_INFO(Render_OpenGL, "Precompiled cache entry is an assembly program, removing");
+        return {};
+    }
     if (!supported_formats.contains(precompiled_entry.binary_format)) {
         LOG_INFO(Render_OpenGL, "Precompiled cache entry with unsupported format, removing");
         return {};
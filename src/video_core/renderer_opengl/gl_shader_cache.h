@@ -47,6 +47,8 @@ using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 struct ProgramHandle {
     OGLProgram source_program;
     OGLAssemblyProgram assembly_program;
+    /// Decompiled assembly code, kept around only to dump it to the precompiled cache
+    std::string assembly_code;
 };
 using ProgramSharedPtr = std::shared_ptr<ProgramHandle>;
 
@@ -304,17 +304,30 @@ std::optional<std::vector<ShaderDiskCachePrecompiled>> ShaderDiskCacheOpenGL::Lo
 
     std::vector<ShaderDiskCachePrecompiled> entries;
     while (precompiled_cache_virtual_file_offset < precompiled_cache_virtual_file.GetSize()) {
-        u32 binary_size;
+        u8 is_assembly;
+        u32 size;
         auto& entry = entries.emplace_back();
         if (!LoadObjectFromPrecompiled(entry.unique_identifier) ||
-            !LoadObjectFromPrecompiled(entry.binary_format) ||
-            !LoadObjectFromPrecompiled(binary_size)) {
+            !LoadObjectFromPrecompiled(is_assembly)) {
             return std::nullopt;
         }
-
-        entry.binary.resize(binary_size);
-        if (!LoadArrayFromPrecompiled(entry.binary.data(), entry.binary.size())) {
-            return std::nullopt;
+        if (is_assembly != 0) {
+            if (!LoadObjectFromPrecompiled(size)) {
+                return std::nullopt;
+            }
+            entry.assembly.resize(size);
+            if (!LoadArrayFromPrecompiled(entry.assembly.data(), entry.assembly.size())) {
+                return std::nullopt;
+            }
+        } else {
+            if (!LoadObjectFromPrecompiled(entry.binary_format) ||
+                !LoadObjectFromPrecompiled(size)) {
+                return std::nullopt;
+            }
+            entry.binary.resize(size);
+            if (!LoadArrayFromPrecompiled(entry.binary.data(), entry.binary.size())) {
+                return std::nullopt;
+            }
         }
     }
     return entries;
@@ -381,7 +394,8 @@ void ShaderDiskCacheOpenGL::SavePrecompiled(u64 unique_identifier, GLuint progra
     std::vector<u8> binary(binary_length);
     glGetProgramBinary(program, binary_length, nullptr, &binary_format, binary.data());
 
-    if (!SaveObjectToPrecompiled(unique_identifier) || !SaveObjectToPrecompiled(binary_format) ||
+    if (!SaveObjectToPrecompiled(unique_identifier) || !SaveObjectToPrecompiled(false) ||
+        !SaveObjectToPrecompiled(binary_format) ||
         !SaveObjectToPrecompiled(static_cast<u32>(binary.size())) ||
         !SaveArrayToPrecompiled(binary.data(), binary.size())) {
         LOG_ERROR(Render_OpenGL, "Failed to save binary program file in shader={:016X}, removing",
@@ -390,6 +404,25 @@ void ShaderDiskCacheOpenGL::SavePrecompiled(u64 unique_identifier, GLuint progra
     }
 }
 
+void ShaderDiskCacheOpenGL::SavePrecompiledAssembly(u64 unique_identifier, std::string_view code) {
+    if (!is_usable) {
+        return;
+    }
+
+    if (precompiled_cache_virtual_file.GetSize() == 0) {
+        SavePrecompiledHeaderToVirtualPrecompiledCache();
+    }
+
+    if (!SaveObjectToPrecompiled(unique_identifier) || !SaveObjectToPrecompiled(true) ||
+        !SaveObjectToPrecompiled(static_cast<u32>(code.size())) ||
+        !SaveArrayToPrecompiled(code.data(), code.size())) {
+        LOG_ERROR(Render_OpenGL,
+                  "Failed to save assembly program file in shader={:016X}, removing",
+                  unique_identifier);
+        InvalidatePrecompiled();
+    }
+}
+
 Common::FS::IOFile ShaderDiskCacheOpenGL::AppendTransferableFile() const {
     if (!EnsureDirectories()) {
         return {};
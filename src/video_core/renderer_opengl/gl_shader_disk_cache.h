@@ -6,6 +6,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -57,11 +58,12 @@ struct ShaderDiskCacheEntry {
     VideoCommon::Shader::BindlessSamplerMap bindless_samplers;
 };
 
-/// Contains an OpenGL dumped binary program
+/// Contains an OpenGL dumped binary program or a decompiled assembly program
 struct ShaderDiskCachePrecompiled {
     u64 unique_identifier = 0;
     GLenum binary_format = 0;
     std::vector<u8> binary;
+    std::string assembly;
 };
 
 class ShaderDiskCacheOpenGL {
@@ -90,6 +92,9 @@ public:
     /// Saves a dump entry to the precompiled file. Does not check for collisions.
     void SavePrecompiled(u64 unique_identifier, GLuint program);
 
+    /// Saves a decompiled assembly program to the precompiled file. Does not check for collisions.
+    void SavePrecompiledAssembly(u64 unique_identifier, std::string_view code);
+
     /// Serializes virtual precompiled shader cache file to real file
     void SaveVirtualPrecompiledFile();
 
@@ -26,7 +26,7 @@ using Regs = Maxwell3D::Regs;
 using Tables = Maxwell3D::DirtyState::Tables;
 using Table = Maxwell3D::DirtyState::Table;
 
-void SetupDirtyColorMasks(Tables& tables) {
+constexpr void SetupDirtyColorMasks(Tables& tables) {
     tables[0][OFF(color_mask_common)] = ColorMaskCommon;
     for (std::size_t rt = 0; rt < Regs::NumRenderTargets; ++rt) {
         const std::size_t offset = OFF(color_mask) + rt * NUM(color_mask[0]);
@@ -36,9 +36,9 @@ void SetupDirtyColorMasks(Tables& tables) {
     FillBlock(tables[1], OFF(color_mask), NUM(color_mask), ColorMasks);
 }
 
-void SetupDirtyVertexArrays(Tables& tables) {
-    static constexpr std::size_t num_array = 3;
-    static constexpr std::size_t instance_base_offset = 3;
+constexpr void SetupDirtyVertexArrays(Tables& tables) {
+    constexpr std::size_t num_array = 3;
+    constexpr std::size_t instance_base_offset = 3;
     for (std::size_t i = 0; i < Regs::NumVertexArrays; ++i) {
         const std::size_t array_offset = OFF(vertex_array) + i * NUM(vertex_array[0]);
         const std::size_t limit_offset = OFF(vertex_array_limit) + i * NUM(vertex_array_limit[0]);
@@ -56,7 +56,7 @@ void SetupDirtyVertexArrays(Tables& tables) {
     }
 }
 
-void SetupDirtyVertexFormat(Tables& tables) {
+constexpr void SetupDirtyVertexFormat(Tables& tables) {
     for (std::size_t i = 0; i < Regs::NumVertexAttributes; ++i) {
         const std::size_t offset = OFF(vertex_attrib_format) + i * NUM(vertex_attrib_format[0]);
         FillBlock(tables[0], offset, NUM(vertex_attrib_format[0]), VertexFormat0 + i);
@@ -65,7 +65,7 @@ void SetupDirtyVertexFormat(Tables& tables) {
     FillBlock(tables[1], OFF(vertex_attrib_format), Regs::NumVertexAttributes, VertexFormats);
 }
 
-void SetupDirtyViewports(Tables& tables) {
+constexpr void SetupDirtyViewports(Tables& tables) {
     for (std::size_t i = 0; i < Regs::NumViewports; ++i) {
         const std::size_t transf_offset = OFF(viewport_transform) + i * NUM(viewport_transform[0]);
         const std::size_t viewport_offset = OFF(viewports) + i * NUM(viewports[0]);
@@ -81,7 +81,7 @@ void SetupDirtyViewports(Tables& tables) {
     tables[1][OFF(viewport_transform_enabled)] = Viewports;
 }
 
-void SetupDirtyScissors(Tables& tables) {
+constexpr void SetupDirtyScissors(Tables& tables) {
     for (std::size_t i = 0; i < Regs::NumViewports; ++i) {
         const std::size_t offset = OFF(scissor_test) + i * NUM(scissor_test[0]);
         FillBlock(tables[0], offset, NUM(scissor_test[0]), Scissor0 + i);
@@ -89,12 +89,12 @@ void SetupDirtyScissors(Tables& tables) {
     FillBlock(tables[1], OFF(scissor_test), NUM(scissor_test), Scissors);
 }
 
-void SetupDirtyShaders(Tables& tables) {
+constexpr void SetupDirtyShaders(Tables& tables) {
     FillBlock(tables[0], OFF(shader_config[0]), NUM(shader_config[0]) * Regs::MaxShaderProgram,
               Shaders);
 }
 
-void SetupDirtyPolygonModes(Tables& tables) {
+constexpr void SetupDirtyPolygonModes(Tables& tables) {
     tables[0][OFF(polygon_mode_front)] = PolygonModeFront;
     tables[0][OFF(polygon_mode_back)] = PolygonModeBack;
 
@@ -103,15 +103,15 @@ void SetupDirtyPolygonModes(Tables& tables) {
     tables[0][OFF(fill_rectangle)] = PolygonModes;
 }
 
-void SetupDirtyDepthTest(Tables& tables) {
+constexpr void SetupDirtyDepthTest(Tables& tables) {
     auto& table = tables[0];
     table[OFF(depth_test_enable)] = DepthTest;
     table[OFF(depth_write_enabled)] = DepthMask;
     table[OFF(depth_test_func)] = DepthTest;
 }
 
-void SetupDirtyStencilTest(Tables& tables) {
-    static constexpr std::array offsets = {
+constexpr void SetupDirtyStencilTest(Tables& tables) {
+    constexpr std::array offsets = {
         OFF(stencil_enable),          OFF(stencil_front_func_func), OFF(stencil_front_func_ref),
         OFF(stencil_front_func_mask), OFF(stencil_front_op_fail),   OFF(stencil_front_op_zfail),
         OFF(stencil_front_op_zpass),  OFF(stencil_front_mask),      OFF(stencil_two_side_enable),
@@ -123,14 +123,14 @@ void SetupDirtyStencilTest(Tables& tables) {
     }
 }
 
-void SetupDirtyAlphaTest(Tables& tables) {
+constexpr void SetupDirtyAlphaTest(Tables& tables) {
     auto& table = tables[0];
     table[OFF(alpha_test_ref)] = AlphaTest;
     table[OFF(alpha_test_func)] = AlphaTest;
     table[OFF(alpha_test_enabled)] = AlphaTest;
 }
 
-void SetupDirtyBlend(Tables& tables) {
+constexpr void SetupDirtyBlend(Tables& tables) {
     FillBlock(tables[0], OFF(blend_color), NUM(blend_color), BlendColor);
 
     tables[0][OFF(independent_blend_enable)] = BlendIndependentEnabled;
@@ -145,11 +145,11 @@ void SetupDirtyBlend(Tables& tables) {
     FillBlock(tables[1], OFF(blend), NUM(blend), BlendStates);
 }
 
-void SetupDirtyPrimitiveRestart(Tables& tables) {
+constexpr void SetupDirtyPrimitiveRestart(Tables& tables) {
     FillBlock(tables[0], OFF(primitive_restart), NUM(primitive_restart), PrimitiveRestart);
 }
 
-void SetupDirtyPolygonOffset(Tables& tables) {
+constexpr void SetupDirtyPolygonOffset(Tables& tables) {
     auto& table = tables[0];
     table[OFF(polygon_offset_fill_enable)] = PolygonOffset;
     table[OFF(polygon_offset_line_enable)] = PolygonOffset;
@@ -159,49 +159,49 @@ void SetupDirtyPolygonOffset(Tables& tables) {
     table[OFF(polygon_offset_clamp)] = PolygonOffset;
 }
 
-void SetupDirtyMultisampleControl(Tables& tables) {
+constexpr void SetupDirtyMultisampleControl(Tables& tables) {
     FillBlock(tables[0], OFF(multisample_control), NUM(multisample_control), MultisampleControl);
 }
 
-void SetupDirtyRasterizeEnable(Tables& tables) {
+constexpr void SetupDirtyRasterizeEnable(Tables& tables) {
     tables[0][OFF(rasterize_enable)] = RasterizeEnable;
 }
 
-void SetupDirtyFramebufferSRGB(Tables& tables) {
+constexpr void SetupDirtyFramebufferSRGB(Tables& tables) {
     tables[0][OFF(framebuffer_srgb)] = FramebufferSRGB;
 }
 
-void SetupDirtyLogicOp(Tables& tables) {
+constexpr void SetupDirtyLogicOp(Tables& tables) {
     FillBlock(tables[0], OFF(logic_op), NUM(logic_op), LogicOp);
 }
 
-void SetupDirtyFragmentClampColor(Tables& tables) {
+constexpr void SetupDirtyFragmentClampColor(Tables& tables) {
     tables[0][OFF(frag_color_clamp)] = FragmentClampColor;
 }
 
-void SetupDirtyPointSize(Tables& tables) {
+constexpr void SetupDirtyPointSize(Tables& tables) {
     tables[0][OFF(vp_point_size)] = PointSize;
     tables[0][OFF(point_size)] = PointSize;
     tables[0][OFF(point_sprite_enable)] = PointSize;
 }
 
-void SetupDirtyLineWidth(Tables& tables) {
+constexpr void SetupDirtyLineWidth(Tables& tables) {
     tables[0][OFF(line_width_smooth)] = LineWidth;
     tables[0][OFF(line_width_aliased)] = LineWidth;
     tables[0][OFF(line_smooth_enable)] = LineWidth;
 }
 
-void SetupDirtyClipControl(Tables& tables) {
+constexpr void SetupDirtyClipControl(Tables& tables) {
     auto& table = tables[0];
     table[OFF(screen_y_control)] = ClipControl;
     table[OFF(depth_mode)] = ClipControl;
 }
 
-void SetupDirtyDepthClampEnabled(Tables& tables) {
+constexpr void SetupDirtyDepthClampEnabled(Tables& tables) {
     tables[0][OFF(view_volume_clip_control)] = DepthClampEnabled;
 }
 
-void SetupDirtyMisc(Tables& tables) {
+constexpr void SetupDirtyMisc(Tables& tables) {
     auto& table = tables[0];
 
     table[OFF(clip_distance_enabled)] = ClipDistances;
@@ -212,11 +212,8 @@ void SetupDirtyMisc(Tables& tables) {
     table[OFF(cull_face)] = CullTest;
 }
 
-} // Anonymous namespace
-
-StateTracker::StateTracker(Tegra::GPU& gpu) : flags{gpu.Maxwell3D().dirty.flags} {
-    auto& dirty = gpu.Maxwell3D().dirty;
-    auto& tables = dirty.tables;
+constexpr Tables MakeDirtyTables() {
+    Tables tables{};
     SetupDirtyRenderTargets(tables);
     SetupDirtyColorMasks(tables);
     SetupDirtyViewports(tables);
@@ -241,6 +238,17 @@ StateTracker::StateTracker(Tegra::GPU& gpu) : flags{gpu.Maxwell3D().dirty.flags}
     SetupDirtyClipControl(tables);
     SetupDirtyDepthClampEnabled(tables);
     SetupDirtyMisc(tables);
+    return tables;
+}
+
+/// Baked at compile time so renderer initialization only copies it in place
+constexpr Tables DIRTY_TABLES = MakeDirtyTables();
+
+} // Anonymous namespace
+
+StateTracker::StateTracker(Tegra::GPU& gpu) : flags{gpu.Maxwell3D().dirty.flags} {
+    auto& dirty = gpu.Maxwell3D().dirty;
+    dirty.tables = DIRTY_TABLES;
 
     auto& store = dirty.on_write_stores;
     store[VertexBuffers] = true;
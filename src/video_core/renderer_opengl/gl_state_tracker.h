@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <limits>
 
 #include <glad/glad.h>
@@ -110,6 +112,30 @@ public:
         glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
     }
 
+    void BindSamplers(GLuint first, GLsizei count, const GLuint* handles) {
+        if (std::equal(handles, handles + count, bound_samplers.begin() + first)) {
+            return;
+        }
+        std::copy_n(handles, count, bound_samplers.begin() + first);
+        glBindSamplers(first, count, handles);
+    }
+
+    void BindTextures(GLuint first, GLsizei count, const GLuint* handles) {
+        if (std::equal(handles, handles + count, bound_textures.begin() + first)) {
+            return;
+        }
+        std::copy_n(handles, count, bound_textures.begin() + first);
+        glBindTextures(first, count, handles);
+    }
+
+    /// Forgets the tracked texture unit state. Has to be called when bindings are changed behind
+    /// the tracker's back or when deleted handles can be reused by new objects.
+    /// @note Image units are not tracked because the util shaders rebind them unconditionally.
+    void InvalidateTextureBindings() {
+        bound_samplers.fill(INVALID_BINDING);
+        bound_textures.fill(INVALID_BINDING);
+    }
+
     void NotifyScreenDrawVertexArray() {
         flags[OpenGL::Dirty::VertexFormats] = true;
         flags[OpenGL::Dirty::VertexFormat0 + 0] = true;
@@ -198,10 +224,18 @@ public:
     }
 
 private:
+    static constexpr std::size_t NUM_TEXTURES = 192;
+
+    /// Handle that never matches a valid OpenGL name so the first bind is never skipped
+    static constexpr GLuint INVALID_BINDING = std::numeric_limits<GLuint>::max();
+
     Tegra::Engines::Maxwell3D::DirtyState::Flags& flags;
 
     GLuint framebuffer = 0;
     GLuint index_buffer = 0;
+
+    std::array<GLuint, NUM_TEXTURES> bound_samplers{};
+    std::array<GLuint, NUM_TEXTURES> bound_textures{};
 };
 
 } // namespace OpenGL
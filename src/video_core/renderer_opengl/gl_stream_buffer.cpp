@@ -9,22 +9,19 @@
 #include "common/assert.h"
 #include "common/microprofile.h"
 #include "video_core/renderer_opengl/gl_device.h"
-#include "video_core/renderer_opengl/gl_state_tracker.h"
 #include "video_core/renderer_opengl/gl_stream_buffer.h"
 
-MICROPROFILE_DEFINE(OpenGL_StreamBuffer, "OpenGL", "Stream Buffer Orphaning",
-                    MP_RGB(128, 128, 192));
+MICROPROFILE_DEFINE(OpenGL_StreamBuffer, "OpenGL", "Stream Buffer Wait", MP_RGB(128, 128, 192));
 
 namespace OpenGL {
 
-OGLStreamBuffer::OGLStreamBuffer(const Device& device, StateTracker& state_tracker_)
-    : state_tracker{state_tracker_} {
+OGLStreamBuffer::OGLStreamBuffer(const Device& device) {
     gl_buffer.Create();
 
-    static constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT;
+    static constexpr GLbitfield flags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
     glNamedBufferStorage(gl_buffer.handle, BUFFER_SIZE, nullptr, flags);
-    mapped_ptr = static_cast<u8*>(
-        glMapNamedBufferRange(gl_buffer.handle, 0, BUFFER_SIZE, flags | GL_MAP_FLUSH_EXPLICIT_BIT));
+    mapped_ptr = static_cast<u8*>(glMapNamedBufferRange(gl_buffer.handle, 0, BUFFER_SIZE, flags));
 
     if (device.UseAssemblyShaders() || device.HasVertexBufferUnifiedMemory()) {
         glMakeNamedBufferResidentNV(gl_buffer.handle, GL_READ_ONLY);
@@ -47,11 +44,20 @@ std::pair<u8*, GLintptr> OGLStreamBuffer::Map(GLsizeiptr size, GLintptr alignmen
     }
 
     if (buffer_pos + size > BUFFER_SIZE) {
-        MICROPROFILE_SCOPE(OpenGL_StreamBuffer);
-        glInvalidateBufferData(gl_buffer.handle);
-        state_tracker.InvalidateStreamBuffer();
-
+        // Guard everything written this lap before wrapping around
+        for (std::size_t region = current_region; region < NUM_REGIONS; ++region) {
+            region_fences[region].Create();
+        }
+        current_region = 0;
         buffer_pos = 0;
+        WaitRegion(0);
+    }
+
+    const auto last_region = static_cast<std::size_t>((buffer_pos + size - 1) / REGION_SIZE);
+    while (current_region < last_region) {
+        // Guard the region we are leaving and wait for the GPU to be done with the next one
+        region_fences[current_region].Create();
+        WaitRegion(++current_region);
     }
 
     return std::make_pair(mapped_ptr + buffer_pos, buffer_pos);
@@ -60,11 +66,17 @@ std::pair<u8*, GLintptr> OGLStreamBuffer::Map(GLsizeiptr size, GLintptr alignmen
 void OGLStreamBuffer::Unmap(GLsizeiptr size) {
     ASSERT(size <= mapped_size);
 
-    if (size > 0) {
-        glFlushMappedNamedBufferRange(gl_buffer.handle, buffer_pos, size);
-    }
-
     buffer_pos += size;
 }
 
+void OGLStreamBuffer::WaitRegion(std::size_t region) {
+    OGLSync& fence = region_fences[region];
+    if (fence.handle == 0) {
+        return;
+    }
+    MICROPROFILE_SCOPE(OpenGL_StreamBuffer);
+    glClientWaitSync(fence.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    fence.Release();
+}
+
 } // namespace OpenGL
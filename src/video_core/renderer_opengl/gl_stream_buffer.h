@@ -4,27 +4,28 @@
 
 #pragma once
 
+#include <array>
 #include <utility>
 
 #include <glad/glad.h>
 
+#include "common/alignment.h"
 #include "common/common_types.h"
 #include "video_core/renderer_opengl/gl_resource_manager.h"
 
 namespace OpenGL {
 
 class Device;
-class StateTracker;
 
 class OGLStreamBuffer : private NonCopyable {
 public:
-    explicit OGLStreamBuffer(const Device& device, StateTracker& state_tracker_);
+    explicit OGLStreamBuffer(const Device& device);
     ~OGLStreamBuffer();
 
     /*
      * Allocates a linear chunk of memory in the GPU buffer with at least "size" bytes
      * and the optional alignment requirement.
-     * If the buffer is full, the whole buffer is reallocated which invalidates old chunks.
+     * If a chunk of the buffer is still in use by the GPU, this blocks until it is free.
      * The return values are the pointer to the new chunk, and the offset within the buffer.
      * The actual used size must be specified on unmapping the chunk.
      */
@@ -44,13 +45,32 @@ public:
         return BUFFER_SIZE;
     }
 
+    /// Returns true when mapping "size" bytes would fence or recycle a region. Draw commands the
+    /// caller is holding back have to be emitted first so that the new fences cover them.
+    bool WouldCrossRegion(GLsizeiptr size, GLintptr alignment = 0) const {
+        std::size_t pos = static_cast<std::size_t>(buffer_pos);
+        if (alignment > 0) {
+            pos = Common::AlignUp(pos, static_cast<std::size_t>(alignment));
+        }
+        if (static_cast<GLsizeiptr>(pos) + size > BUFFER_SIZE) {
+            return true;
+        }
+        return (pos + static_cast<std::size_t>(size) - 1) / REGION_SIZE > current_region;
+    }
+
 private:
-    static constexpr GLsizeiptr BUFFER_SIZE = 256 * 1024 * 1024;
+    /// Blocks until the GPU is done with the given region and releases its guard
+    void WaitRegion(std::size_t region);
 
-    StateTracker& state_tracker;
+    static constexpr GLsizeiptr BUFFER_SIZE = 256 * 1024 * 1024;
+    static constexpr std::size_t NUM_REGIONS = 3;
+    static constexpr GLsizeiptr REGION_SIZE = BUFFER_SIZE / NUM_REGIONS;
 
     OGLBuffer gl_buffer;
 
+    std::array<OGLSync, NUM_REGIONS> region_fences;
+    std::size_t current_region = 0;
+
     GLuint64EXT gpu_address = 0;
     GLintptr buffer_pos = 0;
     GLsizeiptr mapped_size = 0;
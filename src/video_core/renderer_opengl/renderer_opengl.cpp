@@ -134,7 +134,11 @@ RendererOpenGL::RendererOpenGL(Core::TelemetrySession& telemetry_session_,
     : RendererBase{emu_window_, std::move(context_)}, telemetry_session{telemetry_session_},
       emu_window{emu_window_}, cpu_memory{cpu_memory_}, gpu{gpu_}, program_manager{device} {}
 
-RendererOpenGL::~RendererOpenGL() = default;
+RendererOpenGL::~RendererOpenGL() {
+    // Flush and disable the recycling pools first, so the names released while the caches tear
+    // down below are deleted immediately instead of outliving the context inside a pool.
+    ReleaseResourcePools();
+}
 
 void RendererOpenGL::SwapBuffers(const Tegra::FramebufferConfig* framebuffer) {
     if (!framebuffer) {
@@ -404,6 +408,7 @@ void RendererOpenGL::DrawScreen(const Layout::FramebufferLayout& layout) {
     state_tracker.NotifyLogicOp();
     state_tracker.NotifyClipControl();
     state_tracker.NotifyAlphaTest();
+    state_tracker.InvalidateTextureBindings();
 
     program_manager.BindHostPipeline(pipeline.handle);
 
@@ -458,7 +463,8 @@ void RendererOpenGL::DrawScreen(const Layout::FramebufferLayout& layout) {
 }
 
 void RendererOpenGL::RenderScreenshot() {
-    if (!renderer_settings.screenshot_requested) {
+    CheckScreenshotReadback();
+    if (!renderer_settings.screenshot_requested || screenshot_readback.has_value()) {
         return;
     }
 
@@ -482,16 +488,40 @@ void RendererOpenGL::RenderScreenshot() {
 
     DrawScreen(layout);
 
-    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    // Read into a pixel buffer and fence the transfer instead of waiting for it; the readback
+    // completes in CheckScreenshotReadback on a later frame without stalling the render thread.
+    ScreenshotReadback readback;
+    readback.size = static_cast<std::size_t>(layout.width) * layout.height * 4;
+    readback.pbo.Create();
+    glNamedBufferData(readback.pbo.handle, static_cast<GLsizeiptr>(readback.size), nullptr,
+                      GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo.handle);
     glPixelStorei(GL_PACK_ROW_LENGTH, 0);
-    glReadPixels(0, 0, layout.width, layout.height, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV,
-                 renderer_settings.screenshot_bits);
+    glReadPixels(0, 0, layout.width, layout.height, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readback.sync.Create();
+    screenshot_readback = std::move(readback);
 
     screenshot_framebuffer.Release();
     glDeleteRenderbuffers(1, &renderbuffer);
 
     glBindFramebuffer(GL_READ_FRAMEBUFFER, old_read_fb);
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, old_draw_fb);
+}
+
+void RendererOpenGL::CheckScreenshotReadback() {
+    if (!screenshot_readback) {
+        return;
+    }
+    GLint status = GL_UNSIGNALED;
+    glGetSynciv(screenshot_readback->sync.handle, GL_SYNC_STATUS, sizeof(status), nullptr, &status);
+    if (status != GL_SIGNALED) {
+        return;
+    }
+    glGetNamedBufferSubData(screenshot_readback->pbo.handle, 0,
+                            static_cast<GLsizeiptr>(screenshot_readback->size),
+                            renderer_settings.screenshot_bits);
+    screenshot_readback.reset();
 
     renderer_settings.screenshot_complete_callback();
     renderer_settings.screenshot_requested = false;
@@ -510,6 +540,7 @@ bool RendererOpenGL::Init() {
         return false;
     }
 
+    InitResourcePools();
     InitOpenGLObjects();
     CreateRasterizer();
 
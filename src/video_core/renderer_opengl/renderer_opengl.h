@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <optional>
 #include <vector>
 #include <glad/glad.h>
 #include "common/common_types.h"
@@ -83,6 +84,9 @@ private:
 
     void RenderScreenshot();
 
+    /// Completes a pending screenshot readback once its fence has signaled.
+    void CheckScreenshotReadback();
+
     /// Loads framebuffer from emulated memory into the active OpenGL texture.
     void LoadFBToScreenInfo(const Tegra::FramebufferConfig& framebuffer);
 
@@ -109,6 +113,15 @@ private:
     OGLPipeline pipeline;
     OGLFramebuffer screenshot_framebuffer;
 
+    /// Screenshot readback in flight; the buffer and fence outlive the frame that issued it so the
+    /// render thread never waits on glReadPixels
+    struct ScreenshotReadback {
+        OGLBuffer pbo;
+        OGLSync sync;
+        std::size_t size{};
+    };
+    std::optional<ScreenshotReadback> screenshot_readback;
+
     // GPU address of the vertex buffer
     GLuint64EXT vertex_buffer_address = 0;
 
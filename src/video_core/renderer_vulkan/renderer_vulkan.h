@@ -35,7 +35,9 @@ class VKSwapchain;
 class VKScheduler;
 
 struct VKScreenInfo {
+    VkImage image{};
     VkImageView image_view{};
+    VkFormat format{};
     u32 width{};
     u32 height{};
     bool is_srgb{};
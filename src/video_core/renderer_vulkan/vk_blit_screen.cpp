@@ -143,6 +143,11 @@ VkSemaphore VKBlitScreen::Draw(const Tegra::FramebufferConfig& framebuffer, bool
     scheduler.Wait(resource_ticks[image_index]);
     resource_ticks[image_index] = scheduler.CurrentTick();
 
+    if (use_accelerated && CanPassthroughPresent(framebuffer)) {
+        PresentPassthrough(image_index);
+        return *semaphores[image_index];
+    }
+
     UpdateDescriptorSet(image_index,
                         use_accelerated ? screen_info.image_view : *raw_image_views[image_index]);
 
@@ -270,6 +275,123 @@ VkSemaphore VKBlitScreen::Draw(const Tegra::FramebufferConfig& framebuffer, bool
     return *semaphores[image_index];
 }
 
+bool VKBlitScreen::CanPassthroughPresent(const Tegra::FramebufferConfig& framebuffer) const {
+    if (!swapchain.SupportsTransferDestination() || screen_info.image == VK_NULL_HANDLE) {
+        return false;
+    }
+    // An image copy reinterprets raw texels, so the formats have to match exactly
+    if (screen_info.format != swapchain.GetImageFormat()) {
+        return false;
+    }
+    const VkExtent2D size = swapchain.GetSize();
+    if (screen_info.width != size.width || screen_info.height != size.height) {
+        return false;
+    }
+    // The raster pass also letterboxes and flips; a copy can only replace it when the screen
+    // rectangle covers the whole swapchain image one to one
+    const auto& screen = render_window.GetFramebufferLayout().screen;
+    if (screen.left != 0 || screen.top != 0 || screen.GetWidth() != size.width ||
+        screen.GetHeight() != size.height) {
+        return false;
+    }
+    if (framebuffer.transform_flags != Tegra::FramebufferConfig::TransformFlags::Unset) {
+        return false;
+    }
+    const auto& crop = framebuffer.crop_rect;
+    if (crop.left != 0 || crop.top != 0) {
+        return false;
+    }
+    if (crop.GetWidth() != 0 && crop.GetWidth() != static_cast<int>(screen_info.width)) {
+        return false;
+    }
+    if (crop.GetHeight() != 0 && crop.GetHeight() != static_cast<int>(screen_info.height)) {
+        return false;
+    }
+    return true;
+}
+
+void VKBlitScreen::PresentPassthrough(std::size_t image_index) {
+    scheduler.Record([src_image = screen_info.image,
+                      dst_image = swapchain.GetImageIndex(image_index),
+                      size = swapchain.GetSize()](vk::CommandBuffer cmdbuf) {
+        const VkImageSubresourceRange subresources{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        };
+        const std::array<VkImageMemoryBarrier, 2> prepare_barriers{{
+            {
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = src_image,
+                .subresourceRange = subresources,
+            },
+            {
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = 0,
+                .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = dst_image,
+                .subresourceRange = subresources,
+            },
+        }};
+        const VkImageMemoryBarrier present_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = 0,
+            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            .newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = dst_image,
+            .subresourceRange = subresources,
+        };
+        const VkImageCopy copy{
+            .srcSubresource =
+                {
+                    .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                    .mipLevel = 0,
+                    .baseArrayLayer = 0,
+                    .layerCount = 1,
+                },
+            .dstSubresource =
+                {
+                    .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                    .mipLevel = 0,
+                    .baseArrayLayer = 0,
+                    .layerCount = 1,
+                },
+            .srcOffset = {.x = 0, .y = 0, .z = 0},
+            .dstOffset = {.x = 0, .y = 0, .z = 0},
+            .extent =
+                {
+                    .width = size.width,
+                    .height = size.height,
+                    .depth = 1,
+                },
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, {}, {}, prepare_barriers);
+        cmdbuf.CopyImage(src_image, VK_IMAGE_LAYOUT_GENERAL, dst_image,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copy);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                               0, present_barrier);
+    });
+}
+
 void VKBlitScreen::CreateStaticResources() {
     CreateShaders();
     CreateSemaphores();
@@ -324,7 +446,8 @@ void VKBlitScreen::CreateDescriptorPool() {
     const VkDescriptorPoolCreateInfo ci{
         .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
         .pNext = nullptr,
-        .flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+        // The sets are allocated once and live for the whole pool, so no FREE bit is needed
+        .flags = 0,
         .maxSets = static_cast<u32>(image_count),
         .poolSizeCount = static_cast<u32>(pool_sizes.size()),
         .pPoolSizes = pool_sizes.data(),
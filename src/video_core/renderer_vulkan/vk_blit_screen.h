@@ -69,6 +69,12 @@ private:
     void CreateDynamicResources();
     void CreateFramebuffers();
 
+    /// Returns true when the framebuffer image can be presented with a plain image copy
+    bool CanPassthroughPresent(const Tegra::FramebufferConfig& framebuffer) const;
+
+    /// Copies the accelerated framebuffer image into the swapchain image, skipping the blit pass
+    void PresentPassthrough(std::size_t image_index);
+
     void RefreshResources(const Tegra::FramebufferConfig& framebuffer);
     void ReleaseRawImages();
     void CreateStagingBuffer(const Tegra::FramebufferConfig& framebuffer);
@@ -62,8 +62,8 @@ void Buffer::Upload(std::size_t offset, std::size_t data_size, const u8* data) {
     scheduler.RequestOutsideRenderPassOperationContext();
 
     const VkBuffer handle = Handle();
-    scheduler.Record([staging = staging.buffer, handle, offset, data_size,
-                      &device = device](vk::CommandBuffer cmdbuf) {
+    scheduler.Record([src_buffer = staging.buffer, src_offset = staging.offset, handle, offset,
+                      data_size, &device = device](vk::CommandBuffer cmdbuf) {
         const VkBufferMemoryBarrier read_barrier{
             .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
             .pNext = nullptr,
@@ -91,7 +91,7 @@ void Buffer::Upload(std::size_t offset, std::size_t data_size, const u8* data) {
         };
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
                                0, read_barrier);
-        cmdbuf.CopyBuffer(staging, handle, VkBufferCopy{0, offset, data_size});
+        cmdbuf.CopyBuffer(src_buffer, handle, VkBufferCopy{src_offset, offset, data_size});
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, UPLOAD_PIPELINE_STAGE, 0,
                                write_barrier);
     });
@@ -177,6 +177,17 @@ std::shared_ptr<Buffer> VKBufferCache::CreateBlock(VAddr cpu_addr, std::size_t s
                                     size);
 }
 
+VKBufferCache::BufferInfo VKBufferCache::ConstBufferUpload(const void* raw_pointer,
+                                                           std::size_t size) {
+    // Suballocate constant buffers from the stream buffer with uniform alignment. The data is
+    // consumed through a dynamic offset, so the upload is a single mapped write instead of a
+    // cached buffer transaction with barriers.
+    const auto alignment = static_cast<std::size_t>(device.GetUniformBufferAlignment());
+    return StreamBufferUpload(size, alignment, [raw_pointer, size](u8* dest) {
+        std::memcpy(dest, raw_pointer, size);
+    });
+}
+
 VKBufferCache::BufferInfo VKBufferCache::GetEmptyBuffer(std::size_t size) {
     size = std::max(size, std::size_t(4));
     const auto& empty = staging_pool.Request(size, MemoryUsage::DeviceLocal);
@@ -62,6 +62,8 @@ public:
 protected:
     std::shared_ptr<Buffer> CreateBlock(VAddr cpu_addr, std::size_t size) override;
 
+    BufferInfo ConstBufferUpload(const void* raw_pointer, std::size_t size) override;
+
 private:
     const Device& device;
     MemoryAllocator& memory_allocator;
@@ -13,9 +13,15 @@
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
+namespace VideoCommon {
+struct SwizzleParameters;
+}
+
 namespace Vulkan {
 
 class Device;
+class Image;
+struct ImageBufferMap;
 class StagingBufferPool;
 class VKScheduler;
 class VKUpdateDescriptorQueue;
@@ -55,6 +61,11 @@ private:
     VKScheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
     VKUpdateDescriptorQueue& update_descriptor_queue;
+
+    u64 cached_tick = 0;
+    u32 cached_num_quads = 0;
+    u32 cached_first = 0;
+    VkBuffer cached_buffer = nullptr;
 };
 
 class Uint8Pass final : public VKComputePass {
@@ -90,4 +101,19 @@ private:
     VKUpdateDescriptorQueue& update_descriptor_queue;
 };
 
+class ASTCDecoderPass final : public VKComputePass {
+public:
+    explicit ASTCDecoderPass(const Device& device_, VKScheduler& scheduler_,
+                             VKDescriptorPool& descriptor_pool_,
+                             VKUpdateDescriptorQueue& update_descriptor_queue_);
+    ~ASTCDecoderPass();
+
+    void Assemble(Image& image, const ImageBufferMap& map, size_t buffer_offset,
+                  std::span<const VideoCommon::SwizzleParameters> swizzles);
+
+private:
+    VKScheduler& scheduler;
+    VKUpdateDescriptorQueue& update_descriptor_queue;
+};
+
 } // namespace Vulkan
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstring>
 #include <vector>
 
 #include "video_core/renderer_vulkan/vk_compute_pipeline.h"
@@ -18,13 +19,13 @@ namespace Vulkan {
 VKComputePipeline::VKComputePipeline(const Device& device_, VKScheduler& scheduler_,
                                      VKDescriptorPool& descriptor_pool_,
                                      VKUpdateDescriptorQueue& update_descriptor_queue_,
-                                     const SPIRVShader& shader_)
+                                     const SPIRVShader& shader_, VkPipelineCache pipeline_cache)
     : device{device_}, scheduler{scheduler_}, entries{shader_.entries},
       descriptor_set_layout{CreateDescriptorSetLayout()},
       descriptor_allocator{descriptor_pool_, *descriptor_set_layout},
       update_descriptor_queue{update_descriptor_queue_}, layout{CreatePipelineLayout()},
       descriptor_template{CreateDescriptorUpdateTemplate()},
-      shader_module{CreateShaderModule(shader_.code)}, pipeline{CreatePipeline()} {}
+      shader_module{CreateShaderModule(shader_.code)}, pipeline{CreatePipeline(pipeline_cache)} {}
 
 VKComputePipeline::~VKComputePipeline() = default;
 
@@ -32,8 +33,18 @@ VkDescriptorSet VKComputePipeline::CommitDescriptorSet() {
     if (!descriptor_template) {
         return {};
     }
+    const auto entries = update_descriptor_queue.AcquiredEntries();
+    if (last_descriptor_set != VK_NULL_HANDLE && entries.size() == last_payload.size() &&
+        std::memcmp(entries.data(), last_payload.data(), entries.size_bytes()) == 0) {
+        // Nothing changed since the last dispatch with this pipeline. Reuse the previous set
+        // and skip the descriptor write, extending its lifetime to the current tick.
+        descriptor_allocator.RefreshLastCommit();
+        return last_descriptor_set;
+    }
     const VkDescriptorSet set = descriptor_allocator.Commit();
     update_descriptor_queue.Send(*descriptor_template, set);
+    last_payload.assign(entries.begin(), entries.end());
+    last_descriptor_set = set;
     return set;
 }
 
@@ -116,7 +127,7 @@ vk::ShaderModule VKComputePipeline::CreateShaderModule(const std::vector<u32>& c
     });
 }
 
-vk::Pipeline VKComputePipeline::CreatePipeline() const {
+vk::Pipeline VKComputePipeline::CreatePipeline(VkPipelineCache pipeline_cache) const {
 
     VkComputePipelineCreateInfo ci{
         .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
@@ -147,7 +158,7 @@ vk::Pipeline VKComputePipeline::CreatePipeline() const {
         ci.stage.pNext = &subgroup_size_ci;
     }
 
-    return device.GetLogical().CreateComputePipeline(ci);
+    return device.GetLogical().CreateComputePipeline(ci, pipeline_cache);
 }
 
 } // namespace Vulkan
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "common/common_types.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_shader_decompiler.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace Vulkan {
@@ -20,7 +23,7 @@ public:
     explicit VKComputePipeline(const Device& device_, VKScheduler& scheduler_,
                                VKDescriptorPool& descriptor_pool_,
                                VKUpdateDescriptorQueue& update_descriptor_queue_,
-                               const SPIRVShader& shader_);
+                               const SPIRVShader& shader_, VkPipelineCache pipeline_cache = nullptr);
     ~VKComputePipeline();
 
     VkDescriptorSet CommitDescriptorSet();
@@ -46,7 +49,7 @@ private:
 
     vk::ShaderModule CreateShaderModule(const std::vector<u32>& code) const;
 
-    vk::Pipeline CreatePipeline() const;
+    vk::Pipeline CreatePipeline(VkPipelineCache pipeline_cache) const;
 
     const Device& device;
     VKScheduler& scheduler;
@@ -59,6 +62,9 @@ private:
     vk::DescriptorUpdateTemplateKHR descriptor_template;
     vk::ShaderModule shader_module;
     vk::Pipeline pipeline;
+
+    std::vector<DescriptorUpdateEntry> last_payload;
+    VkDescriptorSet last_descriptor_set = VK_NULL_HANDLE;
 };
 
 } // namespace Vulkan
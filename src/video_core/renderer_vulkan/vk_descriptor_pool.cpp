@@ -25,9 +25,14 @@ DescriptorAllocator::~DescriptorAllocator() = default;
 
 VkDescriptorSet DescriptorAllocator::Commit() {
     const std::size_t index = CommitResource();
+    last_index = index;
     return descriptors_allocations[index / SETS_GROW_RATE][index % SETS_GROW_RATE];
 }
 
+void DescriptorAllocator::RefreshLastCommit() {
+    RefreshResource(last_index);
+}
+
 void DescriptorAllocator::Allocate(std::size_t begin, std::size_t end) {
     descriptors_allocations.push_back(descriptor_pool.AllocateDescriptors(layout, end - begin));
 }
@@ -52,7 +57,9 @@ vk::DescriptorPool* VKDescriptorPool::AllocateNewPool() {
     const VkDescriptorPoolCreateInfo ci{
         .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
         .pNext = nullptr,
-        .flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+        // Sets are never freed individually, they are recycled by their DescriptorAllocator and
+        // released with the pool. Omitting the FREE bit lets the driver allocate linearly.
+        .flags = 0,
         .maxSets = num_sets,
         .poolSizeCount = static_cast<u32>(std::size(pool_sizes)),
         .pPoolSizes = std::data(pool_sizes),
@@ -25,6 +25,10 @@ public:
 
     VkDescriptorSet Commit();
 
+    /// Extends the lifetime of the set returned by the last call to Commit to the current tick,
+    /// allowing it to be bound again without committing a new set.
+    void RefreshLastCommit();
+
 protected:
     void Allocate(std::size_t begin, std::size_t end) override;
 
@@ -32,6 +36,8 @@ private:
     VKDescriptorPool& descriptor_pool;
     const VkDescriptorSetLayout layout;
 
+    std::size_t last_index = 0;
+
     std::vector<vk::DescriptorSets> descriptors_allocations;
 };
 
@@ -25,6 +25,15 @@ MICROPROFILE_DECLARE(Vulkan_PipelineCache);
 
 namespace {
 
+u32 CalculatePushConstantSize(const SPIRVProgram& program) {
+    const auto& vertex_shader = program[0];
+    if (!vertex_shader) {
+        return 0;
+    }
+    const auto& entry = vertex_shader->entries.push_constant_cbuf;
+    return entry ? entry->size : 0;
+}
+
 template <class StencilFace>
 VkStencilOpState GetStencilFaceState(const StencilFace& face) {
     return {
@@ -99,14 +108,16 @@ VKGraphicsPipeline::VKGraphicsPipeline(const Device& device_, VKScheduler& sched
                                        VKUpdateDescriptorQueue& update_descriptor_queue_,
                                        const GraphicsPipelineCacheKey& key,
                                        vk::Span<VkDescriptorSetLayoutBinding> bindings,
-                                       const SPIRVProgram& program, u32 num_color_buffers)
+                                       const SPIRVProgram& program, u32 num_color_buffers,
+                                       VkPipelineCache pipeline_cache)
     : device{device_}, scheduler{scheduler_}, cache_key{key}, hash{cache_key.Hash()},
+      push_constant_size{CalculatePushConstantSize(program)},
       descriptor_set_layout{CreateDescriptorSetLayout(bindings)},
       descriptor_allocator{descriptor_pool_, *descriptor_set_layout},
       update_descriptor_queue{update_descriptor_queue_}, layout{CreatePipelineLayout()},
       descriptor_template{CreateDescriptorUpdateTemplate(program)},
       modules(CreateShaderModules(program)),
-      pipeline(CreatePipeline(program, cache_key.renderpass, num_color_buffers)) {}
+      pipeline(CreatePipeline(program, cache_key.renderpass, num_color_buffers, pipeline_cache)) {}
 
 VKGraphicsPipeline::~VKGraphicsPipeline() = default;
 
@@ -114,8 +125,18 @@ VkDescriptorSet VKGraphicsPipeline::CommitDescriptorSet() {
     if (!descriptor_template) {
         return {};
     }
+    const auto entries = update_descriptor_queue.AcquiredEntries();
+    if (last_descriptor_set != VK_NULL_HANDLE && entries.size() == last_payload.size() &&
+        std::memcmp(entries.data(), last_payload.data(), entries.size_bytes()) == 0) {
+        // Nothing changed since the last draw with this pipeline. Reuse the previous set and
+        // skip the descriptor write, extending its lifetime to the current tick.
+        descriptor_allocator.RefreshLastCommit();
+        return last_descriptor_set;
+    }
     const VkDescriptorSet set = descriptor_allocator.Commit();
     update_descriptor_queue.Send(*descriptor_template, set);
+    last_payload.assign(entries.begin(), entries.end());
+    last_descriptor_set = set;
     return set;
 }
 
@@ -132,14 +153,19 @@ vk::DescriptorSetLayout VKGraphicsPipeline::CreateDescriptorSetLayout(
 }
 
 vk::PipelineLayout VKGraphicsPipeline::CreatePipelineLayout() const {
+    const VkPushConstantRange push_constant_range{
+        .stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
+        .offset = 0,
+        .size = push_constant_size,
+    };
     const VkPipelineLayoutCreateInfo ci{
         .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
         .setLayoutCount = 1,
         .pSetLayouts = descriptor_set_layout.address(),
-        .pushConstantRangeCount = 0,
-        .pPushConstantRanges = nullptr,
+        .pushConstantRangeCount = push_constant_size != 0 ? 1U : 0U,
+        .pPushConstantRanges = push_constant_size != 0 ? &push_constant_range : nullptr,
     };
     return device.GetLogical().CreatePipelineLayout(ci);
 }
@@ -202,8 +228,8 @@ std::vector<vk::ShaderModule> VKGraphicsPipeline::CreateShaderModules(
 }
 
 vk::Pipeline VKGraphicsPipeline::CreatePipeline(const SPIRVProgram& program,
-                                                VkRenderPass renderpass,
-                                                u32 num_color_buffers) const {
+                                                VkRenderPass renderpass, u32 num_color_buffers,
+                                                VkPipelineCache pipeline_cache) const {
     const auto& state = cache_key.fixed_state;
     const auto& viewport_swizzles = state.viewport_swizzles;
 
@@ -461,7 +487,7 @@ vk::Pipeline VKGraphicsPipeline::CreatePipeline(const SPIRVProgram& program,
             stage_ci.pNext = &subgroup_size_ci;
         }
     }
-    return device.GetLogical().CreateGraphicsPipeline(VkGraphicsPipelineCreateInfo{
+    const VkGraphicsPipelineCreateInfo ci{
         .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
@@ -481,7 +507,8 @@ vk::Pipeline VKGraphicsPipeline::CreatePipeline(const SPIRVProgram& program,
         .subpass = 0,
         .basePipelineHandle = nullptr,
         .basePipelineIndex = 0,
-    });
+    };
+    return device.GetLogical().CreateGraphicsPipeline(ci, pipeline_cache);
 }
 
 } // namespace Vulkan
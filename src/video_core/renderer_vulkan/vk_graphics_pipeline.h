@@ -13,6 +13,7 @@
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_shader_decompiler.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace Vulkan {
@@ -54,7 +55,8 @@ public:
                                 VKUpdateDescriptorQueue& update_descriptor_queue_,
                                 const GraphicsPipelineCacheKey& key,
                                 vk::Span<VkDescriptorSetLayoutBinding> bindings,
-                                const SPIRVProgram& program, u32 num_color_buffers);
+                                const SPIRVProgram& program, u32 num_color_buffers,
+                                VkPipelineCache pipeline_cache = nullptr);
     ~VKGraphicsPipeline();
 
     VkDescriptorSet CommitDescriptorSet();
@@ -71,6 +73,11 @@ public:
         return cache_key;
     }
 
+    /// Size in bytes of the vertex stage push constant range, zero when it is not used.
+    u32 GetPushConstantSize() const {
+        return push_constant_size;
+    }
+
 private:
     vk::DescriptorSetLayout CreateDescriptorSetLayout(
         vk::Span<VkDescriptorSetLayoutBinding> bindings) const;
@@ -83,12 +90,13 @@ private:
     std::vector<vk::ShaderModule> CreateShaderModules(const SPIRVProgram& program) const;
 
     vk::Pipeline CreatePipeline(const SPIRVProgram& program, VkRenderPass renderpass,
-                                u32 num_color_buffers) const;
+                                u32 num_color_buffers, VkPipelineCache pipeline_cache) const;
 
     const Device& device;
     VKScheduler& scheduler;
     const GraphicsPipelineCacheKey cache_key;
     const u64 hash;
+    const u32 push_constant_size;
 
     vk::DescriptorSetLayout descriptor_set_layout;
     DescriptorAllocator descriptor_allocator;
@@ -98,6 +106,9 @@ private:
     std::vector<vk::ShaderModule> modules;
 
     vk::Pipeline pipeline;
+
+    std::vector<DescriptorUpdateEntry> last_payload;
+    VkDescriptorSet last_descriptor_set = VK_NULL_HANDLE;
 };
 
 } // namespace Vulkan
@@ -4,12 +4,21 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "common/bit_cast.h"
 #include "common/cityhash.h"
+#include "common/common_paths.h"
+#include "common/file_util.h"
+#include "common/hash.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/zstd_compression.h"
 #include "core/core.h"
 #include "core/memory.h"
 #include "video_core/engines/kepler_compute.h"
@@ -38,6 +47,7 @@ MICROPROFILE_DECLARE(Vulkan_PipelineCache);
 using Tegra::Engines::ShaderType;
 using VideoCommon::Shader::GetShaderAddress;
 using VideoCommon::Shader::GetShaderCode;
+using VideoCommon::Shader::GetUniqueIdentifier;
 using VideoCommon::Shader::KERNEL_MAIN_OFFSET;
 using VideoCommon::Shader::ProgramCode;
 using VideoCommon::Shader::STAGE_MAIN_OFFSET;
@@ -56,6 +66,25 @@ constexpr VideoCommon::Shader::CompilerSettings compiler_settings{
     .disable_else_derivation = true,
 };
 
+/// Header prepended to the serialized VkPipelineCache blob. The driver validates its own header
+/// inside the blob, but rejecting incompatible files here avoids handing garbage to the driver.
+struct PipelineCacheDiskHeader {
+    std::array<char, 8> magic;
+    u32 cache_version;
+    u32 vendor_id;
+    u32 device_id;
+    u32 driver_version;
+    std::array<u8, VK_UUID_SIZE> pipeline_cache_uuid;
+};
+static_assert(std::is_trivially_copyable_v<PipelineCacheDiskHeader>);
+
+constexpr std::array<char, 8> PIPELINE_CACHE_MAGIC{'y', 'u', 'z', 'u', 'v', 'k', 'p', 'c'};
+constexpr u32 PIPELINE_CACHE_VERSION = 1;
+
+std::string GetPipelineCacheDir() {
+    return Common::FS::GetUserPath(Common::FS::UserPath::ShaderDir) + DIR_SEP "vulkan";
+}
+
 constexpr std::size_t GetStageFromProgram(std::size_t program) {
     return program == 0 ? 0 : program - 1;
 }
@@ -130,22 +159,72 @@ bool GraphicsPipelineCacheKey::operator==(const GraphicsPipelineCacheKey& rhs) c
 }
 
 std::size_t ComputePipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
-    return static_cast<std::size_t>(hash);
+    return static_cast<std::size_t>(Common::HashValue(*this));
 }
 
 bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) const noexcept {
     return std::memcmp(&rhs, this, sizeof *this) == 0;
 }
 
+Shader::Core::Core(Tegra::Engines::ConstBufferEngineInterface& engine, ShaderType stage_,
+                   ProgramCode program_code_, u32 main_offset_)
+    : stage{stage_}, main_offset{main_offset_},
+      code_size{program_code_.size()}, registry(stage_, engine) {
+    program_code.emplace(std::move(program_code_));
+    shader_ir.emplace(*program_code, main_offset, compiler_settings, registry);
+    entries = GenerateShaderEntries(*shader_ir, stage);
+    compressed_code = Common::Compression::CompressDataZSTDDefault(
+        reinterpret_cast<const u8*>(program_code->data()), code_size * sizeof(u64));
+}
+
+VideoCommon::Shader::ShaderIR& Shader::Core::EnsureIR() {
+    if (!shader_ir) {
+        const std::vector<u8> decompressed =
+            Common::Compression::DecompressDataZSTD(compressed_code);
+        ProgramCode code(code_size);
+        std::memcpy(code.data(), decompressed.data(), decompressed.size());
+        program_code.emplace(std::move(code));
+        shader_ir.emplace(*program_code, main_offset, compiler_settings, registry);
+    }
+    return *shader_ir;
+}
+
+void Shader::Core::ReleaseIR() {
+    shader_ir.reset();
+    program_code.reset();
+}
+
 Shader::Shader(Tegra::Engines::ConstBufferEngineInterface& engine_, ShaderType stage_,
                GPUVAddr gpu_addr_, VAddr cpu_addr_, ProgramCode program_code_, u32 main_offset_)
-    : gpu_addr(gpu_addr_), program_code(std::move(program_code_)), registry(stage_, engine_),
-      shader_ir(program_code, main_offset_, compiler_settings, registry),
-      entries(GenerateShaderEntries(shader_ir)) {}
+    : gpu_addr(gpu_addr_),
+      core(std::make_shared<Core>(engine_, stage_, std::move(program_code_), main_offset_)) {}
+
+Shader::Shader(GPUVAddr gpu_addr_, std::shared_ptr<Core> core_)
+    : gpu_addr(gpu_addr_), core(std::move(core_)) {}
 
 Shader::~Shader() = default;
 
+const std::vector<u32>& Shader::GetSpirv(const Device& device, Tegra::Engines::ShaderType stage,
+                                         const Specialization& specialization) {
+    auto& spirv_cache = core->spirv_cache;
+    const auto it =
+        std::find_if(spirv_cache.begin(), spirv_cache.end(),
+                     [&specialization](const auto& entry) { return entry.first == specialization; });
+    if (it != spirv_cache.end()) {
+        return it->second;
+    }
+    // Most variant bits in the pipeline key don't reach the decompiler, so new pipeline variants
+    // usually hit a module decompiled for a previous variant
+    const std::vector<u32>& result =
+        spirv_cache
+            .emplace_back(specialization, Decompile(device, core->EnsureIR(), stage,
+                                                    core->registry, specialization))
+            .second;
+    // New specializations are rare after the first frames; don't keep the decoded IR resident
+    core->ReleaseIR();
+    return result;
+}
+
 VKPipelineCache::VKPipelineCache(RasterizerVulkan& rasterizer_, Tegra::GPU& gpu_,
                                  Tegra::Engines::Maxwell3D& maxwell3d_,
                                  Tegra::Engines::KeplerCompute& kepler_compute_,
@@ -155,9 +234,98 @@ VKPipelineCache::VKPipelineCache(RasterizerVulkan& rasterizer_, Tegra::GPU& gpu_
     : VideoCommon::ShaderCache<Shader>{rasterizer_}, gpu{gpu_}, maxwell3d{maxwell3d_},
       kepler_compute{kepler_compute_}, gpu_memory{gpu_memory_}, device{device_},
       scheduler{scheduler_}, descriptor_pool{descriptor_pool_}, update_descriptor_queue{
-                                                                    update_descriptor_queue_} {}
+                                                                    update_descriptor_queue_} {
+    vulkan_pipeline_cache = device.GetLogical().CreatePipelineCache({
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .initialDataSize = 0,
+        .pInitialData = nullptr,
+    });
+}
 
-VKPipelineCache::~VKPipelineCache() = default;
+VKPipelineCache::~VKPipelineCache() {
+    SaveDiskCache();
+}
+
+void VKPipelineCache::LoadDiskCache(u64 title_id) {
+    if (!Common::FS::CreateDir(Common::FS::GetUserPath(Common::FS::UserPath::ShaderDir)) ||
+        !Common::FS::CreateDir(GetPipelineCacheDir())) {
+        LOG_ERROR(Render_Vulkan, "Failed to create pipeline cache directories");
+        return;
+    }
+    vulkan_pipeline_cache_path =
+        fmt::format("{}" DIR_SEP "{:016x}.bin", GetPipelineCacheDir(), title_id);
+
+    Common::FS::IOFile file(vulkan_pipeline_cache_path, "rb");
+    if (!file.IsOpen()) {
+        return;
+    }
+    PipelineCacheDiskHeader header;
+    if (file.ReadBytes(&header, sizeof(header)) != sizeof(header)) {
+        LOG_INFO(Render_Vulkan, "Truncated pipeline cache file, ignoring");
+        return;
+    }
+    const VkPhysicalDeviceProperties properties = device.GetPhysical().GetProperties();
+    const bool is_compatible =
+        header.magic == PIPELINE_CACHE_MAGIC && header.cache_version == PIPELINE_CACHE_VERSION &&
+        header.vendor_id == properties.vendorID && header.device_id == properties.deviceID &&
+        header.driver_version == properties.driverVersion &&
+        std::memcmp(header.pipeline_cache_uuid.data(), properties.pipelineCacheUUID,
+                    VK_UUID_SIZE) == 0;
+    if (!is_compatible) {
+        LOG_INFO(Render_Vulkan, "Stored pipeline cache belongs to another device, ignoring");
+        return;
+    }
+    std::vector<u8> data(file.GetSize() - sizeof(header));
+    if (file.ReadBytes(data.data(), data.size()) != data.size()) {
+        LOG_INFO(Render_Vulkan, "Truncated pipeline cache file, ignoring");
+        return;
+    }
+    try {
+        vulkan_pipeline_cache = device.GetLogical().CreatePipelineCache({
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .initialDataSize = data.size(),
+            .pInitialData = data.data(),
+        });
+        LOG_INFO(Render_Vulkan, "Loaded {} bytes of precompiled pipelines", data.size());
+    } catch (const vk::Exception& exception) {
+        LOG_ERROR(Render_Vulkan, "Failed to load stored pipeline cache: {}", exception.what());
+    }
+}
+
+void VKPipelineCache::SaveDiskCache() {
+    if (vulkan_pipeline_cache_path.empty() || !vulkan_pipeline_cache) {
+        return;
+    }
+    const std::vector<u8> data =
+        device.GetLogical().GetPipelineCacheData(*vulkan_pipeline_cache);
+    if (data.empty()) {
+        return;
+    }
+    Common::FS::IOFile file(vulkan_pipeline_cache_path, "wb");
+    if (!file.IsOpen()) {
+        LOG_ERROR(Render_Vulkan, "Failed to open pipeline cache file path={}",
+                  vulkan_pipeline_cache_path);
+        return;
+    }
+    const VkPhysicalDeviceProperties properties = device.GetPhysical().GetProperties();
+    PipelineCacheDiskHeader header{
+        .magic = PIPELINE_CACHE_MAGIC,
+        .cache_version = PIPELINE_CACHE_VERSION,
+        .vendor_id = properties.vendorID,
+        .device_id = properties.deviceID,
+        .driver_version = properties.driverVersion,
+        .pipeline_cache_uuid = {},
+    };
+    std::memcpy(header.pipeline_cache_uuid.data(), properties.pipelineCacheUUID, VK_UUID_SIZE);
+    if (file.WriteObject(header) != 1 || file.WriteBytes(data.data(), data.size()) != data.size()) {
+        LOG_ERROR(Render_Vulkan, "Failed to write pipeline cache file path={}",
+                  vulkan_pipeline_cache_path);
+    }
+}
 
 std::array<Shader*, Maxwell::MaxShaderProgram> VKPipelineCache::GetShaders() {
     std::array<Shader*, Maxwell::MaxShaderProgram> shaders{};
@@ -184,8 +352,8 @@ std::array<Shader*, Maxwell::MaxShaderProgram> VKPipelineCache::GetShaders() {
             ProgramCode code = GetShaderCode(gpu_memory, gpu_addr, host_ptr, false);
             const std::size_t size_in_bytes = code.size() * sizeof(u64);
 
-            auto shader = std::make_unique<Shader>(maxwell3d, stage, gpu_addr, *cpu_addr,
-                                                   std::move(code), stage_offset);
+            std::unique_ptr<Shader> shader =
+                MakeShader(maxwell3d, stage, gpu_addr, *cpu_addr, std::move(code), stage_offset);
             result = shader.get();
 
             if (cpu_addr) {
@@ -232,20 +400,24 @@ VKGraphicsPipeline* VKPipelineCache::GetGraphicsPipeline(
         const auto [program, bindings] = DecompileShaders(key.fixed_state);
         entry = std::make_unique<VKGraphicsPipeline>(device, scheduler, descriptor_pool,
                                                      update_descriptor_queue, key, bindings,
-                                                     program, num_color_buffers);
+                                                     program, num_color_buffers,
+                                                     *vulkan_pipeline_cache);
         gpu.ShaderNotify().MarkShaderComplete();
     }
     last_graphics_pipeline = entry.get();
     return last_graphics_pipeline;
 }
 
-VKComputePipeline& VKPipelineCache::GetComputePipeline(const ComputePipelineCacheKey& key) {
+VKComputePipeline* VKPipelineCache::GetComputePipeline(
+    const ComputePipelineCacheKey& key, VideoCommon::Shader::AsyncShaders& async_shaders) {
     MICROPROFILE_SCOPE(Vulkan_PipelineCache);
 
+    std::unique_lock lock{pipeline_cache};
     const auto [pair, is_cache_miss] = compute_cache.try_emplace(key);
     auto& entry = pair->second;
     if (!is_cache_miss) {
-        return *entry;
+        // The entry is null while an asynchronous pipeline is still being built
+        return entry.get();
     }
     LOG_INFO(Render_Vulkan, "Compile 0x{:016X}", key.Hash());
 
@@ -262,8 +434,9 @@ VKComputePipeline& VKPipelineCache::GetComputePipeline(const ComputePipelineCach
         ProgramCode code = GetShaderCode(gpu_memory, gpu_addr, host_ptr, true);
         const std::size_t size_in_bytes = code.size() * sizeof(u64);
 
-        auto shader_info = std::make_unique<Shader>(kepler_compute, ShaderType::Compute, gpu_addr,
-                                                    *cpu_addr, std::move(code), KERNEL_MAIN_OFFSET);
+        std::unique_ptr<Shader> shader_info =
+            MakeShader(kepler_compute, ShaderType::Compute, gpu_addr, *cpu_addr, std::move(code),
+                       KERNEL_MAIN_OFFSET);
         shader = shader_info.get();
 
         if (cpu_addr) {
@@ -282,12 +455,22 @@ VKComputePipeline& VKPipelineCache::GetComputePipeline(const ComputePipelineCach
         .attribute_types = {},
         .ndc_minus_one_to_one = false,
     };
-    const SPIRVShader spirv_shader{Decompile(device, shader->GetIR(), ShaderType::Compute,
-                                             shader->GetRegistry(), specialization),
-                                   shader->GetEntries()};
+    Shader::Core& core = *shader->GetCore();
+    SPIRVShader spirv_shader{Decompile(device, core.EnsureIR(), ShaderType::Compute,
+                                       shader->GetRegistry(), specialization),
+                             shader->GetEntries()};
+    core.ReleaseIR();
+    if (device.UseAsynchronousShaders()) {
+        gpu.ShaderNotify().MarkSharderBuilding();
+        async_shaders.QueueVulkanComputeShader(this, device, scheduler, descriptor_pool,
+                                               update_descriptor_queue, std::move(spirv_shader),
+                                               key);
+        return entry.get();
+    }
     entry = std::make_unique<VKComputePipeline>(device, scheduler, descriptor_pool,
-                                                update_descriptor_queue, spirv_shader);
-    return *entry;
+                                                update_descriptor_queue, spirv_shader,
+                                                *vulkan_pipeline_cache);
+    return entry.get();
 }
 
 void VKPipelineCache::EmplacePipeline(std::unique_ptr<VKGraphicsPipeline> pipeline) {
@@ -296,6 +479,30 @@ void VKPipelineCache::EmplacePipeline(std::unique_ptr<VKGraphicsPipeline> pipeli
     graphics_cache.at(pipeline->GetCacheKey()) = std::move(pipeline);
 }
 
+void VKPipelineCache::EmplaceComputePipeline(const ComputePipelineCacheKey& key,
+                                             std::unique_ptr<VKComputePipeline> pipeline) {
+    gpu.ShaderNotify().MarkShaderComplete();
+    std::unique_lock lock{pipeline_cache};
+    compute_cache.at(key) = std::move(pipeline);
+}
+
+std::unique_ptr<Shader> VKPipelineCache::MakeShader(
+    Tegra::Engines::ConstBufferEngineInterface& engine, ShaderType stage, GPUVAddr gpu_addr,
+    VAddr cpu_addr, ProgramCode code, u32 main_offset) {
+    const u64 unique_identifier = GetUniqueIdentifier(stage, false, code);
+    const auto it = shader_core_cache.find(unique_identifier);
+    if (it != shader_core_cache.end()) {
+        if (std::shared_ptr<Shader::Core> core = it->second.lock()) {
+            // Another address holds identical code, share its decompiled state
+            return std::make_unique<Shader>(gpu_addr, std::move(core));
+        }
+    }
+    auto shader =
+        std::make_unique<Shader>(engine, stage, gpu_addr, cpu_addr, std::move(code), main_offset);
+    shader_core_cache.insert_or_assign(unique_identifier, shader->GetCore());
+    return shader;
+}
+
 void VKPipelineCache::OnShaderRemoval(Shader* shader) {
     bool finished = false;
     const auto Finish = [&] {
@@ -317,6 +524,9 @@ void VKPipelineCache::OnShaderRemoval(Shader* shader) {
             continue;
         }
         Finish();
+        if (last_graphics_pipeline == it->second.get()) {
+            last_graphics_pipeline = nullptr;
+        }
         it = graphics_cache.erase(it);
     }
     for (auto it = compute_cache.begin(); it != compute_cache.end();) {
@@ -369,7 +579,7 @@ VKPipelineCache::DecompileShaders(const FixedPipelineState& fixed_state) {
         const ShaderType program_type = GetShaderType(program_enum);
         const auto& entries = shader->GetEntries();
         program[stage] = {
-            Decompile(device, shader->GetIR(), program_type, shader->GetRegistry(), specialization),
+            shader->GetSpirv(device, program_type, specialization),
             entries,
         };
 
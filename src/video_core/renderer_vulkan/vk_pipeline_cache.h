@@ -7,6 +7,8 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -83,37 +85,64 @@ namespace Vulkan {
 
 class Shader {
 public:
+    /// Decompiled state shared between every shader instance with identical code
+    struct Core {
+        explicit Core(Tegra::Engines::ConstBufferEngineInterface& engine,
+                      Tegra::Engines::ShaderType stage_,
+                      VideoCommon::Shader::ProgramCode program_code_, u32 main_offset_);
+
+        /// Returns the decoded IR, re-materializing it from the compressed bytecode when it has
+        /// been released
+        VideoCommon::Shader::ShaderIR& EnsureIR();
+
+        /// Drops the decoded IR and bytecode; only the compressed bytecode, the registry and the
+        /// compiled modules stay resident
+        void ReleaseIR();
+
+        Tegra::Engines::ShaderType stage;
+        u32 main_offset;
+        std::size_t code_size;           ///< Size of the uncompressed bytecode in words
+        std::vector<u8> compressed_code; ///< Zstandard-compressed shader bytecode
+        VideoCommon::Shader::Registry registry;
+        /// Decoded bytecode, resident only while the IR is alive since the IR references it
+        std::optional<VideoCommon::Shader::ProgramCode> program_code;
+        std::optional<VideoCommon::Shader::ShaderIR> shader_ir;
+        ShaderEntries entries;
+        std::vector<std::pair<Specialization, std::vector<u32>>> spirv_cache;
+    };
+
     explicit Shader(Tegra::Engines::ConstBufferEngineInterface& engine_,
                     Tegra::Engines::ShaderType stage_, GPUVAddr gpu_addr, VAddr cpu_addr_,
                     VideoCommon::Shader::ProgramCode program_code, u32 main_offset_);
+
+    /// Creates a shader at a new address reusing the decompiled state of identical code
+    explicit Shader(GPUVAddr gpu_addr_, std::shared_ptr<Core> core_);
+
     ~Shader();
 
     GPUVAddr GetGpuAddr() const {
         return gpu_addr;
     }
 
-    VideoCommon::Shader::ShaderIR& GetIR() {
-        return shader_ir;
-    }
-
-    const VideoCommon::Shader::ShaderIR& GetIR() const {
-        return shader_ir;
+    const std::shared_ptr<Core>& GetCore() const {
+        return core;
     }
 
     const VideoCommon::Shader::Registry& GetRegistry() const {
-        return registry;
+        return core->registry;
     }
 
     const ShaderEntries& GetEntries() const {
-        return entries;
+        return core->entries;
     }
 
+    /// Returns the SPIR-V module for the given specialization, decompiling it on first use
+    const std::vector<u32>& GetSpirv(const Device& device, Tegra::Engines::ShaderType stage,
+                                     const Specialization& specialization);
+
 private:
     GPUVAddr gpu_addr{};
-    VideoCommon::Shader::ProgramCode program_code;
-    VideoCommon::Shader::Registry registry;
-    VideoCommon::Shader::ShaderIR shader_ir;
-    ShaderEntries entries;
+    std::shared_ptr<Core> core;
 };
 
 class VKPipelineCache final : public VideoCommon::ShaderCache<Shader> {
@@ -132,14 +161,34 @@ public:
                                             u32 num_color_buffers,
                                             VideoCommon::Shader::AsyncShaders& async_shaders);
 
-    VKComputePipeline& GetComputePipeline(const ComputePipelineCacheKey& key);
+    VKComputePipeline* GetComputePipeline(const ComputePipelineCacheKey& key,
+                                          VideoCommon::Shader::AsyncShaders& async_shaders);
 
     void EmplacePipeline(std::unique_ptr<VKGraphicsPipeline> pipeline);
 
+    void EmplaceComputePipeline(const ComputePipelineCacheKey& key,
+                                std::unique_ptr<VKComputePipeline> pipeline);
+
+    /// Binds the given title and loads its stored driver pipeline cache blob when compatible.
+    void LoadDiskCache(u64 title_id);
+
+    /// Serializes the driver pipeline cache blob back to disk.
+    void SaveDiskCache();
+
+    VkPipelineCache GetVulkanPipelineCache() const {
+        return *vulkan_pipeline_cache;
+    }
+
 protected:
     void OnShaderRemoval(Shader* shader) final;
 
 private:
+    /// Creates a shader, sharing the decompiled core of a previous shader with identical code
+    std::unique_ptr<Shader> MakeShader(Tegra::Engines::ConstBufferEngineInterface& engine,
+                                       Tegra::Engines::ShaderType stage, GPUVAddr gpu_addr,
+                                       VAddr cpu_addr, VideoCommon::Shader::ProgramCode code,
+                                       u32 main_offset);
+
     std::pair<SPIRVProgram, std::vector<VkDescriptorSetLayoutBinding>> DecompileShaders(
         const FixedPipelineState& fixed_state);
 
@@ -156,11 +205,17 @@ private:
     std::unique_ptr<Shader> null_shader;
     std::unique_ptr<Shader> null_kernel;
 
+    /// Decompiled cores indexed by unique identifier, shared across guest addresses
+    std::unordered_map<u64, std::weak_ptr<Shader::Core>> shader_core_cache;
+
     std::array<Shader*, Maxwell::MaxShaderProgram> last_shaders{};
 
     GraphicsPipelineCacheKey last_graphics_key;
     VKGraphicsPipeline* last_graphics_pipeline = nullptr;
 
+    vk::PipelineCache vulkan_pipeline_cache;
+    std::string vulkan_pipeline_cache_path;
+
     std::mutex pipeline_cache;
     std::unordered_map<GraphicsPipelineCacheKey, std::unique_ptr<VKGraphicsPipeline>>
         graphics_cache;
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <utility>
 #include <vector>
 
@@ -27,19 +28,29 @@ constexpr VkQueryType GetTarget(QueryType type) {
 
 } // Anonymous namespace
 
-QueryPool::QueryPool(const Device& device_, VKScheduler& scheduler, QueryType type_)
-    : ResourcePool{scheduler.GetMasterSemaphore(), GROW_STEP}, device{device_}, type{type_} {}
+QueryPool::QueryPool(const Device& device_, MemoryAllocator& memory_allocator_,
+                     VKScheduler& scheduler, QueryType type_)
+    : ResourcePool{scheduler.GetMasterSemaphore(), GROW_STEP}, device{device_},
+      memory_allocator{memory_allocator_}, type{type_} {}
 
 QueryPool::~QueryPool() = default;
 
-std::pair<VkQueryPool, u32> QueryPool::Commit() {
+HostQuery QueryPool::Commit() {
     std::size_t index;
     do {
         index = CommitResource();
     } while (usage[index]);
     usage[index] = true;
 
-    return {*pools[index / GROW_STEP], static_cast<u32>(index % GROW_STEP)};
+    const std::size_t pool_index = index / GROW_STEP;
+    const std::size_t slot = index % GROW_STEP;
+    return {
+        .pool = *pools[pool_index],
+        .index = static_cast<u32>(slot),
+        .buffer = *result_buffers[pool_index],
+        .offset = static_cast<VkDeviceSize>(slot * sizeof(u64)),
+        .result = result_maps[pool_index] + slot,
+    };
 }
 
 void QueryPool::Allocate(std::size_t begin, std::size_t end) {
@@ -53,6 +64,21 @@ void QueryPool::Allocate(std::size_t begin, std::size_t end) {
         .queryCount = static_cast<u32>(end - begin),
         .pipelineStatistics = 0,
     }));
+
+    // Results are resolved GPU-side into a persistently mapped buffer, so retrieving them never
+    // has to call vkGetQueryPoolResults
+    result_buffers.push_back(device.GetLogical().CreateBuffer({
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .size = static_cast<VkDeviceSize>((end - begin) * sizeof(u64)),
+        .usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+    }));
+    result_commits.push_back(memory_allocator.Commit(result_buffers.back(), MemoryUsage::Download));
+    result_maps.push_back(reinterpret_cast<u64*>(result_commits.back().Map().data()));
 }
 
 void QueryPool::Reserve(std::pair<VkQueryPool, u32> query) {
@@ -68,10 +94,11 @@ void QueryPool::Reserve(std::pair<VkQueryPool, u32> query) {
 
 VKQueryCache::VKQueryCache(VideoCore::RasterizerInterface& rasterizer_,
                            Tegra::Engines::Maxwell3D& maxwell3d_, Tegra::MemoryManager& gpu_memory_,
-                           const Device& device_, VKScheduler& scheduler_)
+                           const Device& device_, MemoryAllocator& memory_allocator_,
+                           VKScheduler& scheduler_)
     : QueryCacheBase{rasterizer_, maxwell3d_, gpu_memory_}, device{device_}, scheduler{scheduler_},
       query_pools{
-          QueryPool{device_, scheduler_, QueryType::SamplesPassed},
+          QueryPool{device_, memory_allocator_, scheduler_, QueryType::SamplesPassed},
       } {}
 
 VKQueryCache::~VKQueryCache() {
@@ -85,53 +112,84 @@ VKQueryCache::~VKQueryCache() {
     }
 }
 
-std::pair<VkQueryPool, u32> VKQueryCache::AllocateQuery(QueryType type) {
+HostQuery VKQueryCache::AllocateQuery(QueryType type) {
     return query_pools[static_cast<std::size_t>(type)].Commit();
 }
 
 void VKQueryCache::Reserve(QueryType type, std::pair<VkQueryPool, u32> query) {
+    // The slot can be recycled within the current command buffer, so drop any copy that has not
+    // been recorded yet to avoid reading a query that is reset and begun again.
+    std::erase_if(pending_results, [&query](const PendingResultCopy& pending) {
+        return pending.pool == query.first && pending.index == query.second;
+    });
     query_pools[static_cast<std::size_t>(type)].Reserve(query);
 }
 
+void VKQueryCache::AddPendingResult(const HostQuery& query) {
+    pending_results.push_back({
+        .pool = query.pool,
+        .index = query.index,
+        .buffer = query.buffer,
+        .offset = query.offset,
+    });
+}
+
+void VKQueryCache::CopyPendingResults() {
+    if (pending_results.empty()) {
+        return;
+    }
+    scheduler.Record([copies = std::move(pending_results)](vk::CommandBuffer cmdbuf) {
+        for (const PendingResultCopy& copy : copies) {
+            cmdbuf.CopyQueryPoolResults(copy.pool, copy.index, 1, copy.buffer, copy.offset,
+                                        sizeof(u64),
+                                        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        }
+        static constexpr VkMemoryBarrier WRITE_BARRIER{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
+                               WRITE_BARRIER, {}, {});
+    });
+    pending_results.clear();
+}
+
 HostCounter::HostCounter(VKQueryCache& cache_, std::shared_ptr<HostCounter> dependency_,
                          QueryType type_)
     : HostCounterBase{std::move(dependency_)}, cache{cache_}, type{type_},
       query{cache_.AllocateQuery(type_)}, tick{cache_.GetScheduler().CurrentTick()} {
     const vk::Device* logical = &cache.GetDevice().GetLogical();
-    cache.GetScheduler().Record([logical, query = query](vk::CommandBuffer cmdbuf) {
-        logical->ResetQueryPoolEXT(query.first, query.second, 1);
-        cmdbuf.BeginQuery(query.first, query.second, VK_QUERY_CONTROL_PRECISE_BIT);
+    cache.GetScheduler().Record([logical, pool = query.pool, index = query.index](
+                                    vk::CommandBuffer cmdbuf) {
+        logical->ResetQueryPoolEXT(pool, index, 1);
+        cmdbuf.BeginQuery(pool, index, VK_QUERY_CONTROL_PRECISE_BIT);
     });
 }
 
 HostCounter::~HostCounter() {
-    cache.Reserve(type, query);
+    cache.Reserve(type, {query.pool, query.index});
 }
 
 void HostCounter::EndQuery() {
-    cache.GetScheduler().Record(
-        [query = query](vk::CommandBuffer cmdbuf) { cmdbuf.EndQuery(query.first, query.second); });
+    cache.GetScheduler().Record([pool = query.pool, index = query.index](
+                                    vk::CommandBuffer cmdbuf) { cmdbuf.EndQuery(pool, index); });
+    cache.AddPendingResult(query);
 }
 
 u64 HostCounter::BlockingQuery() const {
-    if (tick >= cache.GetScheduler().CurrentTick()) {
-        cache.GetScheduler().Flush();
+    VKScheduler& scheduler = cache.GetScheduler();
+    if (tick >= scheduler.CurrentTick()) {
+        scheduler.Flush();
     }
+    // The result lands in the mapped buffer when the submission's timeline tick is signaled, so
+    // the only wait left is on genuine same-frame dependencies
+    scheduler.Wait(tick);
 
-    u64 data;
-    const VkResult query_result = cache.GetDevice().GetLogical().GetQueryResults(
-        query.first, query.second, 1, sizeof(data), &data, sizeof(data),
-        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
-
-    switch (query_result) {
-    case VK_SUCCESS:
-        return data;
-    case VK_ERROR_DEVICE_LOST:
-        cache.GetDevice().ReportLoss();
-        [[fallthrough]];
-    default:
-        throw vk::Exception(query_result);
-    }
+    u64 value;
+    std::memcpy(&value, query.result, sizeof(value));
+    return value;
 }
 
 } // namespace Vulkan
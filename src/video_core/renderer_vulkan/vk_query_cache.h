@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <utility>
@@ -12,6 +13,7 @@
 #include "common/common_types.h"
 #include "video_core/query_cache.h"
 #include "video_core/renderer_vulkan/vk_resource_pool.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCore {
@@ -28,12 +30,22 @@ class VKScheduler;
 
 using CounterStream = VideoCommon::CounterStreamBase<VKQueryCache, HostCounter>;
 
+/// Query allocated from a pool, alongside its slot in the host-mapped results buffer
+struct HostQuery {
+    VkQueryPool pool;
+    u32 index;
+    VkBuffer buffer;
+    VkDeviceSize offset;
+    const u64* result;
+};
+
 class QueryPool final : public ResourcePool {
 public:
-    explicit QueryPool(const Device& device, VKScheduler& scheduler, VideoCore::QueryType type);
+    explicit QueryPool(const Device& device, MemoryAllocator& memory_allocator,
+                       VKScheduler& scheduler, VideoCore::QueryType type);
     ~QueryPool() override;
 
-    std::pair<VkQueryPool, u32> Commit();
+    HostQuery Commit();
 
     void Reserve(std::pair<VkQueryPool, u32> query);
 
@@ -44,10 +56,14 @@ private:
     static constexpr std::size_t GROW_STEP = 512;
 
     const Device& device;
+    MemoryAllocator& memory_allocator;
     const VideoCore::QueryType type;
 
     std::vector<vk::QueryPool> pools;
     std::vector<bool> usage;
+    std::vector<vk::Buffer> result_buffers;
+    std::vector<MemoryCommit> result_commits;
+    std::vector<u64*> result_maps;
 };
 
 class VKQueryCache final
@@ -55,13 +71,21 @@ class VKQueryCache final
 public:
     explicit VKQueryCache(VideoCore::RasterizerInterface& rasterizer_,
                           Tegra::Engines::Maxwell3D& maxwell3d_, Tegra::MemoryManager& gpu_memory_,
-                          const Device& device_, VKScheduler& scheduler_);
+                          const Device& device_, MemoryAllocator& memory_allocator_,
+                          VKScheduler& scheduler_);
     ~VKQueryCache();
 
-    std::pair<VkQueryPool, u32> AllocateQuery(VideoCore::QueryType type);
+    HostQuery AllocateQuery(VideoCore::QueryType type);
 
     void Reserve(VideoCore::QueryType type, std::pair<VkQueryPool, u32> query);
 
+    /// Schedules a GPU-side copy of a finished query into its results slot
+    void AddPendingResult(const HostQuery& query);
+
+    /// Records every pending result copy. Called by the scheduler on submission, when the
+    /// command buffer is outside of a render pass.
+    void CopyPendingResults();
+
     const Device& GetDevice() const noexcept {
         return device;
     }
@@ -71,9 +95,17 @@ public:
     }
 
 private:
+    struct PendingResultCopy {
+        VkQueryPool pool;
+        u32 index;
+        VkBuffer buffer;
+        VkDeviceSize offset;
+    };
+
     const Device& device;
     VKScheduler& scheduler;
     std::array<QueryPool, VideoCore::NumQueryTypes> query_pools;
+    std::vector<PendingResultCopy> pending_results;
 };
 
 class HostCounter final : public VideoCommon::HostCounterBase<VKQueryCache, HostCounter> {
@@ -89,7 +121,7 @@ private:
 
     VKQueryCache& cache;
     const VideoCore::QueryType type;
-    const std::pair<VkQueryPool, u32> query;
+    const HostQuery query;
     const u64 tick;
 };
 
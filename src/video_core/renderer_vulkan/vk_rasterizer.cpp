@@ -14,6 +14,7 @@
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/settings.h"
@@ -421,13 +422,15 @@ RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra
       quad_array_pass(device, scheduler, descriptor_pool, staging_pool, update_descriptor_queue),
       quad_indexed_pass(device, scheduler, descriptor_pool, staging_pool, update_descriptor_queue),
       uint8_pass(device, scheduler, descriptor_pool, staging_pool, update_descriptor_queue),
-      texture_cache_runtime{device, scheduler, memory_allocator, staging_pool, blit_image},
+      astc_decoder_pass(device, scheduler, descriptor_pool, update_descriptor_queue),
+      texture_cache_runtime{device,       scheduler,  memory_allocator,
+                            staging_pool, blit_image, astc_decoder_pass},
       texture_cache(texture_cache_runtime, *this, maxwell3d, kepler_compute, gpu_memory),
       pipeline_cache(*this, gpu, maxwell3d, kepler_compute, gpu_memory, device, scheduler,
                      descriptor_pool, update_descriptor_queue),
       buffer_cache(*this, gpu_memory, cpu_memory_, device, memory_allocator, scheduler,
                    stream_buffer, staging_pool),
-      query_cache{*this, maxwell3d, gpu_memory, device, scheduler},
+      query_cache{*this, maxwell3d, gpu_memory, device, memory_allocator, scheduler},
       fence_manager(*this, gpu, gpu_memory, texture_cache, buffer_cache, query_cache, scheduler),
       wfi_event(device.GetLogical().CreateEvent()), async_shaders(emu_window_) {
     scheduler.SetQueryCache(query_cache);
@@ -440,6 +443,7 @@ RasterizerVulkan::~RasterizerVulkan() = default;
 
 void RasterizerVulkan::Draw(bool is_indexed, bool is_instanced) {
     MICROPROFILE_SCOPE(Vulkan_Drawing);
+    Common::AddPerfCounter(Common::PerfCounter::DrawCalls);
 
     SCOPE_EXIT({ gpu.TickWork(); });
     FlushWork();
@@ -447,7 +451,10 @@ void RasterizerVulkan::Draw(bool is_indexed, bool is_instanced) {
     query_cache.UpdateCounters();
 
     GraphicsPipelineCacheKey key;
-    key.fixed_state.Fill(maxwell3d.regs, device.IsExtExtendedDynamicStateSupported());
+    if (state_tracker.TouchFixedPipelineState()) {
+        fixed_pipeline_state.Fill(maxwell3d.regs, device.IsExtExtendedDynamicStateSupported());
+    }
+    key.fixed_state = fixed_pipeline_state;
 
     buffer_cache.Map(CalculateGraphicsStreamBufferSize(is_indexed));
 
@@ -485,6 +492,10 @@ void RasterizerVulkan::Draw(bool is_indexed, bool is_instanced) {
     UpdateDynamicStates();
 
     const auto pipeline_layout = pipeline->GetLayout();
+    if (pipeline->GetPushConstantSize() != 0) {
+        // Vertex shader const buffer promoted to push constants by the decompiler.
+        SetupVertexPushConstants(pipeline_layout, shaders[1]->GetEntries());
+    }
     const auto descriptor_set = pipeline->CommitDescriptorSet();
     scheduler.Record([pipeline_layout, descriptor_set, draw_params](vk::CommandBuffer cmdbuf) {
         if (descriptor_set) {
@@ -577,16 +588,22 @@ void RasterizerVulkan::DispatchCompute(GPUVAddr code_addr) {
     query_cache.UpdateCounters();
 
     const auto& launch_desc = kepler_compute.launch_description;
-    auto& pipeline = pipeline_cache.GetComputePipeline({
-        .shader = code_addr,
-        .shared_memory_size = launch_desc.shared_alloc,
-        .workgroup_size =
-            {
-                launch_desc.block_dim_x,
-                launch_desc.block_dim_y,
-                launch_desc.block_dim_z,
-            },
-    });
+    auto* const pipeline = pipeline_cache.GetComputePipeline(
+        {
+            .shader = code_addr,
+            .shared_memory_size = launch_desc.shared_alloc,
+            .workgroup_size =
+                {
+                    launch_desc.block_dim_x,
+                    launch_desc.block_dim_y,
+                    launch_desc.block_dim_z,
+                },
+        },
+        async_shaders);
+    if (pipeline == nullptr) {
+        // Async compute pipeline was not ready.
+        return;
+    }
 
     // Compute dispatches can't be executed inside a renderpass
     scheduler.RequestOutsideRenderPassOperationContext();
@@ -597,7 +614,7 @@ void RasterizerVulkan::DispatchCompute(GPUVAddr code_addr) {
     auto lock = texture_cache.AcquireLock();
     texture_cache.SynchronizeComputeDescriptors();
 
-    const auto& entries = pipeline.GetEntries();
+    const auto& entries = pipeline->GetEntries();
     SetupComputeUniformTexels(entries);
     SetupComputeTextures(entries);
     SetupComputeStorageTexels(entries);
@@ -620,9 +637,9 @@ void RasterizerVulkan::DispatchCompute(GPUVAddr code_addr) {
 
     buffer_cache.Unmap();
 
-    const VkPipeline pipeline_handle = pipeline.GetHandle();
-    const VkPipelineLayout pipeline_layout = pipeline.GetLayout();
-    const VkDescriptorSet descriptor_set = pipeline.CommitDescriptorSet();
+    const VkPipeline pipeline_handle = pipeline->GetHandle();
+    const VkPipelineLayout pipeline_layout = pipeline->GetLayout();
+    const VkDescriptorSet descriptor_set = pipeline->CommitDescriptorSet();
     scheduler.Record([grid_x = launch_desc.grid_dim_x, grid_y = launch_desc.grid_dim_y,
                       grid_z = launch_desc.grid_dim_z, pipeline_handle, pipeline_layout,
                       descriptor_set](vk::CommandBuffer cmdbuf) {
@@ -776,6 +793,7 @@ void RasterizerVulkan::TickFrame() {
     fence_manager.TickFrame();
     buffer_cache.TickFrame();
     staging_pool.TickFrame();
+    pipeline_cache.TickFrame();
     {
         auto lock = texture_cache.AcquireLock();
         texture_cache.TickFrame();
@@ -790,6 +808,17 @@ bool RasterizerVulkan::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Surf
     return true;
 }
 
+bool RasterizerVulkan::AccelerateBufferCopy(GPUVAddr src_address, GPUVAddr dst_address,
+                                            std::size_t size) {
+    return buffer_cache.DMACopy(src_address, dst_address, size);
+}
+
+bool RasterizerVulkan::AccelerateVideoFrame(const VideoCommon::ImageInfo& info, GPUVAddr gpu_addr,
+                                            std::span<const u8> frame_data) {
+    auto lock = texture_cache.AcquireLock();
+    return texture_cache.UploadVideoFrame(info, gpu_addr, frame_data);
+}
+
 bool RasterizerVulkan::AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                          VAddr framebuffer_addr, u32 pixel_stride) {
     if (!framebuffer_addr) {
@@ -802,13 +831,24 @@ bool RasterizerVulkan::AccelerateDisplay(const Tegra::FramebufferConfig& config,
         return false;
     }
 
+    screen_info.image = image_view->ImageHandle();
     screen_info.image_view = image_view->Handle(VideoCommon::ImageViewType::e2D);
+    // The copy-based present path reinterprets the raw image, so this has to be the format the
+    // image itself was created with, not the view's
+    screen_info.format =
+        MaxwellToVK::SurfaceFormat(device, FormatType::Optimal, true, image_view->ImageFormat())
+            .format;
     screen_info.width = image_view->size.width;
     screen_info.height = image_view->size.height;
     screen_info.is_srgb = VideoCore::Surface::IsPixelFormatSRGB(image_view->format);
     return true;
 }
 
+void RasterizerVulkan::LoadDiskResources(u64 title_id, const std::atomic_bool& stop_loading,
+                                         const VideoCore::DiskResourceLoadCallback& callback) {
+    pipeline_cache.LoadDiskCache(title_id);
+}
+
 void RasterizerVulkan::FlushWork() {
     static constexpr u32 DRAWS_TO_DISPATCH = 4096;
 
@@ -889,13 +929,18 @@ void RasterizerVulkan::SetupShaderDescriptors(
 
 void RasterizerVulkan::UpdateDynamicStates() {
     auto& regs = maxwell3d.regs;
-    UpdateViewportsState(regs);
-    UpdateScissorsState(regs);
-    UpdateDepthBias(regs);
-    UpdateBlendConstants(regs);
-    UpdateDepthBounds(regs);
-    UpdateStencilFaces(regs);
-    if (device.IsExtExtendedDynamicStateSupported()) {
+    // Check whole buckets of dirty flags at once so a clean draw early-outs with one test per
+    // group instead of walking every Update function.
+    if (state_tracker.AnyBaselineDynamicStateDirty()) {
+        UpdateViewportsState(regs);
+        UpdateScissorsState(regs);
+        UpdateDepthBias(regs);
+        UpdateBlendConstants(regs);
+        UpdateDepthBounds(regs);
+        UpdateStencilFaces(regs);
+    }
+    if (device.IsExtExtendedDynamicStateSupported() &&
+        state_tracker.AnyExtendedDynamicStateDirty()) {
         UpdateCullMode(regs);
         UpdateDepthBoundsTestEnable(regs);
         UpdateDepthTestEnable(regs);
@@ -1033,6 +1078,26 @@ void RasterizerVulkan::SetupGraphicsConstBuffers(const ShaderEntries& entries, s
     }
 }
 
+void RasterizerVulkan::SetupVertexPushConstants(VkPipelineLayout pipeline_layout,
+                                                const ShaderEntries& entries) {
+    MICROPROFILE_SCOPE(Vulkan_ConstBuffers);
+    const auto& entry = entries.push_constant_cbuf;
+    if (!entry) {
+        return;
+    }
+    const auto& buffer =
+        maxwell3d.state.shader_stages[0].const_buffers[entry->cbuf_index];
+    std::array<u8, 128> data{};
+    const u32 size = std::min(entry->size, static_cast<u32>(data.size()));
+    if (buffer.enabled) {
+        gpu_memory.ReadBlockUnsafe(buffer.address, data.data(),
+                                   std::min<std::size_t>(size, buffer.size));
+    }
+    scheduler.Record([pipeline_layout, size, data](vk::CommandBuffer cmdbuf) {
+        cmdbuf.PushConstants(pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0, size, data.data());
+    });
+}
+
 void RasterizerVulkan::SetupGraphicsGlobalBuffers(const ShaderEntries& entries, size_t stage) {
     MICROPROFILE_SCOPE(Vulkan_GlobalBuffers);
     const auto& cbufs{maxwell3d.state.shader_stages[stage]};
@@ -1170,7 +1235,7 @@ void RasterizerVulkan::SetupConstBuffer(const ConstBufferEntry& entry,
     ASSERT(size <= MaxConstbufferSize);
 
     const u64 alignment = device.GetUniformBufferAlignment();
-    const auto info = buffer_cache.UploadMemory(buffer.address, size, alignment);
+    const auto info = buffer_cache.UploadMemory(buffer.address, size, alignment, false, true);
     update_descriptor_queue.AddBuffer(info.handle, info.offset, size);
 }
 
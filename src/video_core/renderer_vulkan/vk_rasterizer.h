@@ -84,8 +84,14 @@ public:
     bool AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Surface& src,
                                const Tegra::Engines::Fermi2D::Surface& dst,
                                const Tegra::Engines::Fermi2D::Config& copy_config) override;
+    bool AccelerateBufferCopy(GPUVAddr src_address, GPUVAddr dst_address,
+                              std::size_t size) override;
+    bool AccelerateVideoFrame(const VideoCommon::ImageInfo& info, GPUVAddr gpu_addr,
+                              std::span<const u8> frame_data) override;
     bool AccelerateDisplay(const Tegra::FramebufferConfig& config, VAddr framebuffer_addr,
                            u32 pixel_stride) override;
+    void LoadDiskResources(u64 title_id, const std::atomic_bool& stop_loading,
+                           const VideoCore::DiskResourceLoadCallback& callback) override;
 
     VideoCommon::Shader::AsyncShaders& GetAsyncShaders() {
         return async_shaders;
@@ -139,6 +145,9 @@ private:
     /// Setup constant buffers in the graphics pipeline.
     void SetupGraphicsConstBuffers(const ShaderEntries& entries, std::size_t stage);
 
+    /// Feeds the vertex stage const buffer promoted to push constants by the decompiler.
+    void SetupVertexPushConstants(VkPipelineLayout pipeline_layout, const ShaderEntries& entries);
+
     /// Setup global buffers in the graphics pipeline.
     void SetupGraphicsGlobalBuffers(const ShaderEntries& entries, std::size_t stage);
 
@@ -225,6 +234,7 @@ private:
     QuadArrayPass quad_array_pass;
     QuadIndexedPass quad_indexed_pass;
     Uint8Pass uint8_pass;
+    ASTCDecoderPass astc_decoder_pass;
 
     TextureCacheRuntime texture_cache_runtime;
     TextureCache texture_cache;
@@ -242,6 +252,10 @@ private:
     std::array<VideoCommon::ImageViewId, MAX_IMAGE_VIEWS> image_view_ids;
     boost::container::static_vector<VkSampler, MAX_TEXTURES> sampler_handles;
 
+    /// Pipeline key state cached across draws; only refilled from the Maxwell registers when the
+    /// state tracker reports that a register feeding it changed
+    FixedPipelineState fixed_pipeline_state{};
+
     u32 draw_counter = 0;
 };
 
@@ -45,6 +45,10 @@ size_t ResourcePool::CommitResource() {
     return *found;
 }
 
+void ResourcePool::RefreshResource(size_t index) {
+    ticks[index] = master_semaphore.CurrentTick();
+}
+
 size_t ResourcePool::ManageOverflow() {
     const size_t old_capacity = ticks.size();
     Grow();
@@ -24,6 +24,9 @@ public:
 protected:
     size_t CommitResource();
 
+    /// Extends the lifetime of a committed resource to the current tick.
+    void RefreshResource(size_t index);
+
     /// Called when a chunk of resources have to be allocated.
     virtual void Allocate(size_t begin, size_t end) = 0;
 
@@ -2,11 +2,13 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "common/microprofile.h"
 #include "common/thread.h"
@@ -61,6 +63,11 @@ bool VKScheduler::IsFree(u64 tick) const noexcept {
 }
 
 void VKScheduler::Wait(u64 tick) {
+    if (tick > last_submitted_tick) {
+        // The submission that signals this tick is still held back, send it to the queue first
+        std::unique_lock lock{mutex};
+        SubmitPending(nullptr);
+    }
     master_semaphore->Wait(tick);
 }
 
@@ -80,12 +87,8 @@ void VKScheduler::WaitWorker() {
     MICROPROFILE_SCOPE(Vulkan_WaitForWorker);
     DispatchWork();
 
-    bool finished = false;
-    do {
-        cv.notify_all();
-        std::unique_lock lock{mutex};
-        finished = chunk_queue.Empty();
-    } while (!finished);
+    std::unique_lock lock{mutex};
+    cv.wait(lock, [this] { return chunk_queue.Empty() && !worker_busy; });
 }
 
 void VKScheduler::DispatchWork() {
@@ -154,10 +157,18 @@ void VKScheduler::WorkerThread() {
         if (quit) {
             continue;
         }
-        auto extracted_chunk = std::move(chunk_queue.Front());
-        chunk_queue.Pop();
-        extracted_chunk->ExecuteAll(current_cmdbuf);
-        chunk_reserve.Push(std::move(extracted_chunk));
+        worker_busy = true;
+        do {
+            auto extracted_chunk = std::move(chunk_queue.Front());
+            chunk_queue.Pop();
+            // Execute the chunk with the lock dropped so recording never blocks the producer
+            lock.unlock();
+            extracted_chunk->ExecuteAll(current_cmdbuf);
+            chunk_reserve.Push(std::move(extracted_chunk));
+            lock.lock();
+        } while (!chunk_queue.Empty());
+        worker_busy = false;
+        cv.notify_all();
     } while (!quit);
 }
 
@@ -170,38 +181,76 @@ void VKScheduler::SubmitExecution(VkSemaphore semaphore) {
 
     current_cmdbuf.End();
 
-    const VkSemaphore timeline_semaphore = master_semaphore->Handle();
-    const u32 num_signal_semaphores = semaphore ? 2U : 1U;
-
     const u64 signal_value = master_semaphore->CurrentTick();
-    const u64 wait_value = signal_value - 1;
-    const VkPipelineStageFlags wait_stage_mask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-
     master_semaphore->NextTick();
 
-    const std::array signal_values{signal_value, u64(0)};
-    const std::array signal_semaphores{timeline_semaphore, semaphore};
+    pending_submits.push_back(PendingSubmit{
+        .cmdbuf = *current_cmdbuf.address(),
+        .signal_value = signal_value,
+    });
+    // Binary semaphores have to be signaled on the queue right away, and holding back too many
+    // submissions delays the GPU more than the submission overhead it saves
+    if (semaphore || pending_submits.size() >= MAX_PENDING_SUBMITS) {
+        SubmitPending(semaphore);
+    }
+}
 
-    const VkTimelineSemaphoreSubmitInfoKHR timeline_si{
-        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
-        .pNext = nullptr,
-        .waitSemaphoreValueCount = 1,
-        .pWaitSemaphoreValues = &wait_value,
-        .signalSemaphoreValueCount = num_signal_semaphores,
-        .pSignalSemaphoreValues = signal_values.data(),
-    };
-    const VkSubmitInfo submit_info{
-        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-        .pNext = &timeline_si,
-        .waitSemaphoreCount = 1,
-        .pWaitSemaphores = &timeline_semaphore,
-        .pWaitDstStageMask = &wait_stage_mask,
-        .commandBufferCount = 1,
-        .pCommandBuffers = current_cmdbuf.address(),
-        .signalSemaphoreCount = num_signal_semaphores,
-        .pSignalSemaphores = signal_semaphores.data(),
+void VKScheduler::SubmitPending(VkSemaphore semaphore) {
+    if (pending_submits.empty()) {
+        return;
+    }
+    // Each pending command buffer keeps its own submit info so it waits on the previous tick and
+    // signals its own, preserving the chain the separate submissions had before
+    struct SubmitChain {
+        VkCommandBuffer cmdbuf;
+        u64 wait_value;
+        std::array<u64, 2> signal_values;
+        std::array<VkSemaphore, 2> signal_semaphores;
+        VkTimelineSemaphoreSubmitInfoKHR timeline_si;
     };
-    switch (const VkResult result = device.GetGraphicsQueue().Submit(submit_info)) {
+    static constexpr VkPipelineStageFlags wait_stage_mask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+    const VkSemaphore timeline_semaphore = master_semaphore->Handle();
+    const size_t num_submits = pending_submits.size();
+
+    std::vector<SubmitChain> chains(num_submits);
+    std::vector<VkSubmitInfo> submit_infos(num_submits);
+    for (size_t i = 0; i < num_submits; ++i) {
+        const PendingSubmit& pending = pending_submits[i];
+        SubmitChain& chain = chains[i];
+
+        // Only the last submission of the batch signals the caller's binary semaphore
+        const bool is_last = i + 1 == num_submits;
+        const u32 num_signal_semaphores = is_last && semaphore ? 2U : 1U;
+
+        chain.cmdbuf = pending.cmdbuf;
+        chain.wait_value = pending.signal_value - 1;
+        chain.signal_values = {pending.signal_value, u64(0)};
+        chain.signal_semaphores = {timeline_semaphore, semaphore};
+        chain.timeline_si = {
+            .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+            .pNext = nullptr,
+            .waitSemaphoreValueCount = 1,
+            .pWaitSemaphoreValues = &chain.wait_value,
+            .signalSemaphoreValueCount = num_signal_semaphores,
+            .pSignalSemaphoreValues = chain.signal_values.data(),
+        };
+        submit_infos[i] = {
+            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            .pNext = &chain.timeline_si,
+            .waitSemaphoreCount = 1,
+            .pWaitSemaphores = &timeline_semaphore,
+            .pWaitDstStageMask = &wait_stage_mask,
+            .commandBufferCount = 1,
+            .pCommandBuffers = &chain.cmdbuf,
+            .signalSemaphoreCount = num_signal_semaphores,
+            .pSignalSemaphores = chain.signal_semaphores.data(),
+        };
+    }
+    last_submitted_tick = pending_submits.back().signal_value;
+    pending_submits.clear();
+
+    switch (const VkResult result = device.GetGraphicsQueue().Submit(submit_infos)) {
     case VK_SUCCESS:
         break;
     case VK_ERROR_DEVICE_LOST:
@@ -237,6 +286,7 @@ void VKScheduler::InvalidateState() {
 void VKScheduler::EndPendingOperations() {
     query_cache->DisableStreams();
     EndRenderPass();
+    query_cache->CopyPendingResults();
 }
 
 void VKScheduler::EndRenderPass() {
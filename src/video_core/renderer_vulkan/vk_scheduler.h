@@ -11,6 +11,7 @@
 #include <stack>
 #include <thread>
 #include <utility>
+#include <vector>
 #include "common/alignment.h"
 #include "common/common_types.h"
 #include "common/threadsafe_queue.h"
@@ -167,10 +168,23 @@ private:
         VkPipeline graphics_pipeline = nullptr;
     };
 
+    /// Command buffer that has been recorded and ended but not yet handed to the queue
+    struct PendingSubmit {
+        VkCommandBuffer cmdbuf;
+        u64 signal_value;
+    };
+
+    /// Maximum number of command buffers held back before they are forced into a queue submission
+    static constexpr size_t MAX_PENDING_SUBMITS = 8;
+
     void WorkerThread();
 
     void SubmitExecution(VkSemaphore semaphore);
 
+    /// Sends all held back command buffers to the queue in a single submission.
+    /// The scheduler mutex has to be held when calling this function.
+    void SubmitPending(VkSemaphore semaphore);
+
     void AllocateNewContext();
 
     void EndPendingOperations();
@@ -194,6 +208,9 @@ private:
 
     State state;
 
+    std::vector<PendingSubmit> pending_submits;
+    u64 last_submitted_tick = 0;
+
     u32 num_renderpass_images = 0;
     std::array<VkImage, 9> renderpass_images{};
     std::array<VkImageSubresourceRange, 9> renderpass_image_ranges{};
@@ -202,6 +219,7 @@ private:
     Common::SPSCQueue<std::unique_ptr<CommandChunk>> chunk_reserve;
     std::mutex mutex;
     std::condition_variable cv;
+    bool worker_busy = false;
     bool quit = false;
 };
 
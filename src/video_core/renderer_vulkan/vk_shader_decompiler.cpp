@@ -49,6 +49,17 @@ class ExprDecompiler;
 constexpr u32 MaxConstBufferFloats = 0x4000;
 constexpr u32 MaxConstBufferElements = MaxConstBufferFloats / 4;
 
+// Only the guaranteed minimum push constant budget is used so the fast path works on any device.
+constexpr u32 MaxPushConstantBytes = 128;
+constexpr u32 PushConstantCbufIndex = 0;
+
+/// Returns true when a const buffer is fed through push constants instead of a uniform buffer.
+/// Must yield the same result for shader entry generation and decompilation.
+bool UsePushConstantsForCbuf(ShaderType stage, u32 index, const ConstBuffer& cbuf) {
+    return stage == ShaderType::Vertex && index == PushConstantCbufIndex && !cbuf.IsIndirect() &&
+           cbuf.GetSize() <= MaxPushConstantBytes;
+}
+
 constexpr u32 NumInputPatches = 32; // This value seems to be the standard
 
 enum class Type { Void, Bool, Bool2, Float, Int, Uint, HalfFloat };
@@ -872,6 +883,10 @@ private:
 
     u32 DeclareConstantBuffers(u32 binding) {
         for (const auto& [index, size] : ir.GetConstantBuffers()) {
+            if (UsePushConstantsForCbuf(stage, index, size)) {
+                DeclarePushConstantBuffer(index, size);
+                continue;
+            }
             const Id type = device.IsKhrUniformBufferStandardLayoutSupported() ? t_cbuf_scalar_ubo
                                                                                : t_cbuf_std140_ubo;
             const Id id = OpVariable(type, spv::StorageClass::Uniform);
@@ -884,6 +899,21 @@ private:
         return binding;
     }
 
+    void DeclarePushConstantBuffer(u32 index, const ConstBuffer& cbuf) {
+        // Push constant blocks follow std430 rules, so a tightly packed float array is always
+        // legal here, unlike in the uniform buffer path.
+        const u32 num_floats = cbuf.GetSize() / 4;
+        const Id array = Decorate(Name(TypeArray(t_float, Constant(t_uint, num_floats)),
+                                       "PushCbufArray"),
+                                  spv::Decoration::ArrayStride, 4U);
+        const Id struct_type = MemberDecorate(
+            Decorate(TypeStruct(array), spv::Decoration::Block), 0, spv::Decoration::Offset, 0);
+        const Id pointer_type = TypePointer(spv::StorageClass::PushConstant, struct_type);
+        push_constant_buffer = OpVariable(pointer_type, spv::StorageClass::PushConstant);
+        AddGlobalVariable(Name(push_constant_buffer, fmt::format("pc_cbuf_{}", index)));
+        push_constant_cbuf = index;
+    }
+
     u32 DeclareGlobalBuffers(u32 binding) {
         for (const auto& [base, usage] : ir.GetGlobalMemory()) {
             const Id id = OpVariable(t_gmem_ssbo, spv::StorageClass::StorageBuffer);
@@ -1253,6 +1283,13 @@ private:
 
         if (const auto cbuf = std::get_if<CbufNode>(&*node)) {
             const Node& offset = cbuf->GetOffset();
+            if (push_constant_cbuf && *push_constant_cbuf == cbuf->GetIndex()) {
+                const Id buffer_offset =
+                    OpShiftRightLogical(t_uint, AsUint(Visit(offset)), Constant(t_uint, 2U));
+                const Id pointer = OpAccessChain(t_pc_float, push_constant_buffer,
+                                                 Constant(t_uint, 0U), buffer_offset);
+                return {OpLoad(t_float, pointer), Type::Float};
+            }
             const Id buffer_id = constant_buffers.at(cbuf->GetIndex());
 
             Id pointer{};
@@ -2795,6 +2832,7 @@ private:
     const Id t_out_float4 = Name(TypePointer(spv::StorageClass::Output, t_float4), "out_float4");
 
     const Id t_cbuf_float = TypePointer(spv::StorageClass::Uniform, t_float);
+    const Id t_pc_float = TypePointer(spv::StorageClass::PushConstant, t_float);
     const Id t_cbuf_std140 = Decorate(
         Name(TypeArray(t_float4, Constant(t_uint, MaxConstBufferElements)), "CbufStd140Array"),
         spv::Decoration::ArrayStride, 16U);
@@ -2845,6 +2883,8 @@ private:
     std::map<Attribute::Index, Id> input_attributes;
     std::unordered_map<u8, GenericVaryingDescription> output_attributes;
     std::map<u32, Id> constant_buffers;
+    Id push_constant_buffer{};
+    std::optional<u32> push_constant_cbuf;
     std::map<GlobalMemoryBase, Id> global_buffers;
     std::map<u32, TexelBuffer> uniform_texels;
     std::map<u32, SampledImage> sampled_images;
@@ -3100,9 +3140,17 @@ void SPIRVDecompiler::DecompileAST() {
 
 } // Anonymous namespace
 
-ShaderEntries GenerateShaderEntries(const VideoCommon::Shader::ShaderIR& ir) {
+ShaderEntries GenerateShaderEntries(const VideoCommon::Shader::ShaderIR& ir,
+                                    Tegra::Engines::ShaderType stage) {
     ShaderEntries entries;
     for (const auto& cbuf : ir.GetConstantBuffers()) {
+        if (UsePushConstantsForCbuf(stage, cbuf.first, cbuf.second)) {
+            entries.push_constant_cbuf = PushConstantBufferEntry{
+                .cbuf_index = cbuf.first,
+                .size = cbuf.second.GetSize(),
+            };
+            continue;
+        }
         entries.const_buffers.emplace_back(cbuf.second, cbuf.first);
     }
     for (const auto& [base, usage] : ir.GetGlobalMemory()) {
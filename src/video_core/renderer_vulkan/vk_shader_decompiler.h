@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -62,6 +63,12 @@ private:
     bool is_written{};
 };
 
+/// Describes a const buffer that is fed through push constants instead of a uniform buffer.
+struct PushConstantBufferEntry {
+    u32 cbuf_index{};
+    u32 size{};
+};
+
 struct ShaderEntries {
     u32 NumBindings() const {
         return static_cast<u32>(const_buffers.size() + global_buffers.size() +
@@ -70,6 +77,7 @@ struct ShaderEntries {
     }
 
     std::vector<ConstBufferEntry> const_buffers;
+    std::optional<PushConstantBufferEntry> push_constant_cbuf;
     std::vector<GlobalBufferEntry> global_buffers;
     std::vector<UniformTexelEntry> uniform_texels;
     std::vector<SamplerEntry> samplers;
@@ -96,6 +104,8 @@ struct Specialization final {
     bool early_fragment_tests{};
     float alpha_test_ref{};
     Maxwell::ComparisonOp alpha_test_func{};
+
+    bool operator==(const Specialization&) const noexcept = default;
 };
 // Old gcc versions don't consider this trivially copyable.
 // static_assert(std::is_trivially_copyable_v<Specialization>);
@@ -105,7 +115,8 @@ struct SPIRVShader {
     ShaderEntries entries;
 };
 
-ShaderEntries GenerateShaderEntries(const VideoCommon::Shader::ShaderIR& ir);
+ShaderEntries GenerateShaderEntries(const VideoCommon::Shader::ShaderIR& ir,
+                                    Tegra::Engines::ShaderType stage);
 
 std::vector<u32> Decompile(const Device& device, const VideoCommon::Shader::ShaderIR& ir,
                            Tegra::Engines::ShaderType stage,
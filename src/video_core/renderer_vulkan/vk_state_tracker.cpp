@@ -33,7 +33,7 @@ Flags MakeInvalidationFlags() {
     static constexpr std::array INVALIDATION_FLAGS{
         Viewports,         Scissors,  DepthBias,         BlendConstants,    DepthBounds,
         StencilProperties, CullMode,  DepthBoundsEnable, DepthTestEnable,   DepthWriteEnable,
-        DepthCompareOp,    FrontFace, StencilOp,         StencilTestEnable,
+        DepthCompareOp,    FrontFace, StencilOp,         StencilTestEnable, FixedPipeline,
     };
     Flags flags{};
     for (const int flag : INVALIDATION_FLAGS) {
@@ -42,32 +42,70 @@ Flags MakeInvalidationFlags() {
     return flags;
 }
 
-void SetupDirtyViewports(Tables& tables) {
+Flags MakeBaselineDynamicStateFlags() {
+    static constexpr std::array BASELINE_FLAGS{
+        Viewports, Scissors, DepthBias, BlendConstants, DepthBounds, StencilProperties,
+    };
+    Flags flags{};
+    for (const int flag : BASELINE_FLAGS) {
+        flags[flag] = true;
+    }
+    return flags;
+}
+
+Flags MakeExtendedDynamicStateFlags() {
+    static constexpr std::array EXTENDED_FLAGS{
+        CullMode,         DepthBoundsEnable, DepthTestEnable, DepthWriteEnable,
+        DepthCompareOp,   FrontFace,         StencilOp,       StencilTestEnable,
+    };
+    Flags flags{};
+    for (const int flag : EXTENDED_FLAGS) {
+        flags[flag] = true;
+    }
+    return flags;
+}
+
+Flags MakeFixedPipelinePeekFlags() {
+    // Registers that feed FixedPipelineState but already have a dynamic state flag of their own.
+    // TouchFixedPipelineState peeks these without clearing them; the dynamic state updates that
+    // own them run later in the same draw.
+    static constexpr std::array PEEK_FLAGS{
+        StencilProperties, CullMode,  DepthBoundsEnable, DepthTestEnable,   DepthWriteEnable,
+        DepthCompareOp,    FrontFace, StencilOp,         StencilTestEnable,
+    };
+    Flags flags{};
+    for (const int flag : PEEK_FLAGS) {
+        flags[flag] = true;
+    }
+    return flags;
+}
+
+constexpr void SetupDirtyViewports(Tables& tables) {
     FillBlock(tables[0], OFF(viewport_transform), NUM(viewport_transform), Viewports);
     FillBlock(tables[0], OFF(viewports), NUM(viewports), Viewports);
     tables[0][OFF(viewport_transform_enabled)] = Viewports;
 }
 
-void SetupDirtyScissors(Tables& tables) {
+constexpr void SetupDirtyScissors(Tables& tables) {
     FillBlock(tables[0], OFF(scissor_test), NUM(scissor_test), Scissors);
 }
 
-void SetupDirtyDepthBias(Tables& tables) {
+constexpr void SetupDirtyDepthBias(Tables& tables) {
     auto& table = tables[0];
     table[OFF(polygon_offset_units)] = DepthBias;
     table[OFF(polygon_offset_clamp)] = DepthBias;
     table[OFF(polygon_offset_factor)] = DepthBias;
 }
 
-void SetupDirtyBlendConstants(Tables& tables) {
+constexpr void SetupDirtyBlendConstants(Tables& tables) {
     FillBlock(tables[0], OFF(blend_color), NUM(blend_color), BlendConstants);
 }
 
-void SetupDirtyDepthBounds(Tables& tables) {
+constexpr void SetupDirtyDepthBounds(Tables& tables) {
     FillBlock(tables[0], OFF(depth_bounds), NUM(depth_bounds), DepthBounds);
 }
 
-void SetupDirtyStencilProperties(Tables& tables) {
+constexpr void SetupDirtyStencilProperties(Tables& tables) {
     auto& table = tables[0];
     table[OFF(stencil_two_side_enable)] = StencilProperties;
     table[OFF(stencil_front_func_ref)] = StencilProperties;
@@ -78,35 +116,35 @@ void SetupDirtyStencilProperties(Tables& tables) {
     table[OFF(stencil_back_func_mask)] = StencilProperties;
 }
 
-void SetupDirtyCullMode(Tables& tables) {
+constexpr void SetupDirtyCullMode(Tables& tables) {
     auto& table = tables[0];
     table[OFF(cull_face)] = CullMode;
     table[OFF(cull_test_enabled)] = CullMode;
 }
 
-void SetupDirtyDepthBoundsEnable(Tables& tables) {
+constexpr void SetupDirtyDepthBoundsEnable(Tables& tables) {
     tables[0][OFF(depth_bounds_enable)] = DepthBoundsEnable;
 }
 
-void SetupDirtyDepthTestEnable(Tables& tables) {
+constexpr void SetupDirtyDepthTestEnable(Tables& tables) {
     tables[0][OFF(depth_test_enable)] = DepthTestEnable;
 }
 
-void SetupDirtyDepthWriteEnable(Tables& tables) {
+constexpr void SetupDirtyDepthWriteEnable(Tables& tables) {
     tables[0][OFF(depth_write_enabled)] = DepthWriteEnable;
 }
 
-void SetupDirtyDepthCompareOp(Tables& tables) {
+constexpr void SetupDirtyDepthCompareOp(Tables& tables) {
     tables[0][OFF(depth_test_func)] = DepthCompareOp;
 }
 
-void SetupDirtyFrontFace(Tables& tables) {
+constexpr void SetupDirtyFrontFace(Tables& tables) {
     auto& table = tables[0];
     table[OFF(front_face)] = FrontFace;
     table[OFF(screen_y_control)] = FrontFace;
 }
 
-void SetupDirtyStencilOp(Tables& tables) {
+constexpr void SetupDirtyStencilOp(Tables& tables) {
     auto& table = tables[0];
     table[OFF(stencil_front_op_fail)] = StencilOp;
     table[OFF(stencil_front_op_zfail)] = StencilOp;
@@ -121,15 +159,52 @@ void SetupDirtyStencilOp(Tables& tables) {
     tables[1][OFF(stencil_two_side_enable)] = StencilOp;
 }
 
-void SetupDirtyStencilTestEnable(Tables& tables) {
+constexpr void SetupDirtyStencilTestEnable(Tables& tables) {
     tables[0][OFF(stencil_enable)] = StencilTestEnable;
 }
 
-} // Anonymous namespace
+constexpr void SetupDirtyFixedPipeline(Tables& tables) {
+    auto& table = tables[0];
+    table[OFF(force_early_fragment_tests)] = FixedPipeline;
+    FillBlock(table, OFF(tess_mode), NUM(tess_mode), FixedPipeline);
+    table[OFF(rasterize_enable)] = FixedPipeline;
+    table[OFF(depth_mode)] = FixedPipeline;
+    table[OFF(polygon_mode_front)] = FixedPipeline;
+    table[OFF(polygon_offset_point_enable)] = FixedPipeline;
+    table[OFF(polygon_offset_line_enable)] = FixedPipeline;
+    table[OFF(polygon_offset_fill_enable)] = FixedPipeline;
+    table[OFF(patch_vertices)] = FixedPipeline;
+    table[OFF(color_mask_common)] = FixedPipeline;
+    FillBlock(table, OFF(color_mask), NUM(color_mask), FixedPipeline);
+    FillBlock(table, OFF(vertex_attrib_format), NUM(vertex_attrib_format), FixedPipeline);
+    table[OFF(independent_blend_enable)] = FixedPipeline;
+    FillBlock(table, OFF(blend), NUM(blend), FixedPipeline);
+    FillBlock(table, OFF(independent_blend), NUM(independent_blend), FixedPipeline);
+    table[OFF(alpha_test_enabled)] = FixedPipeline;
+    table[OFF(alpha_test_ref)] = FixedPipeline;
+    table[OFF(alpha_test_func)] = FixedPipeline;
+    table[OFF(point_size)] = FixedPipeline;
+    table[OFF(multisample_mode)] = FixedPipeline;
+    table[OFF(draw.topology)] = FixedPipeline;
+    FillBlock(table, OFF(primitive_restart), NUM(primitive_restart), FixedPipeline);
+    table[OFF(view_volume_clip_control)] = FixedPipeline;
+    FillBlock(table, OFF(logic_op), NUM(logic_op), FixedPipeline);
+    FillBlock(table, OFF(instanced_arrays), NUM(instanced_arrays), FixedPipeline);
+    // Strides, divisors and the enable bits (which also depend on the start address) feed the key
+    FillBlock(table, OFF(vertex_array), NUM(vertex_array), FixedPipeline);
+
+    // Only the swizzles feed the key; the rest of viewport_transform is dynamic state and
+    // table 0 is taken by Viewports
+    constexpr std::size_t num_per_viewport = NUM(viewport_transform[0]);
+    constexpr std::size_t swizzle_offset = offsetof(Regs::ViewportTransform, swizzle) / sizeof(u32);
+    for (std::size_t index = 0; index < Regs::NumViewports; ++index) {
+        tables[1][OFF(viewport_transform) + index * num_per_viewport + swizzle_offset] =
+            FixedPipeline;
+    }
+}
 
-StateTracker::StateTracker(Tegra::GPU& gpu)
-    : flags{gpu.Maxwell3D().dirty.flags}, invalidation_flags{MakeInvalidationFlags()} {
-    auto& tables = gpu.Maxwell3D().dirty.tables;
+constexpr Tables MakeDirtyTables() {
+    Tables tables{};
     SetupDirtyRenderTargets(tables);
     SetupDirtyViewports(tables);
     SetupDirtyScissors(tables);
@@ -145,6 +220,23 @@ StateTracker::StateTracker(Tegra::GPU& gpu)
     SetupDirtyFrontFace(tables);
     SetupDirtyStencilOp(tables);
     SetupDirtyStencilTestEnable(tables);
+    SetupDirtyFixedPipeline(tables);
+    return tables;
+}
+
+/// Baked at compile time so renderer initialization only copies it in place
+constexpr Tables DIRTY_TABLES = MakeDirtyTables();
+
+} // Anonymous namespace
+
+StateTracker::StateTracker(Tegra::GPU& gpu)
+    : flags{gpu.Maxwell3D().dirty.flags}, invalidation_flags{MakeInvalidationFlags()},
+      baseline_dynamic_state_flags{MakeBaselineDynamicStateFlags()},
+      extended_dynamic_state_flags{MakeExtendedDynamicStateFlags()},
+      fixed_pipeline_peek_flags{MakeFixedPipelinePeekFlags()} {
+    gpu.Maxwell3D().dirty.tables = DIRTY_TABLES;
+    // The cached FixedPipelineState starts out empty and has to be filled on the first draw
+    flags[Dirty::FixedPipeline] = true;
 }
 
 } // namespace Vulkan
@@ -35,6 +35,8 @@ enum : u8 {
     StencilOp,
     StencilTestEnable,
 
+    FixedPipeline,
+
     Last
 };
 static_assert(Last <= std::numeric_limits<u8>::max());
@@ -60,6 +62,16 @@ public:
         flags[Dirty::Scissors] = true;
     }
 
+    /// Returns true when any of the always-supported dynamic state flags is dirty.
+    bool AnyBaselineDynamicStateDirty() const noexcept {
+        return (flags & baseline_dynamic_state_flags).any();
+    }
+
+    /// Returns true when any VK_EXT_extended_dynamic_state flag is dirty.
+    bool AnyExtendedDynamicStateDirty() const noexcept {
+        return (flags & extended_dynamic_state_flags).any();
+    }
+
     bool TouchViewports() {
         return Exchange(Dirty::Viewports, false);
     }
@@ -120,6 +132,16 @@ public:
         return Exchange(Dirty::StencilTestEnable, false);
     }
 
+    /// Returns true when a register feeding FixedPipelineState changed since the last call.
+    /// Registers that are also consumed as dynamic state are only peeked here; their flags are
+    /// still cleared by the dynamic state updates later in the draw.
+    bool TouchFixedPipelineState() {
+        const bool is_dirty =
+            flags[Dirty::FixedPipeline] || (flags & fixed_pipeline_peek_flags).any();
+        flags[Dirty::FixedPipeline] = false;
+        return is_dirty;
+    }
+
     bool ChangePrimitiveTopology(Maxwell::PrimitiveTopology new_topology) {
         const bool has_changed = current_topology != new_topology;
         current_topology = new_topology;
@@ -137,6 +159,9 @@ private:
 
     Tegra::Engines::Maxwell3D::DirtyState::Flags& flags;
     Tegra::Engines::Maxwell3D::DirtyState::Flags invalidation_flags;
+    Tegra::Engines::Maxwell3D::DirtyState::Flags baseline_dynamic_state_flags;
+    Tegra::Engines::Maxwell3D::DirtyState::Flags extended_dynamic_state_flags;
+    Tegra::Engines::Maxwell3D::DirtyState::Flags fixed_pipeline_peek_flags;
     Maxwell::PrimitiveTopology current_topology = INVALID_TOPOLOGY;
 };
 
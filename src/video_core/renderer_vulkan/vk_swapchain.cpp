@@ -11,6 +11,7 @@
 #include "common/logging/log.h"
 #include "core/core.h"
 #include "core/frontend/framebuffer_layout.h"
+#include "core/settings.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_swapchain.h"
 #include "video_core/vulkan_common/vulkan_device.h"
@@ -35,10 +36,25 @@ VkSurfaceFormatKHR ChooseSwapSurfaceFormat(vk::Span<VkSurfaceFormatKHR> formats,
     return found != formats.end() ? *found : formats[0];
 }
 
+bool HasPresentMode(vk::Span<VkPresentModeKHR> modes, VkPresentModeKHR mode) {
+    return std::find(modes.begin(), modes.end(), mode) != modes.end();
+}
+
 VkPresentModeKHR ChooseSwapPresentMode(vk::Span<VkPresentModeKHR> modes) {
-    // Mailbox doesn't lock the application like fifo (vsync), prefer it
-    const auto found = std::find(modes.begin(), modes.end(), VK_PRESENT_MODE_MAILBOX_KHR);
-    return found != modes.end() ? *found : VK_PRESENT_MODE_FIFO_KHR;
+    if (Settings::values.use_vsync.GetValue()) {
+        // FIFO is the only mode required to be supported and the only one that always waits for
+        // vertical blank
+        return VK_PRESENT_MODE_FIFO_KHR;
+    }
+    // Mailbox keeps only the latest pending frame, so a slow compositor or vsync wait never
+    // backpressures the GPU thread inside the image acquire. Prefer it, then immediate.
+    if (HasPresentMode(modes, VK_PRESENT_MODE_MAILBOX_KHR)) {
+        return VK_PRESENT_MODE_MAILBOX_KHR;
+    }
+    if (HasPresentMode(modes, VK_PRESENT_MODE_IMMEDIATE_KHR)) {
+        return VK_PRESENT_MODE_IMMEDIATE_KHR;
+    }
+    return VK_PRESENT_MODE_FIFO_KHR;
 }
 
 VkExtent2D ChooseSwapExtent(const VkSurfaceCapabilitiesKHR& capabilities, u32 width, u32 height) {
@@ -139,7 +155,20 @@ void VKSwapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities,
     const VkSurfaceFormatKHR surface_format{ChooseSwapSurfaceFormat(formats, srgb)};
     const VkPresentModeKHR present_mode{ChooseSwapPresentMode(present_modes)};
 
+    // The passthrough present path copies straight into the swapchain image, which needs
+    // transfer destination usage; not every surface supports it, so only request it when the
+    // capabilities report it.
+    supports_transfer = (capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT) != 0;
+    VkImageUsageFlags image_usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    if (supports_transfer) {
+        image_usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    }
+
     u32 requested_image_count{capabilities.minImageCount + 1};
+    if (present_mode == VK_PRESENT_MODE_MAILBOX_KHR) {
+        // Give the driver mailbox a spare image so replaced frames never make the acquire wait
+        ++requested_image_count;
+    }
     if (capabilities.maxImageCount > 0 && requested_image_count > capabilities.maxImageCount) {
         requested_image_count = capabilities.maxImageCount;
     }
@@ -154,7 +183,7 @@ void VKSwapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities,
         .imageColorSpace = surface_format.colorSpace,
         .imageExtent = {},
         .imageArrayLayers = 1,
-        .imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+        .imageUsage = image_usage,
         .imageSharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
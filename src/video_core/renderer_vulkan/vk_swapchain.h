@@ -64,6 +64,11 @@ public:
         return current_srgb;
     }
 
+    /// Returns true when the swapchain images can be used as a transfer destination
+    bool SupportsTransferDestination() const {
+        return supports_transfer;
+    }
+
 private:
     void CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities, u32 width, u32 height,
                          bool srgb);
@@ -94,6 +99,7 @@ private:
     u32 current_width{};
     u32 current_height{};
     bool current_srgb{};
+    bool supports_transfer{};
 };
 
 } // namespace Vulkan
@@ -6,6 +6,8 @@
 
 #include <compare>
 #include <span>
+#include <utility>
+#include <vector>
 
 #include "video_core/texture_cache/texture_cache.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
@@ -19,6 +21,7 @@ using VideoCommon::Offset2D;
 using VideoCommon::RenderTargets;
 using VideoCore::Surface::PixelFormat;
 
+class ASTCDecoderPass;
 class BlitImageHelper;
 class Device;
 class Image;
@@ -63,6 +66,7 @@ struct ImageBufferMap {
     }
 
     VkBuffer handle;
+    VkDeviceSize offset;
     std::span<u8> span;
 };
 
@@ -72,6 +76,7 @@ struct TextureCacheRuntime {
     MemoryAllocator& memory_allocator;
     StagingBufferPool& staging_buffer_pool;
     BlitImageHelper& blit_image_helper;
+    ASTCDecoderPass& astc_decoder_pass;
     std::unordered_map<RenderPassKey, vk::RenderPass> renderpass_cache{};
 
     void Finish();
@@ -90,14 +95,8 @@ struct TextureCacheRuntime {
 
     void ConvertImage(Framebuffer* dst, ImageView& dst_view, ImageView& src_view);
 
-    [[nodiscard]] bool CanAccelerateImageUpload(Image&) const noexcept {
-        return false;
-    }
-
     void AccelerateImageUpload(Image&, const ImageBufferMap&, size_t,
-                               std::span<const VideoCommon::SwizzleParameters>) {
-        UNREACHABLE();
-    }
+                               std::span<const VideoCommon::SwizzleParameters> swizzles);
 
     void InsertUploadMemoryBarrier() {}
 
@@ -133,11 +132,21 @@ public:
         return aspect_mask;
     }
 
+    /// Returns true if the image was already initialized and marks it as initialized
+    [[nodiscard]] bool ExchangeInitialized() noexcept {
+        return std::exchange(initialized, true);
+    }
+
+    [[nodiscard]] VkImageView StorageImageView(s32 level) const noexcept {
+        return *storage_image_views[level];
+    }
+
 private:
     VKScheduler* scheduler;
     vk::Image image;
     vk::Buffer buffer;
     MemoryCommit commit;
+    std::vector<vk::ImageView> storage_image_views;
     VkImageAspectFlags aspect_mask = 0;
     bool initialized = false;
 };
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <span>
 #include <variant>
 #include <boost/container/static_vector.hpp>
 
@@ -40,6 +41,11 @@ public:
 
     void Send(VkDescriptorUpdateTemplateKHR update_template, VkDescriptorSet set);
 
+    /// Returns the entries recorded since the last call to Acquire.
+    std::span<const DescriptorUpdateEntry> AcquiredEntries() const {
+        return {upload_start, payload.data() + payload.size()};
+    }
+
     void AddSampledImage(VkImageView image_view, VkSampler sampler) {
         payload.emplace_back(VkDescriptorImageInfo{
             .sampler = sampler,
@@ -9,6 +9,7 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_base.h"
 #include "video_core/renderer_opengl/gl_shader_cache.h"
+#include "video_core/renderer_vulkan/vk_compute_pipeline.h"
 #include "video_core/shader/async_shaders.h"
 
 namespace VideoCommon::Shader {
@@ -138,6 +139,8 @@ void AsyncShaders::QueueOpenGLShader(const OpenGL::Device& device,
         .program{},
         .key{},
         .num_color_buffers = 0,
+        .compute_shader{},
+        .compute_key{},
     });
     cv.notify_one();
 }
@@ -170,6 +173,42 @@ void AsyncShaders::QueueVulkanShader(Vulkan::VKPipelineCache* pp_cache,
         .program = std::move(program),
         .key = key,
         .num_color_buffers = num_color_buffers,
+        .compute_shader{},
+        .compute_key{},
+    });
+    cv.notify_one();
+}
+
+void AsyncShaders::QueueVulkanComputeShader(Vulkan::VKPipelineCache* pp_cache,
+                                            const Vulkan::Device& device,
+                                            Vulkan::VKScheduler& scheduler,
+                                            Vulkan::VKDescriptorPool& descriptor_pool,
+                                            Vulkan::VKUpdateDescriptorQueue& update_descriptor_queue,
+                                            Vulkan::SPIRVShader shader,
+                                            Vulkan::ComputePipelineCacheKey key) {
+    std::unique_lock lock(queue_mutex);
+    pending_queue.push({
+        .backend = Backend::VulkanCompute,
+        .device = nullptr,
+        .shader_type{},
+        .uid = 0,
+        .code{},
+        .code_b{},
+        .main_offset = 0,
+        .compiler_settings{},
+        .registry{},
+        .cpu_address = 0,
+        .pp_cache = pp_cache,
+        .vk_device = &device,
+        .scheduler = &scheduler,
+        .descriptor_pool = &descriptor_pool,
+        .update_descriptor_queue = &update_descriptor_queue,
+        .bindings{},
+        .program{},
+        .key{},
+        .num_color_buffers = 0,
+        .compute_shader = std::move(shader),
+        .compute_key = key,
     });
     cv.notify_one();
 }
@@ -223,9 +262,16 @@ void AsyncShaders::ShaderCompilerThread(Core::Frontend::GraphicsContext* context
             auto pipeline = std::make_unique<Vulkan::VKGraphicsPipeline>(
                 *work.vk_device, *work.scheduler, *work.descriptor_pool,
                 *work.update_descriptor_queue, work.key, work.bindings, work.program,
-                work.num_color_buffers);
+                work.num_color_buffers, work.pp_cache->GetVulkanPipelineCache());
 
             work.pp_cache->EmplacePipeline(std::move(pipeline));
+        } else if (work.backend == Backend::VulkanCompute) {
+            auto pipeline = std::make_unique<Vulkan::VKComputePipeline>(
+                *work.vk_device, *work.scheduler, *work.descriptor_pool,
+                *work.update_descriptor_queue, work.compute_shader,
+                work.pp_cache->GetVulkanPipelineCache());
+
+            work.pp_cache->EmplaceComputePipeline(work.compute_key, std::move(pipeline));
         }
     }
 }
@@ -49,6 +49,7 @@ public:
         OpenGL,
         GLASM,
         Vulkan,
+        VulkanCompute,
     };
 
     struct ResultPrograms {
@@ -102,6 +103,13 @@ public:
                            Vulkan::SPIRVProgram program, Vulkan::GraphicsPipelineCacheKey key,
                            u32 num_color_buffers);
 
+    void QueueVulkanComputeShader(Vulkan::VKPipelineCache* pp_cache, const Vulkan::Device& device,
+                                  Vulkan::VKScheduler& scheduler,
+                                  Vulkan::VKDescriptorPool& descriptor_pool,
+                                  Vulkan::VKUpdateDescriptorQueue& update_descriptor_queue,
+                                  Vulkan::SPIRVShader shader,
+                                  Vulkan::ComputePipelineCacheKey key);
+
 private:
     void ShaderCompilerThread(Core::Frontend::GraphicsContext* context);
 
@@ -131,6 +139,10 @@ private:
         Vulkan::SPIRVProgram program;
         Vulkan::GraphicsPipelineCacheKey key;
         u32 num_color_buffers;
+
+        // For Vulkan compute
+        Vulkan::SPIRVShader compute_shader;
+        Vulkan::ComputePipelineCacheKey compute_key;
     };
 
     std::condition_variable cv;
@@ -4,12 +4,15 @@
 
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <stack>
 #include <unordered_map>
 #include <vector>
 
 #include "common/assert.h"
+#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "video_core/shader/ast.h"
 #include "video_core/shader/control_flow.h"
@@ -80,9 +83,46 @@ struct CFGRebuildState {
     std::map<u32, u32> ssy_labels;
     std::map<u32, u32> pbk_labels;
     std::unordered_map<u32, BlockStack> stacks;
+    /// Const buffer keys consumed while resolving indirect branches, kept for memoization
+    std::vector<std::pair<std::pair<u32, u32>, u32>> consumed_keys;
     ASTManager* manager{};
 };
 
+/// CFG discovery results shared between translations of the same program
+struct CachedScan {
+    std::vector<BlockInfo> block_info;
+    std::set<u32> labels;
+    std::vector<std::pair<std::pair<u32, u32>, u32>> consumed_keys;
+    bool decompiled{};
+};
+
+std::mutex scan_cache_mutex;
+std::unordered_map<u64, std::shared_ptr<const CachedScan>> scan_cache;
+
+u64 MakeScanKey(const ProgramCode& program_code, u32 start_address,
+                const CompilerSettings& settings) {
+    u64 hash = Common::CityHash64(reinterpret_cast<const char*>(program_code.data()),
+                                  program_code.size() * sizeof(u64));
+    hash ^= static_cast<u64>(start_address) << 32;
+    hash ^= static_cast<u64>(settings.depth);
+    hash ^= settings.disable_else_derivation ? 0x9E3779B97F4A7C15ULL : 0;
+    return hash;
+}
+
+bool IsScanUsable(const CachedScan& scan, Registry& registry) {
+    // Indirect branch targets come from const buffer contents, which can differ between
+    // translations of the same bytecode. Re-query the consumed keys through this translation's
+    // registry: a mismatch falls back to a fresh scan, and the queries also register the keys so
+    // the disk cache entry stays complete.
+    for (const auto& [key, value] : scan.consumed_keys) {
+        const auto current = registry.ObtainKey(key.first, key.second);
+        if (!current || *current != value) {
+            return false;
+        }
+    }
+    return true;
+}
+
 enum class BlockCollision : u32 { None, Found, Inside };
 
 std::pair<BlockCollision, u32> TryGetBlock(CFGRebuildState& state, u32 address) {
@@ -436,6 +476,8 @@ std::pair<ParseResult, ParseInfo> ParseCode(CFGRebuildState& state, u32 address)
                     return {ParseResult::AbnormalFlow, parse_info};
                 }
                 u32 value = *key;
+                state.consumed_keys.emplace_back(
+                    std::make_pair(result.buffer, result.offset + i * 4), value);
                 u32 target = static_cast<u32>((value >> 3) + pc_target);
                 insert_label(state, target);
                 branches.emplace_back(value, target);
@@ -658,38 +700,63 @@ std::unique_ptr<ShaderCharacteristics> ScanFlow(const ProgramCode& program_code,
     }
 
     CFGRebuildState state{program_code, start_address, registry};
-    // Inspect Code and generate blocks
-    state.labels.clear();
-    state.labels.emplace(start_address);
-    state.inspect_queries.push_back(state.start);
-    while (!state.inspect_queries.empty()) {
-        if (!TryInspectAddress(state)) {
-            result_out->settings.depth = CompileDepth::BruteForce;
-            return result_out;
+
+    const u64 scan_key = MakeScanKey(program_code, start_address, settings);
+    std::shared_ptr<const CachedScan> cached_scan;
+    {
+        const std::lock_guard lock{scan_cache_mutex};
+        const auto it = scan_cache.find(scan_key);
+        if (it != scan_cache.end()) {
+            cached_scan = it->second;
         }
     }
 
-    bool use_flow_stack = true;
-
     bool decompiled = false;
 
-    if (settings.depth != CompileDepth::FlowStack) {
-        // Decompile Stacks
-        state.queries.push_back(Query{state.start, {}, {}});
-        decompiled = true;
-        while (!state.queries.empty()) {
-            if (!TryQuery(state)) {
-                decompiled = false;
-                break;
+    if (cached_scan && IsScanUsable(*cached_scan, registry)) {
+        // Reuse the discovered CFG; only the AST has to be rebuilt for this translation
+        state.block_info = cached_scan->block_info;
+        state.labels = cached_scan->labels;
+        decompiled = cached_scan->decompiled;
+    } else {
+        // Inspect Code and generate blocks
+        state.labels.clear();
+        state.labels.emplace(start_address);
+        state.inspect_queries.push_back(state.start);
+        while (!state.inspect_queries.empty()) {
+            if (!TryInspectAddress(state)) {
+                result_out->settings.depth = CompileDepth::BruteForce;
+                return result_out;
             }
         }
-    }
 
-    use_flow_stack = !decompiled;
+        if (settings.depth != CompileDepth::FlowStack) {
+            // Decompile Stacks
+            state.queries.push_back(Query{state.start, {}, {}});
+            decompiled = true;
+            while (!state.queries.empty()) {
+                if (!TryQuery(state)) {
+                    decompiled = false;
+                    break;
+                }
+            }
+        }
+
+        // Sort and organize results
+        std::sort(state.block_info.begin(), state.block_info.end(),
+                  [](const BlockInfo& a, const BlockInfo& b) -> bool { return a.start < b.start; });
+
+        auto snapshot = std::make_shared<CachedScan>();
+        snapshot->block_info = state.block_info;
+        snapshot->labels = state.labels;
+        snapshot->consumed_keys = std::move(state.consumed_keys);
+        snapshot->decompiled = decompiled;
+
+        const std::lock_guard lock{scan_cache_mutex};
+        scan_cache.insert_or_assign(scan_key, std::move(snapshot));
+    }
 
-    // Sort and organize results
-    std::sort(state.block_info.begin(), state.block_info.end(),
-              [](const BlockInfo& a, const BlockInfo& b) -> bool { return a.start < b.start; });
+    const bool use_flow_stack = !decompiled;
     if (decompiled && settings.depth != CompileDepth::NoFlowStack) {
         ASTManager manager{settings.depth != CompileDepth::DecompileBackwards,
                            settings.disable_else_derivation};
@@ -2,9 +2,12 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <cstring>
 #include <limits>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -137,8 +140,15 @@ void ShaderIR::Decode() {
     coverage_end = shader_info.end;
     switch (shader_info.settings.depth) {
     case CompileDepth::FlowStack: {
+        // Decode each block discovered by ScanFlow into its own node list and stitch the results
+        // together afterwards, so the basic block map never holds partially decoded entries.
+        std::vector<std::pair<u32, NodeBlock>> decoded_blocks;
+        decoded_blocks.reserve(shader_info.blocks.size());
         for (const auto& block : shader_info.blocks) {
-            basic_blocks.insert({block.start, DecodeRange(block.start, block.end + 1)});
+            decoded_blocks.emplace_back(block.start, DecodeRange(block.start, block.end + 1));
+        }
+        for (auto& [start, nodes] : decoded_blocks) {
+            basic_blocks.emplace(start, std::move(nodes));
         }
         break;
     }
@@ -148,6 +158,7 @@ void ShaderIR::Decode() {
             if (label == static_cast<u32>(exit_branch)) {
                 return;
             }
+            Optimize(nodes);
             basic_blocks.insert({label, nodes});
         };
         const auto& blocks = shader_info.blocks;
@@ -202,6 +213,7 @@ void ShaderIR::Decode() {
 NodeBlock ShaderIR::DecodeRange(u32 begin, u32 end) {
     NodeBlock basic_block;
     DecodeRangeInner(basic_block, begin, end);
+    Optimize(basic_block);
     return basic_block;
 }
 
@@ -287,39 +299,48 @@ u32 ShaderIR::DecodeInstr(NodeBlock& bb, u32 pc) {
     UNIMPLEMENTED_IF_MSG(instr.pred.full_pred == Pred::NeverExecute,
                          "NeverExecute predicate not implemented");
 
-    static const std::map<OpCode::Type, u32 (ShaderIR::*)(NodeBlock&, u32)> decoders = {
-        {OpCode::Type::Arithmetic, &ShaderIR::DecodeArithmetic},
-        {OpCode::Type::ArithmeticImmediate, &ShaderIR::DecodeArithmeticImmediate},
-        {OpCode::Type::Bfe, &ShaderIR::DecodeBfe},
-        {OpCode::Type::Bfi, &ShaderIR::DecodeBfi},
-        {OpCode::Type::Shift, &ShaderIR::DecodeShift},
-        {OpCode::Type::ArithmeticInteger, &ShaderIR::DecodeArithmeticInteger},
-        {OpCode::Type::ArithmeticIntegerImmediate, &ShaderIR::DecodeArithmeticIntegerImmediate},
-        {OpCode::Type::ArithmeticHalf, &ShaderIR::DecodeArithmeticHalf},
-        {OpCode::Type::ArithmeticHalfImmediate, &ShaderIR::DecodeArithmeticHalfImmediate},
-        {OpCode::Type::Ffma, &ShaderIR::DecodeFfma},
-        {OpCode::Type::Hfma2, &ShaderIR::DecodeHfma2},
-        {OpCode::Type::Conversion, &ShaderIR::DecodeConversion},
-        {OpCode::Type::Warp, &ShaderIR::DecodeWarp},
-        {OpCode::Type::Memory, &ShaderIR::DecodeMemory},
-        {OpCode::Type::Texture, &ShaderIR::DecodeTexture},
-        {OpCode::Type::Image, &ShaderIR::DecodeImage},
-        {OpCode::Type::FloatSetPredicate, &ShaderIR::DecodeFloatSetPredicate},
-        {OpCode::Type::IntegerSetPredicate, &ShaderIR::DecodeIntegerSetPredicate},
-        {OpCode::Type::HalfSetPredicate, &ShaderIR::DecodeHalfSetPredicate},
-        {OpCode::Type::PredicateSetRegister, &ShaderIR::DecodePredicateSetRegister},
-        {OpCode::Type::PredicateSetPredicate, &ShaderIR::DecodePredicateSetPredicate},
-        {OpCode::Type::RegisterSetPredicate, &ShaderIR::DecodeRegisterSetPredicate},
-        {OpCode::Type::FloatSet, &ShaderIR::DecodeFloatSet},
-        {OpCode::Type::IntegerSet, &ShaderIR::DecodeIntegerSet},
-        {OpCode::Type::HalfSet, &ShaderIR::DecodeHalfSet},
-        {OpCode::Type::Video, &ShaderIR::DecodeVideo},
-        {OpCode::Type::Xmad, &ShaderIR::DecodeXmad},
-    };
+    // Flat table indexed by opcode type. This runs once per instruction, so avoid the tree
+    // traversal a map lookup would cost on multi-thousand instruction shaders.
+    using DecoderFn = u32 (ShaderIR::*)(NodeBlock&, u32);
+    static constexpr std::size_t num_decoders = static_cast<std::size_t>(OpCode::Type::Unknown) + 1;
+    static constexpr auto decoders = [] {
+        std::array<DecoderFn, num_decoders> table{};
+        const auto set = [&table](OpCode::Type type, DecoderFn fn) {
+            table[static_cast<std::size_t>(type)] = fn;
+        };
+        set(OpCode::Type::Arithmetic, &ShaderIR::DecodeArithmetic);
+        set(OpCode::Type::ArithmeticImmediate, &ShaderIR::DecodeArithmeticImmediate);
+        set(OpCode::Type::Bfe, &ShaderIR::DecodeBfe);
+        set(OpCode::Type::Bfi, &ShaderIR::DecodeBfi);
+        set(OpCode::Type::Shift, &ShaderIR::DecodeShift);
+        set(OpCode::Type::ArithmeticInteger, &ShaderIR::DecodeArithmeticInteger);
+        set(OpCode::Type::ArithmeticIntegerImmediate, &ShaderIR::DecodeArithmeticIntegerImmediate);
+        set(OpCode::Type::ArithmeticHalf, &ShaderIR::DecodeArithmeticHalf);
+        set(OpCode::Type::ArithmeticHalfImmediate, &ShaderIR::DecodeArithmeticHalfImmediate);
+        set(OpCode::Type::Ffma, &ShaderIR::DecodeFfma);
+        set(OpCode::Type::Hfma2, &ShaderIR::DecodeHfma2);
+        set(OpCode::Type::Conversion, &ShaderIR::DecodeConversion);
+        set(OpCode::Type::Warp, &ShaderIR::DecodeWarp);
+        set(OpCode::Type::Memory, &ShaderIR::DecodeMemory);
+        set(OpCode::Type::Texture, &ShaderIR::DecodeTexture);
+        set(OpCode::Type::Image, &ShaderIR::DecodeImage);
+        set(OpCode::Type::FloatSetPredicate, &ShaderIR::DecodeFloatSetPredicate);
+        set(OpCode::Type::IntegerSetPredicate, &ShaderIR::DecodeIntegerSetPredicate);
+        set(OpCode::Type::HalfSetPredicate, &ShaderIR::DecodeHalfSetPredicate);
+        set(OpCode::Type::PredicateSetRegister, &ShaderIR::DecodePredicateSetRegister);
+        set(OpCode::Type::PredicateSetPredicate, &ShaderIR::DecodePredicateSetPredicate);
+        set(OpCode::Type::RegisterSetPredicate, &ShaderIR::DecodeRegisterSetPredicate);
+        set(OpCode::Type::FloatSet, &ShaderIR::DecodeFloatSet);
+        set(OpCode::Type::IntegerSet, &ShaderIR::DecodeIntegerSet);
+        set(OpCode::Type::HalfSet, &ShaderIR::DecodeHalfSet);
+        set(OpCode::Type::Video, &ShaderIR::DecodeVideo);
+        set(OpCode::Type::Xmad, &ShaderIR::DecodeXmad);
+        return table;
+    }();
 
     std::vector<Node> tmp_block;
-    if (const auto decoder = decoders.find(opcode->get().GetType()); decoder != decoders.end()) {
-        pc = (this->*decoder->second)(tmp_block, pc);
+    if (const auto decoder = decoders[static_cast<std::size_t>(opcode->get().GetType())]) {
+        pc = (this->*decoder)(tmp_block, pc);
     } else {
         pc = DecodeOther(tmp_block, pc);
     }
@@ -500,16 +500,16 @@ u32 ShaderIR::DecodeImage(NodeBlock& bb, u32 pc) {
 ImageEntry& ShaderIR::GetImage(Tegra::Shader::Image image, Tegra::Shader::ImageType type) {
     const auto offset = static_cast<u32>(image.index.Value());
 
-    const auto it =
-        std::find_if(std::begin(used_images), std::end(used_images),
-                     [offset](const ImageEntry& entry) { return entry.offset == offset; });
-    if (it != std::end(used_images)) {
-        ASSERT(!it->is_bindless && it->type == type);
-        return *it;
+    if (const auto it = bound_image_index.find(offset); it != bound_image_index.end()) {
+        ImageEntry& entry = *it->second;
+        ASSERT(!entry.is_bindless && entry.type == type);
+        return entry;
     }
 
     const auto next_index = static_cast<u32>(used_images.size());
-    return used_images.emplace_back(next_index, offset, type);
+    ImageEntry& entry = used_images.emplace_back(next_index, offset, type);
+    bound_image_index.emplace(offset, &entry);
+    return entry;
 }
 
 ImageEntry& ShaderIR::GetBindlessImage(Tegra::Shader::Register reg, Tegra::Shader::ImageType type) {
@@ -520,17 +520,17 @@ ImageEntry& ShaderIR::GetBindlessImage(Tegra::Shader::Register reg, Tegra::Shade
     const auto buffer = std::get<1>(result);
     const auto offset = std::get<2>(result);
 
-    const auto it = std::find_if(std::begin(used_images), std::end(used_images),
-                                 [buffer, offset](const ImageEntry& entry) {
-                                     return entry.buffer == buffer && entry.offset == offset;
-                                 });
-    if (it != std::end(used_images)) {
-        ASSERT(it->is_bindless && it->type == type);
-        return *it;
+    if (const auto it = bindless_image_index.find({buffer, offset});
+        it != bindless_image_index.end()) {
+        ImageEntry& entry = *it->second;
+        ASSERT(entry.is_bindless && entry.type == type);
+        return entry;
     }
 
     const auto next_index = static_cast<u32>(used_images.size());
-    return used_images.emplace_back(next_index, offset, buffer, type);
+    ImageEntry& entry = used_images.emplace_back(next_index, offset, buffer, type);
+    bindless_image_index.emplace(std::pair{buffer, offset}, &entry);
+    return entry;
 }
 
 } // namespace VideoCommon::Shader
@@ -164,7 +164,7 @@ u32 ShaderIR::DecodeOther(NodeBlock& bb, u32 pc) {
             const s32 target = pc + 1;
             const Node index = GetRegister(instr.gpr8);
             const Node op_a =
-                GetConstBufferIndirect(instr.cbuf36.index, instr.cbuf36.GetOffset() + 0, index);
+                GetConstBufferIndirect(bb, instr.cbuf36.index, instr.cbuf36.GetOffset() + 0, index);
             const Node convert = SignedOperation(OperationCode::IArithmeticShiftRight, true,
                                                  PRECISE, op_a, Immediate(3));
             operand = Operation(OperationCode::IAdd, PRECISE, convert, Immediate(target));
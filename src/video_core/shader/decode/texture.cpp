@@ -382,22 +382,20 @@ ShaderIR::SamplerInfo ShaderIR::GetSamplerInfo(
 std::optional<SamplerEntry> ShaderIR::GetSampler(Tegra::Shader::Sampler sampler,
                                                  SamplerInfo sampler_info) {
     const u32 offset = static_cast<u32>(sampler.index.Value());
-    const auto info = GetSamplerInfo(sampler_info, registry.ObtainBoundSampler(offset));
 
-    // If this sampler has already been used, return the existing mapping.
-    const auto it =
-        std::find_if(used_samplers.begin(), used_samplers.end(),
-                     [offset](const SamplerEntry& entry) { return entry.offset == offset; });
-    if (it != used_samplers.end()) {
-        ASSERT(!it->is_bindless && it->type == info.type && it->is_array == info.is_array &&
-               it->is_shadow == info.is_shadow && it->is_buffer == info.is_buffer);
-        return *it;
+    // If this sampler has already been used, return the existing mapping without repeating the
+    // registry query.
+    if (const auto it = bound_sampler_index.find(offset); it != bound_sampler_index.end()) {
+        return *it->second;
     }
 
     // Otherwise create a new mapping for this sampler
+    const auto info = GetSamplerInfo(sampler_info, registry.ObtainBoundSampler(offset));
     const auto next_index = static_cast<u32>(used_samplers.size());
-    return used_samplers.emplace_back(next_index, offset, *info.type, *info.is_array,
-                                      *info.is_shadow, *info.is_buffer, false);
+    SamplerEntry& entry = used_samplers.emplace_back(
+        next_index, offset, *info.type, *info.is_array, *info.is_shadow, *info.is_buffer, false);
+    bound_sampler_index.emplace(offset, &entry);
+    return entry;
 }
 
 std::optional<SamplerEntry> ShaderIR::GetBindlessSampler(Tegra::Shader::Register reg,
@@ -413,68 +411,66 @@ std::optional<SamplerEntry> ShaderIR::GetBindlessSampler(Tegra::Shader::Register
     if (const auto sampler_info = std::get_if<BindlessSamplerNode>(&*tracked_sampler_info)) {
         const u32 buffer = sampler_info->index;
         const u32 offset = sampler_info->offset;
-        info = GetSamplerInfo(info, registry.ObtainBindlessSampler(buffer, offset));
 
-        // If this sampler has already been used, return the existing mapping.
-        const auto it = std::find_if(used_samplers.begin(), used_samplers.end(),
-                                     [buffer, offset](const SamplerEntry& entry) {
-                                         return entry.buffer == buffer && entry.offset == offset;
-                                     });
-        if (it != used_samplers.end()) {
-            ASSERT(it->is_bindless && it->type == info.type && it->is_array == info.is_array &&
-                   it->is_shadow == info.is_shadow);
-            return *it;
+        // If this sampler has already been used, return the existing mapping without repeating
+        // the registry query.
+        if (const auto it = bindless_sampler_index.find({buffer, offset});
+            it != bindless_sampler_index.end()) {
+            return *it->second;
         }
 
         // Otherwise create a new mapping for this sampler
+        info = GetSamplerInfo(info, registry.ObtainBindlessSampler(buffer, offset));
         const auto next_index = static_cast<u32>(used_samplers.size());
-        return used_samplers.emplace_back(next_index, offset, buffer, *info.type, *info.is_array,
-                                          *info.is_shadow, *info.is_buffer, false);
+        SamplerEntry& entry =
+            used_samplers.emplace_back(next_index, offset, buffer, *info.type, *info.is_array,
+                                       *info.is_shadow, *info.is_buffer, false);
+        bindless_sampler_index.emplace(std::pair{buffer, offset}, &entry);
+        return entry;
     }
     if (const auto sampler_info = std::get_if<SeparateSamplerNode>(&*tracked_sampler_info)) {
         const std::pair indices = sampler_info->indices;
         const std::pair offsets = sampler_info->offsets;
-        info = GetSamplerInfo(info, registry.ObtainSeparateSampler(indices, offsets));
-
-        // Try to use an already created sampler if it exists
-        const auto it =
-            std::find_if(used_samplers.begin(), used_samplers.end(),
-                         [indices, offsets](const SamplerEntry& entry) {
-                             return offsets == std::pair{entry.offset, entry.secondary_offset} &&
-                                    indices == std::pair{entry.buffer, entry.secondary_buffer};
-                         });
-        if (it != used_samplers.end()) {
-            ASSERT(it->is_separated && it->type == info.type && it->is_array == info.is_array &&
-                   it->is_shadow == info.is_shadow && it->is_buffer == info.is_buffer);
-            return *it;
+        const std::pair<u64, u64> key{(u64{indices.first} << 32) | indices.second,
+                                      (u64{offsets.first} << 32) | offsets.second};
+
+        // Try to use an already created sampler if it exists, without repeating the registry
+        // query.
+        if (const auto it = separate_sampler_index.find(key);
+            it != separate_sampler_index.end()) {
+            return *it->second;
         }
 
         // Otherwise create a new mapping for this sampler
+        info = GetSamplerInfo(info, registry.ObtainSeparateSampler(indices, offsets));
         const u32 next_index = static_cast<u32>(used_samplers.size());
-        return used_samplers.emplace_back(next_index, offsets, indices, *info.type, *info.is_array,
-                                          *info.is_shadow, *info.is_buffer);
+        SamplerEntry& entry = used_samplers.emplace_back(
+            next_index, offsets, indices, *info.type, *info.is_array, *info.is_shadow,
+            *info.is_buffer);
+        separate_sampler_index.emplace(key, &entry);
+        return entry;
     }
     if (const auto sampler_info = std::get_if<ArraySamplerNode>(&*tracked_sampler_info)) {
         const u32 base_offset = sampler_info->base_offset / 4;
         index_var = GetCustomVariable(sampler_info->bindless_var);
-        info = GetSamplerInfo(info, registry.ObtainBoundSampler(base_offset));
 
-        // If this sampler has already been used, return the existing mapping.
-        const auto it = std::find_if(
-            used_samplers.begin(), used_samplers.end(),
-            [base_offset](const SamplerEntry& entry) { return entry.offset == base_offset; });
-        if (it != used_samplers.end()) {
-            ASSERT(!it->is_bindless && it->type == info.type && it->is_array == info.is_array &&
-                   it->is_shadow == info.is_shadow && it->is_buffer == info.is_buffer &&
-                   it->is_indexed);
-            return *it;
+        // If this sampler has already been used, return the existing mapping without repeating
+        // the registry query.
+        if (const auto it = bound_sampler_index.find(base_offset);
+            it != bound_sampler_index.end()) {
+            ASSERT(it->second->is_indexed);
+            return *it->second;
         }
 
+        info = GetSamplerInfo(info, registry.ObtainBoundSampler(base_offset));
         uses_indexed_samplers = true;
         // Otherwise create a new mapping for this sampler
         const auto next_index = static_cast<u32>(used_samplers.size());
-        return used_samplers.emplace_back(next_index, base_offset, *info.type, *info.is_array,
-                                          *info.is_shadow, *info.is_buffer, true);
+        SamplerEntry& entry =
+            used_samplers.emplace_back(next_index, base_offset, *info.type, *info.is_array,
+                                       *info.is_shadow, *info.is_buffer, true);
+        bound_sampler_index.emplace(base_offset, &entry);
+        return entry;
     }
     return std::nullopt;
 }
@@ -0,0 +1,235 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstdlib>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/shader/node.h"
+#include "video_core/shader/node_helper.h"
+#include "video_core/shader/shader_ir.h"
+
+namespace VideoCommon::Shader {
+
+namespace {
+
+std::optional<u32> GetImmediate(const Node& node) {
+    if (const auto imm = std::get_if<ImmediateNode>(node.get())) {
+        return imm->GetValue();
+    }
+    return std::nullopt;
+}
+
+/// Evaluates an integer operation with a single immediate operand.
+std::optional<u32> FoldUnary(OperationCode code, u32 a) {
+    switch (code) {
+    case OperationCode::INegate:
+        return static_cast<u32>(-static_cast<s32>(a));
+    case OperationCode::IAbsolute:
+        return static_cast<u32>(std::abs(static_cast<s32>(a)));
+    case OperationCode::IBitwiseNot:
+    case OperationCode::UBitwiseNot:
+        return ~a;
+    case OperationCode::ICastUnsigned:
+    case OperationCode::UCastSigned:
+        return a;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Evaluates an integer operation with two immediate operands.
+std::optional<u32> FoldBinary(OperationCode code, u32 a, u32 b) {
+    switch (code) {
+    case OperationCode::IAdd:
+    case OperationCode::UAdd:
+        return a + b;
+    case OperationCode::IMul:
+    case OperationCode::UMul:
+        return a * b;
+    case OperationCode::IDiv:
+        if (b == 0 || (a == 0x80000000 && b == 0xFFFFFFFF)) {
+            return std::nullopt;
+        }
+        return static_cast<u32>(static_cast<s32>(a) / static_cast<s32>(b));
+    case OperationCode::UDiv:
+        if (b == 0) {
+            return std::nullopt;
+        }
+        return a / b;
+    case OperationCode::IMin:
+        return static_cast<u32>(std::min(static_cast<s32>(a), static_cast<s32>(b)));
+    case OperationCode::IMax:
+        return static_cast<u32>(std::max(static_cast<s32>(a), static_cast<s32>(b)));
+    case OperationCode::UMin:
+        return std::min(a, b);
+    case OperationCode::UMax:
+        return std::max(a, b);
+    case OperationCode::ILogicalShiftLeft:
+    case OperationCode::ULogicalShiftLeft:
+        return b < 32 ? a << b : std::optional<u32>{};
+    case OperationCode::ILogicalShiftRight:
+    case OperationCode::ULogicalShiftRight:
+        return b < 32 ? a >> b : std::optional<u32>{};
+    case OperationCode::IArithmeticShiftRight:
+    case OperationCode::UArithmeticShiftRight:
+        return b < 32 ? static_cast<u32>(static_cast<s32>(a) >> b) : std::optional<u32>{};
+    case OperationCode::IBitwiseAnd:
+    case OperationCode::UBitwiseAnd:
+        return a & b;
+    case OperationCode::IBitwiseOr:
+    case OperationCode::UBitwiseOr:
+        return a | b;
+    case OperationCode::IBitwiseXor:
+    case OperationCode::UBitwiseXor:
+        return a ^ b;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Simplifies operations where one immediate operand makes the result trivial. Operands are pure
+/// expressions, so dropping one cannot lose side effects.
+Node SimplifyIdentity(OperationCode code, const std::vector<Node>& operands) {
+    const std::optional<u32> lhs = GetImmediate(operands[0]);
+    const std::optional<u32> rhs = GetImmediate(operands[1]);
+    switch (code) {
+    case OperationCode::IAdd:
+    case OperationCode::UAdd:
+    case OperationCode::IBitwiseOr:
+    case OperationCode::UBitwiseOr:
+    case OperationCode::IBitwiseXor:
+    case OperationCode::UBitwiseXor:
+        if (lhs == 0) {
+            return operands[1];
+        }
+        if (rhs == 0) {
+            return operands[0];
+        }
+        return {};
+    case OperationCode::IMul:
+    case OperationCode::UMul:
+        if (lhs == 0 || rhs == 0) {
+            return Immediate(u32{0});
+        }
+        if (lhs == 1) {
+            return operands[1];
+        }
+        if (rhs == 1) {
+            return operands[0];
+        }
+        return {};
+    case OperationCode::IBitwiseAnd:
+    case OperationCode::UBitwiseAnd:
+        if (lhs == 0 || rhs == 0) {
+            return Immediate(u32{0});
+        }
+        if (lhs == 0xFFFFFFFF) {
+            return operands[1];
+        }
+        if (rhs == 0xFFFFFFFF) {
+            return operands[0];
+        }
+        return {};
+    case OperationCode::ILogicalShiftLeft:
+    case OperationCode::ULogicalShiftLeft:
+    case OperationCode::ILogicalShiftRight:
+    case OperationCode::ULogicalShiftRight:
+    case OperationCode::IArithmeticShiftRight:
+    case OperationCode::UArithmeticShiftRight:
+        if (rhs == 0) {
+            return operands[0];
+        }
+        return {};
+    default:
+        return {};
+    }
+}
+
+Node OptimizeNode(const Node& node);
+
+Node OptimizeOperation(const Node& node, const OperationNode& operation) {
+    const std::size_t operand_count = operation.GetOperandsCount();
+    std::vector<Node> operands;
+    operands.reserve(operand_count);
+    bool changed = false;
+    for (std::size_t index = 0; index < operand_count; ++index) {
+        Node operand = OptimizeNode(operation[index]);
+        changed |= operand != operation[index];
+        operands.push_back(std::move(operand));
+    }
+
+    const OperationCode code = operation.GetCode();
+    // Amend code is attached to the node it was declared on; never optimize those nodes away
+    if (!operation.GetAmendIndex()) {
+        if (operand_count == 1) {
+            if (const auto imm = GetImmediate(operands[0])) {
+                if (const auto folded = FoldUnary(code, *imm)) {
+                    return Immediate(*folded);
+                }
+            }
+        }
+        if (operand_count == 2) {
+            const auto lhs = GetImmediate(operands[0]);
+            const auto rhs = GetImmediate(operands[1]);
+            if (lhs && rhs) {
+                if (const auto folded = FoldBinary(code, *lhs, *rhs)) {
+                    return Immediate(*folded);
+                }
+            }
+            if (Node simplified = SimplifyIdentity(code, operands)) {
+                return simplified;
+            }
+        }
+    }
+
+    if (!changed) {
+        return node;
+    }
+    Node result = MakeNode<OperationNode>(code, Meta{operation.GetMeta()}, std::move(operands));
+    if (const auto amend_index = operation.GetAmendIndex()) {
+        std::get_if<OperationNode>(result.get())->SetAmendIndex(*amend_index);
+    }
+    return result;
+}
+
+Node OptimizeNode(const Node& node) {
+    if (const auto operation = std::get_if<OperationNode>(node.get())) {
+        return OptimizeOperation(node, *operation);
+    }
+    if (const auto conditional = std::get_if<ConditionalNode>(node.get())) {
+        Node condition = OptimizeNode(conditional->GetCondition());
+        std::vector<Node> code;
+        code.reserve(conditional->GetCode().size());
+        bool changed = condition != conditional->GetCondition();
+        for (const Node& statement : conditional->GetCode()) {
+            Node optimized = OptimizeNode(statement);
+            changed |= optimized != statement;
+            code.push_back(std::move(optimized));
+        }
+        if (!changed) {
+            return node;
+        }
+        Node result = MakeNode<ConditionalNode>(std::move(condition), std::move(code));
+        if (const auto amend_index = conditional->GetAmendIndex()) {
+            std::get_if<ConditionalNode>(result.get())->SetAmendIndex(*amend_index);
+        }
+        return result;
+    }
+    return node;
+}
+
+} // Anonymous namespace
+
+void ShaderIR::Optimize(NodeBlock& block) {
+    for (Node& node : block) {
+        node = OptimizeNode(node);
+    }
+}
+
+} // namespace VideoCommon::Shader
@@ -63,22 +63,48 @@ Node ShaderIR::GetConstBuffer(u64 index_, u64 offset_) {
     return MakeNode<CbufNode>(index, Immediate(offset));
 }
 
-Node ShaderIR::GetConstBufferIndirect(u64 index_, u64 offset_, Node node) {
+Node ShaderIR::GetConstBufferIndirect(const NodeBlock& code, u64 index_, u64 offset_, Node node) {
     const auto index = static_cast<u32>(index_);
     const auto offset = static_cast<u32>(offset_);
 
-    used_cbufs.try_emplace(index).first->second.MarkAsUsedIndirect();
+    // Attempt to inline constant buffer without a variable offset. This is done to allow
+    // tracking LDC calls.
+    if (const auto gpr = std::get_if<GprNode>(&*node)) {
+        if (gpr->GetIndex() == Register::ZeroIndex) {
+            used_cbufs.try_emplace(index).first->second.MarkAsUsed(offset);
+            return MakeNode<CbufNode>(index, Immediate(offset));
+        }
+    }
 
-    Node final_offset = [&] {
-        // Attempt to inline constant buffer without a variable offset. This is done to allow
-        // tracking LDC calls.
-        if (const auto gpr = std::get_if<GprNode>(&*node)) {
-            if (gpr->GetIndex() == Register::ZeroIndex) {
-                return Immediate(offset);
+    // When the dynamic offset is provably bounded to a few aligned values, flatten the load into
+    // a chain of selects over direct accesses. Drivers can constant-propagate these, and the
+    // buffer is not promoted to its maximum size. Reads from the bound buffer are left alone so
+    // that bindless sampler tracking still sees the indirect pattern.
+    if (index != registry.GetBoundBuffer()) {
+        const auto values = TrackIndirectCbufValues(node, code, static_cast<s64>(code.size()));
+        const auto is_aligned = [](u32 value) { return value % sizeof(u32) == 0; };
+        if (values && values->size() > 1 &&
+            std::all_of(values->begin(), values->end(), is_aligned)) {
+            auto& entry = used_cbufs.try_emplace(index).first->second;
+            for (const u32 value : *values) {
+                entry.MarkAsUsed(offset + value);
+            }
+            Node result = MakeNode<CbufNode>(index, Immediate(offset + values->back()));
+            for (std::size_t i = values->size() - 1; i-- > 0;) {
+                Node compare =
+                    Operation(OperationCode::LogicalUEqual, node, Immediate((*values)[i]));
+                Node direct = MakeNode<CbufNode>(index, Immediate(offset + (*values)[i]));
+                result = Operation(OperationCode::Select, NO_PRECISE, std::move(compare),
+                                   std::move(direct), std::move(result));
             }
+            return result;
         }
-        return Operation(OperationCode::UAdd, NO_PRECISE, std::move(node), Immediate(offset));
-    }();
+    }
+
+    used_cbufs.try_emplace(index).first->second.MarkAsUsedIndirect();
+
+    Node final_offset =
+        Operation(OperationCode::UAdd, NO_PRECISE, std::move(node), Immediate(offset));
     return MakeNode<CbufNode>(index, std::move(final_offset));
 }
 
@@ -10,9 +10,12 @@
 #include <optional>
 #include <set>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/hash.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/engines/shader_bytecode.h"
 #include "video_core/engines/shader_header.h"
@@ -207,6 +210,9 @@ private:
     void DecodeRangeInner(NodeBlock& bb, u32 begin, u32 end);
     void InsertControlFlow(NodeBlock& bb, const ShaderBlock& block);
 
+    /// Applies constant folding and algebraic simplifications to a decoded block
+    void Optimize(NodeBlock& block);
+
     /**
      * Decodes a single instruction from Tegra to IR.
      * @param bb Basic block where the nodes will be written to.
@@ -255,7 +261,7 @@ private:
     /// Generates a node representing a constant buffer
     Node GetConstBuffer(u64 index, u64 offset);
     /// Generates a node representing a constant buffer with a variadic offset
-    Node GetConstBufferIndirect(u64 index, u64 offset, Node node);
+    Node GetConstBufferIndirect(const NodeBlock& code, u64 index, u64 offset, Node node);
     /// Generates a node for a passed predicate. It can be optionally negated
     Node GetPredicate(u64 pred, bool negated = false);
     /// Generates a predicate node for an immediate true or false value
@@ -420,6 +426,11 @@ private:
 
     std::optional<u32> TrackImmediate(Node tracked, const NodeBlock& code, s64 cursor) const;
 
+    /// Enumerates every value a dynamic const buffer offset can take, when the expression that
+    /// computes it is provably bounded to a small set (e.g. masked with a narrow bitmask).
+    std::optional<std::vector<u32>> TrackIndirectCbufValues(Node tracked, const NodeBlock& code,
+                                                            s64 cursor) const;
+
     std::pair<Node, s64> TrackRegister(const GprNode* tracked, const NodeBlock& code,
                                        s64 cursor) const;
 
@@ -456,6 +467,15 @@ private:
     std::map<u32, ConstBuffer> used_cbufs;
     std::list<SamplerEntry> used_samplers;
     std::list<ImageEntry> used_images;
+    // Hash indices over used_samplers and used_images, memoizing the per-instruction
+    // deduplication scans and their registry queries. Bound and array-indexed entries key by
+    // offset, bindless entries by (buffer, offset) and separated samplers by both packed pairs.
+    // The pointers stay valid because entries live in the std::lists above.
+    std::unordered_map<u32, SamplerEntry*> bound_sampler_index;
+    std::unordered_map<std::pair<u32, u32>, SamplerEntry*, Common::PairHash> bindless_sampler_index;
+    std::unordered_map<std::pair<u64, u64>, SamplerEntry*, Common::PairHash> separate_sampler_index;
+    std::unordered_map<u32, ImageEntry*> bound_image_index;
+    std::unordered_map<std::pair<u32, u32>, ImageEntry*, Common::PairHash> bindless_image_index;
     std::array<bool, Tegra::Engines::Maxwell3D::Regs::NumClipDistances> used_clip_distances{};
     std::map<GlobalMemoryBase, GlobalMemoryUsage> used_global_memory;
     bool uses_layer{};
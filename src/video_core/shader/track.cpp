@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <bit>
 #include <utility>
 #include <variant>
 
@@ -213,6 +214,94 @@ std::optional<u32> ShaderIR::TrackImmediate(Node tracked, const NodeBlock& code,
     return std::nullopt;
 }
 
+std::optional<std::vector<u32>> ShaderIR::TrackIndirectCbufValues(Node tracked,
+                                                                  const NodeBlock& code,
+                                                                  s64 cursor) const {
+    // Keep the candidate sets small enough that flattening them into selects stays profitable
+    static constexpr std::size_t max_candidates = 4;
+
+    if (const auto immediate = std::get_if<ImmediateNode>(&*tracked)) {
+        return std::vector<u32>{immediate->GetValue()};
+    }
+    if (const auto gpr = std::get_if<GprNode>(&*tracked)) {
+        if (gpr->GetIndex() == Tegra::Shader::Register::ZeroIndex) {
+            return std::vector<u32>{0};
+        }
+        // Reduce the cursor in one to avoid infinite loops when the instruction sets the same
+        // register that it uses as operand
+        const auto [source, new_cursor] = TrackRegister(gpr, code, cursor - 1);
+        if (!source) {
+            return std::nullopt;
+        }
+        return TrackIndirectCbufValues(source, code, new_cursor);
+    }
+    const auto operation = std::get_if<OperationNode>(&*tracked);
+    if (!operation || operation->GetOperandsCount() != 2) {
+        return std::nullopt;
+    }
+    const auto get_immediate = [](const Node& node) -> std::optional<u32> {
+        if (const auto immediate = std::get_if<ImmediateNode>(&*node)) {
+            return immediate->GetValue();
+        }
+        return std::nullopt;
+    };
+    switch (operation->GetCode()) {
+    case OperationCode::IBitwiseAnd:
+    case OperationCode::UBitwiseAnd: {
+        // A narrow mask bounds the offset regardless of what the other operand holds
+        for (std::size_t i = 0; i < 2; ++i) {
+            const std::optional<u32> mask = get_immediate((*operation)[i]);
+            if (!mask || std::popcount(*mask) > 2) {
+                continue;
+            }
+            std::vector<u32> values;
+            for (u32 subset = *mask;; subset = (subset - 1) & *mask) {
+                values.push_back(subset);
+                if (subset == 0) {
+                    break;
+                }
+            }
+            std::sort(values.begin(), values.end());
+            return values;
+        }
+        return std::nullopt;
+    }
+    case OperationCode::IAdd:
+    case OperationCode::UAdd:
+    case OperationCode::ILogicalShiftLeft:
+    case OperationCode::ULogicalShiftLeft:
+    case OperationCode::IMul:
+    case OperationCode::UMul: {
+        const std::optional<u32> immediate = get_immediate((*operation)[1]);
+        if (!immediate) {
+            return std::nullopt;
+        }
+        auto values = TrackIndirectCbufValues((*operation)[0], code, cursor);
+        if (!values || values->size() > max_candidates) {
+            return std::nullopt;
+        }
+        for (u32& value : *values) {
+            switch (operation->GetCode()) {
+            case OperationCode::IAdd:
+            case OperationCode::UAdd:
+                value += *immediate;
+                break;
+            case OperationCode::ILogicalShiftLeft:
+            case OperationCode::ULogicalShiftLeft:
+                value <<= *immediate;
+                break;
+            default:
+                value *= *immediate;
+                break;
+            }
+        }
+        return values;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
 std::pair<Node, s64> ShaderIR::TrackRegister(const GprNode* tracked, const NodeBlock& code,
                                              s64 cursor) const {
     for (; cursor >= 0; --cursor) {
@@ -4,9 +4,11 @@
 
 #include <algorithm>
 #include <array>
+#include <mutex>
 #include <unordered_map>
 
 #include "common/assert.h"
+#include "common/cityhash.h"
 #include "common/common_types.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/shader/registry.h"
@@ -68,9 +70,34 @@ constexpr std::array VECTORS = {
     216, // gl_TexCoord[6]
     220, // gl_TexCoord[7]
 };
-} // namespace
 
-std::unordered_map<u8, VaryingTFB> BuildTransformFeedback(const GraphicsInfo& info) {
+/// Transform feedback state relevant to the varying layout, with the register padding stripped so
+/// that it can be hashed and compared bytewise.
+struct TransformFeedbackKey {
+    std::array<std::array<u32, 3>, Maxwell::NumTransformFeedbackBuffers> layouts;
+    std::array<std::array<u8, 128>, Maxwell::NumTransformFeedbackBuffers> varying_locs;
+
+    bool operator==(const TransformFeedbackKey&) const = default;
+};
+
+struct TransformFeedbackKeyHash {
+    std::size_t operator()(const TransformFeedbackKey& key) const noexcept {
+        return static_cast<std::size_t>(
+            Common::CityHash64(reinterpret_cast<const char*>(&key), sizeof(key)));
+    }
+};
+
+TransformFeedbackKey MakeTransformFeedbackKey(const GraphicsInfo& info) {
+    TransformFeedbackKey key;
+    for (std::size_t buffer = 0; buffer < Maxwell::NumTransformFeedbackBuffers; ++buffer) {
+        const auto& layout = info.tfb_layouts[buffer];
+        key.layouts[buffer] = {layout.stream, layout.varying_count, layout.stride};
+    }
+    key.varying_locs = info.tfb_varying_locs;
+    return key;
+}
+
+std::unordered_map<u8, VaryingTFB> MakeTransformFeedback(const GraphicsInfo& info) {
 
     std::unordered_map<u8, VaryingTFB> tfb;
 
@@ -112,4 +139,24 @@ std::unordered_map<u8, VaryingTFB> BuildTransformFeedback(const GraphicsInfo& in
     return tfb;
 }
 
+} // namespace
+
+std::unordered_map<u8, VaryingTFB> BuildTransformFeedback(const GraphicsInfo& info) {
+    // Titles reuse a handful of layouts across their whole shader set, so share built varying
+    // maps between shader translations. Shaders are decompiled from worker threads.
+    static std::mutex cache_mutex;
+    static std::unordered_map<TransformFeedbackKey, std::unordered_map<u8, VaryingTFB>,
+                              TransformFeedbackKeyHash>
+        cache;
+
+    const TransformFeedbackKey key = MakeTransformFeedbackKey(info);
+
+    const std::lock_guard lock{cache_mutex};
+    const auto [it, is_new] = cache.try_emplace(key);
+    if (is_new) {
+        it->second = MakeTransformFeedback(info);
+    }
+    return it->second;
+}
+
 } // namespace VideoCommon::Shader
@@ -22,11 +22,17 @@ class ShaderCache {
     static constexpr u64 PAGE_BITS = 14;
     static constexpr u64 PAGE_SIZE = u64(1) << PAGE_BITS;
 
+    /// Shaders not looked up for this many frames are evicted on the next eviction pass
+    static constexpr u64 NUM_EVICTION_FRAMES = 4096;
+    /// Number of frames between eviction passes over the lookup cache
+    static constexpr u64 EVICTION_PASS_INTERVAL = 256;
+
     struct Entry {
         VAddr addr_start;
         VAddr addr_end;
         T* data;
 
+        u64 last_used_tick = 0;
         bool is_memory_marked = true;
 
         constexpr bool Overlaps(VAddr start, VAddr end) const noexcept {
@@ -72,9 +78,36 @@ public:
         if (it == lookup_cache.end()) {
             return nullptr;
         }
+        it->second->last_used_tick = frame_tick;
         return it->second->data;
     }
 
+    /// @brief Advances the frame tick and periodically evicts shaders unused for many frames
+    /// @note Evicted shaders are rebuilt from guest memory if they are ever executed again
+    void TickFrame() {
+        std::scoped_lock lock{invalidation_mutex, lookup_mutex};
+        ++frame_tick;
+        if (frame_tick % EVICTION_PASS_INTERVAL != 0) {
+            return;
+        }
+        for (auto& [addr, entry] : lookup_cache) {
+            if (frame_tick - entry->last_used_tick < NUM_EVICTION_FRAMES) {
+                continue;
+            }
+            UnmarkMemory(entry.get());
+            RemoveEntryFromInvalidationCache(entry.get());
+            marked_for_removal.push_back(entry.get());
+        }
+        if (marked_for_removal.empty()) {
+            return;
+        }
+        // Remove duplicates in case an entry was already pending removal from a CPU write
+        std::sort(marked_for_removal.begin(), marked_for_removal.end());
+        marked_for_removal.erase(std::unique(marked_for_removal.begin(), marked_for_removal.end()),
+                                 marked_for_removal.end());
+        RemoveMarkedShaders();
+    }
+
 protected:
     explicit ShaderCache(VideoCore::RasterizerInterface& rasterizer_) : rasterizer{rasterizer_} {}
 
@@ -130,11 +163,17 @@ private:
         marked_for_removal.erase(std::unique(marked_for_removal.begin(), marked_for_removal.end()),
                                  marked_for_removal.end());
 
+        std::scoped_lock lock{lookup_mutex};
+        RemoveMarkedShaders();
+    }
+
+    /// @brief Removes the unique entries in marked_for_removal from the cache
+    /// @pre invalidation_mutex is locked
+    /// @pre lookup_mutex is locked
+    void RemoveMarkedShaders() {
         std::vector<T*> removed_shaders;
         removed_shaders.reserve(marked_for_removal.size());
 
-        std::scoped_lock lock{lookup_mutex};
-
         for (Entry* const entry : marked_for_removal) {
             removed_shaders.push_back(entry->data);
 
@@ -219,7 +258,7 @@ private:
     /// @brief Creates a new entry in the lookup cache and returns its pointer
     /// @pre lookup_mutex is locked
     Entry* NewEntry(VAddr addr, VAddr addr_end, T* data) {
-        auto entry = std::make_unique<Entry>(Entry{addr, addr_end, data});
+        auto entry = std::make_unique<Entry>(Entry{addr, addr_end, data, frame_tick});
         Entry* const entry_pointer = entry.get();
 
         lookup_cache.emplace(addr, std::move(entry));
@@ -235,6 +274,7 @@ private:
     std::unordered_map<u64, std::vector<Entry*>> invalidation_cache;
     std::vector<std::unique_ptr<T>> storage;
     std::vector<Entry*> marked_for_removal;
+    u64 frame_tick = 0;
 };
 
 } // namespace VideoCommon
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include "common/assert.h"
+#include "video_core/command_classes/vic.h"
 #include "video_core/surface.h"
 #include "video_core/texture_cache/format_lookup_table.h"
 #include "video_core/texture_cache/image_info.h"
@@ -186,4 +187,26 @@ ImageInfo::ImageInfo(const Tegra::Engines::Fermi2D::Surface& config) noexcept {
     }
 }
 
+ImageInfo::ImageInfo(const Tegra::VicConfig& config, s32 frame_width, s32 frame_height) noexcept {
+    const auto pixel_format = static_cast<Tegra::VideoPixelFormat>(config.pixel_format.Value());
+    format = pixel_format == Tegra::VideoPixelFormat::BGRA8 ? PixelFormat::B8G8R8A8_UNORM
+                                                            : PixelFormat::A8B8G8R8_UNORM;
+    size = Extent3D{
+        .width = static_cast<u32>(frame_width),
+        .height = static_cast<u32>(frame_height),
+        .depth = 1,
+    };
+    if (config.block_linear_kind != 0) {
+        type = ImageType::e2D;
+        block = Extent3D{
+            .width = 0,
+            .height = static_cast<u32>(config.block_linear_height_log2),
+            .depth = 0,
+        };
+    } else {
+        type = ImageType::Linear;
+        pitch = size.width * BytesPerBlock(format);
+    }
+}
+
 } // namespace VideoCommon
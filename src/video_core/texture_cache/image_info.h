@@ -9,6 +9,10 @@
 #include "video_core/surface.h"
 #include "video_core/texture_cache/types.h"
 
+namespace Tegra {
+union VicConfig;
+}
+
 namespace VideoCommon {
 
 using Tegra::Texture::TICEntry;
@@ -20,6 +24,7 @@ struct ImageInfo {
     explicit ImageInfo(const Tegra::Engines::Maxwell3D::Regs& regs, size_t index) noexcept;
     explicit ImageInfo(const Tegra::Engines::Maxwell3D::Regs& regs) noexcept;
     explicit ImageInfo(const Tegra::Engines::Fermi2D::Surface& config) noexcept;
+    explicit ImageInfo(const Tegra::VicConfig& config, s32 frame_width, s32 frame_height) noexcept;
 
     PixelFormat format = PixelFormat::Invalid;
     ImageType type = ImageType::e1D;
@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <cstring>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -22,6 +24,7 @@
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/logging/log.h"
+#include "common/perf_counters.h"
 #include "video_core/compatible_formats.h"
 #include "video_core/delayed_destruction_ring.h"
 #include "video_core/dirty_flags.h"
@@ -153,6 +156,11 @@ public:
                    const Tegra::Engines::Fermi2D::Surface& src,
                    const Tegra::Engines::Fermi2D::Config& copy);
 
+    /// Upload a decoded video frame into the image backing the given address, returns false when
+    /// the frame could not be placed in the cache and must be written back to guest memory
+    [[nodiscard]] bool UploadVideoFrame(const ImageInfo& info, GPUVAddr gpu_addr,
+                                        std::span<const u8> frame_data);
+
     /// Invalidate the contents of the color buffer index
     /// These contents become unspecified, the cache can assume aggressive optimizations.
     void InvalidateColorBuffer(size_t index);
@@ -258,6 +266,10 @@ private:
     template <typename Func>
     void ForEachImageInRegion(VAddr cpu_addr, size_t size, Func&& func);
 
+    /// Iterates over the images overlapping a region using the ordered interval index
+    template <typename Func>
+    void ForEachOverlapCandidate(VAddr cpu_addr, size_t size, Func&& func);
+
     /// Find or create an image view in the given image with the passed parameters
     [[nodiscard]] ImageViewId FindOrEmplaceImageView(ImageId image_id, const ImageViewInfo& info);
 
@@ -282,6 +294,9 @@ private:
     /// Remove framebuffers using the given image views from the cache
     void RemoveFramebuffers(std::span<const ImageViewId> removed_views);
 
+    /// Sentence framebuffers not used for a number of frames for destruction
+    void TrimFramebuffers();
+
     /// Mark an image as modified from the GPU
     void MarkModification(ImageBase& image) noexcept;
 
@@ -324,15 +339,25 @@ private:
     std::vector<ImageViewId> compute_image_view_ids;
 
     RenderTargets render_targets;
+    FramebufferId current_framebuffer_id{};
 
     std::mutex mutex;
 
+    struct FramebufferCacheEntry {
+        FramebufferId framebuffer_id;
+        u64 last_use_tick = 0;
+    };
+
     std::unordered_map<TICEntry, ImageViewId> image_views;
     std::unordered_map<TSCEntry, SamplerId> samplers;
-    std::unordered_map<RenderTargets, FramebufferId> framebuffers;
+    std::unordered_map<RenderTargets, FramebufferCacheEntry> framebuffers;
 
     std::unordered_map<u64, std::vector<ImageId>, IdentityHash<u64>> page_table;
 
+    /// Registered images ordered by guest address to find overlap candidates in logarithmic time
+    std::multimap<VAddr, ImageId> image_intervals;
+    size_t max_image_size_bytes = 0;
+
     bool has_deleted_images = false;
 
     SlotVector<Image> slot_images;
@@ -346,6 +371,7 @@ private:
     std::queue<std::vector<ImageId>> committed_downloads;
 
     static constexpr size_t TICKS_TO_DESTROY = 6;
+    static constexpr u64 TICKS_TO_EVICT_FRAMEBUFFERS = 512;
     DelayedDestructionRing<Image, TICKS_TO_DESTROY> sentenced_images;
     DelayedDestructionRing<ImageView, TICKS_TO_DESTROY> sentenced_image_view;
     DelayedDestructionRing<Framebuffer, TICKS_TO_DESTROY> sentenced_framebuffers;
@@ -354,6 +380,9 @@ private:
 
     u64 modification_tick = 0;
     u64 frame_tick = 0;
+
+    u64 num_overlap_resolves = 0;
+    u64 num_image_aliases = 0;
 };
 
 template <class P>
@@ -382,6 +411,11 @@ void TextureCache<P>::TickFrame() {
     sentenced_images.Tick();
     sentenced_framebuffers.Tick();
     sentenced_image_view.Tick();
+    TrimFramebuffers();
+    if (frame_tick % 1024 == 0 && (num_overlap_resolves | num_image_aliases) != 0) {
+        LOG_DEBUG(HW_GPU, "Alias churn: {} overlap resolves, {} image aliases",
+                  num_overlap_resolves, num_image_aliases);
+    }
     ++frame_tick;
 }
 
@@ -503,11 +537,15 @@ void TextureCache<P>::UpdateRenderTargets(bool is_clear) {
         maxwell3d.regs.render_area.width,
         maxwell3d.regs.render_area.height,
     };
+    current_framebuffer_id = FramebufferId{};
 }
 
 template <class P>
 typename P::Framebuffer* TextureCache<P>::GetFramebuffer() {
-    return &slot_framebuffers[GetFramebufferId(render_targets)];
+    if (!current_framebuffer_id) {
+        current_framebuffer_id = GetFramebufferId(render_targets);
+    }
+    return &slot_framebuffers[current_framebuffer_id];
 }
 
 template <class P>
@@ -546,17 +584,18 @@ ImageViewId TextureCache<P>::VisitImageView(DescriptorTable<TICEntry>& table,
 template <class P>
 FramebufferId TextureCache<P>::GetFramebufferId(const RenderTargets& key) {
     const auto [pair, is_new] = framebuffers.try_emplace(key);
-    FramebufferId& framebuffer_id = pair->second;
+    FramebufferCacheEntry& entry = pair->second;
+    entry.last_use_tick = frame_tick;
     if (!is_new) {
-        return framebuffer_id;
+        return entry.framebuffer_id;
     }
     std::array<ImageView*, NUM_RT> color_buffers;
     std::ranges::transform(key.color_buffer_ids, color_buffers.begin(),
                            [this](ImageViewId id) { return id ? &slot_image_views[id] : nullptr; });
     ImageView* const depth_buffer =
         key.depth_buffer_id ? &slot_image_views[key.depth_buffer_id] : nullptr;
-    framebuffer_id = slot_framebuffers.insert(runtime, color_buffers, depth_buffer, key);
-    return framebuffer_id;
+    entry.framebuffer_id = slot_framebuffers.insert(runtime, color_buffers, depth_buffer, key);
+    return entry.framebuffer_id;
 }
 
 template <class P>
@@ -596,13 +635,29 @@ void TextureCache<P>::DownloadMemory(VAddr cpu_addr, size_t size) {
     std::ranges::sort(images, [this](ImageId lhs, ImageId rhs) {
         return slot_images[lhs].modification_tick < slot_images[rhs].modification_tick;
     });
+    size_t total_size_bytes = 0;
+    for (const ImageId image_id : images) {
+        total_size_bytes += slot_images[image_id].unswizzled_size_bytes;
+    }
+    auto download_map = runtime.MapDownloadBuffer(total_size_bytes);
+    size_t buffer_offset = 0;
     for (const ImageId image_id : images) {
         Image& image = slot_images[image_id];
-        auto map = runtime.MapDownloadBuffer(image.unswizzled_size_bytes);
         const auto copies = FullDownloadCopies(image.info);
-        image.DownloadMemory(map, 0, copies);
-        runtime.Finish();
-        SwizzleImage(gpu_memory, image.gpu_addr, image.info, copies, map.Span());
+        image.DownloadMemory(download_map, buffer_offset, copies);
+        buffer_offset += image.unswizzled_size_bytes;
+    }
+    // Wait for all the downloads at once instead of stalling per image
+    runtime.Finish();
+
+    buffer_offset = 0;
+    const std::span<u8> download_span = download_map.Span();
+    for (const ImageId image_id : images) {
+        const ImageBase& image = slot_images[image_id];
+        const auto copies = FullDownloadCopies(image.info);
+        const std::span<u8> image_download_span = download_span.subspan(buffer_offset);
+        SwizzleImage(gpu_memory, image.gpu_addr, image.info, copies, image_download_span);
+        buffer_offset += image.unswizzled_size_bytes;
     }
 }
 
@@ -671,10 +726,52 @@ void TextureCache<P>::BlitImage(const Tegra::Engines::Fermi2D::Surface& dst,
     }
 }
 
+template <class P>
+bool TextureCache<P>::UploadVideoFrame(const ImageInfo& info, GPUVAddr gpu_addr,
+                                       std::span<const u8> frame_data) {
+    if (!gpu_memory.GpuToCpuAddress(gpu_addr)) {
+        return false;
+    }
+    const ImageId image_id = FindOrInsertImage(info, gpu_addr);
+    if (!image_id) {
+        return false;
+    }
+    Image& image = slot_images[image_id];
+    if (image.info.size.width != info.size.width || image.info.size.height != info.size.height) {
+        // The frame only covers part of an existing image, let the caller write it back to guest
+        // memory where the cache can pick it up with the regular upload path
+        return false;
+    }
+    // The upload overwrites the full image, invalidate any pending guest data and mark the new
+    // contents as GPU modified so they are downloaded back to the guest on flush
+    PrepareImage(image_id, true, true);
+
+    auto map = runtime.MapUploadBuffer(frame_data.size_bytes());
+    std::memcpy(map.Span().data(), frame_data.data(), frame_data.size_bytes());
+    const std::array copies{BufferImageCopy{
+        .buffer_offset = 0,
+        .buffer_size = frame_data.size_bytes(),
+        .buffer_row_length = info.size.width,
+        .buffer_image_height = info.size.height,
+        .image_subresource =
+            {
+                .base_level = 0,
+                .base_layer = 0,
+                .num_layers = 1,
+            },
+        .image_offset = {0, 0, 0},
+        .image_extent = info.size,
+    }};
+    image.UploadMemory(map, 0, copies);
+    runtime.InsertUploadMemoryBarrier();
+    return true;
+}
+
 template <class P>
 void TextureCache<P>::InvalidateColorBuffer(size_t index) {
     ImageViewId& color_buffer_id = render_targets.color_buffer_ids[index];
     color_buffer_id = FindColorBuffer(index, false);
+    current_framebuffer_id = FramebufferId{};
     if (!color_buffer_id) {
         LOG_ERROR(HW_GPU, "Invalidating invalid color buffer in index={}", index);
         return;
@@ -692,6 +789,7 @@ template <class P>
 void TextureCache<P>::InvalidateDepthBuffer() {
     ImageViewId& depth_buffer_id = render_targets.depth_buffer_id;
     depth_buffer_id = FindDepthBuffer(false);
+    current_framebuffer_id = FramebufferId{};
     if (!depth_buffer_id) {
         LOG_ERROR(HW_GPU, "Invalidating invalid depth buffer");
         return;
@@ -871,8 +969,10 @@ template <class P>
 ImageId TextureCache<P>::FindOrInsertImage(const ImageInfo& info, GPUVAddr gpu_addr,
                                            RelaxedOptions options) {
     if (const ImageId image_id = FindImage(info, gpu_addr, options); image_id) {
+        Common::AddPerfCounter(Common::PerfCounter::TextureCacheHits);
         return image_id;
     }
+    Common::AddPerfCounter(Common::PerfCounter::TextureCacheMisses);
     return InsertImage(info, gpu_addr, options);
 }
 
@@ -931,7 +1031,7 @@ ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, VA
     std::vector<ImageId> overlap_ids;
     std::vector<ImageId> left_aliased_ids;
     std::vector<ImageId> right_aliased_ids;
-    ForEachImageInRegion(cpu_addr, size_bytes, [&](ImageId overlap_id, ImageBase& overlap) {
+    ForEachOverlapCandidate(cpu_addr, size_bytes, [&](ImageId overlap_id, ImageBase& overlap) {
         if (info.type != overlap.info.type) {
             return;
         }
@@ -961,6 +1061,9 @@ ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, VA
             right_aliased_ids.push_back(overlap_id);
         }
     });
+    num_overlap_resolves += overlap_ids.size();
+    num_image_aliases += left_aliased_ids.size() + right_aliased_ids.size();
+
     const ImageId new_image_id = slot_images.insert(runtime, new_info, gpu_addr, cpu_addr);
     Image& new_image = slot_images[new_image_id];
 
@@ -1140,6 +1243,22 @@ void TextureCache<P>::ForEachImageInRegion(VAddr cpu_addr, size_t size, Func&& f
     }
 }
 
+template <class P>
+template <typename Func>
+void TextureCache<P>::ForEachOverlapCandidate(VAddr cpu_addr, size_t size, Func&& func) {
+    // Images starting more than the largest registered image size before the region can't reach it
+    const VAddr window_start = cpu_addr - std::min<VAddr>(cpu_addr, max_image_size_bytes);
+    const auto end = image_intervals.lower_bound(cpu_addr + size);
+    for (auto it = image_intervals.lower_bound(window_start); it != end; ++it) {
+        const ImageId image_id = it->second;
+        Image& image = slot_images[image_id];
+        if (!image.Overlaps(cpu_addr, size)) {
+            continue;
+        }
+        func(image_id, image);
+    }
+}
+
 template <class P>
 ImageViewId TextureCache<P>::FindOrEmplaceImageView(ImageId image_id, const ImageViewInfo& info) {
     Image& image = slot_images[image_id];
@@ -1159,6 +1278,8 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     image.flags |= ImageFlagBits::Registered;
     ForEachPage(image.cpu_addr, image.guest_size_bytes,
                 [this, image_id](u64 page) { page_table[page].push_back(image_id); });
+    image_intervals.emplace(image.cpu_addr, image_id);
+    max_image_size_bytes = std::max<size_t>(max_image_size_bytes, image.guest_size_bytes);
 }
 
 template <class P>
@@ -1181,6 +1302,14 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
         }
         image_ids.erase(vector_it);
     });
+    const auto [begin, end] = image_intervals.equal_range(image.cpu_addr);
+    const auto interval_it = std::find_if(
+        begin, end, [image_id](const auto& entry) { return entry.second == image_id; });
+    if (interval_it != end) {
+        image_intervals.erase(interval_it);
+    } else {
+        UNREACHABLE_MSG("Unregistering image not in the interval index");
+    }
 }
 
 template <class P>
@@ -1278,9 +1407,13 @@ void TextureCache<P>::RemoveImageViewReferences(std::span<const ImageViewId> rem
 
 template <class P>
 void TextureCache<P>::RemoveFramebuffers(std::span<const ImageViewId> removed_views) {
+    current_framebuffer_id = FramebufferId{};
     auto it = framebuffers.begin();
     while (it != framebuffers.end()) {
         if (it->first.Contains(removed_views)) {
+            const FramebufferId framebuffer_id = it->second.framebuffer_id;
+            sentenced_framebuffers.Push(std::move(slot_framebuffers[framebuffer_id]));
+            slot_framebuffers.erase(framebuffer_id);
             it = framebuffers.erase(it);
         } else {
             ++it;
@@ -1288,6 +1421,26 @@ void TextureCache<P>::RemoveFramebuffers(std::span<const ImageViewId> removed_vi
     }
 }
 
+template <class P>
+void TextureCache<P>::TrimFramebuffers() {
+    for (auto it = framebuffers.begin(); it != framebuffers.end();) {
+        auto& [framebuffer_id, last_use_tick] = it->second;
+        if (framebuffer_id == current_framebuffer_id) {
+            // The current framebuffer is fetched without a cache lookup, keep it alive
+            last_use_tick = frame_tick;
+            ++it;
+            continue;
+        }
+        if (frame_tick - last_use_tick <= TICKS_TO_EVICT_FRAMEBUFFERS) {
+            ++it;
+            continue;
+        }
+        sentenced_framebuffers.Push(std::move(slot_framebuffers[framebuffer_id]));
+        slot_framebuffers.erase(framebuffer_id);
+        it = framebuffers.erase(it);
+    }
+}
+
 template <class P>
 void TextureCache<P>::MarkModification(ImageBase& image) noexcept {
     image.flags |= ImageFlagBits::GpuModified;
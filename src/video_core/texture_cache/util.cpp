@@ -28,9 +28,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <numeric>
 #include <optional>
 #include <span>
+#include <thread>
 #include <vector>
 
 #include "common/alignment.h"
@@ -38,6 +40,8 @@
 #include "common/bit_util.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
+#include "common/thread.h"
+#include "common/thread_worker.h"
 #include "video_core/compatible_formats.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/memory_manager.h"
@@ -623,6 +627,12 @@ void SwizzleBlockLinearImage(Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr
     ASSERT(host_offset - copy.buffer_offset == copy.buffer_size);
 }
 
+Common::ThreadWorker& ConvertWorkers() {
+    const std::size_t num_workers = std::max<std::size_t>(std::thread::hardware_concurrency() / 2, 1);
+    static Common::ThreadWorker workers(num_workers, "yuzu:TexConvert");
+    return workers;
+}
+
 } // Anonymous namespace
 
 u32 CalculateGuestSizeInBytes(const ImageInfo& info) noexcept {
@@ -905,6 +915,23 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
     u32 output_offset = 0;
 
     const Extent2D tile_size = DefaultBlockSize(info.format);
+    const bool is_astc = IsPixelFormatASTC(info.format);
+    // ASTC decompression already splits itself across threads; everything else converts its
+    // levels concurrently on the worker pool while this thread keeps dispatching. The dispatch
+    // loop holds one reference on remaining_jobs so workers finishing early can't signal
+    // completion before every job has been queued.
+    std::atomic<size_t> remaining_jobs{1};
+    Common::Event completion;
+    const auto queue_job = [&remaining_jobs, &completion](auto&& work) {
+        remaining_jobs.fetch_add(1, std::memory_order_relaxed);
+        ConvertWorkers().QueueWork([work = std::move(work), &remaining_jobs, &completion] {
+            work();
+            if (remaining_jobs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                completion.Set();
+            }
+        });
+    };
+
     for (BufferImageCopy& copy : copies) {
         const u32 level = copy.image_subresource.base_level;
         const Extent3D mip_size = AdjustMipSize(info.size, level);
@@ -914,15 +941,41 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
         ASSERT(copy.buffer_row_length == Common::AlignUp(mip_size.width, tile_size.width));
         ASSERT(copy.buffer_image_height == Common::AlignUp(mip_size.height, tile_size.height));
 
-        if (IsPixelFormatASTC(info.format)) {
+        const std::span<const u8> copy_input = input.subspan(copy.buffer_offset);
+        const std::span<u8> copy_output = output.subspan(output_offset);
+        if (is_astc) {
             ASSERT(copy.image_extent.depth == 1);
-            Tegra::Texture::ASTC::Decompress(input.subspan(copy.buffer_offset),
-                                             copy.image_extent.width, copy.image_extent.height,
+            Tegra::Texture::ASTC::Decompress(copy_input, copy.image_extent.width,
+                                             copy.image_extent.height,
                                              copy.image_subresource.num_layers, tile_size.width,
-                                             tile_size.height, output.subspan(output_offset));
+                                             tile_size.height, copy_output);
         } else {
-            DecompressBC4(input.subspan(copy.buffer_offset), copy.image_extent,
-                          output.subspan(output_offset));
+            // Levels above the threshold are cut into bands of whole block rows so that even a
+            // single-level upload spreads across the workers.
+            static constexpr u32 BAND_TEXELS = 512 * 512;
+            const Extent3D extent = copy.image_extent;
+            const u32 level_texels = extent.width * extent.height * extent.depth;
+            if (extent.depth == 1 && extent.height % 4 == 0 && level_texels >= 2 * BAND_TEXELS) {
+                const size_t input_row_pitch = (extent.width / 4) * sizeof(u64);
+                const size_t output_row_pitch =
+                    size_t{extent.width} * 4 * CONVERTED_BYTES_PER_BLOCK;
+                const u32 num_block_rows = extent.height / 4;
+                const u32 band_rows = std::max(BAND_TEXELS / (extent.width * 4), 1U);
+                for (u32 row = 0; row < num_block_rows; row += band_rows) {
+                    const u32 rows = std::min(band_rows, num_block_rows - row);
+                    const Extent3D band_extent{extent.width, rows * 4, 1};
+                    queue_job([in = copy_input.subspan(row * input_row_pitch),
+                               out = copy_output.subspan(row * output_row_pitch), band_extent] {
+                        DecompressBC4(in, band_extent, out);
+                    });
+                }
+            } else if (copies.size() > 1) {
+                queue_job([copy_input, copy_output, extent] {
+                    DecompressBC4(copy_input, extent, copy_output);
+                });
+            } else {
+                DecompressBC4(copy_input, copy.image_extent, copy_output);
+            }
         }
         copy.buffer_offset = output_offset;
         copy.buffer_row_length = mip_size.width;
@@ -931,6 +984,9 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
         output_offset += copy.image_extent.width * copy.image_extent.height *
                          copy.image_subresource.num_layers * CONVERTED_BYTES_PER_BLOCK;
     }
+    if (remaining_jobs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        completion.Wait();
+    }
 }
 
 std::vector<BufferImageCopy> FullDownloadCopies(const ImageInfo& info) {
@@ -1030,14 +1086,33 @@ std::vector<SwizzleParameters> FullUploadSwizzles(const ImageInfo& info) {
 
 void SwizzleImage(Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr, const ImageInfo& info,
                   std::span<const BufferImageCopy> copies, std::span<const u8> memory) {
-    const bool is_pitch_linear = info.type == ImageType::Linear;
-    for (const BufferImageCopy& copy : copies) {
-        if (is_pitch_linear) {
+    if (info.type == ImageType::Linear) {
+        for (const BufferImageCopy& copy : copies) {
             SwizzlePitchLinearImage(gpu_memory, gpu_addr, info, copy, memory);
+        }
+        return;
+    }
+    // Each block linear copy swizzles through a private bounce buffer and writes a disjoint
+    // guest range, so subresources can be converted in parallel on the conversion workers
+    const bool parallelize = copies.size() > 1;
+    std::atomic<size_t> remaining_jobs{copies.size()};
+    Common::Event completion;
+    for (const BufferImageCopy& copy : copies) {
+        if (parallelize) {
+            ConvertWorkers().QueueWork(
+                [&gpu_memory, gpu_addr, &info, copy, memory, &remaining_jobs, &completion] {
+                    SwizzleBlockLinearImage(gpu_memory, gpu_addr, info, copy, memory);
+                    if (remaining_jobs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        completion.Set();
+                    }
+                });
         } else {
             SwizzleBlockLinearImage(gpu_memory, gpu_addr, info, copy, memory);
         }
     }
+    if (parallelize) {
+        completion.Wait();
+    }
 }
 
 bool IsBlockLinearSizeCompatible(const ImageInfo& lhs, const ImageInfo& rhs, u32 lhs_level,
@@ -19,11 +19,13 @@
 #include <cassert>
 #include <cstring>
 #include <span>
+#include <thread>
 #include <vector>
 
 #include <boost/container/static_vector.hpp>
 
 #include "common/common_types.h"
+#include "common/div_ceil.h"
 
 #include "video_core/textures/astc.h"
 
@@ -1679,31 +1681,67 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
 
 namespace Tegra::Texture::ASTC {
 
-void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
-                uint32_t block_width, uint32_t block_height, std::span<uint8_t> output) {
-    u32 block_index = 0;
-    std::size_t depth_offset = 0;
-    for (u32 z = 0; z < depth; z++) {
-        for (u32 y = 0; y < height; y += block_height) {
-            for (u32 x = 0; x < width; x += block_width) {
-                const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
-
-                // Blocks can be at most 12x12
-                std::array<u32, 12 * 12> uncompData;
-                ASTCC::DecompressBlock(blockPtr, block_width, block_height, uncompData);
-
-                u32 decompWidth = std::min(block_width, width - x);
-                u32 decompHeight = std::min(block_height, height - y);
-
-                const std::span<u8> outRow = output.subspan(depth_offset + (y * width + x) * 4);
-                for (u32 jj = 0; jj < decompHeight; jj++) {
-                    std::memcpy(outRow.data() + jj * width * 4,
-                                uncompData.data() + jj * block_width, decompWidth * 4);
-                }
-                ++block_index;
+namespace {
+
+/// Decompresses a horizontal stripe of block rows. Stripes write disjoint regions of the output
+/// surface, so they can run concurrently without synchronization.
+void DecompressStripe(std::span<const uint8_t> data, uint32_t width, uint32_t height,
+                      uint32_t block_width, uint32_t block_height, std::span<uint8_t> output,
+                      u32 num_rows, u32 num_cols, u32 begin_row, u32 end_row) {
+    for (u32 i = begin_row; i < end_row; ++i) {
+        const u32 z = i / num_rows;
+        const u32 y = (i % num_rows) * block_height;
+        const std::size_t depth_offset = z * height * width * 4;
+        u32 block_index = i * num_cols;
+        for (u32 x = 0; x < width; x += block_width) {
+            const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
+
+            // Blocks can be at most 12x12
+            std::array<u32, 12 * 12> uncompData;
+            ASTCC::DecompressBlock(blockPtr, block_width, block_height, uncompData);
+
+            const u32 decompWidth = std::min(block_width, width - x);
+            const u32 decompHeight = std::min(block_height, height - y);
+
+            const std::span<u8> outRow = output.subspan(depth_offset + (y * width + x) * 4);
+            for (u32 jj = 0; jj < decompHeight; jj++) {
+                std::memcpy(outRow.data() + jj * width * 4, uncompData.data() + jj * block_width,
+                            decompWidth * 4);
             }
+            ++block_index;
         }
-        depth_offset += height * width * 4;
+    }
+}
+
+} // Anonymous namespace
+
+void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
+                uint32_t block_width, uint32_t block_height, std::span<uint8_t> output) {
+    const u32 num_rows = Common::DivCeil(height, block_height);
+    const u32 num_cols = Common::DivCeil(width, block_width);
+    const u32 total_rows = num_rows * depth;
+
+    // Only spin up workers when there are enough block rows to pay for the thread wakeups.
+    static constexpr u32 MIN_ROWS_PER_WORKER = 4;
+    const u32 hardware_threads = std::max(std::thread::hardware_concurrency(), 1U);
+    const u32 num_workers = std::min(hardware_threads, total_rows / MIN_ROWS_PER_WORKER);
+    if (num_workers <= 1) {
+        DecompressStripe(data, width, height, block_width, block_height, output, num_rows,
+                         num_cols, 0, total_rows);
+        return;
+    }
+
+    const u32 rows_per_worker = total_rows / num_workers;
+    std::vector<std::thread> threads;
+    threads.reserve(num_workers);
+    for (u32 worker = 0; worker < num_workers; ++worker) {
+        const u32 begin_row = worker * rows_per_worker;
+        const u32 end_row = worker + 1 == num_workers ? total_rows : begin_row + rows_per_worker;
+        threads.emplace_back(DecompressStripe, data, width, height, block_width, block_height,
+                             output, num_rows, num_cols, begin_row, end_row);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
     }
 }
 
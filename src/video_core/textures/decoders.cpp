@@ -2,16 +2,21 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <span>
+#include <thread>
 #include <utility>
 
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/bit_util.h"
 #include "common/div_ceil.h"
+#include "common/thread.h"
+#include "common/thread_worker.h"
 #include "video_core/gpu.h"
 #include "video_core/textures/decoders.h"
 #include "video_core/textures/texture.h"
@@ -37,9 +42,44 @@ constexpr SwizzleTable MakeSwizzleTableConst() {
 
 constexpr SwizzleTable SWIZZLE_TABLE = MakeSwizzleTableConst();
 
-template <bool TO_LINEAR>
-void Swizzle(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel, u32 width,
-             u32 height, u32 depth, u32 block_height, u32 block_depth, u32 stride_alignment) {
+/// Number of bytes that remain contiguous within a gob row. The swizzle table only reorders
+/// 16-byte sectors, so any span that does not cross a sector boundary can be copied whole.
+constexpr u32 GOB_SECTOR_WIDTH = 16;
+
+constexpr u32 GOB_SECTORS_PER_ROW = GOB_SIZE_X / GOB_SECTOR_WIDTH;
+
+/// Swizzled offset of each 16-byte sector within a gob row, folded out of SWIZZLE_TABLE at
+/// compile time. Bytes inside a sector stay linear, so a line whose pitch is sector aligned
+/// reduces to fixed-size streaming copies driven by this table.
+constexpr auto MakeSectorOffsetTable() {
+    std::array<std::array<u16, GOB_SECTORS_PER_ROW>, GOB_SIZE_Y> table{};
+    for (u32 y = 0; y < GOB_SIZE_Y; ++y) {
+        for (u32 sector = 0; sector < GOB_SECTORS_PER_ROW; ++sector) {
+            table[y][sector] = SWIZZLE_TABLE[y][sector * GOB_SECTOR_WIDTH];
+        }
+    }
+    return table;
+}
+
+constexpr auto SECTOR_OFFSET_TABLE = MakeSectorOffsetTable();
+
+/// Swizzles below this size run on the calling thread; the fixed cost of dispatching to the
+/// worker pool outweighs the copy itself.
+constexpr std::size_t SWIZZLE_THREADED_THRESHOLD = 1024 * 1024;
+
+std::size_t NumSwizzleWorkers() {
+    return std::max<std::size_t>(std::thread::hardware_concurrency() / 2, 1);
+}
+
+Common::ThreadWorker& SwizzleWorkers() {
+    static Common::ThreadWorker workers(NumSwizzleWorkers(), "yuzu:Swizzle");
+    return workers;
+}
+
+template <bool TO_LINEAR, bool SECTOR_ALIGNED>
+void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel, u32 width,
+                 u32 height, u32 depth, u32 block_height, u32 block_depth, u32 stride_alignment,
+                 u32 line_start, u32 line_end) {
     // The origin of the transformation can be configured here, leave it as zero as the current API
     // doesn't expose it.
     static constexpr u32 origin_x = 0;
@@ -64,31 +104,100 @@ void Swizzle(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixe
         const u32 z = slice + origin_z;
         const u32 offset_z = (z >> block_depth) * slice_size +
                              ((z & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
-        for (u32 line = 0; line < height; ++line) {
+        for (u32 line = line_start; line < line_end; ++line) {
             const u32 y = line + origin_y;
-            const auto& table = SWIZZLE_TABLE[y % GOB_SIZE_Y];
 
             const u32 block_y = y >> GOB_SIZE_Y_SHIFT;
             const u32 offset_y = (block_y >> block_height) * block_size +
                                  ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
 
-            for (u32 column = 0; column < width; ++column) {
-                const u32 x = (column + origin_x) * bytes_per_pixel;
+            const u32 unswizzled_line = slice * pitch * height + line * pitch;
+            if constexpr (SECTOR_ALIGNED) {
+                // Sector-aligned pitches stream whole sectors; the per-byte swizzle lookup
+                // collapses to a compile-time table indexed by sector, and the fixed copy
+                // length lets the compiler emit straight vector loads and stores.
+                const auto& sector_row = SECTOR_OFFSET_TABLE[y % GOB_SIZE_Y];
+                for (u32 x = 0; x < pitch; x += GOB_SECTOR_WIDTH) {
+                    const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
+                    const u32 swizzled_offset = offset_z + offset_y + offset_x +
+                                                sector_row[(x % GOB_SIZE_X) / GOB_SECTOR_WIDTH];
+                    const u32 unswizzled_offset = unswizzled_line + x;
+
+                    u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+                    const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+                    std::memcpy(dst, src, GOB_SECTOR_WIDTH);
+                }
+                continue;
+            }
+            const auto& table = SWIZZLE_TABLE[y % GOB_SIZE_Y];
+            // Walk the line in bytes and copy whole sector rows at once; texels within a
+            // 16-byte sector are laid out linearly on both sides of the transformation.
+            for (u32 x = origin_x * bytes_per_pixel; x < pitch;) {
                 const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
 
-                const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
-                const u32 swizzled_offset = base_swizzled_offset + table[x % GOB_SIZE_X];
-
-                const u32 unswizzled_offset =
-                    slice * pitch * height + line * pitch + column * bytes_per_pixel;
+                const u32 swizzled_offset = offset_z + offset_y + offset_x + table[x % GOB_SIZE_X];
+                const u32 unswizzled_offset = unswizzled_line + x;
+                const u32 copy_length =
+                    std::min(GOB_SECTOR_WIDTH - (x % GOB_SECTOR_WIDTH), pitch - x);
 
                 u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
                 const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
-                std::memcpy(dst, src, bytes_per_pixel);
+                std::memcpy(dst, src, copy_length);
+
+                x += copy_length;
             }
         }
     }
 }
+
+template <bool TO_LINEAR>
+void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel, u32 width,
+                 u32 height, u32 depth, u32 block_height, u32 block_depth, u32 stride_alignment,
+                 u32 line_start, u32 line_end) {
+    if (width * bytes_per_pixel % GOB_SECTOR_WIDTH == 0) {
+        SwizzleImpl<TO_LINEAR, true>(output, input, bytes_per_pixel, width, height, depth,
+                                     block_height, block_depth, stride_alignment, line_start,
+                                     line_end);
+    } else {
+        SwizzleImpl<TO_LINEAR, false>(output, input, bytes_per_pixel, width, height, depth,
+                                      block_height, block_depth, stride_alignment, line_start,
+                                      line_end);
+    }
+}
+
+template <bool TO_LINEAR>
+void Swizzle(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel, u32 width,
+             u32 height, u32 depth, u32 block_height, u32 block_depth, u32 stride_alignment) {
+    const std::size_t linear_size =
+        static_cast<std::size_t>(width) * bytes_per_pixel * height * depth;
+    if (linear_size < SWIZZLE_THREADED_THRESHOLD) {
+        SwizzleImpl<TO_LINEAR>(output, input, bytes_per_pixel, width, height, depth, block_height,
+                               block_depth, stride_alignment, 0, height);
+        return;
+    }
+    // Split the surface on block row boundaries so each task walks whole blocks and no two
+    // tasks ever touch the same gob.
+    const u32 lines_per_block = GOB_SIZE_Y << block_height;
+    const u32 num_blocks = Common::DivCeil(height, lines_per_block);
+    const u32 num_tasks = std::min(static_cast<u32>(NumSwizzleWorkers()), num_blocks);
+    const u32 lines_per_task = Common::DivCeil(num_blocks, num_tasks) * lines_per_block;
+
+    std::atomic<u32> remaining_tasks{num_tasks};
+    Common::Event completion;
+    for (u32 task = 0; task < num_tasks; ++task) {
+        const u32 line_start = std::min(task * lines_per_task, height);
+        const u32 line_end = std::min(line_start + lines_per_task, height);
+        SwizzleWorkers().QueueWork([=, &remaining_tasks, &completion] {
+            SwizzleImpl<TO_LINEAR>(output, input, bytes_per_pixel, width, height, depth,
+                                   block_height, block_depth, stride_alignment, line_start,
+                                   line_end);
+            if (remaining_tasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                completion.Set();
+            }
+        });
+    }
+    completion.Wait();
+}
 } // Anonymous namespace
 
 SwizzleTable MakeSwizzleTable() {
@@ -121,16 +230,21 @@ void SwizzleSubrect(u32 subrect_width, u32 subrect_height, u32 source_pitch, u32
             (dst_y / (GOB_SIZE_Y * block_height)) * GOB_SIZE * block_height * image_width_in_gobs +
             ((dst_y % (GOB_SIZE_Y * block_height)) / GOB_SIZE_Y) * GOB_SIZE;
         const auto& table = SWIZZLE_TABLE[dst_y % GOB_SIZE_Y];
-        for (u32 x = 0; x < subrect_width; ++x) {
-            const u32 dst_x = x + offset_x;
+        const u32 line_bytes = subrect_width * bytes_per_pixel;
+        for (u32 x = 0; x < line_bytes;) {
+            const u32 dst_x = x + offset_x * bytes_per_pixel;
             const u32 gob_address =
-                gob_address_y + (dst_x * bytes_per_pixel / GOB_SIZE_X) * GOB_SIZE * block_height;
-            const u32 swizzled_offset = gob_address + table[(dst_x * bytes_per_pixel) % GOB_SIZE_X];
-            const u32 unswizzled_offset = line * source_pitch + x * bytes_per_pixel;
+                gob_address_y + (dst_x / GOB_SIZE_X) * GOB_SIZE * block_height;
+            const u32 swizzled_offset = gob_address + table[dst_x % GOB_SIZE_X];
+            const u32 unswizzled_offset = line * source_pitch + x;
+            const u32 copy_length =
+                std::min(GOB_SECTOR_WIDTH - (dst_x % GOB_SECTOR_WIDTH), line_bytes - x);
 
             const u8* const source_line = unswizzled_data + unswizzled_offset;
             u8* const dest_addr = swizzled_data + swizzled_offset;
-            std::memcpy(dest_addr, source_line, bytes_per_pixel);
+            std::memcpy(dest_addr, source_line, copy_length);
+
+            x += copy_length;
         }
     }
 }
@@ -151,14 +265,19 @@ void UnswizzleSubrect(u32 line_length_in, u32 line_count, u32 pitch, u32 width,
         const u32 block_y = src_y >> GOB_SIZE_Y_SHIFT;
         const u32 src_offset_y = (block_y >> block_height) * block_size +
                                  ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
-        for (u32 column = 0; column < line_length_in; ++column) {
-            const u32 src_x = (column + origin_x) * bytes_per_pixel;
+        const u32 line_bytes = line_length_in * bytes_per_pixel;
+        for (u32 x = 0; x < line_bytes;) {
+            const u32 src_x = x + origin_x * bytes_per_pixel;
             const u32 src_offset_x = (src_x >> GOB_SIZE_X_SHIFT) << x_shift;
 
             const u32 swizzled_offset = src_offset_y + src_offset_x + table[src_x % GOB_SIZE_X];
-            const u32 unswizzled_offset = line * pitch + column * bytes_per_pixel;
+            const u32 unswizzled_offset = line * pitch + x;
+            const u32 copy_length =
+                std::min(GOB_SECTOR_WIDTH - (src_x % GOB_SECTOR_WIDTH), line_bytes - x);
+
+            std::memcpy(output + unswizzled_offset, input + swizzled_offset, copy_length);
 
-            std::memcpy(output + unswizzled_offset, input + swizzled_offset, bytes_per_pixel);
+            x += copy_length;
         }
     }
 }
@@ -5,7 +5,7 @@
 #include <algorithm>
 #include <array>
 
-#include "common/cityhash.h"
+#include "common/hash.h"
 #include "core/settings.h"
 #include "video_core/textures/texture.h"
 
@@ -84,9 +84,9 @@ float TSCEntry::MaxAnisotropy() const noexcept {
 } // namespace Tegra::Texture
 
 size_t std::hash<TICEntry>::operator()(const TICEntry& tic) const noexcept {
-    return Common::CityHash64(reinterpret_cast<const char*>(&tic), sizeof tic);
+    return static_cast<size_t>(Common::HashValue(tic));
 }
 
 size_t std::hash<TSCEntry>::operator()(const TSCEntry& tsc) const noexcept {
-    return Common::CityHash64(reinterpret_cast<const char*>(&tsc), sizeof tsc);
+    return static_cast<size_t>(Common::HashValue(tsc));
 }
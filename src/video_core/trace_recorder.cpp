@@ -0,0 +1,114 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstdlib>
+#include <vector>
+
+#include "common/cityhash.h"
+#include "common/logging/log.h"
+#include "common/lz4_compression.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/memory_manager.h"
+#include "video_core/trace_recorder.h"
+
+namespace Tegra {
+
+namespace {
+
+constexpr u32 TRACE_MAGIC = 0x54504759; // 'YGPT'
+constexpr u32 TRACE_VERSION = 1;
+
+enum class ChunkType : u32 {
+    Data = 0,       ///< Deduplicated LZ4 compressed pushbuffer contents
+    Submission = 1, ///< One PushGPUEntries call
+};
+
+struct ChunkHeader {
+    ChunkType type;
+    u32 size; ///< Size in bytes of the chunk payload
+};
+
+} // Anonymous namespace
+
+TraceRecorder::TraceRecorder(const std::string& path) : file{path, "wb"} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU trace file '{}'", path);
+        return;
+    }
+    file.WriteObject(TRACE_MAGIC);
+    file.WriteObject(TRACE_VERSION);
+    LOG_INFO(HW_GPU, "Recording GPU command stream to '{}'", path);
+}
+
+TraceRecorder::~TraceRecorder() = default;
+
+std::unique_ptr<TraceRecorder> TraceRecorder::CreateFromEnvironment() {
+    const char* const path = std::getenv("YUZU_GPU_TRACE");
+    if (path == nullptr || *path == '\0') {
+        return nullptr;
+    }
+    auto recorder = std::make_unique<TraceRecorder>(path);
+    if (!recorder->IsOpen()) {
+        return nullptr;
+    }
+    return recorder;
+}
+
+void TraceRecorder::RecordSubmission(MemoryManager& memory_manager, const CommandList& entries) {
+    if (!file.IsOpen()) {
+        return;
+    }
+    std::lock_guard lock{mutex};
+
+    std::vector<u8> pushbuffer;
+    std::vector<u64> hashes;
+    hashes.reserve(entries.command_lists.size());
+    for (const CommandListHeader& header : entries.command_lists) {
+        const std::size_t size_bytes = header.size * sizeof(CommandHeader);
+        pushbuffer.resize(size_bytes);
+        // Pushbuffers are written from the CPU before submission, so the cache-safe read is not
+        // needed here and would stall flushing GPU caches
+        memory_manager.ReadBlockUnsafe(header.addr, pushbuffer.data(), size_bytes);
+        const u64 hash =
+            Common::CityHash64(reinterpret_cast<const char*>(pushbuffer.data()), size_bytes);
+        hashes.push_back(hash);
+        if (written_hashes.insert(hash).second) {
+            WriteDataChunk(hash, header.addr, pushbuffer);
+        }
+    }
+    const u32 num_headers = static_cast<u32>(entries.command_lists.size());
+    const u32 num_prefetch = static_cast<u32>(entries.prefetch_command_list.size());
+    const ChunkHeader chunk{
+        .type = ChunkType::Submission,
+        .size = static_cast<u32>(sizeof(num_headers) + sizeof(num_prefetch) +
+                                 num_headers * (sizeof(CommandListHeader) + sizeof(u64)) +
+                                 num_prefetch * sizeof(CommandHeader)),
+    };
+    file.WriteObject(chunk);
+    file.WriteObject(num_headers);
+    file.WriteObject(num_prefetch);
+    file.WriteArray(entries.command_lists.data(), entries.command_lists.size());
+    file.WriteArray(hashes.data(), hashes.size());
+    file.WriteArray(entries.prefetch_command_list.data(), entries.prefetch_command_list.size());
+}
+
+void TraceRecorder::WriteDataChunk(u64 hash, u64 gpu_addr, std::span<const u8> data) {
+    const std::vector<u8> compressed =
+        Common::Compression::CompressDataLZ4(data.data(), data.size());
+    const u32 uncompressed_size = static_cast<u32>(data.size());
+    const u32 compressed_size = static_cast<u32>(compressed.size());
+    const ChunkHeader chunk{
+        .type = ChunkType::Data,
+        .size = static_cast<u32>(sizeof(hash) + sizeof(gpu_addr) + sizeof(uncompressed_size) +
+                                 sizeof(compressed_size) + compressed.size()),
+    };
+    file.WriteObject(chunk);
+    file.WriteObject(hash);
+    file.WriteObject(gpu_addr);
+    file.WriteObject(uncompressed_size);
+    file.WriteObject(compressed_size);
+    file.WriteArray(compressed.data(), compressed.size());
+}
+
+} // namespace Tegra
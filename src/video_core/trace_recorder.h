@@ -0,0 +1,56 @@
+// Copyright 2021 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_set>
+
+#include "common/common_types.h"
+#include "common/file_util.h"
+
+namespace Tegra {
+
+class MemoryManager;
+struct CommandList;
+
+/**
+ * Records GPFIFO submissions into a file for offline inspection and benchmarking.
+ *
+ * The trace starts with a magic and version pair and continues as a sequence of chunks, each
+ * preceded by a ChunkHeader. Pushbuffer contents are stored as LZ4 compressed data chunks
+ * deduplicated by hash, so repeated submissions of identical pushbuffers only store one copy.
+ * Submission chunks keep the original command list headers together with the hashes of the
+ * pushbuffer contents they referenced at submission time.
+ *
+ * Recording is enabled by pointing the YUZU_GPU_TRACE environment variable to the output path.
+ */
+class TraceRecorder {
+public:
+    explicit TraceRecorder(const std::string& path);
+    ~TraceRecorder();
+
+    /// Creates a recorder when the YUZU_GPU_TRACE environment variable is set, null otherwise.
+    [[nodiscard]] static std::unique_ptr<TraceRecorder> CreateFromEnvironment();
+
+    /// Returns true when the output file could be opened.
+    [[nodiscard]] bool IsOpen() const {
+        return file.IsOpen();
+    }
+
+    /// Serializes a GPFIFO submission and the pushbuffer memory it references.
+    void RecordSubmission(MemoryManager& memory_manager, const CommandList& entries);
+
+private:
+    void WriteDataChunk(u64 hash, u64 gpu_addr, std::span<const u8> data);
+
+    Common::FS::IOFile file;
+    std::unordered_set<u64> written_hashes;
+    std::mutex mutex;
+};
+
+} // namespace Tegra
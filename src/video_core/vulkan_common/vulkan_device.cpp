@@ -4,6 +4,7 @@
 
 #include <bitset>
 #include <chrono>
+#include <future>
 #include <optional>
 #include <string_view>
 #include <thread>
@@ -193,8 +194,12 @@ std::unordered_map<VkFormat, VkFormatProperties> GetFormatProperties(vk::Physica
 
 Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR surface,
                const vk::InstanceDispatch& dld_)
-    : instance{instance_}, dld{dld_}, physical{physical_}, properties{physical.GetProperties()},
-      format_properties{GetFormatProperties(physical)} {
+    : instance{instance_}, dld{dld_}, physical{physical_}, properties{physical.GetProperties()} {
+    // Format support is only consulted after the logical device exists, so overlap the per-format
+    // driver queries with the rest of initialization. Physical device queries are thread-safe.
+    std::future<std::unordered_map<VkFormat, VkFormatProperties>> format_properties_future =
+        std::async(std::launch::async, [this] { return GetFormatProperties(physical); });
+
     CheckSuitability();
     SetupFamilies(surface);
     SetupFeatures();
@@ -412,6 +417,8 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
     }
     logical = vk::Device::Create(physical, queue_cis, extensions, first_next, dld);
 
+    format_properties = format_properties_future.get();
+
     CollectTelemetryParameters();
     CollectToolingInfo();
 
@@ -517,11 +524,14 @@ bool Device::IsOptimalAstcSupported(const VkPhysicalDeviceFeatures& features) co
 bool Device::TestDepthStencilBlits() const {
     static constexpr VkFormatFeatureFlags required_features =
         VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
-    const auto test_features = [](VkFormatProperties props) {
+    // Queries the physical device directly instead of format_properties, which is still being
+    // populated asynchronously while the constructor runs.
+    const auto test_features = [this](VkFormat format) {
+        const VkFormatProperties props = physical.GetFormatProperties(format);
         return (props.optimalTilingFeatures & required_features) == required_features;
     };
-    return test_features(format_properties.at(VK_FORMAT_D32_SFLOAT_S8_UINT)) &&
-           test_features(format_properties.at(VK_FORMAT_D24_UNORM_S8_UINT));
+    return test_features(VK_FORMAT_D32_SFLOAT_S8_UINT) &&
+           test_features(VK_FORMAT_D24_UNORM_S8_UINT);
 }
 
 bool Device::IsFormatSupported(VkFormat wanted_format, VkFormatFeatureFlags wanted_usage,
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <bit>
+#include <chrono>
 #include <optional>
 #include <vector>
 
@@ -11,6 +12,7 @@
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/logging/log.h"
+#include "core/settings.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -20,6 +22,7 @@ namespace {
 struct Range {
     u64 begin;
     u64 end;
+    std::chrono::steady_clock::time_point birth; ///< Only filled when tracking is enabled.
 
     [[nodiscard]] bool Contains(u64 iterator, u64 size) const noexcept {
         return iterator < end && begin < iterator + size;
@@ -56,9 +59,11 @@ struct Range {
 class MemoryAllocation {
 public:
     explicit MemoryAllocation(const Device& device_, vk::DeviceMemory memory_,
-                              VkMemoryPropertyFlags properties, u64 allocation_size_, u32 type)
+                              VkMemoryPropertyFlags properties, u64 allocation_size_, u32 type,
+                              MemoryTypeStats* stats_)
         : device{device_}, memory{std::move(memory_)}, allocation_size{allocation_size_},
-          property_flags{properties}, shifted_memory_type{1U << type} {}
+          property_flags{properties}, memory_type{type}, shifted_memory_type{1U << type},
+          stats{stats_} {}
 
     [[nodiscard]] std::optional<MemoryCommit> Commit(VkDeviceSize size, VkDeviceSize alignment) {
         const std::optional<u64> alloc = FindFreeRegion(size, alignment);
@@ -69,14 +74,30 @@ public:
         const Range range{
             .begin = *alloc,
             .end = *alloc + size,
+            .birth = stats ? std::chrono::steady_clock::now()
+                           : std::chrono::steady_clock::time_point{},
         };
         commits.insert(std::ranges::upper_bound(commits, *alloc, {}, &Range::begin), range);
+        if (stats) {
+            stats->committed_bytes += size;
+            stats->peak_committed_bytes =
+                std::max(stats->peak_committed_bytes, stats->committed_bytes);
+            ++stats->total_commits;
+        }
         return std::make_optional<MemoryCommit>(this, *memory, *alloc, *alloc + size);
     }
 
     void Free(u64 begin) {
         const auto it = std::ranges::find(commits, begin, &Range::begin);
         ASSERT_MSG(it != commits.end(), "Invalid commit");
+        if (stats) {
+            stats->committed_bytes -= it->end - it->begin;
+            ++stats->freed_commits;
+            stats->total_lifetime_ns +=
+                static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now() - it->birth)
+                                     .count());
+        }
         commits.erase(it);
     }
 
@@ -93,6 +114,41 @@ public:
         return (flags & property_flags) && (type_mask & shifted_memory_type) != 0;
     }
 
+    /// Returns the memory type index of this allocation.
+    [[nodiscard]] u32 Type() const noexcept {
+        return memory_type;
+    }
+
+    /// Returns the size in bytes of the backing block.
+    [[nodiscard]] u64 AllocationSize() const noexcept {
+        return allocation_size;
+    }
+
+    /// Returns the number of bytes currently suballocated from this block.
+    [[nodiscard]] u64 CommittedBytes() const noexcept {
+        u64 bytes = 0;
+        for (const Range& commit : commits) {
+            bytes += commit.end - commit.begin;
+        }
+        return bytes;
+    }
+
+    /// Returns the number of live suballocations in this block.
+    [[nodiscard]] size_t NumActiveCommits() const noexcept {
+        return commits.size();
+    }
+
+    /// Returns the size in bytes of the largest free contiguous region of this block.
+    [[nodiscard]] u64 LargestFreeRegion() const noexcept {
+        u64 largest = 0;
+        u64 iterator = 0;
+        for (const Range& commit : commits) {
+            largest = std::max(largest, commit.begin - iterator);
+            iterator = commit.end;
+        }
+        return std::max(largest, allocation_size - iterator);
+    }
+
 private:
     [[nodiscard]] static constexpr u32 ShiftType(u32 type) {
         return 1U << type;
@@ -122,7 +178,9 @@ private:
     const vk::DeviceMemory memory;              ///< Vulkan memory allocation handler.
     const u64 allocation_size;                  ///< Size of this allocation.
     const VkMemoryPropertyFlags property_flags; ///< Vulkan memory property flags.
+    const u32 memory_type;                      ///< Vulkan memory type index.
     const u32 shifted_memory_type;              ///< Shifted Vulkan memory type.
+    MemoryTypeStats* const stats;               ///< Type statistics. Null when not tracking.
     std::vector<Range> commits;                 ///< All commit ranges done from this allocation.
     std::span<u8> memory_mapped_span; ///< Memory mapped span. Empty if not queried before.
 };
@@ -163,9 +221,19 @@ void MemoryCommit::Release() {
 }
 
 MemoryAllocator::MemoryAllocator(const Device& device_)
-    : device{device_}, properties{device_.GetPhysical().GetMemoryProperties()} {}
+    : device{device_}, properties{device_.GetPhysical().GetMemoryProperties()},
+      is_tracking_enabled{Settings::values.renderer_debug} {
+    for (u32 heap = 0; heap < properties.memoryHeapCount; ++heap) {
+        if ((properties.memoryHeaps[heap].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0) {
+            device_local_heap_size =
+                std::max(device_local_heap_size, properties.memoryHeaps[heap].size);
+        }
+    }
+}
 
-MemoryAllocator::~MemoryAllocator() = default;
+MemoryAllocator::~MemoryAllocator() {
+    DumpMemoryStatistics();
+}
 
 MemoryCommit MemoryAllocator::Commit(const VkMemoryRequirements& requirements, MemoryUsage usage) {
     // Find the fastest memory flags we can afford with the current requirements
@@ -202,8 +270,62 @@ void MemoryAllocator::AllocMemory(VkMemoryPropertyFlags flags, u32 type_mask, u6
         .allocationSize = size,
         .memoryTypeIndex = type,
     });
-    allocations.push_back(
-        std::make_unique<MemoryAllocation>(device, std::move(memory), flags, size, type));
+    allocations.push_back(std::make_unique<MemoryAllocation>(
+        device, std::move(memory), flags, size, type,
+        is_tracking_enabled ? &type_stats[type] : nullptr));
+    if (is_tracking_enabled) {
+        ++type_stats[type].block_count;
+        type_stats[type].block_bytes += size;
+    }
+
+    if ((flags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) != 0) {
+        device_local_reserved += size;
+        // Warn once when reservations approach the heap size; going past it is how we end up
+        // with device-lost from overcommit on small boards
+        if (!reported_overcommit && device_local_heap_size != 0 &&
+            device_local_reserved >= device_local_heap_size - device_local_heap_size / 10) {
+            reported_overcommit = true;
+            LOG_WARNING(Render_Vulkan,
+                        "Device-local reservation of {} MiB is within 10% of the {} MiB heap",
+                        device_local_reserved >> 20, device_local_heap_size >> 20);
+            DumpMemoryStatistics();
+        }
+    }
+}
+
+void MemoryAllocator::DumpMemoryStatistics() const {
+    if (!is_tracking_enabled) {
+        return;
+    }
+    for (size_t index = 0; index < allocations.size(); ++index) {
+        const MemoryAllocation& allocation = *allocations[index];
+        const u64 size = allocation.AllocationSize();
+        const u64 committed = allocation.CommittedBytes();
+        // One pair of collapsed stack lines per block, consumable by flame graph tooling
+        LOG_INFO(Render_Vulkan, "vkmem;type_{};block_{};committed {}", allocation.Type(), index,
+                 committed);
+        LOG_INFO(Render_Vulkan, "vkmem;type_{};block_{};free {}", allocation.Type(), index,
+                 size - committed);
+        LOG_INFO(Render_Vulkan,
+                 "Block {}: type={} size={} KiB committed={} KiB suballocations={} "
+                 "largest_free={} KiB",
+                 index, allocation.Type(), size >> 10, committed >> 10,
+                 allocation.NumActiveCommits(), allocation.LargestFreeRegion() >> 10);
+    }
+    for (u32 type = 0; type < properties.memoryTypeCount; ++type) {
+        const MemoryTypeStats& stats = type_stats[type];
+        if (stats.block_count == 0) {
+            continue;
+        }
+        const u64 avg_lifetime_us =
+            stats.freed_commits != 0 ? stats.total_lifetime_ns / stats.freed_commits / 1000 : 0;
+        LOG_INFO(Render_Vulkan,
+                 "Memory type {}: blocks={} ({} MiB) committed={} MiB peak={} MiB commits={} "
+                 "freed={} avg_lifetime={} us",
+                 type, stats.block_count, stats.block_bytes >> 20, stats.committed_bytes >> 20,
+                 stats.peak_committed_bytes >> 20, stats.total_commits, stats.freed_commits,
+                 avg_lifetime_us);
+    }
 }
 
 std::optional<MemoryCommit> MemoryAllocator::TryCommit(const VkMemoryRequirements& requirements,
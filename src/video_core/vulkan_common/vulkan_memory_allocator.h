@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <span>
 #include <utility>
@@ -24,6 +25,17 @@ enum class MemoryUsage {
     Download,    ///< Requires a host visible memory type optimized for GPU to CPU readbacks
 };
 
+/// Runtime statistics of one Vulkan memory type, recorded when allocation tracking is enabled
+struct MemoryTypeStats {
+    u64 block_count{};          ///< Number of VkDeviceMemory blocks allocated.
+    u64 block_bytes{};          ///< Total size in bytes of those blocks.
+    u64 committed_bytes{};      ///< Bytes currently suballocated.
+    u64 peak_committed_bytes{}; ///< High-water mark of committed_bytes.
+    u64 total_commits{};        ///< Suballocations made over the lifetime of the allocator.
+    u64 freed_commits{};        ///< Suballocations already released.
+    u64 total_lifetime_ns{};    ///< Accumulated lifetime of the freed suballocations.
+};
+
 /// Ownership handle of a memory commitment.
 /// Points to a subregion of a memory allocation.
 class MemoryCommit {
@@ -89,6 +101,20 @@ public:
     /// Commits memory required by the image and binds it.
     MemoryCommit Commit(const vk::Image& image, MemoryUsage usage);
 
+    /// Logs every memory block with its suballocation state in a collapsed flame-graph-compatible
+    /// format, followed by the per-type statistics. No-op unless tracking is enabled.
+    void DumpMemoryStatistics() const;
+
+    /// Returns the number of bytes currently reserved from device-local heaps
+    u64 GetDeviceLocalReservation() const noexcept {
+        return device_local_reserved;
+    }
+
+    /// Returns the size in bytes of the largest device-local heap
+    u64 GetDeviceLocalHeapSize() const noexcept {
+        return device_local_heap_size;
+    }
+
 private:
     /// Allocates a chunk of memory.
     void AllocMemory(VkMemoryPropertyFlags flags, u32 type_mask, u64 size);
@@ -108,7 +134,12 @@ private:
 
     const Device& device;                                       ///< Device handle.
     const VkPhysicalDeviceMemoryProperties properties;          ///< Physical device properties.
+    const bool is_tracking_enabled;                             ///< Whether stats are recorded.
     std::vector<std::unique_ptr<MemoryAllocation>> allocations; ///< Current allocations.
+    std::array<MemoryTypeStats, VK_MAX_MEMORY_TYPES> type_stats{}; ///< Per-type statistics.
+    u64 device_local_heap_size{};  ///< Size of the largest device-local heap.
+    u64 device_local_reserved{};   ///< Bytes reserved from device-local heaps.
+    bool reported_overcommit{};    ///< Whether the near-overcommit warning has been logged.
 };
 
 /// Returns true when a memory usage is guaranteed to be host visible.
@@ -485,6 +485,8 @@ void Config::ReadAudioValues() {
             ReadSetting(QStringLiteral("output_device"), QStringLiteral("auto"))
                 .toString()
                 .toStdString();
+        Settings::values.audio_stretching_quality = static_cast<Settings::AudioStretchingQuality>(
+            ReadSetting(QStringLiteral("audio_stretching_quality"), 1).toInt());
     }
     ReadSettingGlobal(Settings::values.enable_audio_stretching,
                       QStringLiteral("enable_audio_stretching"), true);
@@ -734,6 +736,9 @@ void Config::ReadPathValues() {
 void Config::ReadCpuValues() {
     qt_config->beginGroup(QStringLiteral("Cpu"));
 
+    ReadSettingGlobal(Settings::values.use_performance_core_affinity,
+                      QStringLiteral("use_performance_core_affinity"), true);
+
     if (global) {
         Settings::values.cpu_accuracy = static_cast<Settings::CPUAccuracy>(
             ReadSetting(QStringLiteral("cpu_accuracy"), 0).toInt());
@@ -754,6 +759,8 @@ void Config::ReadCpuValues() {
             ReadSetting(QStringLiteral("cpuopt_misc_ir"), true).toBool();
         Settings::values.cpuopt_reduce_misalign_checks =
             ReadSetting(QStringLiteral("cpuopt_reduce_misalign_checks"), true).toBool();
+        Settings::values.cpuopt_fastmem =
+            ReadSetting(QStringLiteral("cpuopt_fastmem"), true).toBool();
 
         Settings::values.cpuopt_unsafe_unfuse_fma =
             ReadSetting(QStringLiteral("cpuopt_unsafe_unfuse_fma"), true).toBool();
@@ -776,6 +783,8 @@ void Config::ReadRendererValues() {
     ReadSettingGlobal(Settings::values.max_anisotropy, QStringLiteral("max_anisotropy"), 0);
     ReadSettingGlobal(Settings::values.use_frame_limit, QStringLiteral("use_frame_limit"), true);
     ReadSettingGlobal(Settings::values.frame_limit, QStringLiteral("frame_limit"), 100);
+    ReadSettingGlobal(Settings::values.use_frame_pacing, QStringLiteral("use_frame_pacing"),
+                      false);
     ReadSettingGlobal(Settings::values.use_disk_shader_cache,
                       QStringLiteral("use_disk_shader_cache"), true);
     ReadSettingGlobal(Settings::values.gpu_accuracy, QStringLiteral("gpu_accuracy"), 0);
@@ -1150,6 +1159,8 @@ void Config::SaveAudioValues() {
         WriteSetting(QStringLiteral("output_device"),
                      QString::fromStdString(Settings::values.audio_device_id),
                      QStringLiteral("auto"));
+        WriteSetting(QStringLiteral("audio_stretching_quality"),
+                     static_cast<int>(Settings::values.audio_stretching_quality), 1);
     }
     WriteSettingGlobal(QStringLiteral("enable_audio_stretching"),
                        Settings::values.enable_audio_stretching, true);
@@ -1299,6 +1310,9 @@ void Config::SavePathValues() {
 void Config::SaveCpuValues() {
     qt_config->beginGroup(QStringLiteral("Cpu"));
 
+    WriteSettingGlobal(QStringLiteral("use_performance_core_affinity"),
+                       Settings::values.use_performance_core_affinity, true);
+
     if (global) {
         WriteSetting(QStringLiteral("cpu_accuracy"),
                      static_cast<int>(Settings::values.cpu_accuracy), 0);
@@ -1317,6 +1331,7 @@ void Config::SaveCpuValues() {
         WriteSetting(QStringLiteral("cpuopt_misc_ir"), Settings::values.cpuopt_misc_ir, true);
         WriteSetting(QStringLiteral("cpuopt_reduce_misalign_checks"),
                      Settings::values.cpuopt_reduce_misalign_checks, true);
+        WriteSetting(QStringLiteral("cpuopt_fastmem"), Settings::values.cpuopt_fastmem, true);
 
         WriteSetting(QStringLiteral("cpuopt_unsafe_unfuse_fma"),
                      Settings::values.cpuopt_unsafe_unfuse_fma, true);
@@ -1341,6 +1356,8 @@ void Config::SaveRendererValues() {
     WriteSettingGlobal(QStringLiteral("max_anisotropy"), Settings::values.max_anisotropy, 0);
     WriteSettingGlobal(QStringLiteral("use_frame_limit"), Settings::values.use_frame_limit, true);
     WriteSettingGlobal(QStringLiteral("frame_limit"), Settings::values.frame_limit, 100);
+    WriteSettingGlobal(QStringLiteral("use_frame_pacing"), Settings::values.use_frame_pacing,
+                       false);
     WriteSettingGlobal(QStringLiteral("use_disk_shader_cache"),
                        Settings::values.use_disk_shader_cache, true);
     WriteSettingGlobal(QStringLiteral("gpu_accuracy"),
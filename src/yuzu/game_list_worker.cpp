@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <utility>
@@ -63,10 +64,18 @@ QString GetGameListCachedObject(const std::string& filename, const std::string&
     return generator();
 }
 
+/// Returns a stamp identifying the current contents of a file, for cache invalidation.
+/// Changed files get a new stamp from their size and modification time.
+std::string MakeCacheStamp(const std::string& path, std::size_t size) {
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(std::filesystem::path{path}, ec);
+    return fmt::format("{:x}-{:x}", size, ec ? 0 : mtime.time_since_epoch().count());
+}
+
 std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
-    const std::string& filename, const std::string& ext,
+    const std::string& filename, const std::string& stamp,
     const std::function<std::pair<std::vector<u8>, std::string>()>& generator) {
-    if (!UISettings::values.cache_game_list || filename == "0000000000000000") {
+    if (!UISettings::values.cache_game_list || filename.starts_with("0000000000000000")) {
         return generator();
     }
 
@@ -74,10 +83,19 @@ std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
                        "game_list" + DIR_SEP + filename + ".jpeg";
     const auto path2 = Common::FS::GetUserPath(Common::FS::UserPath::CacheDir) + DIR_SEP +
                        "game_list" + DIR_SEP + filename + ".appname.txt";
+    const auto path3 = Common::FS::GetUserPath(Common::FS::UserPath::CacheDir) + DIR_SEP +
+                       "game_list" + DIR_SEP + filename + ".stamp.txt";
 
     Common::FS::CreateFullPath(path1);
 
-    if (!Common::FS::Exists(path1) || !Common::FS::Exists(path2)) {
+    // An entry is stale when the stamp of the file it was generated from no longer matches
+    bool stale = false;
+    if (!stamp.empty()) {
+        QFile stamp_file{QString::fromStdString(path3)};
+        stale = !stamp_file.open(QFile::ReadOnly) || stamp_file.readAll().toStdString() != stamp;
+    }
+
+    if (!Common::FS::Exists(path1) || !Common::FS::Exists(path2) || stale) {
         const auto [icon, nacp] = generator();
 
         QFile file1{QString::fromStdString(path1)};
@@ -102,6 +120,13 @@ std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
             file2.write(nacp.data(), nacp.size());
         }
 
+        if (!stamp.empty()) {
+            QFile stamp_file{QString::fromStdString(path3)};
+            if (stamp_file.open(QFile::WriteOnly)) {
+                stamp_file.write(stamp.data(), stamp.size());
+            }
+        }
+
         return std::make_pair(icon, nacp);
     }
 
@@ -330,11 +355,19 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
                     }
                 }
             } else {
-                std::vector<u8> icon;
-                [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                std::string name = " ";
-                [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
+                // Key the cached icon and name by title id and path, invalidated by a stamp of
+                // the file contents, so unchanged files skip the icon extraction on refreshes
+                const auto path_hash = std::hash<std::string>{}(physical_name);
+                const auto [icon, name] = GetGameListCachedObject(
+                    fmt::format("{:016X}-{:08X}", program_id, static_cast<u32>(path_hash)),
+                    MakeCacheStamp(physical_name, file->GetSize()), [&loader] {
+                        std::vector<u8> icon_data;
+                        [[maybe_unused]] const auto res1 = loader->ReadIcon(icon_data);
+
+                        std::string title = " ";
+                        [[maybe_unused]] const auto res3 = loader->ReadTitle(title);
+                        return std::make_pair(std::move(icon_data), std::move(title));
+                    });
 
                 const FileSys::PatchManager patch{program_id, system.GetFileSystemController(),
                                                   system.GetContentProvider()};
@@ -369,6 +369,10 @@ void Config::ReadValues() {
     Settings::values.use_multi_core.SetValue(
         sdl2_config->GetBoolean("Core", "use_multi_core", true));
 
+    // Cpu
+    Settings::values.use_performance_core_affinity.SetValue(
+        sdl2_config->GetBoolean("Cpu", "use_performance_core_affinity", true));
+
     // Renderer
     const int renderer_backend = sdl2_config->GetInteger(
         "Renderer", "backend", static_cast<int>(Settings::RendererBackend::OpenGL));
@@ -386,6 +390,8 @@ void Config::ReadValues() {
         sdl2_config->GetBoolean("Renderer", "use_frame_limit", true));
     Settings::values.frame_limit.SetValue(
         static_cast<u16>(sdl2_config->GetInteger("Renderer", "frame_limit", 100)));
+    Settings::values.use_frame_pacing.SetValue(
+        sdl2_config->GetBoolean("Renderer", "use_frame_pacing", false));
     Settings::values.use_disk_shader_cache.SetValue(
         sdl2_config->GetBoolean("Renderer", "use_disk_shader_cache", false));
     const int gpu_accuracy_level = sdl2_config->GetInteger("Renderer", "gpu_accuracy", 0);
@@ -414,6 +420,8 @@ void Config::ReadValues() {
     Settings::values.sink_id = sdl2_config->Get("Audio", "output_engine", "auto");
     Settings::values.enable_audio_stretching.SetValue(
         sdl2_config->GetBoolean("Audio", "enable_audio_stretching", true));
+    Settings::values.audio_stretching_quality = static_cast<Settings::AudioStretchingQuality>(
+        sdl2_config->GetInteger("Audio", "audio_stretching_quality", 1));
     Settings::values.audio_device_id = sdl2_config->Get("Audio", "output_device", "auto");
     Settings::values.volume.SetValue(
         static_cast<float>(sdl2_config->GetReal("Audio", "volume", 1)));
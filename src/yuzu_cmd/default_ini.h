@@ -106,6 +106,10 @@ udp_pad_index=
 use_multi_core=
 
 [Cpu]
+# Pin emulation threads to performance cores on heterogeneous (P/E core) host CPUs
+# 0: Disabled, 1 (default): Enabled
+use_performance_core_affinity =
+
 # Enable inline page tables optimization (faster guest memory access)
 # 0: Disabled, 1 (default): Enabled
 cpuopt_page_tables =
@@ -138,6 +142,10 @@ cpuopt_misc_ir =
 # 0: Disabled, 1 (default): Enabled
 cpuopt_reduce_misalign_checks =
 
+# Enable Host MMU Emulation (faster guest memory access)
+# 0: Disabled, 1 (default): Enabled
+cpuopt_fastmem =
+
 [Renderer]
 # Which backend API to use.
 # 0 (default): OpenGL, 1: Vulkan
@@ -186,6 +194,10 @@ use_frame_limit =
 # 1 - 9999: Speed limit as a percentage of target game speed. 100 (default)
 frame_limit =
 
+# Paces frame release to the predicted display cadence to reduce judder
+# 0: Off (default), 1: On
+use_frame_pacing =
+
 # Whether to use disk based shader cache
 # 0 (default): Off, 1 : On
 use_disk_shader_cache =
@@ -245,6 +257,10 @@ output_engine =
 # 0: No, 1 (default): Yes
 enable_audio_stretching =
 
+# Quality/latency trade-off of the audio-stretching effect.
+# 0: Fast, 1 (default): Balanced, 2: High
+audio_stretching_quality =
+
 # Which audio device to use.
 # auto (default): Auto-select
 output_device =
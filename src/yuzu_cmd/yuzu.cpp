@@ -3,11 +3,13 @@
 // Refer to the license.txt file included.
 
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <thread>
 
+#include <fmt/format.h>
 #include <fmt/ostream.h>
 
 #include "common/common_paths.h"
@@ -18,17 +20,20 @@
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/nvidia_flags.h"
+#include "common/perf_counters.h"
 #include "common/scm_rev.h"
 #include "common/scope_exit.h"
 #include "common/string_util.h"
 #include "common/telemetry.h"
 #include "core/core.h"
+#include "core/core_timing.h"
 #include "core/crypto/key_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/vfs_real.h"
 #include "core/hle/kernel/process.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "core/telemetry_session.h"
 #include "input_common/main.h"
@@ -63,6 +68,8 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 static void PrintHelp(const char* argv0) {
     std::cout << "Usage: " << argv0
               << " [options] <filename>\n"
+                 "-b, --bench=FRAMES    Run the given number of guest frames against a hidden\n"
+                 "                      window, print statistics as JSON and exit\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
                  "-h, --help            Display this help and exit\n"
                  "-v, --version         Output version information and exit\n"
@@ -73,6 +80,45 @@ static void PrintVersion() {
     std::cout << "yuzu " << Common::g_scm_branch << " " << Common::g_scm_desc << std::endl;
 }
 
+/// Prints the benchmark run statistics to stdout as a single JSON object
+static void PrintBenchResults(Core::System& system) {
+    auto& perf_stats = system.GetPerfStats();
+    const u64 title_id = system.CurrentProcess()->GetTitleID();
+    const u64 game_frames = perf_stats.GetTotalGameFrames();
+    const double mean_frametime = perf_stats.GetMeanFrametime();
+    const Core::FrametimePercentiles percentiles = perf_stats.GetFrametimePercentiles();
+    // Nothing in this frontend resets the stats while the benchmark runs, so this covers the
+    // whole session.
+    const Core::PerfStatsResults results =
+        perf_stats.GetAndResetStats(system.CoreTiming().GetGlobalTimeUs());
+
+    std::string counters;
+    for (std::size_t i = 0; i < Common::NumPerfCounters; ++i) {
+        counters += fmt::format("{}\n    \"{}\": {}", i == 0 ? "" : ",",
+                                Common::GetPerfCounterName(static_cast<Common::PerfCounter>(i)),
+                                results.counters[i]);
+    }
+    fmt::print("{{\n"
+               "  \"title_id\": \"{:016X}\",\n"
+               "  \"game_frames\": {},\n"
+               "  \"game_fps\": {:.3f},\n"
+               "  \"system_fps\": {:.3f},\n"
+               "  \"emulation_speed\": {:.4f},\n"
+               "  \"mean_frametime_ms\": {:.4f},\n"
+               "  \"frametime_percentiles_ms\": {{\n"
+               "    \"p50\": {:.4f},\n"
+               "    \"p90\": {:.4f},\n"
+               "    \"p95\": {:.4f},\n"
+               "    \"p99\": {:.4f}\n"
+               "  }},\n"
+               "  \"audio_underruns\": {},\n"
+               "  \"counters\": {{{}\n  }}\n"
+               "}}\n",
+               title_id, game_frames, results.game_fps, results.system_fps,
+               results.emulation_speed, mean_frametime, percentiles.p50, percentiles.p90,
+               percentiles.p95, percentiles.p99, results.audio_underruns, counters);
+}
+
 static void InitializeLogging() {
     Log::Filter log_filter(Log::Level::Debug);
     log_filter.ParseFilterString(Settings::values.log_filter);
@@ -108,8 +154,10 @@ int main(int argc, char** argv) {
     std::string filepath;
 
     bool fullscreen = false;
+    u64 bench_frames = 0;
 
     static struct option long_options[] = {
+        {"bench", required_argument, 0, 'b'},
         {"fullscreen", no_argument, 0, 'f'},
         {"help", no_argument, 0, 'h'},
         {"version", no_argument, 0, 'v'},
@@ -118,9 +166,16 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvp::", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "b:g:fhvp::", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
+            case 'b':
+                bench_frames = std::strtoull(optarg, nullptr, 0);
+                if (bench_frames == 0) {
+                    LOG_CRITICAL(Frontend, "Invalid benchmark frame count: {}", optarg);
+                    return -1;
+                }
+                break;
             case 'f':
                 fullscreen = true;
                 LOG_INFO(Frontend, "Starting in fullscreen mode...");
@@ -166,13 +221,15 @@ int main(int argc, char** argv) {
     // Apply the command line arguments
     Settings::Apply(system);
 
+    const bool bench = bench_frames != 0;
+
     std::unique_ptr<EmuWindow_SDL2> emu_window;
     switch (Settings::values.renderer_backend.GetValue()) {
     case Settings::RendererBackend::OpenGL:
-        emu_window = std::make_unique<EmuWindow_SDL2_GL>(&input_subsystem, fullscreen);
+        emu_window = std::make_unique<EmuWindow_SDL2_GL>(&input_subsystem, fullscreen, bench);
         break;
     case Settings::RendererBackend::Vulkan:
-        emu_window = std::make_unique<EmuWindow_SDL2_VK>(&input_subsystem);
+        emu_window = std::make_unique<EmuWindow_SDL2_VK>(&input_subsystem, bench);
         break;
     }
 
@@ -220,10 +277,22 @@ int main(int argc, char** argv) {
         [](VideoCore::LoadCallbackStage, size_t value, size_t total) {});
 
     void(system.Run());
-    while (emu_window->IsOpen()) {
-        emu_window->WaitEvent();
+    if (bench) {
+        // Headless benchmark: the hidden window receives no events, so poll the frame counter
+        // instead of blocking on SDL until the requested number of guest frames has run.
+        auto& perf_stats = system.GetPerfStats();
+        while (emu_window->IsOpen() && perf_stats.GetTotalGameFrames() < bench_frames) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    } else {
+        while (emu_window->IsOpen()) {
+            emu_window->WaitEvent();
+        }
     }
     void(system.Pause());
+    if (bench) {
+        PrintBenchResults(system);
+    }
     system.Shutdown();
 
     detached_tasks.WaitForAllTasks();